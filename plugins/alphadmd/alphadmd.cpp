@@ -264,7 +264,7 @@ static void onGetRenderDMD(const unsigned int eventId, void* userData, void* msg
       return;
 
    GetSegMsg getSegMsg { { segSources.entries[0].id.endpointId, segSources.entries[0].id.resId } };
-   msgApi->BroadcastMsg(endpointId, getSegId, &getSegMsg);
+   msgApi->SendResMsg(endpointId, getSegId, getSegMsg.segId.id, &getSegMsg);
    if (getSegMsg.frame == nullptr)
       return;
    float* lum = getSegMsg.frame;
@@ -386,7 +386,7 @@ static void onGetIdentifyDMD(const unsigned int eventId, void* userData, void* m
 
    // Gather data and convert to a backward compatible bitset
    GetSegMsg getSegMsg { { segSources.entries[0].id.endpointId, segSources.entries[0].id.resId } };
-   msgApi->BroadcastMsg(endpointId, getSegId, &getSegMsg);
+   msgApi->SendResMsg(endpointId, getSegId, getSegMsg.segId.id, &getSegMsg);
    if (getSegMsg.frame == nullptr)
       return;
    const float* lum = getSegMsg.frame;
@@ -60,8 +60,6 @@ void FlexDMD::Render()
    Uint64 elapsedMs = tick - m_lastRenderTick;
    if ((m_renderLockCount == 0) && elapsedMs > 2)
    {
-      m_frameId++;
-      m_lum8FrameDirty = m_lumFrameDirty = m_rgbFrameDirty = m_rgbaFrameDirty = true;
       m_lastRenderTick = tick;
       m_pStage->Update((float)(elapsedMs / 1000.0));
       if (m_pSurface == nullptr)
@@ -69,31 +67,66 @@ void FlexDMD::Render()
          SDL_Surface* pSurface = SDL_CreateSurface(m_width, m_height, SDL_PIXELFORMAT_RGB24);
          m_pSurface = new VP::SurfaceGraphics(pSurface);
       }
+      // Nothing changed in the scene since last render: keep the previous frame (and frame id)
+      if (!m_lastFrame.empty() && (m_sceneRevision == m_renderedRevision))
+         return;
       if (m_clear)
       {
          m_pSurface->SetColor(RGB(0, 0, 0));
          m_pSurface->Clear();
       }
       m_pStage->Draw(m_pSurface);
+      // Drawing may adjust the layout of some actors (overlays, sequence frames), this does not need another render
+      m_renderedRevision = m_sceneRevision;
+
+      // Identify the damaged rows against the last rendered frame, so that only these get converted
+      SDL_Surface* surf = m_pSurface->GetSurface();
+      const int rowSize = m_width * 3;
+      int top = 0, bottom = m_height;
+      SDL_LockSurface(surf);
+      const uint8_t* const pixels = static_cast<uint8_t*>(surf->pixels);
+      if (m_lastFrame.empty())
+         m_lastFrame.assign(pixels, pixels + m_height * rowSize);
+      else
+      {
+         while (top < bottom && memcmp(pixels + top * rowSize, m_lastFrame.data() + top * rowSize, rowSize) == 0)
+            top++;
+         while (bottom > top && memcmp(pixels + (bottom - 1) * rowSize, m_lastFrame.data() + (bottom - 1) * rowSize, rowSize) == 0)
+            bottom--;
+         memcpy(m_lastFrame.data() + top * rowSize, pixels + top * rowSize, (bottom - top) * rowSize);
+      }
+      SDL_UnlockSurface(surf);
+      if (top < bottom)
+      {
+         m_frameId++;
+         m_lum8FrameDirty.Add(top, bottom);
+         m_lumFrameDirty.Add(top, bottom);
+         m_rgbFrameDirty.Add(top, bottom);
+         m_rgbaFrameDirty.Add(top, bottom);
+      }
    }
 }
 
 uint8_t* FlexDMD::UpdateLum8Frame()
 {
-   if ((m_lum8Frame != nullptr) && !m_lum8FrameDirty)
+   if ((m_lum8Frame != nullptr) && m_lum8FrameDirty.IsEmpty())
       return m_lum8Frame;
    if (m_lum8Frame == nullptr)
+   {
       m_lum8Frame = new uint8_t[m_width * m_height];
+      m_lum8FrameDirty.Add(0, m_height);
+   }
    if (m_pSurface == nullptr)
       return m_lum8Frame;
    if (m_renderLockCount > 0)
       return m_lum8Frame;
-   m_lum8FrameDirty = false;
+   const int top = m_lum8FrameDirty.top, bottom = m_lum8FrameDirty.bottom;
+   m_lum8FrameDirty.Clear();
    SDL_Surface* surf = m_pSurface->GetSurface();
    SDL_LockSurface(surf);
-   const uint8_t* __restrict pixels = static_cast<uint8_t*>(surf->pixels);
-   uint8_t* __restrict dst = m_lum8Frame;
-   for (int o = 0; o < m_height*m_width; o++)
+   const uint8_t* __restrict pixels = static_cast<uint8_t*>(surf->pixels) + top * m_width * 3;
+   uint8_t* __restrict dst = m_lum8Frame + top * m_width;
+   for (int o = top * m_width; o < bottom * m_width; o++)
       {
          float r = static_cast<float>(*pixels++);
          float g = static_cast<float>(*pixels++);
@@ -106,21 +139,25 @@ uint8_t* FlexDMD::UpdateLum8Frame()
 
 void FlexDMD::UpdateLumFrame()
 {
-   if (!m_lumFrame.empty() && !m_lumFrameDirty)
+   if (!m_lumFrame.empty() && m_lumFrameDirty.IsEmpty())
       return;
    if (m_lumFrame.empty())
+   {
       m_lumFrame.resize(m_width * m_height);
+      m_lumFrameDirty.Add(0, m_height);
+   }
    if (m_pSurface == nullptr)
       return;
    if (m_renderLockCount > 0)
       return;
-   m_lumFrameDirty = false;
+   const int top = m_lumFrameDirty.top, bottom = m_lumFrameDirty.bottom;
+   m_lumFrameDirty.Clear();
    UpdateLum8Frame();
-   const uint8_t* __restrict src = m_lum8Frame;
-   uint8_t* __restrict dst = m_lumFrame.data();
+   const uint8_t* __restrict src = m_lum8Frame + top * m_width;
+   uint8_t* __restrict dst = m_lumFrame.data() + top * m_width;
    static constexpr uint8_t lum4[] = { 0, 85, 170, 255 };
    static constexpr uint8_t lum16[] = { 0, 17, 34, 51, 68, 85, 102, 119, 136, 153, 170, 187, 204, 221, 238, 255 };
-   for (int o = 0; o < m_height*m_width; o++)
+   for (int o = top * m_width; o < bottom * m_width; o++)
          if (m_renderMode == RenderMode_DMD_GRAY_2)
             *dst++ = lum4[(*src++) >> 6];
          else if (m_renderMode == RenderMode_DMD_GRAY_4)
@@ -129,38 +166,46 @@ void FlexDMD::UpdateLumFrame()
 
 uint8_t* FlexDMD::UpdateRGBFrame()
 {
-   if ((m_rgbFrame != nullptr) && !m_rgbFrameDirty)
+   if ((m_rgbFrame != nullptr) && m_rgbFrameDirty.IsEmpty())
       return m_rgbFrame;
    if (m_rgbFrame == nullptr)
+   {
       m_rgbFrame = new uint8_t[m_width * m_height * 3];
+      m_rgbFrameDirty.Add(0, m_height);
+   }
    if (m_pSurface == nullptr)
       return m_rgbFrame;
    if (m_renderLockCount > 0)
       return m_rgbFrame;
-   m_rgbFrameDirty = false;
+   const int rowSize = m_width * 3;
    SDL_Surface* surf = m_pSurface->GetSurface();
    SDL_LockSurface(surf);
-   memcpy(m_rgbFrame, static_cast<uint8_t*>(surf->pixels), m_width * m_height * 3);
+   memcpy(m_rgbFrame + m_rgbFrameDirty.top * rowSize, static_cast<uint8_t*>(surf->pixels) + m_rgbFrameDirty.top * rowSize, (m_rgbFrameDirty.bottom - m_rgbFrameDirty.top) * rowSize);
+   m_rgbFrameDirty.Clear();
    SDL_UnlockSurface(surf);
    return m_rgbFrame;
 }
 
 void FlexDMD::UpdateRGBAFrame()
 {
-   if (!m_rgbaFrame.empty() && !m_rgbaFrameDirty)
+   if (!m_rgbaFrame.empty() && m_rgbaFrameDirty.IsEmpty())
       return;
    if (m_rgbaFrame.empty())
+   {
       m_rgbaFrame.resize(m_width * m_height);
+      m_rgbaFrameDirty.Add(0, m_height);
+   }
    if (m_pSurface == nullptr)
       return;
    if (m_renderLockCount > 0)
       return;
-   m_rgbaFrameDirty = false;
+   const int top = m_rgbaFrameDirty.top, bottom = m_rgbaFrameDirty.bottom;
+   m_rgbaFrameDirty.Clear();
    SDL_Surface* surf = m_pSurface->GetSurface();
    SDL_LockSurface(surf);
-   const uint8_t* __restrict pixels = static_cast<uint8_t*>(surf->pixels);
-   uint32_t* __restrict dst = m_rgbaFrame.data();
-   for (int o = 0; o < m_height*m_width; o++)
+   const uint8_t* __restrict pixels = static_cast<uint8_t*>(surf->pixels) + top * m_width * 3;
+   uint32_t* __restrict dst = m_rgbaFrame.data() + top * m_width;
+   for (int o = top * m_width; o < bottom * m_width; o++)
       {
          uint8_t r = *pixels++;
          uint8_t g = *pixels++;
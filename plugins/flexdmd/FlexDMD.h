@@ -69,7 +69,7 @@ public:
    void SetProjectFolder(const string& folder) { m_pAssetManager->SetBasePath(folder); }
 
    bool GetClear() const { return m_clear; }
-   void SetClear(bool v) { m_clear = v; }
+   void SetClear(bool v) { if (m_clear != v) { m_clear = v; MarkDirty(); } }
 
    void Render();
    const std::vector<uint32_t>& GetDmdColoredPixels();
@@ -108,6 +108,10 @@ public:
    const uint16_t* GetSegFrame() const { return m_segData; }
    unsigned int GetFrameId() const { return m_frameId; }
 
+   // Called by actors (and direct surface drawing) when something affecting the rendered frame changed.
+   // Render skips drawing the stage altogether as long as the scene revision is left unchanged.
+   void MarkDirty() const { m_sceneRevision++; }
+
 private:
    void (*m_onDMDChangedHandler)(FlexDMD*) = nullptr;
    void (*m_onDestroyHandler)(FlexDMD*) = nullptr;
@@ -124,21 +128,45 @@ private:
       delete[] m_lum8Frame; m_lum8Frame = nullptr;
       m_rgbaFrame.clear();
       m_lumFrame.clear();
+      m_lastFrame.clear();
+      m_rgbFrameDirty.Clear();
+      m_rgbaFrameDirty.Clear();
+      m_lum8FrameDirty.Clear();
+      m_lumFrameDirty.Clear();
    }
 
+   // Span of rows [top, bottom) that were modified since a converted frame was last updated
+   struct DirtyRows
+   {
+      int top = 0;
+      int bottom = 0;
+      bool IsEmpty() const { return top >= bottom; }
+      void Add(int t, int b)
+      {
+         if (IsEmpty()) { top = t; bottom = b; }
+         else { top = min(top, t); bottom = max(bottom, b); }
+      }
+      void Clear() { top = bottom = 0; }
+   };
+
+   // Copy of the last rendered surface, used to find the rows actually damaged by a render
+   std::vector<uint8_t> m_lastFrame;
+   mutable unsigned int m_sceneRevision = 0;
+   unsigned int m_renderedRevision = 0;
+
    uint8_t* m_rgbFrame = nullptr;
-   bool m_rgbFrameDirty = true;
+   DirtyRows m_rgbFrameDirty;
 
    void UpdateRGBAFrame();
    std::vector<uint32_t> m_rgbaFrame;
-   bool m_rgbaFrameDirty = true;
+   DirtyRows m_rgbaFrameDirty;
 
    uint8_t* m_lum8Frame = nullptr;
-   bool m_lum8FrameDirty = true;
+   DirtyRows m_lum8FrameDirty;
 
    void UpdateLumFrame();
    std::vector<uint8_t> m_lumFrame;
-   bool m_lumFrameDirty = true;
+   DirtyRows m_lumFrameDirty;
 
    string m_szGameName;
    Uint64 m_lastRenderTick = 0;
@@ -1,7 +1,52 @@
 #include "SurfaceGraphics.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+ #define FLEXDMD_SSE2
+ #include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+ #define FLEXDMD_NEON
+ #include <arm_neon.h>
+#endif
+
 namespace VP {
 
+// dst = color + dst * invAlpha / 255, with color premultiplied by alpha. As color and alpha are replicated
+// per channel, blending does not depend on the pixel layout and is performed on plain byte runs.
+static void BlendPremultipliedRow(uint8_t* __restrict dst, const uint8_t* __restrict color, const uint8_t* __restrict invAlpha, const int size)
+{
+   int i = 0;
+#if defined(FLEXDMD_SSE2)
+   const __m128i zero = _mm_setzero_si128();
+   const __m128i half = _mm_set1_epi16(128);
+   for (; i + 16 <= size; i += 16)
+   {
+      const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+      const __m128i ia = _mm_loadu_si128(reinterpret_cast<const __m128i*>(invAlpha + i));
+      __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), _mm_unpacklo_epi8(ia, zero)), half);
+      __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), _mm_unpackhi_epi8(ia, zero)), half);
+      lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+      hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+      const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(color + i));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_adds_epu8(_mm_packus_epi16(lo, hi), c));
+   }
+#elif defined(FLEXDMD_NEON)
+   for (; i + 16 <= size; i += 16)
+   {
+      const uint8x16_t d = vld1q_u8(dst + i);
+      const uint8x16_t ia = vld1q_u8(invAlpha + i);
+      const uint16x8_t lo = vmull_u8(vget_low_u8(d), vget_low_u8(ia));
+      const uint16x8_t hi = vmull_u8(vget_high_u8(d), vget_high_u8(ia));
+      const uint8x16_t r = vcombine_u8(vraddhn_u16(lo, vrshrq_n_u16(lo, 8)), vraddhn_u16(hi, vrshrq_n_u16(hi, 8)));
+      vst1q_u8(dst + i, vqaddq_u8(r, vld1q_u8(color + i)));
+   }
+#endif
+   for (; i < size; i++)
+   {
+      const unsigned int v = dst[i] * invAlpha[i] + 128;
+      dst[i] = static_cast<uint8_t>(min(color[i] + ((v + (v >> 8)) >> 8), 255u));
+   }
+}
+
 SurfaceGraphics::SurfaceGraphics(SDL_Surface* pSurface)
 {
    m_pSurface = pSurface;
@@ -36,6 +81,29 @@ void SurfaceGraphics::DrawImage(SDL_Surface* pImage, SDL_Rect* pSrcRect, SDL_Rec
    SDL_BlitSurfaceScaled(pImage, pSrcRect, m_pSurface, &rect, SDL_SCALEMODE_NEAREST);
 }
 
+void SurfaceGraphics::DrawPremultipliedImage(const uint8_t* pColor, const uint8_t* pInvAlpha, int w, int h, int x, int y)
+{
+   assert(m_pSurface->format == SDL_PIXELFORMAT_RGB24);
+   SDL_Rect clip;
+   SDL_GetSurfaceClipRect(m_pSurface, &clip);
+   x += m_translateX;
+   y += m_translateY;
+   const int x0 = max(x, clip.x);
+   const int y0 = max(y, clip.y);
+   const int x1 = min(x + w, clip.x + clip.w);
+   const int y1 = min(y + h, clip.y + clip.h);
+   if (x0 >= x1 || y0 >= y1)
+      return;
+   const int srcPitch = w * 3;
+   const int srcOffset = (y0 - y) * srcPitch + (x0 - x) * 3;
+   const int rowSize = (x1 - x0) * 3;
+   SDL_LockSurface(m_pSurface);
+   uint8_t* dst = static_cast<uint8_t*>(m_pSurface->pixels) + y0 * m_pSurface->pitch + x0 * 3;
+   for (int row = 0; row < y1 - y0; row++, dst += m_pSurface->pitch)
+      BlendPremultipliedRow(dst, pColor + srcOffset + row * srcPitch, pInvAlpha + srcOffset + row * srcPitch, rowSize);
+   SDL_UnlockSurface(m_pSurface);
+}
+
 void SurfaceGraphics::FillRectangle(const SDL_Rect& rect)
 {
    SDL_Rect dstRect = { rect.x + m_translateX, rect.y + m_translateY, rect.w, rect.h };
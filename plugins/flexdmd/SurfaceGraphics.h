@@ -13,6 +13,8 @@ public:
    void Clear();
    void SetColor(ColorRGBA32 color, uint8_t alpha = 255);
    void DrawImage(SDL_Surface* pImage, SDL_Rect* pSrcRect, SDL_Rect* pDstRect);
+   // Alpha blend an image given as premultiplied RGB24 color and 255-alpha replicated for each channel (both with a pitch of 3 * w) on a RGB24 surface
+   void DrawPremultipliedImage(const uint8_t* pColor, const uint8_t* pInvAlpha, int w, int h, int x, int y);
    void FillRectangle(const SDL_Rect& rect);
    void SetClip(const SDL_Rect& rect);
    void ResetClip();
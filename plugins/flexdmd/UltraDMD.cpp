@@ -74,6 +74,7 @@ void UltraDMD::Clear()
    VP::SurfaceGraphics* pGraphics = m_pFlexDMD->GetGraphics();
    pGraphics->SetColor(RGB(0, 0, 0));
    pGraphics->Clear();
+   m_pFlexDMD->MarkDirty();
    m_pScoreBoard->SetVisible(false);
    if (m_pQueue->IsFinished())
       m_pQueue->SetVisible(false);
@@ -356,6 +357,7 @@ void UltraDMD::DisplayText(const string& text, int textBrightness, int textOutli
       Label* pLabel = GetFittedLabel(text, textBrightness / 15.0f, textOutlineBrightness / 15.0f);
       pLabel->Draw(m_pFlexDMD->GetGraphics());
       delete pLabel;
+      m_pFlexDMD->MarkDirty();
    }
 }
 
@@ -38,6 +38,12 @@ void Actor::ClearActions()
    m_actions.clear();
 }
 
+void Actor::MarkDirty() const
+{
+   if (m_pFlexDMD)
+      m_pFlexDMD->MarkDirty();
+}
+
 void Actor::Remove()
 {
    if (m_parent != nullptr)
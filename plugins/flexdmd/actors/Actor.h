@@ -36,37 +36,37 @@ public:
    void SetName(const string &szName) { m_name = szName; }
    const string &GetName() const { return m_name; }
    
-   void SetBounds(float x, float y, float Width, float Height) { m_x = x; m_y = y; m_width = Width; m_height = Height; }
-   void SetPosition(float x, float y) { m_x = x; m_y = y; }
-   void SetAlignedPosition(float x, float y, Alignment alignment) { m_x = x; m_y = y; Layout::ApplyAlign(alignment, m_width, m_height, m_x, m_y); }
+   void SetBounds(float x, float y, float Width, float Height) { SetPosition(x, y); SetSize(Width, Height); }
+   void SetPosition(float x, float y) { SetX(x); SetY(y); }
+   void SetAlignedPosition(float x, float y, Alignment alignment) { Layout::ApplyAlign(alignment, m_width, m_height, x, y); SetPosition(x, y); }
 
-   void SetSize(float Width, float Height) { m_width = Width; m_height = Height; }
-   void Pack() { m_width = GetPrefWidth(); m_height = GetPrefHeight(); }
+   void SetSize(float Width, float Height) { SetWidth(Width); SetHeight(Height); }
+   void Pack() { SetSize(GetPrefWidth(), GetPrefHeight()); }
    float GetX() const { return m_x; }
-   void SetX(float x) { m_x = x; }
+   void SetX(float x) { if (m_x != x) { m_x = x; MarkDirty(); } }
    float GetY() const { return m_y; }
-   void SetY(float y) { m_y = y; }
+   void SetY(float y) { if (m_y != y) { m_y = y; MarkDirty(); } }
    float GetWidth() const { return m_width; }
-   void SetWidth(float width) { m_width = width; }
+   void SetWidth(float width) { if (m_width != width) { m_width = width; MarkDirty(); } }
    float GetHeight() const { return m_height; }
-   void SetHeight(float height) { m_height = height; }
+   void SetHeight(float height) { if (m_height != height) { m_height = height; MarkDirty(); } }
    virtual float GetPrefWidth() const { return m_prefWidth; }
-   void SetPrefWidth(float prefWidth) { m_prefWidth = prefWidth; }
+   void SetPrefWidth(float prefWidth) { if (m_prefWidth != prefWidth) { m_prefWidth = prefWidth; MarkDirty(); } }
    virtual float GetPrefHeight() const { return m_prefHeight; }
-   void SetPrefHeight(float prefHeight) { m_prefHeight = prefHeight; }
+   void SetPrefHeight(float prefHeight) { if (m_prefHeight != prefHeight) { m_prefHeight = prefHeight; MarkDirty(); } }
    
    ActionFactory* GetActionFactory() const;
    void AddAction(Action *action);
    void ClearActions();
 
    bool GetVisible() const { return m_visible; }
-   virtual void SetVisible(bool visible) { m_visible = visible; }
+   virtual void SetVisible(bool visible) { if (m_visible != visible) { m_visible = visible; MarkDirty(); } }
 
    bool GetClearBackground() const { return m_clearBackground; };
-   void SetClearBackground(bool v) { m_clearBackground = v; }
+   void SetClearBackground(bool v) { if (m_clearBackground != v) { m_clearBackground = v; MarkDirty(); } }
 
    bool GetOnStage() const { return m_onStage; }
-   void SetOnStage(bool onStage) { m_onStage = onStage; OnStageStateChanged(); }
+   void SetOnStage(bool onStage) { m_onStage = onStage; OnStageStateChanged(); MarkDirty(); }
 
    bool GetFillParent() const { return m_fillParent; }
    void SetFillParent(bool fillParent) { m_fillParent = fillParent; }
@@ -82,6 +82,9 @@ public:
    virtual void Draw(VP::SurfaceGraphics *pGraphics);
    
 protected:
+   // Notify the owning FlexDMD that something affecting the rendered frame has changed
+   void MarkDirty() const;
+
    ActionFactory* m_pActionFactory;
 
 private:
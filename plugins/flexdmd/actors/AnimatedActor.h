@@ -26,9 +26,9 @@ public:
    void SetTime(float time) { m_time = time; }
    void SetEndOfAnimation(bool endOfAnimation) { m_endOfAnimation = endOfAnimation; }
    Scaling GetScaling() const { return m_scaling; }
-   void SetScaling(Scaling scaling) { m_scaling = scaling; }
+   void SetScaling(Scaling scaling) { if (m_scaling != scaling) { m_scaling = scaling; MarkDirty(); } }
    Alignment GetAlignment() const { return m_alignment; }
-   void SetAlignment(Alignment alignment) { m_alignment = alignment; }
+   void SetAlignment(Alignment alignment) { if (m_alignment != alignment) { m_alignment = alignment; MarkDirty(); } }
    virtual float GetLength() const { return m_length; }
    void SetLength(float length) { m_length = length; }
    bool GetLoop() const { return m_loop; }
@@ -10,8 +10,8 @@ public:
    ~FadeOverlay() = default;
 
    float GetAlpha() const { return m_alpha; }
-   void SetAlpha(float alpha) { m_alpha = alpha; }
-   void SetColor(uint32_t color) { m_color = color; }
+   void SetAlpha(float alpha) { if (m_alpha != alpha) { m_alpha = alpha; MarkDirty(); } }
+   void SetColor(uint32_t color) { if (m_color != color) { m_color = color; MarkDirty(); } }
    void Draw(VP::SurfaceGraphics* pGraphics) override;
 
 private:
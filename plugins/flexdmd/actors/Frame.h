@@ -12,13 +12,13 @@ public:
    ActorType GetType() const override { return AT_Frame; }
 
    int GetThickness() const { return m_thickness; }
-   void SetThickness(int v) { m_thickness = v; }
+   void SetThickness(int v) { if (m_thickness != v) { m_thickness = v; MarkDirty(); } }
    ColorRGBA32 GetBorderColor() const { return m_borderColor; }
-   void SetBorderColor(ColorRGBA32 v) { m_borderColor = v; }
+   void SetBorderColor(ColorRGBA32 v) { if (m_borderColor != v) { m_borderColor = v; MarkDirty(); } }
    bool GetFill() const { return m_fill; }
-   void SetFill(bool v) { m_fill = v; }
+   void SetFill(bool v) { if (m_fill != v) { m_fill = v; MarkDirty(); } }
    ColorRGBA32 GetFillColor() const { return m_fillColor; }
-   void SetFillColor(ColorRGBA32 v) { m_fillColor = v; }
+   void SetFillColor(ColorRGBA32 v) { if (m_fillColor != v) { m_fillColor = v; MarkDirty(); } }
 
    void Draw(VP::SurfaceGraphics* pGraphics) override;
 
@@ -75,7 +75,14 @@ void GIFImage::ReadNextFrame()
 void GIFImage::UpdateFrame() 
 {
    if (m_pBitmap)
-      m_pActiveFrameSurface = m_pBitmap->GetFrameSurface(m_pos);
+   {
+      SDL_Surface* pFrameSurface = m_pBitmap->GetFrameSurface(m_pos);
+      if (pFrameSurface != m_pActiveFrameSurface)
+      {
+         m_pActiveFrameSurface = pFrameSurface;
+         MarkDirty();
+      }
+   }
 }
 
 void GIFImage::Draw(VP::SurfaceGraphics* pGraphics)
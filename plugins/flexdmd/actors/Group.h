@@ -26,7 +26,7 @@ public:
    Image *GetImage(const string &Name);
 
    bool GetClip() const { return m_clip; }
-   void SetClip(bool clip) { m_clip = clip; }
+   void SetClip(bool clip) { if (m_clip != clip) { m_clip = clip; MarkDirty(); } }
 
    void AddActor(Actor *actor);
    void AddActorAt(Actor *actor, int index);
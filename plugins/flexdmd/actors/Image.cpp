@@ -54,6 +54,7 @@ void Image::SetBitmap(Bitmap *pBitmap)
    m_pBitmap = pBitmap;
    if (m_pBitmap)
       m_pBitmap->AddRef();
+   MarkDirty();
 }
 
 void Image::Draw(VP::SurfaceGraphics* pGraphics)
@@ -19,9 +19,9 @@ public:
    Bitmap* GetBitmap();
    void SetBitmap(Bitmap* pBitmap);
    Scaling GetScaling() const { return m_scaling; }
-   void SetScaling(Scaling scaling) { m_scaling = scaling; }
+   void SetScaling(Scaling scaling) { if (m_scaling != scaling) { m_scaling = scaling; MarkDirty(); } }
    Alignment GetAlignment() const { return m_alignment; }
-   void SetAlignment(Alignment alignment) { m_alignment = alignment; }
+   void SetAlignment(Alignment alignment) { if (m_alignment != alignment) { m_alignment = alignment; MarkDirty(); } }
 
    void Draw(VP::SurfaceGraphics* pGraphics) override;
    void OnStageStateChanged() override;
@@ -48,7 +48,11 @@ void ImageSequence::OnStageStateChanged()
 void ImageSequence::Rewind() 
 {
    AnimatedActor::Rewind();
-   m_frame = 0;
+   if (m_frame != 0)
+   {
+      m_frame = 0;
+      MarkDirty();
+   }
 }
 
 void ImageSequence::ReadNextFrame()
@@ -58,6 +62,7 @@ void ImageSequence::ReadNextFrame()
     else {
        m_frame++;
        SetFrameTime(m_frame * GetFrameDuration());
+       MarkDirty();
     }
 }
 
@@ -51,6 +51,7 @@ void Label::SetText(const string& szText)
       while (std::getline(ss, line, '\n'))
          m_lines.push_back(line);
       UpdateBounds();
+      MarkDirty();
    }
 }
 
@@ -12,9 +12,9 @@ public:
    ActorType GetType() const override { return AT_Label; }
 
    Alignment GetAlignment() const { return m_alignment; }
-   void SetAlignment(Alignment alignment) { m_alignment = alignment; }
+   void SetAlignment(Alignment alignment) { if (m_alignment != alignment) { m_alignment = alignment; MarkDirty(); } }
    Font* GetFont() const { m_pFont->AddRef(); return m_pFont; }
-   void SetFont(Font* pFont) { m_pFont->Release(); m_pFont = pFont; m_pFont->AddRef(); UpdateBounds(); }
+   void SetFont(Font* pFont) { if (m_pFont == pFont) return; m_pFont->Release(); m_pFont = pFont; m_pFont->AddRef(); UpdateBounds(); MarkDirty(); }
    const string& GetText() const { return m_szText; }
    void SetText(const string& szText);
    bool GetAutoPack() const { return m_autopack; }
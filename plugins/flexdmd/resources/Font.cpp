@@ -5,21 +5,20 @@ Font::Font(AssetManager* pAssetManager, AssetSrc* pAssetSrc)
 {
    m_pBitmapFont = (BitmapFont*)pAssetManager->Open(pAssetSrc);
  
-   m_textures = new SDL_Surface*[m_pBitmapFont->GetPageCount()];
-   memset((char*)m_textures, 0, sizeof(SDL_Surface*) * m_pBitmapFont->GetPageCount());
+   vector<SDL_Surface*> textures(m_pBitmapFont->GetPageCount(), nullptr);
 
    for (int i = 0; i < m_pBitmapFont->GetPageCount(); i++) {
       AssetSrc* pTextureAssetSrc = pAssetManager->ResolveSrc(m_pBitmapFont->GetPage(i)->GetFilename(), pAssetSrc);
-      m_textures[i] = (SDL_Surface*)pAssetManager->Open(pTextureAssetSrc);
+      textures[i] = (SDL_Surface*)pAssetManager->Open(pTextureAssetSrc);
       pTextureAssetSrc->Release();
    }
 
    if (pAssetSrc->GetFontBorderSize() > 0) {
       for (int i = 0; i < m_pBitmapFont->GetPageCount(); i++) {
-         if (!m_textures[i])
+         if (!textures[i])
             continue;
 
-         SDL_Surface* src = SDL_ConvertSurface(m_textures[i], SDL_PIXELFORMAT_RGBA32);
+         SDL_Surface* src = SDL_ConvertSurface(textures[i], SDL_PIXELFORMAT_RGBA32);
 
          int w = src->w;
          int h = src->h;
@@ -91,9 +90,9 @@ Font::Font(AssetManager* pAssetManager, AssetSrc* pAssetSrc)
          SDL_UnlockSurface(src);
          SDL_UnlockSurface(dst);
          SDL_DestroySurface(src);
-         SDL_DestroySurface(m_textures[i]);
+         SDL_DestroySurface(textures[i]);
 
-         m_textures[i] = dst;
+         textures[i] = dst;
       }
 
       for(const auto& pair : m_pBitmapFont->GetCharacters()) {
@@ -103,10 +102,10 @@ Font::Font(AssetManager* pAssetManager, AssetSrc* pAssetSrc)
    }
    else if (pAssetSrc->GetFontTint() != RGB(255, 255, 255)) {
       for (int i = 0; i < m_pBitmapFont->GetPageCount(); i++) {
-         if (!m_textures[i])
+         if (!textures[i])
             continue;
 
-         SDL_Surface* const dst = SDL_ConvertSurface(m_textures[i], SDL_PIXELFORMAT_RGBA32);
+         SDL_Surface* const dst = SDL_ConvertSurface(textures[i], SDL_PIXELFORMAT_RGBA32);
 
          SDL_LockSurface(dst);
 
@@ -128,72 +127,146 @@ Font::Font(AssetManager* pAssetManager, AssetSrc* pAssetSrc)
          }
 
          SDL_UnlockSurface(dst);
-         SDL_DestroySurface(m_textures[i]);
+         SDL_DestroySurface(textures[i]);
 
-         m_textures[i] = dst;
+         textures[i] = dst;
       }
    }
+
+   BuildAtlas(textures);
+
+   for (SDL_Surface* texture : textures) {
+      if (texture)
+         SDL_DestroySurface(texture);
+   }
 }
 
 Font::~Font()
 {
    assert(m_refCount == 0);
-   if (m_pBitmapFont)
-   {
-      for (int i = 0; i < m_pBitmapFont->GetPageCount(); ++i) {
-         if (m_textures[i])
-            SDL_DestroySurface(m_textures[i]);
+   delete m_pBitmapFont;
+}
+
+void Font::BuildAtlas(const vector<SDL_Surface*>& textures)
+{
+   // Copy all glyphs, one after the other, to premultiplied color and inverse alpha planes, laid out
+   // to match the RGB24 render surface so that drawing text does not need any format conversion
+   vector<SDL_Surface*> pages(textures.size(), nullptr);
+   for (size_t i = 0; i < textures.size(); i++) {
+      if (textures[i]) {
+         pages[i] = SDL_ConvertSurface(textures[i], SDL_PIXELFORMAT_RGBA32);
+         if (pages[i])
+            SDL_LockSurface(pages[i]);
       }
+   }
 
-      delete m_pBitmapFont;
+   size_t atlasSize = 0;
+   for (const auto& pair : m_pBitmapFont->GetCharacters()) {
+      const Character* character = pair.second;
+      const int page = character->GetTexturePage();
+      if (page < 0 || page >= static_cast<int>(pages.size()) || pages[page] == nullptr || m_glyphs.contains(character))
+         continue;
+      SDL_Rect bounds = character->GetBounds();
+      const SDL_Rect pageRect = { 0, 0, pages[page]->w, pages[page]->h };
+      if (!SDL_GetRectIntersection(&bounds, &pageRect, &bounds))
+         bounds = { 0, 0, 0, 0 };
+      m_glyphs[character] = { bounds.w, bounds.h, atlasSize };
+      atlasSize += bounds.w * bounds.h * 3;
+   }
+
+   m_atlasColor.resize(atlasSize);
+   m_atlasInvAlpha.resize(atlasSize);
+   for (const auto& [character, glyph] : m_glyphs) {
+      const SDL_Surface* page = pages[character->GetTexturePage()];
+      const SDL_Rect& bounds = character->GetBounds();
+      uint8_t* color = m_atlasColor.data() + glyph.offset;
+      uint8_t* invAlpha = m_atlasInvAlpha.data() + glyph.offset;
+      for (int y = 0; y < glyph.h; y++) {
+         const uint8_t* src = static_cast<const uint8_t*>(page->pixels) + (max(bounds.y, 0) + y) * page->pitch + max(bounds.x, 0) * 4;
+         for (int x = 0; x < glyph.w; x++, src += 4, color += 3, invAlpha += 3) {
+            const unsigned int a = src[3];
+            for (int c = 0; c < 3; c++) {
+               const unsigned int v = src[c] * a + 128;
+               color[c] = static_cast<uint8_t>((v + (v >> 8)) >> 8);
+               invAlpha[c] = static_cast<uint8_t>(255 - a);
+            }
+         }
+      }
+   }
+
+   for (SDL_Surface* page : pages) {
+      if (page) {
+         SDL_UnlockSurface(page);
+         SDL_DestroySurface(page);
+      }
    }
 }
 
-void Font::DrawCharacter(VP::SurfaceGraphics* pGraphics, char character, char previousCharacter, float& x, float& y)
+Character* Font::ResolveCharacter(char character)
 {
-   if (character == '\n') {
-      x = 0;
-      y += m_pBitmapFont->GetLineHeight();
+   Character* pCharacter = m_pBitmapFont->GetCharacter(character);
+   if (pCharacter)
+      return pCharacter;
+   if ('a' <= character && character <= 'z' && m_pBitmapFont->GetCharacter(toupper(character))) {
+      m_pBitmapFont->SetCharacter(character, m_pBitmapFont->GetCharacter(toupper(character)));
+      return m_pBitmapFont->GetCharacter(character);
    }
-   else {
-      Character* pCharacter = m_pBitmapFont->GetCharacter(character);
-      if (pCharacter) {
-         int kerning = m_pBitmapFont->GetKerning(previousCharacter, character);
-         if (pGraphics) {
-            SDL_Surface* pSource = m_textures[pCharacter->GetTexturePage()];
-            if (pSource) {
-               SDL_Rect bounds = pCharacter->GetBounds();
-               SDL_Point offset = pCharacter->GetOffset();
-               SDL_Rect rect = { (int)(x + offset.x + kerning), (int)(y + offset.y), bounds.w, bounds.h };
-               pGraphics->DrawImage(pSource, &bounds, &rect);
-            }
+   if (m_pBitmapFont->GetCharacter(' ')) {
+      //PLOGD.printf("Missing character 0x%02X replaced by ' '", character);
+      m_pBitmapFont->SetCharacter(character, m_pBitmapFont->GetCharacter(' '));
+      return m_pBitmapFont->GetCharacter(character);
+   }
+   return nullptr;
+}
+
+const Font::TextLayout& Font::GetLayout(const string& text)
+{
+   auto it = m_layouts.find(text);
+   if (it != m_layouts.end())
+      return it->second;
+
+   // Labels are mostly static or cycle through a small set of values (scores, credits, ...), so just restart from scratch when the cache grows too much
+   if (m_layouts.size() >= 256)
+      m_layouts.clear();
+
+   TextLayout& layout = m_layouts[text];
+   int x = 0;
+   int y = 0;
+   bool absoluteX = false;
+   char previousCharacter = ' ';
+   for (char character : text) {
+      if (character == '
+') {
+         x = 0;
+         y += m_pBitmapFont->GetLineHeight();
+         absoluteX = true;
+      }
+      else if (Character* pCharacter = ResolveCharacter(character); pCharacter) {
+         const int kerning = m_pBitmapFont->GetKerning(previousCharacter, character);
+         auto glyph = m_glyphs.find(pCharacter);
+         if (glyph != m_glyphs.end() && glyph->second.w > 0 && glyph->second.h > 0) {
+            const SDL_Point& offset = pCharacter->GetOffset();
+            layout.glyphs.push_back({ &glyph->second, x + offset.x + kerning, y + offset.y, absoluteX });
          }
          x += pCharacter->GetXAdvance() + kerning;
       }
-      else if ('a' <= character && character <= 'z' && m_pBitmapFont->GetCharacter(toupper(character))) {
-         m_pBitmapFont->SetCharacter(character, m_pBitmapFont->GetCharacter(toupper(character)));
-         DrawCharacter(pGraphics, character, previousCharacter, x, y);
-      }
-      else if (m_pBitmapFont->GetCharacter(' ')) {
-         //PLOGD.printf("Missing character 0x%02X replaced by ' '", character);
-         m_pBitmapFont->SetCharacter(character, m_pBitmapFont->GetCharacter(' '));
-         DrawCharacter(pGraphics, character, previousCharacter, x, y);
-      }
+      previousCharacter = character;
    }
+   layout.size = m_pBitmapFont->MeasureFont(text);
+   return layout;
 }
 
 SDL_Rect Font::MeasureFont(const string& text)
 {
-   DrawText_(NULL, 0, 0, text);
-   return m_pBitmapFont->MeasureFont(text);
+   return GetLayout(text).size;
 }
 
 void Font::DrawText_(VP::SurfaceGraphics* pGraphics, float x, float y, const string& text)
 {
-   char previousCharacter = ' ';
-   for (size_t i = 0; i < text.length(); i++) {
-      char character = text[i];
-      DrawCharacter(pGraphics, character, previousCharacter, x, y);
-      previousCharacter = character;
+   for (const GlyphPlacement& placement : GetLayout(text).glyphs) {
+      const Glyph& glyph = *placement.pGlyph;
+      const int px = placement.absoluteX ? placement.x : static_cast<int>(x + static_cast<float>(placement.x));
+      const int py = static_cast<int>(y + static_cast<float>(placement.y));
+      pGraphics->DrawPremultipliedImage(m_atlasColor.data() + glyph.offset, m_atlasInvAlpha.data() + glyph.offset, glyph.w, glyph.h, px, py);
    }
 }
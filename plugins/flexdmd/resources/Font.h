@@ -5,6 +5,8 @@
 #include "bmfonts/BitmapFont.h"
 #include "SurfaceGraphics.h"
 
+#include <unordered_map>
+
 class AssetManager;
 
 class Font final {
@@ -14,12 +16,38 @@ public:
 
    PSC_IMPLEMENT_REFCOUNT()
 
-   void DrawCharacter(VP::SurfaceGraphics* pGraphics, char character, char previousCharacter, float& x, float& y);
    SDL_Rect MeasureFont(const string& text);
    void DrawText_(VP::SurfaceGraphics* pGraphics, float x, float y, const string& text);
    BitmapFont* GetBitmapFont() const { return m_pBitmapFont; }
 
 private:
+   // Glyph pre-rasterized in the atlas, with the font tint and border already applied
+   struct Glyph
+   {
+      int w, h;
+      size_t offset; // Offset of the glyph pixels in the atlas planes, with a row pitch of 3 * w
+   };
+
+   struct GlyphPlacement
+   {
+      const Glyph* pGlyph;
+      int x, y;
+      bool absoluteX; // Glyphs following a line feed are placed from the left of the surface
+   };
+
+   struct TextLayout
+   {
+      vector<GlyphPlacement> glyphs;
+      SDL_Rect size;
+   };
+
+   Character* ResolveCharacter(char character);
+   void BuildAtlas(const vector<SDL_Surface*>& textures);
+   const TextLayout& GetLayout(const string& text);
+
    BitmapFont* m_pBitmapFont;
-   SDL_Surface** m_textures;
+   std::unordered_map<const Character*, Glyph> m_glyphs;
+   vector<uint8_t> m_atlasColor; // Premultiplied RGB
+   vector<uint8_t> m_atlasInvAlpha; // 255 - alpha, replicated for each channel
+   std::unordered_map<string, TextLayout> m_layouts;
 };
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+// Journal of the output changes reported by PinMAME for one kind of output (lamps, solenoids,...).
+// PinMAME change lists are destructive (each call only reports the changes since the previous call), so
+// they are polled into a shared ring and each consumer reads from its own cursor. This allows multiple
+// consumers (script, B2S, plugins,...) to watch the same machine without stealing each other's changes.
+//
+// PinMAME writes directly into the ring, and consumers are given the ring entries, so a change is only copied
+// once more when it is delivered. When an entry is about to be overwritten, it is folded into the last known
+// state of its output, which is reported to consumers that fell behind more than the ring size.
+//
+// The journal is not thread safe: consumers running on different threads must serialize their calls.
+template <typename T, auto Id = nullptr> class ChangeJournal
+{
+public:
+   typedef uint64_t Cursor;
+
+   // Poll PinMAME for new changes (at most maxCount) and append them to the journal
+   template <typename PollFunc> void Poll(const int maxCount, const PollFunc& poll)
+   {
+      if (maxCount <= 0)
+         return;
+      const size_t max = static_cast<size_t>(maxCount);
+      if (m_ring.empty() || max > m_maxCount)
+      {
+         // (Re)allocate the ring, with enough spare slots after its end for PinMAME to always write contiguously
+         for (; m_tail < m_head; m_tail++)
+            Fold(m_ring[m_tail % m_size]);
+         m_maxCount = max;
+         m_size = JOURNAL_SIZE > 2 * max ? JOURNAL_SIZE : 2 * max;
+         m_ring.resize(m_size + max);
+      }
+      // Fold the entries that the poll may overwrite
+      for (; m_tail + m_size < m_head + max; m_tail++)
+         Fold(m_ring[m_tail % m_size]);
+      const size_t start = static_cast<size_t>(m_head % m_size);
+      int count = poll(&m_ring[start]);
+      count = count < 0 ? 0 : count > maxCount ? maxCount : count;
+      // Move the entries written past the end of the ring to its start
+      for (size_t i = m_size; i < start + count; i++)
+         m_ring[i - m_size] = m_ring[i];
+      m_head += count;
+   }
+
+   // Visit the changes since the given cursor, moving the cursor past each visited change.
+   // A consumer that fell behind (or was created before a reset) first receives the last known state of every output.
+   // The visitor may return false to stop before a change (for example when the consumer buffer is full): the cursor is then left
+   // on this change so that it is visited again by the next call. When resynchronizing, the cursor only moves once all the last
+   // known states have been visited, so the consumer must be able to receive at least one change per output.
+   template <typename Visitor> void Read(Cursor& cursor, const Visitor& visit) const
+   {
+      if (cursor < m_tail || cursor > m_head)
+      {
+         if constexpr (Id != nullptr)
+         {
+            for (size_t i = 0; i < m_states.size(); i++)
+               if (m_known[i] && !Visit(visit, m_states[i]))
+                  return;
+         }
+         cursor = m_tail;
+      }
+      for (; cursor < m_head; cursor++)
+         if (!Visit(visit, m_ring[cursor % m_size]))
+            return;
+   }
+
+   Cursor GetHead() const { return m_head; }
+
+   // Drop the pending changes and the last known states when a new game is started (cursors stay valid as the head is not reset)
+   void Reset()
+   {
+      m_tail = m_head;
+      m_states.clear();
+      m_known.clear();
+   }
+
+private:
+   template <typename Visitor> static bool Visit(const Visitor& visit, const T& state)
+   {
+      if constexpr (std::is_void_v<std::invoke_result_t<Visitor, const T&>>)
+      {
+         visit(state);
+         return true;
+      }
+      else
+         return visit(state);
+   }
+
+   void Fold(const T& state)
+   {
+      if constexpr (Id != nullptr)
+      {
+         const size_t index = static_cast<size_t>(state.*Id);
+         if (index >= m_states.size())
+         {
+            m_states.resize(index + 1);
+            m_known.resize(index + 1);
+         }
+         m_states[index] = state;
+         m_known[index] = true;
+      }
+   }
+
+   static constexpr size_t JOURNAL_SIZE = 4096;
+   std::vector<T> m_ring; // m_size slots addressed by cursor, followed by m_maxCount spare slots written by PinMAME when a poll wraps around
+   size_t m_size = 0;
+   size_t m_maxCount = 0;
+   Cursor m_head = 0; // Cursor of the next change
+   Cursor m_tail = 0; // Cursor of the oldest change still in the ring
+   std::vector<T> m_states; // Last known state of each output for the changes dropped from the ring
+   std::vector<bool> m_known;
+};
@@ -123,6 +123,18 @@ void Controller::Run(long hParentWnd, int nMinVersion)
       std::this_thread::sleep_for(std::chrono::milliseconds(75)); 
 
    if ((PinmameIsRunning() == 1) && status == PINMAME_STATUS_OK) {
+      m_lampJournal.Reset();
+      m_ledJournal.Reset();
+      m_nvramJournal.Reset();
+      m_giJournal.Reset();
+      m_solenoidJournal.Reset();
+      for (OutputStateBuffer& buffer : m_outputStates)
+      {
+         buffer.block.lamps.clear();
+         buffer.block.solenoids.clear();
+         buffer.block.giStrings.clear();
+      }
+      m_outputStates[m_frontOutputStates].block.version++;
       /*Settings* const pSettings = &g_pplayer->m_ptable->m_settings;
       if (pSettings->LoadValueWithDefault(Settings::Standalone, "AltSound"s, true)) {
           AltsoundSetLogger(g_pvp->m_szMyPrefPath, ALTSOUND_LOG_LEVEL_INFO, false);
@@ -192,66 +204,123 @@ void Controller::SetMech(int mechNo, int newVal)
 
 const vector<PinmameNVRAMState>& Controller::GetChangedNVRAM()
 {
-   m_nvramStates.resize(PinmameGetMaxNVRAM()); // TODO we should use the actual size of the running machine
-   int count = PinmameGetChangedNVRAM(m_nvramStates.data());
-   if (count < 0) // report error ?
-      count = 0;
-   m_nvramStates.resize(count);
+   m_nvramStates.clear();
+   GetChangedNVRAM(m_nvramCursor, m_nvramStates);
    return m_nvramStates;
 }
 
 const vector<PinmameSoundCommand>& Controller::GetNewSoundCommands()
 {
-   m_soundCommands.resize(PinmameGetMaxSoundCommands());
-   int count = PinmameGetNewSoundCommands(m_soundCommands.data());
-   if (count < 0) // report error ?
-      count = 0;
-   m_soundCommands.resize(count);
+   m_soundCommands.clear();
+   GetNewSoundCommands(m_soundCommandCursor, m_soundCommands);
    return m_soundCommands;
 }
 
 const vector<PinmameLampState>& Controller::GetChangedLamps()
 {
-   m_lampStates.resize(PinmameGetMaxLamps()); // TODO we should use the actual size of the running machine
-   int count = PinmameGetChangedLamps(m_lampStates.data());
-   if (count < 0) // report error ?
-      count = 0;
-   m_lampStates.resize(count);
+   m_lampStates.clear();
+   GetChangedLamps(m_lampCursor, m_lampStates);
    return m_lampStates;
 }
 
 const vector<PinmameLEDState>& Controller::GetChangedLEDs(int nHigh, int nLow, int nnHigh, int nnLow)
 {
-   m_ledStates.resize(PinmameGetMaxLEDs()); // TODO we should use the actual size of the running machine
-   uint64_t mask = ((uint64_t)nHigh << 32) | (uint64_t)nLow;
-   uint64_t mask2 = ((uint64_t)nnHigh << 32) | (uint64_t)nnLow;
-   int count = PinmameGetChangedLEDs(mask, mask2, m_ledStates.data());
-   if (count < 0) // report error ?
-      count = 0;
-   m_ledStates.resize(count);
+   m_ledStates.clear();
+   GetChangedLEDs(m_ledCursor, m_ledStates, ((uint64_t)nHigh << 32) | (uint64_t)nLow, ((uint64_t)nnHigh << 32) | (uint64_t)nnLow);
    return m_ledStates;
 }
 
 const vector<PinmameGIState>& Controller::GetChangedGIStrings()
 {
-   m_giStates.resize(PinmameGetMaxGIs()); // TODO we should use the actual size of the running machine
-   int count = PinmameGetChangedGIs(m_giStates.data());
-   if (count < 0) // report error ?
-      count = 0;
-   m_giStates.resize(count);
+   m_giStates.clear();
+   GetChangedGIStrings(m_giCursor, m_giStates);
    return m_giStates;
 }
 
 const vector<PinmameSolenoidState>& Controller::GetChangedSolenoids()
 {
-   m_solenoidStates.resize(PinmameGetMaxSolenoids()); // TODO we should use the actual size of the running machine
-   int count = PinmameGetChangedSolenoids(m_solenoidStates.data());
-   if (count < 0) // report error ?
-      count = 0;
-   m_solenoidStates.resize(count);
+   m_solenoidStates.clear();
+   GetChangedSolenoids(m_solenoidCursor, m_solenoidStates);
    return m_solenoidStates;
 }
 
+// Each call polls PinMAME into the shared journal, so no change is lost for the other consumers, whatever the order of their calls
+
+void Controller::PollNVRAM() { m_nvramJournal.Poll(PinmameGetMaxNVRAM(), [](PinmameNVRAMState* states) { return PinmameGetChangedNVRAM(states); }); } // TODO we should use the actual size of the running machine
+void Controller::PollSoundCommands() { m_soundCommandJournal.Poll(PinmameGetMaxSoundCommands(), [](PinmameSoundCommand* states) { return PinmameGetNewSoundCommands(states); }); }
+void Controller::PollLamps() { m_lampJournal.Poll(PinmameGetMaxLamps(), [](PinmameLampState* states) { return PinmameGetChangedLamps(states); }); } // TODO we should use the actual size of the running machine
+// Poll all LEDs since consumers may use different masks, then only report the ones requested by each consumer
+void Controller::PollLEDs() { m_ledJournal.Poll(PinmameGetMaxLEDs(), [](PinmameLEDState* states) { return PinmameGetChangedLEDs(~0ull, ~0ull, states); }); } // TODO we should use the actual size of the running machine
+void Controller::PollGIStrings() { m_giJournal.Poll(PinmameGetMaxGIs(), [](PinmameGIState* states) { return PinmameGetChangedGIs(states); }); } // TODO we should use the actual size of the running machine
+void Controller::PollSolenoids() { m_solenoidJournal.Poll(PinmameGetMaxSolenoids(), [](PinmameSolenoidState* states) { return PinmameGetChangedSolenoids(states); }); } // TODO we should use the actual size of the running machine
+
+void Controller::GetChangedNVRAM(ChangeCursor& cursor, vector<PinmameNVRAMState>& changes)
+{
+   PollNVRAM();
+   m_nvramJournal.Read(cursor, [&changes](const PinmameNVRAMState& state) { changes.push_back(state); });
+}
+
+void Controller::GetNewSoundCommands(ChangeCursor& cursor, vector<PinmameSoundCommand>& commands)
+{
+   PollSoundCommands();
+   m_soundCommandJournal.Read(cursor, [&commands](const PinmameSoundCommand& command) { commands.push_back(command); });
+}
+
+void Controller::GetChangedLamps(ChangeCursor& cursor, vector<PinmameLampState>& changes)
+{
+   PollLamps();
+   m_lampJournal.Read(cursor, [&changes](const PinmameLampState& state) { changes.push_back(state); });
+}
+
+void Controller::GetChangedLEDs(ChangeCursor& cursor, vector<PinmameLEDState>& changes, uint64_t mask, uint64_t mask2)
+{
+   PollLEDs();
+   m_ledJournal.Read(cursor, [&changes, mask, mask2](const PinmameLEDState& state) {
+      if (state.ledNo < 64 ? ((mask >> state.ledNo) & 1) != 0 : state.ledNo < 128 && ((mask2 >> (state.ledNo - 64)) & 1) != 0)
+         changes.push_back(state);
+   });
+}
+
+void Controller::GetChangedGIStrings(ChangeCursor& cursor, vector<PinmameGIState>& changes)
+{
+   PollGIStrings();
+   m_giJournal.Read(cursor, [&changes](const PinmameGIState& state) { changes.push_back(state); });
+}
+
+void Controller::GetChangedSolenoids(ChangeCursor& cursor, vector<PinmameSolenoidState>& changes)
+{
+   PollSolenoids();
+   m_solenoidJournal.Read(cursor, [&changes](const PinmameSolenoidState& state) { changes.push_back(state); });
+}
+
+const Controller::OutputStateBlock& Controller::GetOutputStateBlock()
+{
+   PollLamps();
+   PollSolenoids();
+   PollGIStrings();
+   OutputStateBuffer& back = m_outputStates[1 - m_frontOutputStates];
+   const OutputStateBlock& front = m_outputStates[m_frontOutputStates].block;
+   // The back block is one update late: apply the changes since its last update, and only publish it if it now differs from the front one
+   bool changed = false;
+   const auto apply = [&changed](vector<int>& states, const vector<int>& frontStates, const int index, const int state)
+   {
+      if (index < 0)
+         return;
+      if (static_cast<size_t>(index) >= states.size())
+         states.resize(index + 1);
+      states[index] = state;
+      changed |= static_cast<size_t>(index) >= frontStates.size() || frontStates[index] != state;
+   };
+   m_lampJournal.Read(back.lampCursor, [&](const PinmameLampState& state) { apply(back.block.lamps, front.lamps, state.lampNo, state.state); });
+   m_solenoidJournal.Read(back.solenoidCursor, [&](const PinmameSolenoidState& state) { apply(back.block.solenoids, front.solenoids, state.solNo, state.state); });
+   m_giJournal.Read(back.giCursor, [&](const PinmameGIState& state) { apply(back.block.giStrings, front.giStrings, state.giNo, state.state); });
+   if (!changed)
+      return front;
+   back.block.version = front.version + 1;
+   m_frontOutputStates = 1 - m_frontOutputStates;
+   return back.block;
+}
+
 int Controller::GetRawDmdWidth() const
 {
    GetStateBlock(PINMAME_STATE_REQMASK_DISPLAY_STATE);
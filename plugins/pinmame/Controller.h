@@ -1,6 +1,7 @@
 #pragma once
 
 #include "common.h"
+#include "ChangeJournal.h"
 
 class Game;
 
@@ -71,6 +72,15 @@ public:
    const vector<PinmameGIState>& GetChangedGIStrings();
    const vector<PinmameSolenoidState>& GetChangedSolenoids();
 
+   // Non destructive change tracking: each consumer keeps its own cursor (0 to get the full state), changes are appended to the given vector
+   typedef uint64_t ChangeCursor;
+   void GetChangedNVRAM(ChangeCursor& cursor, vector<PinmameNVRAMState>& changes);
+   void GetNewSoundCommands(ChangeCursor& cursor, vector<PinmameSoundCommand>& commands);
+   void GetChangedLamps(ChangeCursor& cursor, vector<PinmameLampState>& changes);
+   void GetChangedLEDs(ChangeCursor& cursor, vector<PinmameLEDState>& changes, uint64_t mask = ~0ull, uint64_t mask2 = ~0ull);
+   void GetChangedGIStrings(ChangeCursor& cursor, vector<PinmameGIState>& changes);
+   void GetChangedSolenoids(ChangeCursor& cursor, vector<PinmameSolenoidState>& changes);
+
    // TODO should we bridge this ? but to what as External dmddevice.dll is handled through the plugin bus ?
    bool GetShowPinDMD() const { LOGE("ShowPinDMD is not implemented"); return false; }
    void SetShowPinDMD(bool v) const { LOGE("ShowPinDMD is not implemented"); }
@@ -145,12 +155,45 @@ public:
       return m_stateBlock;
    }
 
+   // Versioned, double buffered mirror of the lamp, solenoid and GI states, for consumers that need the full state rather than the changes.
+   // Each update catches the back block up with the journals (through its own cursors) then publishes it, so a returned block stays valid and
+   // unmodified until the next update but one. The version is increased when changes were reported since the previous update.
+   struct OutputStateBlock
+   {
+      uint64_t version = 0;
+      vector<int> lamps; // Indexed by output number
+      vector<int> solenoids;
+      vector<int> giStrings;
+   };
+   const OutputStateBlock& GetOutputStateBlock();
+
    const string& GetVpmPath() const { return m_vpmPath; }
 
 private:
    string m_vpmPath;
    PinmameGame* m_pPinmameGame = nullptr; // Game selected by setting GameName property
    PinmameMechConfig* m_pPinmameMechConfig = nullptr;
+   ChangeJournal<PinmameLampState, &PinmameLampState::lampNo> m_lampJournal;
+   ChangeJournal<PinmameLEDState, &PinmameLEDState::ledNo> m_ledJournal;
+   ChangeJournal<PinmameNVRAMState, &PinmameNVRAMState::nvramNo> m_nvramJournal;
+   ChangeJournal<PinmameSoundCommand> m_soundCommandJournal;
+   ChangeJournal<PinmameGIState, &PinmameGIState::giNo> m_giJournal;
+   ChangeJournal<PinmameSolenoidState, &PinmameSolenoidState::solNo> m_solenoidJournal;
+   struct OutputStateBuffer
+   {
+      OutputStateBlock block;
+      ChangeCursor lampCursor = 0, solenoidCursor = 0, giCursor = 0;
+   };
+   OutputStateBuffer m_outputStates[2];
+   int m_frontOutputStates = 0;
+   void PollLamps();
+   void PollLEDs();
+   void PollNVRAM();
+   void PollSoundCommands();
+   void PollGIStrings();
+   void PollSolenoids();
+   // Cursors and result buffers of the script API which keeps the 'changed since last call' semantics
+   ChangeCursor m_lampCursor = 0, m_ledCursor = 0, m_nvramCursor = 0, m_soundCommandCursor = 0, m_giCursor = 0, m_solenoidCursor = 0;
    vector<PinmameLampState> m_lampStates;
    vector<PinmameLEDState> m_ledStates;
    vector<PinmameNVRAMState> m_nvramStates;
@@ -10,6 +10,8 @@
 
 #include <filesystem>
 #include <cassert>
+#include <atomic>
+#include <algorithm>
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 // Scriptable object definitions
@@ -225,6 +227,38 @@ void PINMAMECALLBACK OnLogMessage(PINMAME_LOG_LEVEL logLevel, const char* format
 static unsigned int onAudioUpdateId;
 static AudioUpdateMsg* audioSrc = nullptr;
 
+// Single producer (emulation thread) / single consumer (audio device thread) ring buffer, so that samples do not go through
+// the main thread and no allocation is performed per audio frame. Sized for a bit more than 300ms of 48kHz stereo float samples.
+static constexpr uint32_t audioRingSize = 1 << 17;
+static uint8_t audioRing[audioRingSize];
+static std::atomic<uint32_t> audioRingRead = 0;
+static std::atomic<uint32_t> audioRingWrite = 0;
+
+static unsigned int ReadAudioSamples(void* context, uint8_t* buffer, unsigned int size)
+{
+   const uint32_t read = audioRingRead.load(std::memory_order_relaxed);
+   const uint32_t available = audioRingWrite.load(std::memory_order_acquire) - read;
+   const uint32_t n = std::min(available, static_cast<uint32_t>(size));
+   const uint32_t pos = read & (audioRingSize - 1);
+   const uint32_t n1 = std::min(n, audioRingSize - pos);
+   memcpy(buffer, audioRing + pos, n1);
+   memcpy(buffer + n1, audioRing, n - n1);
+   audioRingRead.store(read + n, std::memory_order_release);
+   return n;
+}
+
+static void WriteAudioSamples(const uint8_t* buffer, uint32_t size)
+{
+   const uint32_t write = audioRingWrite.load(std::memory_order_relaxed);
+   if (audioRingSize - (write - audioRingRead.load(std::memory_order_acquire)) < size)
+      return; // Overrun: consumer is not reading (paused, stalled), drop this frame
+   const uint32_t pos = write & (audioRingSize - 1);
+   const uint32_t n1 = std::min(size, audioRingSize - pos);
+   memcpy(audioRing + pos, buffer, n1);
+   memcpy(audioRing, buffer + n1, size - n1);
+   audioRingWrite.store(write + size, std::memory_order_release);
+}
+
 static void StopAudioStream()
 {
    if (audioSrc != nullptr)
@@ -232,6 +266,8 @@ static void StopAudioStream()
       // Send an end of stream message
       AudioUpdateMsg* pendingAudioUpdate = new AudioUpdateMsg(); 
       memcpy(pendingAudioUpdate, audioSrc, sizeof(AudioUpdateMsg));
+      pendingAudioUpdate->readSamples = nullptr;
+      pendingAudioUpdate->readContext = nullptr;
       msgApi->RunOnMainThread(0, [](void* userData) {
             AudioUpdateMsg* msg = static_cast<AudioUpdateMsg*>(userData);
             msgApi->BroadcastMsg(endpointId, onAudioUpdateId, msg);
@@ -249,11 +285,23 @@ int PINMAMECALLBACK OnAudioAvailable(PinmameAudioInfo* p_audioInfo, void* const
    if (((p_audioInfo->format == PINMAME_AUDIO_FORMAT_INT16) || (p_audioInfo->format == PINMAME_AUDIO_FORMAT_FLOAT))
       && ((p_audioInfo->channels == 1) || (p_audioInfo->channels == 2)))
    {
+      StopAudioStream();
       audioSrc = new AudioUpdateMsg();
       audioSrc->id = { endpointId, 0 };
       audioSrc->type = (p_audioInfo->channels == 1) ? CTLPI_AUDIO_SRC_BACKGLASS_MONO : CTLPI_AUDIO_SRC_BACKGLASS_STEREO;
       audioSrc->format = (p_audioInfo->format == PINMAME_AUDIO_FORMAT_INT16) ? CTLPI_AUDIO_FORMAT_SAMPLE_INT16 : CTLPI_AUDIO_FORMAT_SAMPLE_FLOAT;
       audioSrc->sampleRate = p_audioInfo->sampleRate;
+      audioSrc->readSamples = ReadAudioSamples;
+      // Announce the stream, the consumer will then pull the samples from the ring buffer
+      AudioUpdateMsg* pendingAudioUpdate = new AudioUpdateMsg();
+      memcpy(pendingAudioUpdate, audioSrc, sizeof(AudioUpdateMsg));
+      msgApi->RunOnMainThread(0, [](void* userData) {
+            AudioUpdateMsg* msg = static_cast<AudioUpdateMsg*>(userData);
+            // Previous stream consumer (if any) has been destroyed by the end of stream message, so no one is reading the ring
+            audioRingRead.store(audioRingWrite.load(std::memory_order_acquire), std::memory_order_release);
+            msgApi->BroadcastMsg(endpointId, onAudioUpdateId, msg);
+            delete msg;
+         }, pendingAudioUpdate);
    }
    else
    {
@@ -267,20 +315,10 @@ int PINMAMECALLBACK OnAudioUpdated(void* p_buffer, int samples, void* const pUse
    if (audioSrc != nullptr)
    {
       // This callback is invoked on the emulation thread, with data only valid in the context of the call.
-      // Therefore, we need to copy the data to feed them on the message thread.
+      // Therefore, we need to copy the data, directly to the ring buffer read by the audio device thread.
       const int bytePerSample = (audioSrc->format == CTLPI_AUDIO_FORMAT_SAMPLE_INT16) ? 2 : 4;
       const int nChannels = (audioSrc->type == CTLPI_AUDIO_SRC_BACKGLASS_MONO) ? 1 : 2;
-      AudioUpdateMsg* pendingAudioUpdate = new AudioUpdateMsg(); 
-      memcpy(pendingAudioUpdate, audioSrc, sizeof(AudioUpdateMsg));
-      pendingAudioUpdate->bufferSize = samples * bytePerSample * nChannels;
-      pendingAudioUpdate->buffer = new uint8_t[pendingAudioUpdate->bufferSize];
-      memcpy(pendingAudioUpdate->buffer, p_buffer, pendingAudioUpdate->bufferSize);
-      msgApi->RunOnMainThread(0, [](void* userData) {
-            AudioUpdateMsg* msg = static_cast<AudioUpdateMsg*>(userData);
-            msgApi->BroadcastMsg(endpointId, onAudioUpdateId, msg);
-            delete[] msg->buffer;
-            delete msg;
-         }, pendingAudioUpdate);
+      WriteAudioSamples(static_cast<const uint8_t*>(p_buffer), samples * bytePerSample * nChannels);
    }
    return samples;
 }
@@ -466,15 +504,22 @@ static void OnControllerGameStart(Controller*)
       if (hasDMD)
       {
          msgApi->SubscribeMsg(endpointId, getDmdSrcId, onGetRenderDMDSrc, controller);
-         msgApi->SubscribeMsg(endpointId, getRenderDmdId, onGetRenderDMD, controller);
-         msgApi->SubscribeMsg(endpointId, getIdentifyDmdId, onGetIdentifyDMD, controller);
+         // Frame requests are only dispatched to us for the displays we own
+         pinmame_tFrameState* frame = PINMAME_STATE_BLOCK_FIRST_DISPLAY_FRAME(block->displayStates);
+         for (unsigned int index = 0; index < block->displayStates->nDisplays; index++)
+         {
+            const CtlResId resId { endpointId, static_cast<uint32_t>(frame->displayId) };
+            msgApi->SubscribeResMsg(endpointId, getRenderDmdId, resId.id, onGetRenderDMD, controller);
+            msgApi->SubscribeResMsg(endpointId, getIdentifyDmdId, resId.id, onGetIdentifyDMD, controller);
+            frame = PINMAME_STATE_BLOCK_NEXT_DISPLAY_FRAME(frame);
+         }
          msgApi->BroadcastMsg(endpointId, onDmdSrcChangedId, nullptr);
       }
       hasAlpha = (block->alphaDisplayStates != nullptr) && (block->alphaDisplayStates->nDisplays > 0);
       if (hasAlpha)
       {
          msgApi->SubscribeMsg(endpointId, getSegSrcId, onGetSegSrc, controller);
-         msgApi->SubscribeMsg(endpointId, getSegId, onGetSeg, controller);
+         msgApi->SubscribeResMsg(endpointId, getSegId, CtlResId { endpointId, 0 }.id, onGetSeg, controller);
          msgApi->BroadcastMsg(endpointId, onSegSrcChangedId, nullptr);
       }
    }
@@ -146,7 +146,7 @@ void onUpdateDMD(void* userData)
    if (now - lastFrameTick >= std::chrono::milliseconds(16))
    {
       GetRawDmdMsg getDmdMsg = { dmdId };
-      msgApi->BroadcastMsg(endpointId, getDmdId, &getDmdMsg);
+      msgApi->SendResMsg(endpointId, getDmdId, dmdId.id, &getDmdMsg);
       processDMD(getDmdMsg, now);
    }
    msgApi->RunOnMainThread(1. / 60., onUpdateDMD, nullptr);
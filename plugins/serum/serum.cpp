@@ -16,6 +16,21 @@
  #define strcpy_s(A, B, C) strncpy(A, C, B)
 #endif
 
+#if defined(__aarch64__) || defined(_M_ARM64)
+ #define SERUM_NEON
+ #include <arm_neon.h>
+#elif defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+ // SSSE3 is not part of the baseline of the plugin builds, so it is selected at runtime
+ #define SERUM_SSSE3
+ #include <tmmintrin.h>
+ #ifdef _MSC_VER
+  #include <intrin.h>
+  #define SERUM_SSSE3_TARGET
+ #else
+  #define SERUM_SSSE3_TARGET __attribute__((target("ssse3")))
+ #endif
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // Serum Colorization plugin
 //
@@ -32,8 +47,98 @@ static unsigned int onDmdSrcChangedId, getDmdSrcId, getRenderDmdId, getIdentifyD
 static Serum_Frame_Struc* pSerum;
 static CtlResId dmdId;
 static unsigned int lastRawFrameId;
+static uint64_t lastRawFrameHash = 0;
 static bool dmdSelected = false;
 
+// Fast 64 bit multiply/xor hash, used to detect raw frames with a new id but the same content
+static uint64_t HashFrame(const uint8_t* const data, const size_t size)
+{
+   uint64_t hash = 0x9E3779B97F4A7C15ull ^ size;
+   size_t i = 0;
+   for (; i + 8 <= size; i += 8)
+   {
+      uint64_t v;
+      memcpy(&v, data + i, 8);
+      hash = (hash ^ v) * 0xFF51AFD7ED558CCDull;
+      hash ^= hash >> 32;
+   }
+   for (; i < size; i++)
+      hash = (hash ^ data[i]) * 0x100000001B3ull;
+   return hash;
+}
+
+#ifdef SERUM_SSSE3
+static bool HasSSSE3()
+{
+#ifdef _MSC_VER
+   static int ssse3_supported = -1;
+   if (ssse3_supported == -1)
+   {
+      int cpuInfo[4];
+      __cpuid(cpuInfo, 1);
+      ssse3_supported = (cpuInfo[2] & (1 << 9)) ? 1 : 0;
+   }
+   return ssse3_supported != 0;
+#else
+   static const bool ssse3_supported = __builtin_cpu_supports("ssse3");
+   return ssse3_supported;
+#endif
+}
+
+// Expand 16 pixels at a time from 64 entries per channel lookup tables (4 shuffles of 16 entries, selected by the index high bits),
+// then interleave the 3 planar channels into packed RGB. Returns the number of processed pixels.
+SERUM_SSSE3_TARGET static unsigned int ExpandPaletteSSSE3(uint8_t* const __restrict dst, const uint8_t* const __restrict frame, const uint8_t (&lut)[3][64], const unsigned int size)
+{
+   alignas(16) static int8_t interleave[3][3][16]; // [output block][channel][byte]
+   static const bool interleaveInit = []()
+   {
+      for (int block = 0; block < 3; block++)
+         for (int channel = 0; channel < 3; channel++)
+            for (int j = 0; j < 16; j++)
+            {
+               const int pos = block * 16 + j;
+               interleave[block][channel][j] = (pos % 3 == channel) ? static_cast<int8_t>(pos / 3) : -1;
+            }
+      return true;
+   }();
+   (void)interleaveInit;
+
+   __m128i luts[3][4];
+   for (int channel = 0; channel < 3; channel++)
+      for (int k = 0; k < 4; k++)
+         luts[channel][k] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&lut[channel][k * 16]));
+   __m128i masks[3][3];
+   for (int block = 0; block < 3; block++)
+      for (int channel = 0; channel < 3; channel++)
+         masks[block][channel] = _mm_load_si128(reinterpret_cast<const __m128i*>(interleave[block][channel]));
+   const __m128i lowMask = _mm_set1_epi8(0x0F);
+
+   unsigned int i = 0;
+   for (; i + 16 <= size; i += 16)
+   {
+      const __m128i index = _mm_loadu_si128(reinterpret_cast<const __m128i*>(frame + i));
+      const __m128i lo = _mm_and_si128(index, lowMask);
+      const __m128i hi = _mm_and_si128(_mm_srli_epi16(index, 4), lowMask);
+      __m128i select[4];
+      for (int k = 0; k < 4; k++)
+         select[k] = _mm_cmpeq_epi8(hi, _mm_set1_epi8(static_cast<char>(k)));
+      __m128i channels[3];
+      for (int channel = 0; channel < 3; channel++)
+      {
+         channels[channel] = _mm_and_si128(_mm_shuffle_epi8(luts[channel][0], lo), select[0]);
+         for (int k = 1; k < 4; k++)
+            channels[channel] = _mm_or_si128(channels[channel], _mm_and_si128(_mm_shuffle_epi8(luts[channel][k], lo), select[k]));
+      }
+      for (int block = 0; block < 3; block++)
+      {
+         const __m128i rgb = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(channels[0], masks[block][0]), _mm_shuffle_epi8(channels[1], masks[block][1])), _mm_shuffle_epi8(channels[2], masks[block][2]));
+         _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 3 + block * 16), rgb);
+      }
+   }
+   return i;
+}
+#endif
+
 class ColorizationState
 {
 public:
@@ -55,8 +160,39 @@ public:
    void UpdateFrameV1()
    {
       assert(pSerum && (pSerum->SerumVersion == SERUM_V1));
-      for (unsigned int i = 0; i < m_width * m_height; i++)
-         memcpy(&(m_colorFrame[i * 3]), &pSerum->palette[pSerum->frame[i] * 3], 3);
+      const unsigned int size = m_width * m_height;
+      const uint8_t* const __restrict frame = pSerum->frame;
+      const uint8_t* const __restrict palette = pSerum->palette;
+      unsigned int i = 0;
+      #if defined(SERUM_NEON) || defined(SERUM_SSSE3)
+         // Serum v1 palettes have 64 colors, split them into one lookup table per channel
+         uint8_t lut[3][64];
+         for (int j = 0; j < 64; j++)
+         {
+            lut[0][j] = palette[j * 3];
+            lut[1][j] = palette[j * 3 + 1];
+            lut[2][j] = palette[j * 3 + 2];
+         }
+      #endif
+      #if defined(SERUM_NEON)
+         const uint8x16x4_t lutR = { { vld1q_u8(&lut[0][0]), vld1q_u8(&lut[0][16]), vld1q_u8(&lut[0][32]), vld1q_u8(&lut[0][48]) } };
+         const uint8x16x4_t lutG = { { vld1q_u8(&lut[1][0]), vld1q_u8(&lut[1][16]), vld1q_u8(&lut[1][32]), vld1q_u8(&lut[1][48]) } };
+         const uint8x16x4_t lutB = { { vld1q_u8(&lut[2][0]), vld1q_u8(&lut[2][16]), vld1q_u8(&lut[2][32]), vld1q_u8(&lut[2][48]) } };
+         for (; i + 16 <= size; i += 16)
+         {
+            const uint8x16_t index = vld1q_u8(frame + i);
+            uint8x16x3_t rgb;
+            rgb.val[0] = vqtbl4q_u8(lutR, index);
+            rgb.val[1] = vqtbl4q_u8(lutG, index);
+            rgb.val[2] = vqtbl4q_u8(lutB, index);
+            vst3q_u8(m_colorFrame + i * 3, rgb);
+         }
+      #elif defined(SERUM_SSSE3)
+         if (HasSSSE3())
+            i = ExpandPaletteSSSE3(m_colorFrame, frame, lut, size);
+      #endif
+      for (; i < size; i++)
+         memcpy(&(m_colorFrame[i * 3]), &palette[frame[i] * 3], 3);
       m_colorizedframeId++;
    }
    void UpdateFrame32V2()
@@ -114,9 +250,15 @@ void onGetIdentifyDMD(const unsigned int eventId, void* userData, void* msgData)
    if ((getDmdMsg->frame == nullptr) || (getDmdMsg->frameId == lastRawFrameId))
       return;
 
+   // Skip identification if the frame content did not change (keeping the previous colorized frame and its id)
+   lastRawFrameId = getDmdMsg->frameId;
+   const uint64_t rawFrameHash = HashFrame(getDmdMsg->frame, getDmdMsg->width * getDmdMsg->height);
+   if (rawFrameHash == lastRawFrameHash)
+      return;
+   lastRawFrameHash = rawFrameHash;
+
    // We received a raw frame to identify/colorize (eventually requested by us)
    const uint32_t firstrot = Serum_Colorize(getDmdMsg->frame);
-   lastRawFrameId = getDmdMsg->frameId;
    if (pSerum->triggerID != 0xffffffff)
       msgApi->BroadcastMsg(endpointId, onDmdTrigger, &pSerum->triggerID);
    if (firstrot != IDENTIFY_NO_FRAME)
@@ -178,7 +320,7 @@ void onGetRenderDMD(const unsigned int eventId, void* userData, void* msgData)
 
    // Update to the last 'raw' frame
    GetRawDmdMsg getRawDmdMsg = { dmdId };
-   msgApi->BroadcastMsg(endpointId, getIdentifyDmdId, &getRawDmdMsg);
+   msgApi->SendResMsg(endpointId, getIdentifyDmdId, dmdId.id, &getRawDmdMsg);
    onGetIdentifyDMD(getIdentifyDmdId, nullptr, static_cast<void*>(&getRawDmdMsg));
    if (state == nullptr)
       return;
@@ -275,6 +417,7 @@ void onGameStart(const unsigned int eventId, void* userData, void* msgData)
       msgApi->GetSetting("Serum", "CRZFolder", crzFolder, sizeof(crzFolder));
    pSerum = Serum_Load(crzFolder, msg->gameId, FLAG_REQUEST_32P_FRAMES | FLAG_REQUEST_64P_FRAMES);
    dmdSelected = false;
+   lastRawFrameHash = 0;
    if (pSerum)
    {
       msgApi->SubscribeMsg(endpointId, getDmdSrcId, onGetRenderDMDSrc, nullptr);
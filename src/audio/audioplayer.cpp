@@ -200,6 +200,40 @@ bool AudioPlayer::StreamInit(DWORD frequency, int channels, const float volume)
    return true;
 }
 
+bool AudioPlayer::StreamInit(DWORD frequency, int channels, bool floatSamples, const float volume, StreamReadCallback readCallback, void* readContext)
+{
+   if (g_pvp->m_ps.bass_BG_idx != -1 && g_pvp->m_ps.bass_STD_idx != g_pvp->m_ps.bass_BG_idx) BASS_SetDevice(g_pvp->m_ps.bass_BG_idx);
+
+   m_readCallback = readCallback;
+   m_readContext = readContext;
+   m_stream = BASS_StreamCreate( frequency, channels, floatSamples ? BASS_SAMPLE_FLOAT : 0, &AudioPlayer::StreamProc, this );
+
+   if (m_stream == 0) {
+      const int code = BASS_ErrorGetCode();
+      string message;
+      BASS_ErrorMapCode(code, message);
+      g_pvp->MessageBox(("BASS music/sound library cannot play stream (error " + std::to_string(code) + ": " + message + ')').c_str(), "Error", MB_ICONERROR);
+      return false;
+   }
+
+   // No playback buffering: the ring buffer is read directly by the device update thread, otherwise BASS would prefetch it and add its buffer length to the latency
+   BASS_ChannelSetAttribute(m_stream, BASS_ATTRIB_BUFFER, 0.f);
+   BASS_ChannelSetAttribute(m_stream, BASS_ATTRIB_VOL, volume);
+   BASS_ChannelPlay(m_stream, 0);
+
+   return true;
+}
+
+DWORD CALLBACK AudioPlayer::StreamProc(HSTREAM handle, void* buffer, DWORD length, void* user)
+{
+   // Called on BASS update thread: on underrun, pad with silence to keep the stream running without adding latency
+   const AudioPlayer* const me = static_cast<AudioPlayer*>(user);
+   const unsigned int read = me->m_readCallback(me->m_readContext, static_cast<uint8_t*>(buffer), length);
+   if (read < length)
+      memset(static_cast<uint8_t*>(buffer) + read, 0, length - read);
+   return length;
+}
+
 void AudioPlayer::StreamUpdate(void* buffer, DWORD length) 
 {
    if (m_stream)
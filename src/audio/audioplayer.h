@@ -61,6 +61,14 @@ public:
    void StreamUpdate(void* buffer, DWORD length);
    void StreamVolume(const float volume);
 
+   // Pulled stream: samples are read through the given callback from the audio device thread (no buffering through StreamUpdate)
+   typedef unsigned int (*StreamReadCallback)(void* context, uint8_t* buffer, unsigned int size);
+   bool StreamInit(DWORD frequency, int channels, bool floatSamples, const float volume, StreamReadCallback readCallback, void* readContext);
+
 private:
+   static DWORD CALLBACK StreamProc(HSTREAM handle, void* buffer, DWORD length, void* user);
+
    HSTREAM m_stream;
+   StreamReadCallback m_readCallback = nullptr;
+   void* m_readContext = nullptr;
 };
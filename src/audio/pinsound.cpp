@@ -81,10 +81,24 @@ PinSound::~PinSound()
    UnInitialize();
 
    delete [] m_pdata;
+   MemoryAccounting::Add(MemoryAccounting::SOUND, -m_accountedMemory);
+}
+
+void PinSound::UpdateMemoryAccounting()
+{
+   const int64_t size = (m_pdata ? m_cdata : 0) + (int64_t)(m_mixerSamples.capacity() * sizeof(float));
+   MemoryAccounting::Add(MemoryAccounting::SOUND, size - m_accountedMemory);
+   m_accountedMemory = size;
 }
 
 void PinSound::UnInitialize()
 {
+   if (g_pvp->m_ps.GetMixer())
+      g_pvp->m_ps.GetMixer()->Release(this);
+   m_mixerSamples.clear();
+   m_mixerSamples.shrink_to_fit();
+   m_mixerChannels = 0;
+
    if (IsWav())
    {
 #ifndef __STANDALONE__
@@ -114,6 +128,7 @@ class PinDirectSound *PinSound::GetPinDirectSound()
 HRESULT PinSound::ReInitialize()
 {
    UnInitialize();
+   UpdateMemoryAccounting();
 
    if(!IsWav())
    {
@@ -140,6 +155,9 @@ HRESULT PinSound::ReInitialize()
 		   BASS_ChannelGetAttribute(m_BASSstream, BASS_ATTRIB_FREQ, &m_freq);
 	   }
 
+	   if (g_pvp->m_ps.GetMixer() && m_outputTarget == SNDOUT_TABLE)
+		   PrepareMixerSamples();
+
 	   return S_OK;
    }
 
@@ -273,7 +291,7 @@ void PinSound::Play(const float volume, const float randompitch, const int pitch
          BASS_ChannelSetAttribute(m_BASSstream, BASS_ATTRIB_FREQ, freq);
       }
 
-      const SoundConfigTypes SoundMode3D = (m_outputTarget == SNDOUT_BACKGLASS) ? SNDCFG_SND3D2CH : (SoundConfigTypes)g_pvp->m_settings.LoadValueWithDefault(Settings::Player, "Sound3D"s, (int)SNDCFG_SND3D2CH);
+      const SoundConfigTypes SoundMode3D = (m_outputTarget == SNDOUT_BACKGLASS) ? SNDCFG_SND3D2CH : g_pvp->m_ps.GetSoundMode3D();
       switch (SoundMode3D)
       {
       case SNDCFG_SND3DALLREAR:
@@ -336,6 +354,9 @@ void PinSound::Play(const float volume, const float randompitch, const int pitch
 
 void PinSound::Stop()
 {
+   if (g_pvp->m_ps.GetMixer())
+      g_pvp->m_ps.GetMixer()->Stop(this);
+
    if (IsWav())
       StopInternal();
    else
@@ -346,6 +367,336 @@ void PinSound::Stop()
       }
 }
 
+// Decode the whole sound to float samples for the software mixer, done when the sound is (re)initialized so that playing never decodes on the script thread.
+// If decoding fails, the sound is played through its own BASS channel instead.
+void PinSound::PrepareMixerSamples()
+{
+   const HSTREAM decoder = BASS_StreamCreateFile(TRUE, m_pdata, 0, m_cdata, BASS_STREAM_DECODE | BASS_SAMPLE_FLOAT);
+   if (decoder == 0)
+      return;
+
+   BASS_CHANNELINFO info;
+   if (!BASS_ChannelGetInfo(decoder, &info) || info.chans == 0 || (float)info.freq != m_freq)
+   {
+      BASS_StreamFree(decoder);
+      return;
+   }
+
+   // Only keep the first 2 channels, the mixer does the positioning itself
+   m_mixerChannels = (info.chans > 2) ? 2 : (unsigned int)info.chans;
+   const QWORD length = BASS_ChannelGetLength(decoder, BASS_POS_BYTE);
+   if (length != (QWORD)-1)
+      m_mixerSamples.reserve((size_t)(length / (sizeof(float) * info.chans)) * m_mixerChannels);
+   float block[4096];
+   const DWORD blockBytes = (DWORD)(sizeof(block) / (sizeof(float) * info.chans) * (sizeof(float) * info.chans));
+   while (true)
+   {
+      const DWORD read = BASS_ChannelGetData(decoder, block, blockBytes);
+      if (read == (DWORD)-1 || read == 0)
+         break;
+      const unsigned int frames = read / (unsigned int)(sizeof(float) * info.chans);
+      for (unsigned int i = 0; i < frames; ++i)
+         for (unsigned int c = 0; c < m_mixerChannels; ++c)
+            m_mixerSamples.push_back(block[i * info.chans + c]);
+   }
+   BASS_StreamFree(decoder);
+
+   if (m_mixerSamples.size() < m_mixerChannels * 2)
+   {
+      m_mixerSamples.clear();
+      m_mixerSamples.shrink_to_fit();
+   }
+   UpdateMemoryAccounting();
+}
+
+PinSoundMixer::PinSoundMixer(const SoundConfigTypes mode, const DWORD frequency)
+   : m_mode(mode), m_channels((mode == SNDCFG_SND3DSSF) ? 8 : 2), m_frequency((float)frequency)
+{
+   for (Voice& voice : m_voices)
+      voice.sound = nullptr;
+
+   m_stream = BASS_StreamCreate(frequency, m_channels, BASS_SAMPLE_FLOAT, &StreamProc, this);
+   if (m_stream == 0)
+   {
+      const int code = BASS_ErrorGetCode();
+      string bla;
+      BASS_ErrorMapCode(code, bla);
+      PLOGE << "BASS software mixer stream creation error " << code << ": " << bla;
+      return;
+   }
+   // No playback buffering: the stream is rendered directly by the device update thread, keeping latency as low as with individual channels
+   BASS_ChannelSetAttribute(m_stream, BASS_ATTRIB_BUFFER, 0.f);
+   BASS_ChannelPlay(m_stream, FALSE);
+}
+
+PinSoundMixer::~PinSoundMixer()
+{
+   if (m_stream)
+      BASS_StreamFree(m_stream);
+}
+
+void PinSoundMixer::Play(const PinSound * const pps, const float volume, const float randompitch, const int pitch, const float pan, const float front_rear_fade, const bool loop, const bool restart)
+{
+   Command cmd;
+   cmd.type = CMD_PLAY;
+   cmd.sound = pps;
+   cmd.loop = loop;
+   cmd.restart = restart;
+
+   float freq = pps->m_freq + (float)pitch;
+   if (randompitch > 0.f)
+   {
+      const float rndh = rand_mt_01();
+      const float rndl = rand_mt_01();
+      freq += (freq * randompitch * rndh * rndh) - (freq * randompitch * rndl * rndl * 0.5f);
+   }
+   cmd.step = max(freq, 1.f) / m_frequency;
+
+   const float vol = sqrtf(saturate(volume*(float)(1.0/100.))); // to match VP legacy
+   if (m_mode == SNDCFG_SND3DSSF)
+   {
+      // Equal power panning using the SSF pan [-3,3] and fade [-3,0] mappings: like the BASS 3D listener, z = 0 is the side pair and z = -3 the rear pair
+      const float lr = (PinDirectSound::PanSSF(pan) + 3.0f) * (float)(1.0 / 6.0);
+      const float rear = saturate(PinDirectSound::FadeSSF(front_rear_fade) * (float)(-1.0 / 3.0));
+      const float l = cosf(lr * (float)(M_PI / 2.0)), r = sinf(lr * (float)(M_PI / 2.0));
+      const float s = cosf(rear * (float)(M_PI / 2.0)), b = sinf(rear * (float)(M_PI / 2.0));
+      cmd.gain[0] = vol * l * s;
+      cmd.gain[1] = vol * r * s;
+      cmd.gain[2] = vol * l * b;
+      cmd.gain[3] = vol * r * b;
+   }
+   else
+   {
+      // Balance, like BASS_ATTRIB_PAN on a stereo channel
+      const float p = clamp(pan, -1.f, 1.f);
+      cmd.gain[0] = vol * min(1.f - p, 1.f);
+      cmd.gain[1] = vol * min(1.f + p, 1.f);
+      cmd.gain[2] = cmd.gain[3] = 0.f;
+   }
+
+   PostCommand(cmd);
+}
+
+void PinSoundMixer::Stop(const PinSound * const pps)
+{
+   Command cmd;
+   cmd.type = CMD_STOP;
+   cmd.sound = pps;
+   PostCommand(cmd);
+}
+
+void PinSoundMixer::StopAll()
+{
+   Command cmd;
+   cmd.type = CMD_STOPALL;
+   cmd.sound = nullptr;
+   PostCommand(cmd);
+}
+
+void PinSoundMixer::Release(const PinSound * const pps)
+{
+   if (m_stream == 0)
+      return;
+   BASS_ChannelLock(m_stream, TRUE);
+   ProcessCommands();
+   for (Voice& voice : m_voices)
+      if (voice.sound == pps)
+         voice.sound = nullptr;
+   BASS_ChannelLock(m_stream, FALSE);
+}
+
+void PinSoundMixer::PostCommand(const Command& cmd)
+{
+   if (m_stream == 0)
+      return;
+   const unsigned int write = m_commandWrite.load(std::memory_order_relaxed);
+   const unsigned int next = (write + 1) % MAX_COMMANDS;
+   if (next == m_commandRead.load(std::memory_order_acquire))
+   {
+      // Queue is full (audio thread not keeping up or stalled): drain it here while the stream callback is locked out
+      BASS_ChannelLock(m_stream, TRUE);
+      ProcessCommands();
+      BASS_ChannelLock(m_stream, FALSE);
+   }
+   m_commands[write] = cmd;
+   m_commandWrite.store(next, std::memory_order_release);
+}
+
+void PinSoundMixer::ProcessCommands()
+{
+   unsigned int read = m_commandRead.load(std::memory_order_relaxed);
+   const unsigned int write = m_commandWrite.load(std::memory_order_acquire);
+   for (; read != write; read = (read + 1) % MAX_COMMANDS)
+   {
+      const Command& cmd = m_commands[read];
+      switch (cmd.type)
+      {
+      case CMD_PLAY: StartVoice(cmd); break;
+      case CMD_STOP:
+         for (Voice& voice : m_voices)
+            if (voice.sound == cmd.sound)
+               voice.sound = nullptr;
+         break;
+      case CMD_STOPALL:
+         for (Voice& voice : m_voices)
+            voice.sound = nullptr;
+         break;
+      }
+   }
+   m_commandRead.store(read, std::memory_order_release);
+}
+
+void PinSoundMixer::StartVoice(const Command& cmd)
+{
+   const float priority = max(max(cmd.gain[0], cmd.gain[1]), max(cmd.gain[2], cmd.gain[3])) + (cmd.loop ? 1.f : 0.f);
+
+   // Same as a single BASS channel per sound: update the playing voice, only rewinding it if requested
+   Voice *target = nullptr;
+   for (Voice& voice : m_voices)
+      if (voice.sound == cmd.sound)
+      {
+         target = &voice;
+         if (cmd.restart)
+            target->position = 0.;
+         break;
+      }
+
+   if (target == nullptr)
+   {
+      // Use a free voice, or steal the one with the lowest priority if it is below the new one
+      for (Voice& voice : m_voices)
+      {
+         if (voice.sound == nullptr)
+         {
+            target = &voice;
+            break;
+         }
+         if (target == nullptr || voice.priority < target->priority)
+            target = &voice;
+      }
+      if (target->sound != nullptr && target->priority > priority)
+         return;
+      target->position = 0.;
+   }
+
+   target->sound = cmd.sound;
+   target->step = cmd.step;
+   memcpy(target->gain, cmd.gain, sizeof(cmd.gain));
+   target->priority = priority;
+   target->loop = cmd.loop;
+}
+
+void PinSoundMixer::MixVoice(Voice& voice, float * __restrict out, const unsigned int frames) const
+{
+   const float * __restrict const src = voice.sound->m_mixerSamples.data();
+   const unsigned int srcChannels = voice.sound->m_mixerChannels;
+   const unsigned int srcFrames = (unsigned int)(voice.sound->m_mixerSamples.size() / srcChannels);
+   const double step = voice.step;
+   double position = voice.position;
+   unsigned int i = 0;
+
+#ifdef ENABLE_SSE_OPTIMIZATIONS
+   // Stereo output, 4 frames at a time with linear interpolation, as long as all source frames are inside the sample (no wrap/end handling)
+   if (m_channels == 2)
+   {
+      const __m128 gl = _mm_set1_ps(voice.gain[0]);
+      const __m128 gr = _mm_set1_ps(voice.gain[1]);
+      for (; i + 4 <= frames && position + 3. * step + 1. < (double)srcFrames; i += 4)
+      {
+         unsigned int idx[4];
+         float frac[4];
+         for (unsigned int k = 0; k < 4; ++k)
+         {
+            const double p = position + (double)k * step;
+            idx[k] = (unsigned int)p;
+            frac[k] = (float)(p - (double)idx[k]);
+         }
+         const __m128 t = _mm_loadu_ps(frac);
+         __m128 l, r;
+         if (srcChannels == 1)
+         {
+            const __m128 a = _mm_set_ps(src[idx[3]], src[idx[2]], src[idx[1]], src[idx[0]]);
+            const __m128 b = _mm_set_ps(src[idx[3] + 1], src[idx[2] + 1], src[idx[1] + 1], src[idx[0] + 1]);
+            l = r = _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), t));
+         }
+         else
+         {
+            const __m128 al = _mm_set_ps(src[idx[3] * 2], src[idx[2] * 2], src[idx[1] * 2], src[idx[0] * 2]);
+            const __m128 bl = _mm_set_ps(src[idx[3] * 2 + 2], src[idx[2] * 2 + 2], src[idx[1] * 2 + 2], src[idx[0] * 2 + 2]);
+            const __m128 ar = _mm_set_ps(src[idx[3] * 2 + 1], src[idx[2] * 2 + 1], src[idx[1] * 2 + 1], src[idx[0] * 2 + 1]);
+            const __m128 br = _mm_set_ps(src[idx[3] * 2 + 3], src[idx[2] * 2 + 3], src[idx[1] * 2 + 3], src[idx[0] * 2 + 3]);
+            l = _mm_add_ps(al, _mm_mul_ps(_mm_sub_ps(bl, al), t));
+            r = _mm_add_ps(ar, _mm_mul_ps(_mm_sub_ps(br, ar), t));
+         }
+         l = _mm_mul_ps(l, gl);
+         r = _mm_mul_ps(r, gr);
+         float * const o = out + i * 2;
+         _mm_storeu_ps(o,     _mm_add_ps(_mm_loadu_ps(o),     _mm_unpacklo_ps(l, r)));
+         _mm_storeu_ps(o + 4, _mm_add_ps(_mm_loadu_ps(o + 4), _mm_unpackhi_ps(l, r)));
+         position += 4. * step;
+      }
+   }
+#endif
+
+   for (; i < frames; ++i)
+   {
+      if (position >= (double)srcFrames)
+      {
+         if (!voice.loop)
+         {
+            voice.sound = nullptr;
+            return;
+         }
+         position = fmod(position, (double)srcFrames);
+      }
+      const unsigned int i0 = (unsigned int)position;
+      const unsigned int i1 = (i0 + 1 < srcFrames) ? i0 + 1 : (voice.loop ? 0 : i0);
+      const float t = (float)(position - (double)i0);
+      float l, r;
+      if (srcChannels == 1)
+         l = r = src[i0] + (src[i1] - src[i0]) * t;
+      else
+      {
+         l = src[i0 * 2    ] + (src[i1 * 2    ] - src[i0 * 2    ]) * t;
+         r = src[i0 * 2 + 1] + (src[i1 * 2 + 1] - src[i0 * 2 + 1]) * t;
+      }
+      if (m_channels == 2)
+      {
+         out[i * 2    ] += l * voice.gain[0];
+         out[i * 2 + 1] += r * voice.gain[1];
+      }
+      else
+      {
+         // 7.1 channel order is front L/R, center, LFE, side L/R, rear L/R
+         const float m = (l + r) * 0.5f;
+         out[i * 8 + 4] += m * voice.gain[0];
+         out[i * 8 + 5] += m * voice.gain[1];
+         out[i * 8 + 6] += m * voice.gain[2];
+         out[i * 8 + 7] += m * voice.gain[3];
+      }
+      position += step;
+   }
+   voice.position = position;
+}
+
+DWORD CALLBACK PinSoundMixer::StreamProc(HSTREAM handle, void *buffer, DWORD length, void *user)
+{
+   PinSoundMixer * const mixer = static_cast<PinSoundMixer*>(user);
+   mixer->ProcessCommands();
+
+   float * const out = static_cast<float*>(buffer);
+   const unsigned int frames = length / (unsigned int)(sizeof(float) * mixer->m_channels);
+   const unsigned int samples = frames * mixer->m_channels;
+   memset(out, 0, samples * sizeof(float));
+   for (Voice& voice : mixer->m_voices)
+      if (voice.sound)
+         mixer->MixVoice(voice, out, frames);
+   for (unsigned int i = 0; i < samples; ++i)
+      out[i] = clamp(out[i], -1.f, 1.f);
+
+   return samples * (DWORD)sizeof(float);
+}
+
 PinDirectSound::~PinDirectSound()
 {
 #ifndef __STANDALONE__
@@ -477,6 +828,7 @@ void AudioMusicPlayer::InitPinDirectSound(const Settings& settings, const HWND h
    const int DSidx2 = settings.LoadValueWithDefault(Settings::Player, "SoundDeviceBG"s, -1);
 #endif
    const SoundConfigTypes SoundMode3D = (SoundConfigTypes)settings.LoadValueWithDefault(Settings::Player, "Sound3D"s, (int)SNDCFG_SND3D2CH);
+   m_soundMode3D = SoundMode3D;
 
    //---- Initialize BASS Audio Library
 
@@ -544,6 +896,20 @@ void AudioMusicPlayer::InitPinDirectSound(const Settings& settings, const HWND h
          break;
    }
 
+   //---- Software mixer for table sounds (only for the modes it can map itself, others use BASS 3D positioning)
+   if ((SoundMode3D == SNDCFG_SND3D2CH || SoundMode3D == SNDCFG_SND3DSSF) && settings.LoadValueWithDefault(Settings::Player, "SoundMixer"s, false))
+   {
+      if (bass_STD_idx != -1 && bass_STD_idx != bass_BG_idx)
+         BASS_SetDevice(bass_STD_idx);
+      BASS_INFO info;
+      m_mixer = new PinSoundMixer(SoundMode3D, (BASS_GetInfo(&info) && info.freq > 0) ? info.freq : 44100);
+      if (!m_mixer->IsValid())
+      {
+         delete m_mixer;
+         m_mixer = nullptr;
+      }
+   }
+
    //---- Initialize DirectSound
    m_pds.InitDirectSound(hwnd, false);
    // If these are the same device, and we are not in 3d mode, just point the backglass device to the main one.
@@ -693,6 +1059,7 @@ PinSound *AudioMusicPlayer::LoadFile(const string& strFileName)
 	   }
    }
 
+   pps->UpdateMemoryAccounting();
    return pps;
 }
 
@@ -910,7 +1277,7 @@ void PinDirectSoundWavCopy::PlayInternal(const float volume, const float randomp
 		}
 	}
 
-	const SoundConfigTypes SoundMode3D = (m_ppsOriginal->GetOutputTarget() == SNDOUT_BACKGLASS) ? SNDCFG_SND3D2CH : (SoundConfigTypes)g_pvp->m_settings.LoadValueWithDefault(Settings::Player, "Sound3D"s, (int)SNDCFG_SND3D2CH);
+	const SoundConfigTypes SoundMode3D = (m_ppsOriginal->GetOutputTarget() == SNDOUT_BACKGLASS) ? SNDCFG_SND3D2CH : g_pvp->m_ps.GetSoundMode3D();
 
 	switch (SoundMode3D)
 	{
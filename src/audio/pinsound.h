@@ -3,6 +3,7 @@
 #pragma once
 
 #include "core/Settings.h"
+#include <atomic>
 
 void BASS_ErrorMapCode(const int code, string& text);
 
@@ -108,6 +109,9 @@ public:
    void Play(const float volume, const float randompitch, const int pitch, const float pan, const float front_rear_fade, const int flags, const bool restart);
    void Stop();
 
+   bool HasMixerSamples() const { return !m_mixerSamples.empty(); }
+   void UpdateMemoryAccounting(); // Report the sound data and decoded samples to the memory accounting
+
    union
    {
       class PinDirectSound *m_pPinDirectSound;
@@ -136,8 +140,15 @@ public:
    int m_cdata_org;
 #endif
 
+   // decoded float samples (1 or 2 channels interleaved) played by the software mixer, decoded when the sound is (re)initialized
+   vector<float> m_mixerSamples;
+   unsigned int m_mixerChannels = 0;
+
 private:
+   void PrepareMixerSamples();
+
    SoundOutTypes m_outputTarget;
+   int64_t m_accountedMemory = 0;
 };
 
 
@@ -159,6 +170,77 @@ private:
    LPDIRECTSOUND3DLISTENER m_pDSListener;
 };
 
+// Software mixer for table sounds
+// ===============================
+//
+// Instead of driving one BASS channel per sound (and setting its attributes and 3D position on every call),
+// table sounds are mixed into a single BASS output stream from a fixed pool of voices. The script thread
+// only posts commands to a lock free queue, which is drained by the BASS update thread in the stream callback
+// before mixing. When all voices are in use, the one with the lowest priority (loudness, looping sounds first)
+// is stolen.
+//
+// 2CH mixes to stereo, SSF mixes to a 7.1 stream using the same pan/fade curves as the BASS 3D path: like there, playfield
+// sounds are faded between the side (top of the playfield) and rear (bottom of the playfield) pairs, and never reach the front (backbox) ones.
+//
+// Like a single BASS channel per sound, a sound only uses one voice at a time: playing it again updates the playing voice.
+
+class PinSoundMixer
+{
+public:
+   PinSoundMixer(const SoundConfigTypes mode, const DWORD frequency);
+   ~PinSoundMixer();
+
+   bool IsValid() const { return m_stream != 0; }
+
+   void Play(const PinSound * const pps, const float volume, const float randompitch, const int pitch, const float pan, const float front_rear_fade, const bool loop, const bool restart);
+   void Stop(const PinSound * const pps);
+   void StopAll();
+   void Release(const PinSound * const pps); // Synchronously remove all voices of a sound before its samples get freed
+
+private:
+   static constexpr unsigned int MAX_VOICES = 64;
+   static constexpr unsigned int MAX_COMMANDS = 256;
+
+   enum CommandType : char { CMD_PLAY, CMD_STOP, CMD_STOPALL };
+
+   struct Command
+   {
+      CommandType type;
+      bool loop;
+      bool restart;
+      const PinSound *sound;
+      float step;
+      float gain[4]; // left/right for 2CH, side left/right then rear left/right for SSF
+   };
+
+   struct Voice
+   {
+      const PinSound *sound; // nullptr if the voice is free
+      double position; // in source frames
+      float step;
+      float gain[4];
+      float priority;
+      bool loop;
+   };
+
+   static DWORD CALLBACK StreamProc(HSTREAM handle, void *buffer, DWORD length, void *user);
+   void PostCommand(const Command& cmd);
+   void ProcessCommands();
+   void StartVoice(const Command& cmd);
+   void MixVoice(Voice& voice, float * __restrict out, const unsigned int frames) const;
+
+   const SoundConfigTypes m_mode;
+   const unsigned int m_channels;
+   const float m_frequency;
+   HSTREAM m_stream = 0;
+
+   Voice m_voices[MAX_VOICES];
+
+   Command m_commands[MAX_COMMANDS]; // single producer (script thread) / single consumer (audio thread) ring
+   std::atomic<unsigned int> m_commandRead { 0 };
+   std::atomic<unsigned int> m_commandWrite { 0 };
+};
+
 
 class AudioMusicPlayer
 {
@@ -166,6 +248,7 @@ public:
 	AudioMusicPlayer() : m_pbackglassds(nullptr) {}
 	~AudioMusicPlayer()
 	{
+		delete m_mixer;
 		if (m_pbackglassds != &m_pds) delete m_pbackglassds;
       BASS_Stop();
       BASS_Free();
@@ -175,6 +258,8 @@ public:
 
 	void ReInitPinDirectSound(const Settings& settings, const HWND hwnd)
 	{
+		delete m_mixer;
+		m_mixer = nullptr;
 		if (m_pbackglassds != &m_pds) delete m_pbackglassds;
       BASS_Stop();
       BASS_Free();
@@ -187,6 +272,9 @@ public:
 		return (outputTarget == SNDOUT_BACKGLASS) ? m_pbackglassds : &m_pds;
 	}
 
+	SoundConfigTypes GetSoundMode3D() const { return m_soundMode3D; }
+	PinSoundMixer* GetMixer() const { return m_mixer; }
+
 	void StopCopiedWav(const string& name)
 	{
 #ifndef __STANDALONE__
@@ -204,6 +292,8 @@ public:
 
 	void StopCopiedWavs()
 	{
+		if (m_mixer)
+			m_mixer->StopAll();
 #ifndef __STANDALONE__
 		for (size_t i = 0; i < m_copiedwav.size(); i++)
 			m_copiedwav[i]->m_pDSBuffer->Stop();
@@ -212,6 +302,8 @@ public:
 
 	void StopAndClearCopiedWavs()
 	{
+		if (m_mixer)
+			m_mixer->StopAll();
 #ifndef __STANDALONE__
 		for (size_t i = 0; i < m_copiedwav.size(); i++)
 		{
@@ -248,6 +340,17 @@ public:
 	{
 		const int flags = (loopcount == -1) ? DSBPLAY_LOOPING : 0;
 
+		if (m_mixer && pps->HasMixerSamples())
+		{
+			// Same restart rule as the per sound BASS channel path below
+#ifdef ONLY_USE_BASS
+			m_mixer->Play(pps, volume, randompitch, pitch, pan, front_rear_fade, loopcount == -1, (pps->IsWav2() && !usesame) ? true : restart);
+#else
+			m_mixer->Play(pps, volume, randompitch, pitch, pan, front_rear_fade, loopcount == -1, restart);
+#endif
+			return;
+		}
+
 		if (!pps->IsWav())
 		{
 #ifdef ONLY_USE_BASS
@@ -298,6 +401,9 @@ private:
 	PinDirectSound m_pds;
 	PinDirectSound *m_pbackglassds;
 
+	SoundConfigTypes m_soundMode3D = SNDCFG_SND3D2CH; // cached, as changing it reinitializes the sound system anyway
+	PinSoundMixer *m_mixer = nullptr;
+
 	vector< PinDirectSoundWavCopy* > m_copiedwav; // copied sounds currently playing
 };
 
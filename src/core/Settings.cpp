@@ -16,6 +16,9 @@ static const string regKey[Settings::Plugin00] = { "Controller"s, "Editor"s, "St
    };
 vector<string> Settings::m_settingKeys = vector<string>(regKey, regKey + Settings::Section::Plugin00);
 vector<Settings::OptionDef> Settings::m_pluginOptions;
+vector<std::pair<Settings::Section, string>> Settings::m_handleKeys;
+std::atomic<unsigned int> Settings::m_globalVersion { 1 };
+std::mutex Settings::m_cacheMutex;
 
 Settings::Section Settings::GetSection(const string& name)
 {
@@ -40,6 +43,23 @@ Settings::Settings(const Settings* parent)
 {
 }
 
+Settings &Settings::operator=(const Settings &other)
+{
+   if (this == &other)
+      return *this;
+   std::lock_guard<std::mutex> lock(m_cacheMutex);
+   m_modified = other.m_modified;
+   m_iniPath = other.m_iniPath;
+   m_ini = other.m_ini;
+   m_parent = other.m_parent;
+   m_tableOptions = other.m_tableOptions;
+   m_cache = other.m_cache;
+   #ifdef DEBUG
+      m_validatedKeys = other.m_validatedKeys;
+   #endif
+   return *this;
+}
+
 void Settings::Validate(const Section section, const string &key, const string& defVal, const bool addDefaults)
 {
    #ifdef DEBUG
@@ -176,7 +196,13 @@ bool Settings::LoadFromFile(const string& path, const bool createDefault)
    m_modified = false;
    m_iniPath = path;
    mINI::INIFile file(path);
-   if (file.read(m_ini))
+   bool loaded;
+   {
+      std::lock_guard<std::mutex> lock(m_cacheMutex);
+      loaded = file.read(m_ini);
+      m_globalVersion++;
+   }
+   if (loaded)
    {
       PLOGI << "Settings file was loaded from '" << path << '\'';
       Validate(createDefault);
@@ -203,10 +229,12 @@ bool Settings::LoadFromFile(const string& path, const bool createDefault)
       {
          ShowError("Copying of default settings file 'Default_VPinballX.ini' from the 'assets' folder failed");
       }
+      std::unique_lock<std::mutex> lock(m_cacheMutex);
       if (!file.read(m_ini))
       {
          PLOGE << "Loading of default settings file failed";
       }
+      m_globalVersion++;
 
       #ifdef _WIN32
       // For Windows, get settings values from windows registry (which was used to store settings before 10.8)
@@ -295,6 +323,7 @@ bool Settings::LoadFromFile(const string& path, const bool createDefault)
          RegCloseKey(hk);
       }
       #endif
+      lock.unlock();
       Validate(true); // Guarantee a valid setting setup with defaults defined
       return true;
    }
@@ -335,6 +364,7 @@ void Settings::Save()
 void Settings::CopyOverrides(const Settings& settings)
 {
    assert(m_parent != nullptr); // Overrides are defined relatively to a parent
+   std::unique_lock<std::mutex> lock(m_cacheMutex);
    for (const auto& section : settings.m_ini)
    {
       for (const auto& item : section.second)
@@ -358,6 +388,8 @@ void Settings::CopyOverrides(const Settings& settings)
          }
       }
    }
+   lock.unlock();
+   OnModified();
 }
 
 bool Settings::HasValue(const Section section, const string& key, const bool searchParent) const
@@ -514,13 +546,21 @@ bool Settings::SaveValue(const Section section, const string &key, const DataTyp
          if (m_ini.get(m_settingKeys[section]).has(key))
          {
             m_modified = true;
-            m_ini[m_settingKeys[section]].remove(key);
+            {
+               std::lock_guard<std::mutex> lock(m_cacheMutex);
+               m_ini[m_settingKeys[section]].remove(key);
+            }
+            OnModified();
          }
          return true;
       }
    }
    m_modified = true;
-   m_ini[m_settingKeys[section]][key] = copy;
+   {
+      std::lock_guard<std::mutex> lock(m_cacheMutex);
+      m_ini[m_settingKeys[section]][key] = copy;
+   }
+   OnModified();
    return true;
 }
 
@@ -565,7 +605,11 @@ bool Settings::DeleteValue(const Section section, const string &key, const bool
    if (m_ini.get(m_settingKeys[section]).has(key))
    {
       m_modified = true;
-      success &= m_ini[m_settingKeys[section]].remove(key);
+      {
+         std::lock_guard<std::mutex> lock(m_cacheMutex);
+         success &= m_ini[m_settingKeys[section]].remove(key);
+      }
+      OnModified();
    }
    return success;
 }
@@ -578,11 +622,93 @@ bool Settings::DeleteSubKey(const Section section, const bool deleteFromParent)
    if (m_ini.has(m_settingKeys[section]))
    {
       m_modified = true;
-      success &= m_ini.remove(m_settingKeys[section]);
+      {
+         std::lock_guard<std::mutex> lock(m_cacheMutex);
+         success &= m_ini.remove(m_settingKeys[section]);
+      }
+      OnModified();
    }
    return success;
 }
 
+Settings::Handle Settings::GetHandle(const Section section, const string &key)
+{
+   // Handles are resolved once (usually stored in a static), so a linear search is fine here
+   std::lock_guard<std::mutex> lock(m_cacheMutex);
+   for (size_t i = 0; i < m_handleKeys.size(); i++)
+      if (m_handleKeys[i].first == section && m_handleKeys[i].second == key)
+         return (Handle)i;
+   if (m_handleKeys.size() == MAX_HANDLES)
+      PLOGE << "Too many settings handles, '" << m_settingKeys[section] << '/' << key << "' and the following ones will not be cached";
+   m_handleKeys.emplace_back(section, key);
+   return (Handle)(m_handleKeys.size() - 1);
+}
+
+void Settings::AddChangeListener(const Handle handle, const ChangeListener &listener)
+{
+   if (handle >= MAX_HANDLES)
+   {
+      PLOGE << "Change listeners are only supported for cached settings handles, listener ignored";
+      return;
+   }
+   GetCachedValue(handle); // Make sure the current value is known, to only notify actual changes
+   std::lock_guard<std::mutex> lock(m_cacheMutex);
+   m_cache.listeners.emplace_back(handle, listener);
+}
+
+void Settings::OnModified()
+{
+   m_globalVersion++;
+   bool hasListeners;
+   {
+      std::lock_guard<std::mutex> lock(m_cacheMutex);
+      hasListeners = !m_cache.listeners.empty();
+   }
+   if (hasListeners)
+      RefreshCache();
+}
+
+void Settings::RefreshCache() const
+{
+   vector<std::pair<Handle, ChangeListener>> notify;
+   {
+      std::lock_guard<std::mutex> lock(m_cacheMutex);
+      // The version is read first: if the settings are modified while refreshing, the cache stays outdated and will be refreshed again
+      const unsigned int version = m_globalVersion.load(std::memory_order_acquire);
+      const unsigned int nCached = m_cache.count.load(std::memory_order_relaxed);
+      const unsigned int nHandles = min((unsigned int)m_handleKeys.size(), MAX_HANDLES);
+      if (m_cache.version.load(std::memory_order_relaxed) == version && nCached == nHandles)
+         return; // Already refreshed by another thread
+      const bool notifyChanges = m_cache.version.load(std::memory_order_relaxed) != 0;
+      for (unsigned int i = 0; i < nHandles; i++)
+      {
+         string text;
+         const bool present = LoadValue(m_handleKeys[i].first, m_handleKeys[i].second, text);
+         const int intValue = present ? (int)atoll(text.c_str()) : 0;
+         float floatValue;
+         if (!present || !LoadValue(m_handleKeys[i].first, m_handleKeys[i].second, floatValue))
+            floatValue = 0.f;
+         CachedValue &cached = m_cache.values[i];
+         if (i < nCached && notifyChanges
+            && (cached.present.load(std::memory_order_relaxed) != present || cached.intValue.load(std::memory_order_relaxed) != intValue || cached.floatValue.load(std::memory_order_relaxed) != floatValue))
+         {
+            for (const auto &listener : m_cache.listeners)
+               if (listener.first == i)
+                  notify.push_back(listener);
+         }
+         cached.present.store(present, std::memory_order_relaxed);
+         cached.intValue.store(intValue, std::memory_order_relaxed);
+         cached.floatValue.store(floatValue, std::memory_order_relaxed);
+      }
+      m_cache.count.store(nHandles, std::memory_order_release);
+      m_cache.version.store(version, std::memory_order_release);
+   }
+
+   // Called outside of the lock, so that listeners may read or modify settings
+   for (const auto &listener : notify)
+      listener.second(listener.first);
+}
+
 void Settings::RegisterSetting(const Section section, const string& id, const unsigned int showMask, const string &name, float minValue, float maxValue, float step, float defaultValue, OptionUnit unit, const vector<string> &literals)
 {
    assert(section == TableOption || section >= Plugin00); // For the time being, this system is only used for custom table and plugin options (could be extend for all options to get the benefit of validation, fast access, and remove unneeded copied states...)
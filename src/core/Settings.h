@@ -5,6 +5,9 @@
 #define MINI_CASE_SENSITIVE
 #include "mINI/ini.h"
 #include "robin_hood.h"
+#include <atomic>
+#include <functional>
+#include <mutex>
 
 
 // This class holds the settings registry.
@@ -15,6 +18,8 @@ class Settings final
 {
 public:
    Settings(const Settings* parent = nullptr);
+   Settings(const Settings&) = default;
+   Settings &operator=(const Settings &other);
 
    void SetParent(const Settings *parent) { m_parent = parent; }
 
@@ -117,6 +122,21 @@ public:
    bool DeleteValue(const Section section, const string &key, const bool deleteFromParent = false);
    bool DeleteSubKey(const Section section, const bool deleteFromParent = false);
 
+   // Fast typed access for settings read at runtime.
+   // A handle is resolved once by section/key (handles are shared by all settings blocks) and indexes a per block array of pre-parsed values.
+   // The array is reparsed when any settings block is modified (since the value may come from the parent), and change listeners are notified
+   // for the values that actually changed. This happens immediately for modifications of this block, and on the next access for parent ones.
+   // Reads may be done from any thread (f.e. plugins): handle registration, reparsing and all modifications of the ini data are serialized by a lock.
+   // Only the first MAX_HANDLES handles are cached, later ones are still valid but fall back to a (slower) lookup of the ini data.
+   typedef unsigned int Handle;
+   static constexpr unsigned int MAX_HANDLES = 64;
+   typedef std::function<void(const Handle handle)> ChangeListener;
+   static Handle GetHandle(const Section section, const string &key);
+   int GetInt(const Handle handle, const int def) const { if (handle >= MAX_HANDLES) return GetUncachedValue(handle, def); const CachedValue &v = GetCachedValue(handle); return v.present.load(std::memory_order_relaxed) ? v.intValue.load(std::memory_order_relaxed) : def; }
+   float GetFloat(const Handle handle, const float def) const { if (handle >= MAX_HANDLES) return GetUncachedValue(handle, def); const CachedValue &v = GetCachedValue(handle); return v.present.load(std::memory_order_relaxed) ? v.floatValue.load(std::memory_order_relaxed) : def; }
+   bool GetBool(const Handle handle, const bool def) const { if (handle >= MAX_HANDLES) return GetUncachedValue(handle, def); const CachedValue &v = GetCachedValue(handle); return v.present.load(std::memory_order_relaxed) ? (v.intValue.load(std::memory_order_relaxed) != 0) : def; }
+   void AddChangeListener(const Handle handle, const ChangeListener &listener);
+
    enum OptionUnit
    {
       OT_NONE, // Display without a unit
@@ -147,11 +167,45 @@ private:
    bool LoadValue(const Section section, const string &key, DataType &type, void *pvalue, DWORD size) const;
    bool SaveValue(const Section section, const string &key, const DataType type, const void *pvalue, const DWORD size, const bool overrideMode);
 
+   // Fixed storage, so that values are never moved while being read from another thread
+   struct CachedValue
+   {
+      std::atomic<bool> present { false };
+      std::atomic<int> intValue { 0 };
+      std::atomic<float> floatValue { 0.f };
+   };
+   // Copying a settings block does not copy its cache and listeners, but invalidates all caches (the copied block may be the parent of others)
+   struct ValueCache
+   {
+      ValueCache() = default;
+      ValueCache(const ValueCache&) { }
+      ValueCache &operator=(const ValueCache&) { m_globalVersion++; return *this; }
+      CachedValue values[MAX_HANDLES];
+      std::atomic<unsigned int> count { 0 };
+      std::atomic<unsigned int> version { 0 };
+      vector<std::pair<Handle, ChangeListener>> listeners;
+   };
+   const CachedValue &GetCachedValue(const Handle handle) const
+   {
+      assert(handle < MAX_HANDLES); // Uncached handles are handled by the callers
+      if (m_cache.version.load(std::memory_order_acquire) != m_globalVersion.load(std::memory_order_acquire) || handle >= m_cache.count.load(std::memory_order_acquire))
+         RefreshCache();
+      return m_cache.values[handle];
+   }
+   template <typename T> T GetUncachedValue(const Handle handle, const T def) const
+   {
+      std::lock_guard<std::mutex> lock(m_cacheMutex);
+      return LoadValueWithDefault(m_handleKeys[handle].first, m_handleKeys[handle].second, def);
+   }
+   void RefreshCache() const;
+   void OnModified();
+
    bool m_modified = false;
    string m_iniPath;
    mINI::INIStructure m_ini;
    const Settings * m_parent;
    vector<OptionDef> m_tableOptions;
+   mutable ValueCache m_cache;
    #ifdef DEBUG
       robin_hood::unordered_map<Section, robin_hood::unordered_flat_set<string>> m_validatedKeys;
    #endif
@@ -159,4 +213,7 @@ private:
    // Shared accross all settings
    static vector<OptionDef> m_pluginOptions;
    static vector<string> m_settingKeys;
+   static vector<std::pair<Section, string>> m_handleKeys;
+   static std::atomic<unsigned int> m_globalVersion;
+   static std::mutex m_cacheMutex; // guards handle registration, cache refresh, listeners and modifications of the ini data
 };
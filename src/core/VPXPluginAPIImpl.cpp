@@ -99,9 +99,13 @@ void VPXPluginAPIImpl::GetActiveViewSetup(VPXViewSetupDef* view)
    view->viewVOfs = viewSetup.mViewVOfs;
    view->windowTopZOfs = viewSetup.mWindowTopZOfs;
    view->windowBottomZOfs = viewSetup.mWindowBottomZOfs;
-   view->screenWidth = g_pplayer->m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "ScreenWidth"s, 0.0f);
-   view->screenHeight = g_pplayer->m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "ScreenHeight"s, 0.0f);
-   view->screenInclination = g_pplayer->m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "ScreenInclination"s, 0.0f);
+   // Plugins may query this every frame (f.e. head tracking), so use cached settings
+   static const Settings::Handle screenWidthHandle = Settings::GetHandle(Settings::Player, "ScreenWidth"s);
+   static const Settings::Handle screenHeightHandle = Settings::GetHandle(Settings::Player, "ScreenHeight"s);
+   static const Settings::Handle screenInclinationHandle = Settings::GetHandle(Settings::Player, "ScreenInclination"s);
+   view->screenWidth = g_pplayer->m_ptable->m_settings.GetFloat(screenWidthHandle, 0.0f);
+   view->screenHeight = g_pplayer->m_ptable->m_settings.GetFloat(screenHeightHandle, 0.0f);
+   view->screenInclination = g_pplayer->m_ptable->m_settings.GetFloat(screenInclinationHandle, 0.0f);
    view->realToVirtualScale = viewSetup.GetRealToVirtualScale(g_pplayer->m_ptable);
 }
 
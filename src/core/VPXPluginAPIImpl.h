@@ -25,6 +25,7 @@ public:
    const VPXPluginAPI& getAPI() const { return m_api; }
    unsigned int GetVPXEndPointId() const { return m_vpxPlugin->m_endpointId; }
    void BroadcastVPXMsg(const unsigned int msgId, void* data) const { MsgPluginManager::GetInstance().GetMsgAPI().BroadcastMsg(m_vpxPlugin->m_endpointId, msgId, data); }
+   void SendVPXResMsg(const unsigned int msgId, const uint64_t resId, void* data) const { MsgPluginManager::GetInstance().GetMsgAPI().SendResMsg(m_vpxPlugin->m_endpointId, msgId, resId, data); }
 
    unsigned int GetMsgID(const char* name_space, const char* name) const { return MsgPluginManager::GetInstance().GetMsgAPI().GetMsgID(name_space, name); }
    void ReleaseMsgID(const unsigned int msgId) const { MsgPluginManager::GetInstance().GetMsgAPI().ReleaseMsgID(msgId); }
@@ -172,7 +172,8 @@ enum SaveDirtyState
 enum VertexFormat
 {
    VF_POS_TEX,
-   VF_POS_NORMAL_TEX
+   VF_POS_NORMAL_TEX,
+   VF_POS_NORMAL_TEX_COMPACT
 };
 
 // These Structs are used for rendering and loading meshes. They must match the VertexDeclaration in RenderDevice.cpp and the loaded meshes.
@@ -209,6 +210,20 @@ public:
    D3DVALUE tv;
 };
 
+// Compact version of Vertex3D_NoTex2 for static meshes, uses VF_POS_NORMAL_TEX_COMPACT (see VertexBuffer::PackCompact)
+class Vertex3D_Compact final
+{
+public:
+   // Position (half float, w is always 1)
+   unsigned short x, y, z, w;
+
+   // Normals (snorm16, w is always 0)
+   short nx, ny, nz, nw;
+
+   // Texture coordinates (snorm16, so limited to -1..1)
+   short tu, tv;
+};
+
 class LocalString final
 {
 public:
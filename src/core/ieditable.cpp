@@ -9,6 +9,7 @@ IEditable::IEditable()
 
 IEditable::~IEditable()
 {
+   InvalidateSavedStream();
 }
 
 void IEditable::SetDirtyDraw()
@@ -42,6 +43,15 @@ void IEditable::Uncreate()
       GetPTable()->m_pcv->RemoveItem(GetScriptable());
 }
 
+void IEditable::InvalidateSavedStream()
+{
+   if (m_savedStream)
+   {
+      m_savedStream->Release();
+      m_savedStream = nullptr;
+   }
+}
+
 HRESULT IEditable::put_TimerEnabled(VARIANT_BOOL newVal, BOOL *pte)
 {
    STARTUNDO
@@ -183,6 +193,8 @@ void IEditable::SetName(const string& name)
     g_pvp->SetPropSel(GetPTable()->m_vmultisel);
 
     if (GetItemType() == eItemSurface && g_pvp->MessageBox("Replace the name also in all table elements that use this surface?", "Replace", MB_ICONQUESTION | MB_YESNO) == IDYES)
+    {
+    pt->InvalidateSavedStreams();
     for (size_t i = 0; i < pt->m_vedit.size(); i++)
     {
        IEditable *const pedit = pt->m_vedit[i];
@@ -205,6 +217,7 @@ void IEditable::SetName(const string& name)
        else if (pedit->GetItemType() == ItemTypeEnum::eItemTrigger && ((Trigger *)pedit)->m_d.m_szSurface == oldName)
           ((Trigger *)pedit)->m_d.m_szSurface = name;
     }
+    }
 #endif
     STOPUNDO
 }
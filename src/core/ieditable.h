@@ -221,6 +221,7 @@ public:
 
 class EventProxyBase;
 class ObjLoader;
+class FastIStream;
 // IEditable is the subclass for anything class which is a self-contained table element.
 // It knows how to draw itself, interact with event and properties,
 // And talk to the player
@@ -286,6 +287,10 @@ public:
    void Delete();
    void Uncreate();
 
+   // Stream serialized by the last save, written again by the next save unless the part was modified since
+   FastIStream *m_savedStream = nullptr;
+   void InvalidateSavedStream();
+
    bool m_backglass = false; // if the light/decal (+dispreel/textbox is always true) is on the table (false) or a backglass view
 
    HRESULT put_TimerEnabled(VARIANT_BOOL newVal, BOOL *pte);
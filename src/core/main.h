@@ -264,6 +264,7 @@ class SCNotification final { };
 #endif
 
 #include "utils/Logger.h"
+#include "utils/MemoryAccounting.h"
 
 #ifdef __STANDALONE__
 #include "standalone/inc/atl/atldef.h"
@@ -120,7 +120,7 @@ PinInput::PinInput()
 #endif
 {
    ZeroMemory(m_oldMouseButtonState, sizeof(m_oldMouseButtonState));
-   ZeroMemory(m_diq, sizeof(m_diq));
+   ResetQueue();
    ZeroMemory(m_keyPressedState, sizeof(m_keyPressedState));
 
 #ifdef _WIN32
@@ -467,40 +467,60 @@ void PinInput::RefreshSDLDevices()
 }
 #endif
 
-void PinInput::PushQueue(DIDEVICEOBJECTDATA * const data, const unsigned int app_data/*, const U32 curr_time_msec*/)
+void PinInput::ResetQueue()
 {
-   if ((!data) ||
-       (((m_head + 1) % MAX_KEYQUEUE_SIZE) == m_tail)) // queue full?
-       return;
+   for (unsigned int i = 0; i < MAX_KEYQUEUE_SIZE; i++)
+   {
+      ZeroMemory(&m_diq[i].data, sizeof(DIDEVICEOBJECTDATA));
+      m_diq[i].timestamp_usec = 0;
+   }
+   m_head = 0;
+   m_tail = 0;
+}
 
-   m_diq[m_head] = *data;
-   //m_diq[m_head].dwTimeStamp = curr_time_msec; //rewrite time from game start
-   m_diq[m_head].dwSequence = app_data;
+void PinInput::PushQueue(DIDEVICEOBJECTDATA * const data, const unsigned int app_data, const U64 timestamp_usec)
+{
+   if ((!data) ||
+       (m_head - m_tail == MAX_KEYQUEUE_SIZE)) // queue full?
+      return;
 
-   m_head = (m_head + 1) % MAX_KEYQUEUE_SIZE; // advance head of queue
+   QueuedInput &entry = m_diq[m_head & (MAX_KEYQUEUE_SIZE - 1)];
+   entry.data = *data;
+   entry.data.dwSequence = app_data;
+   entry.timestamp_usec = timestamp_usec ? timestamp_usec : usec();
+   m_head++; // advance head of queue
 }
 
-const DIDEVICEOBJECTDATA *PinInput::GetTail(/*const U32 curr_sim_msec*/)
+bool PinInput::HasQueuedInput(const U64 until_usec) const
 {
-   if (m_head == m_tail)
-      return nullptr; // queue empty?
-
-   const DIDEVICEOBJECTDATA * const ptr = &m_diq[m_tail];
+   return (m_head != m_tail) && (m_diq[m_tail & (MAX_KEYQUEUE_SIZE - 1)].timestamp_usec <= until_usec);
+}
 
+bool PinInput::PopQueue(DIDEVICEOBJECTDATA &data, const U64 until_usec)
+{
    // If we've simulated to or beyond the timestamp of when this control was received, then process the control into the system
-   //if ( curr_sim_msec >= ptr->dwTimeStamp ) //!! time stamp disabled to save a bit of lag
-   {
-      m_tail = (m_tail + 1) % MAX_KEYQUEUE_SIZE; // advance tail of queue
+   if (!HasQueuedInput(until_usec))
+      return false;
 
-      return ptr;
-   }
-   //else return nullptr;
+   data = m_diq[m_tail & (MAX_KEYQUEUE_SIZE - 1)].data;
+   m_tail++; // advance tail of queue
+   return true;
 }
 
 //
 // End of Direct Input specific code
 //
 
+#ifdef _WIN32
+// DirectInput buffered data is stamped (in GetTickCount() milliseconds) when received: use this stamp so that events get applied at the matching physics step, even though devices are only polled by the logic thread
+static U64 GetDITimestamp(const DIDEVICEOBJECTDATA &didod)
+{
+   const U64 now = usec();
+   const U64 age = (U64)(DWORD)(GetTickCount() - didod.dwTimeStamp) * 1000ull;
+   return (age < 1000000ull && now > age) ? now - age : now; // ignore stamps that would be more than 1s old (not stamped by the driver)
+}
+#endif
+
 void PinInput::GetInputDeviceData(/*const U32 curr_time_msec*/)
 {
    DIDEVICEOBJECTDATA didod[INPUT_BUFFER_SIZE]; // Receives buffered data 
@@ -524,7 +544,7 @@ void PinInput::GetInputDeviceData(/*const U32 curr_time_msec*/)
             {
                if (m_focusHWnd == GetForegroundWindow())
                   for (DWORD i = 0; i < dwElements; i++)
-                     PushQueue(&didod[i], APP_KEYBOARD/*, curr_time_msec*/);
+                     PushQueue(&didod[i], APP_KEYBOARD, GetDITimestamp(didod[i]));
             }
          }
       }
@@ -641,7 +661,7 @@ void PinInput::HandleInputDI(DIDEVICEOBJECTDATA *didod)
                {
                   if (m_focusHWnd == GetForegroundWindow())
                      for (DWORD i = 0; i < dwElements; i++)
-                        PushQueue(&didod[i], APP_JOYSTICK(k)/*, curr_time_msec*/);
+                        PushQueue(&didod[i], APP_JOYSTICK(k), GetDITimestamp(didod[i]));
                }
             }
          }
@@ -760,6 +780,11 @@ void PinInput::HandleSDLEvent(SDL_Event &e)
 {
    assert(m_inputApi == PI_SDL);
    static constexpr DWORD axes[] = { DIJOFS_X, DIJOFS_Y, DIJOFS_RX, DIJOFS_RY, DIJOFS_Z, DIJOFS_RZ };
+   // SDL events are processed with the OS messages, once per frame, but they are stamped by SDL when received: use this stamp so that they get applied at the matching physics step
+   const U64 now = usec();
+   const Uint64 ticksNs = SDL_GetTicksNS();
+   const U64 age = ticksNs > e.common.timestamp ? (U64)((ticksNs - e.common.timestamp) / 1000) : 0;
+   const U64 timestamp = now > age ? now - age : now;
    static constexpr int axisMultiplier[] = { 2, 2, 2, 2, 256, 256 };  // NOTE - this is a hard-coded assumption that JOYRANGE is -65536..+65536
    switch (e.type) 
    {
@@ -771,8 +796,7 @@ void PinInput::HandleSDLEvent(SDL_Event &e)
                DIDEVICEOBJECTDATA didod;
                didod.dwOfs = dik;
                didod.dwData = e.type == SDL_EVENT_KEY_DOWN ? 0x80 : 0;
-               //didod.dwTimeStamp = curr_time_msec;
-               PushQueue(&didod, APP_KEYBOARD/*, curr_time_msec*/);
+               PushQueue(&didod, APP_KEYBOARD, timestamp);
             }
          }
          break;
@@ -794,7 +818,7 @@ void PinInput::HandleSDLEvent(SDL_Event &e)
                   DIDEVICEOBJECTDATA didod;
                   didod.dwOfs = g_pplayer->m_rgKeys[touchkeymap[i]];
                   didod.dwData = g_pplayer->m_touchregion_pressed[i] ? 0x80 : 0;
-                  PushQueue(&didod, APP_TOUCH /*, curr_time_msec*/);
+                  PushQueue(&didod, APP_TOUCH, timestamp);
                }
             }
          }
@@ -811,7 +835,7 @@ void PinInput::HandleSDLEvent(SDL_Event &e)
             didod.dwOfs = axes[e.gaxis.axis];
             const int value = e.gaxis.value * axisMultiplier[e.gaxis.axis];
             didod.dwData = (DWORD)(value);
-            PushQueue(&didod, APP_JOYSTICK(0)); // Index 0 for gamepad
+            PushQueue(&didod, APP_JOYSTICK(0), timestamp); // Index 0 for gamepad
          }
          break;
       case SDL_EVENT_GAMEPAD_BUTTON_DOWN:
@@ -820,7 +844,7 @@ void PinInput::HandleSDLEvent(SDL_Event &e)
             DIDEVICEOBJECTDATA didod;
             didod.dwOfs = DIJOFS_BUTTON0 + (DWORD)e.gbutton.button;
             didod.dwData = e.type == SDL_EVENT_GAMEPAD_BUTTON_DOWN ? 0x80 : 0x00;
-            PushQueue(&didod, APP_JOYSTICK(0)); // Index 0 for gamepad
+            PushQueue(&didod, APP_JOYSTICK(0), timestamp); // Index 0 for gamepad
          }
          break;
       case SDL_EVENT_JOYSTICK_ADDED:
@@ -833,7 +857,7 @@ void PinInput::HandleSDLEvent(SDL_Event &e)
             didod.dwOfs = axes[e.jaxis.axis];
             const int value = e.jaxis.value * axisMultiplier[e.jaxis.axis];
             didod.dwData = (DWORD)(value);
-            PushQueue(&didod, APP_JOYSTICK(1)); // Index 1 for joystick
+            PushQueue(&didod, APP_JOYSTICK(1), timestamp); // Index 1 for joystick
          }
          break;
       case SDL_EVENT_JOYSTICK_BUTTON_DOWN:
@@ -842,7 +866,7 @@ void PinInput::HandleSDLEvent(SDL_Event &e)
             DIDEVICEOBJECTDATA didod;
             didod.dwOfs = DIJOFS_BUTTON0 + (DWORD)e.jbutton.button;
             didod.dwData = e.type == SDL_EVENT_JOYSTICK_BUTTON_DOWN ? 0x80 : 0x00;
-            PushQueue(&didod, APP_JOYSTICK(1)); // Index 1 for joystick
+            PushQueue(&didod, APP_JOYSTICK(1), timestamp); // Index 1 for joystick
          }
          break;
    }
@@ -1076,7 +1100,7 @@ void PinInput::Init()
 
 void PinInput::UnInit()
 {
-   m_head = m_tail = 0;
+   ResetQueue();
 
 #if defined(ENABLE_SDL_INPUT)
    SDL_QuitSubSystem(SDL_INIT_JOYSTICK);
@@ -1132,8 +1156,6 @@ void PinInput::UnInit()
    SAFE_RELEASE(m_pDI);
 #endif
 
-   ZeroMemory(m_diq, sizeof(m_diq));
-
    // close Open Pinball Device interfaces
    TerminateOpenPinballDevices();
 }
@@ -1826,7 +1848,7 @@ void PinInput::ProcessJoystick(const DIDEVICEOBJECTDATA * __restrict input, int
 }
 
 
-void PinInput::ProcessKeys(/*const U32 curr_sim_msec,*/ int curr_time_msec) // last one is negative if only key events should be fired
+void PinInput::ProcessKeys(int curr_time_msec, const U64 until_usec) // curr_time_msec is negative if only key events should be fired
 {
    if (!g_pplayer || !g_pplayer->m_ptable) return; // only if player is running
    g_pplayer->m_logicProfiler.OnProcessInput();
@@ -1854,7 +1876,7 @@ void PinInput::ProcessKeys(/*const U32 curr_sim_msec,*/ int curr_time_msec) // l
    // Camera/Light tweaking mode (F6) incl. fly-around parameters
    if (g_pplayer->m_liveUI->IsTweakMode())
    {
-      if (m_head == m_tail) // key queue empty, so just continue using the old pressed key
+      if (!HasQueuedInput(until_usec)) // key queue empty, so just continue using the old pressed key
       {
          if ((curr_time_msec - m_nextKeyPressedTime) > 10) // reduce update rate
          {
@@ -1911,8 +1933,9 @@ void PinInput::ProcessKeys(/*const U32 curr_sim_msec,*/ int curr_time_msec) // l
    }
    #endif
 
-   const DIDEVICEOBJECTDATA * __restrict input;
-   while ((input = GetTail(/*curr_sim_msec*/)))
+   DIDEVICEOBJECTDATA inputData;
+   const DIDEVICEOBJECTDATA * const input = &inputData;
+   while (PopQueue(inputData, until_usec))
    {
       if (input->dwSequence == APP_MOUSE && g_pplayer && !g_pplayer->m_liveUI->HasMouseCapture())
       {
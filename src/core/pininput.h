@@ -21,7 +21,7 @@
 #pragma comment(lib, "runtimeobject.lib")
 #endif
 
-#define MAX_KEYQUEUE_SIZE 32
+#define MAX_KEYQUEUE_SIZE 128
 
 #if MAX_KEYQUEUE_SIZE & (MAX_KEYQUEUE_SIZE-1)
 #error Note that MAX_KEYQUEUE_SIZE must be power of 2
@@ -104,11 +104,14 @@ public:
    // implicitly sync'd with visuals as each keystroke is applied to the sim
    void FireKeyEvent(const int dispid, int keycode);
 
-   void PushQueue(DIDEVICEOBJECTDATA * const data, const unsigned int app_data/*, const U32 curr_time_msec*/);
-   const DIDEVICEOBJECTDATA *GetTail(/*const U32 curr_sim_msec*/);
+   // Queue an input event, timestamped with the time it was received (in usec() time base, defaults to now). Thread safe.
+   void PushQueue(DIDEVICEOBJECTDATA * const data, const unsigned int app_data, const U64 timestamp_usec = 0);
+   // Dequeue the oldest input event if it was received at or before the given time
+   bool PopQueue(DIDEVICEOBJECTDATA &data, const U64 until_usec);
 
    void ProcessCameraKeys(const DIDEVICEOBJECTDATA * __restrict input);
-   void ProcessKeys(/*const U32 curr_sim_msec,*/ int curr_time_msec);
+   // Process input, only applying the events received up to the given time (usec() real time, see PhysicsEngine::GetCurPhysicsFrameRealTime) so that they are applied at the physics step matching their arrival
+   void ProcessKeys(int curr_time_msec, const U64 until_usec = ~0ull);
 
    void ProcessJoystick(const DIDEVICEOBJECTDATA * __restrict input, int curr_time_msec);
 
@@ -219,10 +222,18 @@ private:
 
    bool m_tilt_updown;
 
-   DIDEVICEOBJECTDATA m_diq[MAX_KEYQUEUE_SIZE]; // circular queue of direct input events
-
-   int m_head; // head==tail means empty, (head+1)%MAX_KEYQUEUE_SIZE == tail means full
-   int m_tail; // These are integer indices into keyq and should be in domain of 0..MAX_KEYQUEUE_SIZE-1
+   // Bounded circular queue of timestamped input events. Devices are polled and events are processed by the logic thread,
+   // so the queue is only accessed from that thread, but events keep the time they were received at.
+   struct QueuedInput
+   {
+      DIDEVICEOBJECTDATA data;
+      U64 timestamp_usec;
+   };
+   QueuedInput m_diq[MAX_KEYQUEUE_SIZE];
+   unsigned int m_head; // Next write position (wrapping, masked by MAX_KEYQUEUE_SIZE-1 to index m_diq)
+   unsigned int m_tail; // Next read position (wrapping as well, the queue is full when m_head - m_tail == MAX_KEYQUEUE_SIZE)
+   void ResetQueue();
+   bool HasQueuedInput(const U64 until_usec) const;
 
    // Axis assignments - these map to the drop-list index in the axis
    // selection combos in the Keys dialog:
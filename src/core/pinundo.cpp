@@ -48,6 +48,9 @@ void PinUndo::BeginUndo()
 
 void PinUndo::MarkForUndo(IEditable * const pie, const bool saveForUndo)
 {
+   // The part is about to be modified, so its last saved stream is stale
+   pie->InvalidateSavedStream();
+
    if (g_pplayer)
       return;
 
@@ -149,6 +152,7 @@ void PinUndo::Undo()
       pstm->Read(&pie, sizeof(IEditable *), &read);
 
       pie->ClearForOverwrite();
+      pie->InvalidateSavedStream();
 
       int foo2;
       pie->InitLoad(pstm, m_ptable, &foo2, CURRENT_FILE_FORMAT_VERSION, 0, 0);
@@ -181,6 +181,11 @@ Player::Player(PinTable *const editor_table, PinTable *const live_table, const i
    m_renderProfiler = new FrameProfiler();
    m_renderProfiler->NewFrame(0);
    g_frameProfiler = &m_logicProfiler;
+   if (m_ptable->m_settings.LoadValueWithDefault(Settings::Editor, "ProfilerTrace"s, false))
+   {
+      m_logicProfiler.EnableTraceCapture("Game logic"s);
+      m_renderProfiler->EnableTraceCapture("Render"s);
+   }
 
    m_progressDialog.Create(g_pvp->GetHwnd());
    m_progressDialog.ShowWindow(g_pvp->m_open_minimized ? SW_HIDE : SW_SHOWNORMAL);
@@ -695,6 +700,13 @@ Player::Player(PinTable *const editor_table, PinTable *const live_table, const i
       if (hitable->HitableGetItemType() == ItemTypeEnum::eItemBall)
          m_vball.push_back(&((Ball*)hitable)->m_hitBall);
    }
+   {
+      vector<Light*> lights;
+      for (auto editable : m_ptable->m_vedit)
+         if (editable->GetItemType() == ItemTypeEnum::eItemLight)
+            lights.push_back((Light*)editable);
+      m_lightAnimator = new LightAnimator(lights, m_time_msec);
+   }
 
    // Setup anisotropic filtering
    const bool forceAniso = m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "ForceAnisotropicFiltering"s, true);
@@ -720,6 +732,10 @@ Player::Player(PinTable *const editor_table, PinTable *const live_table, const i
       PLOGI << "Starting script"; // For profiling
       m_progressDialog.SetProgress("Starting Game Scripts..."s);
 
+      // The script engine allocates on its own, so estimate its memory (and the one of the objects created by the script) from the process growth
+      MemoryAccounting::Reset(MemoryAccounting::SCRIPT);
+      const MemoryAccounting::ProcessGrowthScope scriptMemory(MemoryAccounting::SCRIPT);
+
       m_ptable->m_pcv->Start(); // Hook up to events and start cranking script
 
       // Fire Init event for table object and all 'hitable' parts, also fire Animate event of parts having it since initial setup is considered as the initial animation event
@@ -765,7 +781,11 @@ Player::Player(PinTable *const editor_table, PinTable *const live_table, const i
    m_onAudioUpdatedMsgId = VPXPluginAPIImpl::GetInstance().GetMsgID(CTLPI_NAMESPACE, CTLPI_ONAUDIO_UPDATE_MSG);
    MsgPluginManager::GetInstance().GetMsgAPI().SubscribeMsg(VPXPluginAPIImpl::GetInstance().GetVPXEndPointId(), m_onAudioUpdatedMsgId, OnAudioUpdated, this);
    m_onGameStartMsgId = VPXPluginAPIImpl::GetInstance().GetMsgID(VPXPI_NAMESPACE, VPXPI_EVT_ON_GAME_START);
-   VPXPluginAPIImpl::GetInstance().BroadcastVPXMsg(m_onGameStartMsgId, nullptr);
+   {
+      MemoryAccounting::Reset(MemoryAccounting::PLUGIN);
+      const MemoryAccounting::ProcessGrowthScope pluginMemory(MemoryAccounting::PLUGIN);
+      VPXPluginAPIImpl::GetInstance().BroadcastVPXMsg(m_onGameStartMsgId, nullptr);
+   }
    m_onPrepareFrameMsgId = VPXPluginAPIImpl::GetInstance().GetMsgID(VPXPI_NAMESPACE, VPXPI_EVT_ON_PREPARE_FRAME);
 
    m_scoreView.Select(m_scoreviewOutput);
@@ -864,6 +884,13 @@ Player::~Player()
    bool appExitRequested = (m_closing == CS_CLOSE_APP);
    m_closing = CS_CLOSED;
    PLOGI << "Closing player...";
+   MemoryAccounting::LogReport();
+
+#ifdef __STANDALONE__
+#ifndef __LIBVPINBALL__
+   g_pvp->m_webServer.ClearPlayerTelemetry();
+#endif
+#endif
 
 #ifdef __LIBVPINBALL__
    VPinballLib::VPinball::SendEvent(VPinballLib::Event::PlayerClosing, nullptr);
@@ -1024,6 +1051,8 @@ Player::~Player()
    m_pininput.UnInit();
    delete m_physics;
    m_physics = nullptr;
+   delete m_lightAnimator;
+   m_lightAnimator = nullptr;
 
    for (auto probe : m_ptable->m_vrenderprobe)
       probe->RenderRelease();
@@ -1096,6 +1125,11 @@ Player::~Player()
    delete m_vrDevice;
    m_vrDevice = nullptr;
 
+   // Without a separate render thread, the render profiler is the logic one
+   vector<const FrameProfiler*> tracedProfilers { &m_logicProfiler };
+   if (&m_logicProfiler != m_renderProfiler)
+      tracedProfilers.push_back(m_renderProfiler);
+   FrameProfiler::ExportTrace(g_pvp->m_szMyPrefPath + "vpinball_trace.json", tracedProfilers);
    m_logicProfiler.LogWorstFrame();
    if (&m_logicProfiler != m_renderProfiler)
    {
@@ -1851,7 +1885,7 @@ void Player::GameLoop(std::function<void()> ProcessOSMessages)
       ProcessOSMessages();
       if (!IsEditorMode())
       {
-         m_pininput.ProcessKeys(/*sim_msec,*/ -(int)(m_startFrameTick / 1000)); // Trigger key events to sync with controller
+         m_pininput.ProcessKeys(-(int)(m_startFrameTick / 1000), m_physics->GetCurPhysicsFrameRealTime()); // Trigger key events to sync with controller (events received after the simulated time are applied by the physics loop)
          m_physics->UpdatePhysics(); // Update physics (also triggering events, syncing with controller)
          FireSyncController(); // Trigger script sync event (to sync solenoids back)
       }
@@ -2114,12 +2148,17 @@ void Player::PrepareFrame(const std::function<void()>& sync)
       const float diff_time_msec = (float)(m_time_msec - m_last_frame_time_msec);
       m_last_frame_time_msec = m_time_msec;
       if (diff_time_msec > 0.f)
+      {
          for (size_t i = 0; i < m_ptable->m_vedit.size(); ++i)
          {
             Hitable *const ph = m_ptable->m_vedit[i]->GetIHitable();
             if (ph)
                ph->UpdateAnimation(diff_time_msec);
          }
+         m_lightAnimator->Update(m_time_msec, diff_time_msec);
+         for (Light *const light : m_lightAnimator->GetChangedLights())
+            light->FireGroupEvent(DISPID_AnimateEvents_Animate);
+      }
    }
 
    // New Frame event: Legacy implementation with timers with magic interval value have special behaviors, here -1 for onNewFrame event
@@ -2241,12 +2280,18 @@ void Player::FinishFrame()
    // Update FPS counter
    m_fps = (float) (1e6 / m_logicProfiler.GetSlidingAvg(FrameProfiler::PROFILE_FRAME));
 
+#ifdef __STANDALONE__
+#ifndef __LIBVPINBALL__
+   g_pvp->m_webServer.PublishPlayerTelemetry(this);
+#endif
+#endif
+
 #ifndef ACCURATETIMERS
    ApplyDeferredTimerChanges();
    FireTimers(m_time_msec);
 #else
    if (m_videoSyncMode != VideoSyncMode::VSM_FRAME_PACING)
-      m_pininput.ProcessKeys(/*sim_msec,*/ -(int)(m_startFrameTick / 1000)); // trigger key events mainly for VPM<->VP roundtrip
+      m_pininput.ProcessKeys(-(int)(m_startFrameTick / 1000), m_physics->GetCurPhysicsFrameRealTime()); // trigger key events mainly for VPM<->VP roundtrip
 #endif
 
    // Detect & fire end of music events
@@ -2361,7 +2406,15 @@ void Player::OnAudioUpdated(const unsigned int msgId, void* userData, void* msgD
    const auto &entry = me->m_externalAudioPlayers.find(msg.id.id);
    if (entry == me->m_externalAudioPlayers.end())
    {
-      if (msg.buffer != nullptr)
+      if (msg.readSamples != nullptr)
+      {
+         // Pulled stream: samples are directly read from the audio thread, no more update messages will be received
+         const int nChannels = (msg.type == CTLPI_AUDIO_SRC_BACKGLASS_MONO) ? 1 : 2;
+         AudioPlayer* player = new AudioPlayer();
+         player->StreamInit(static_cast<DWORD>(msg.sampleRate), nChannels, msg.format == CTLPI_AUDIO_FORMAT_SAMPLE_FLOAT, 1.f, msg.readSamples, msg.readContext);
+         me->m_externalAudioPlayers[msg.id.id] = player;
+      }
+      else if (msg.buffer != nullptr)
       {
          const int nChannels = (msg.type == CTLPI_AUDIO_SRC_BACKGLASS_MONO) ? 1 : 2;
          AudioPlayer* player = new AudioPlayer();
@@ -2473,7 +2526,7 @@ Player::ControllerSegDisplay Player::GetControllerSegDisplay(CtlResId id)
 
    // Obtain frame from controller plugin
    GetSegMsg getMsg = { display->segId, 0, nullptr };
-   VPXPluginAPIImpl::GetInstance().BroadcastVPXMsg(m_getSegMsgId, &getMsg);
+   VPXPluginAPIImpl::GetInstance().SendVPXResMsg(m_getSegMsgId, getMsg.segId.id, &getMsg);
    if (getMsg.frame == nullptr)
       return { display->segId, 0, nullptr };
    memcpy(display->frame, getMsg.frame, display->nElements * 16 * sizeof(float));
@@ -2581,7 +2634,7 @@ Player::ControllerDisplay Player::GetControllerDisplay(CtlResId id)
 
    // Obtain DMD frame from controller plugin
    GetDmdMsg getMsg = { display->dmdId, 0, nullptr };
-   VPXPluginAPIImpl::GetInstance().BroadcastVPXMsg(m_getDmdMsgId, &getMsg);
+   VPXPluginAPIImpl::GetInstance().SendVPXResMsg(m_getDmdMsgId, getMsg.dmdId.id.id, &getMsg);
    if (getMsg.frame == nullptr)
       return { display->dmdId, -1, nullptr };
 
@@ -20,6 +20,7 @@
 constexpr int DBG_SPRITE_SIZE = 1024;
 
 class VRDevice;
+class LightAnimator;
 
 // NOTE that the following four definitions need to be in sync in their order!
 enum EnumAssignKeys
@@ -427,6 +428,7 @@ public:
    VPX::RenderOutput m_backglassOutput;
    Renderer *m_renderer = nullptr;
    VRDevice *m_vrDevice = nullptr;
+   LightAnimator *m_lightAnimator = nullptr; // Batched light fading (see light.h)
    bool m_headTracking = false;
    bool m_scaleFX_DMD = false;
 
@@ -319,22 +319,33 @@ void Light::ClearForOverwrite()
    ClearPointsForOverwrite();
 }
 
-void Light::UpdateAnimation(const float diff_time_msec)
+// Incandescent bulb model: heat up/cool down the filament, then derive the emitted intensity
+static float UpdateIncandescentFader(const float lightState, const float intensity, const float maxIntensity, const float fadeSpeedUp, const float fadeSpeedDown, double& filamentTemperature, const float diff_time_msec)
 {
-   if ((m_duration > 0) && (m_timerDurationEndTime < g_pplayer->m_time_msec))
+   const float inv_fadeSpeed = (intensity < maxIntensity * lightState ? fadeSpeedUp : fadeSpeedDown) / maxIntensity; // 1.0 / (Fade speed in ms)
+   const float remaining_time = diff_time_msec * (float)(0.001 * 40.0) * inv_fadeSpeed; // Apply a speed factor (a bulb with this characteristics reaches full power between 30 and 40ms so we modulate around this)
+   if (lightState != 0.f)
+   {
+      const float U = 6.3f * sqrtf(sqrtf(lightState)); //=powf(lightState, 0.25f); // Modulating by Emission^0.25 is not fully correct (ignoring visible/non visible wavelengths) but an acceptable approximation
+      filamentTemperature = bulb_heat_up(BULB_44, filamentTemperature, remaining_time, U, 0.0f);
+   }
+   else
    {
-      m_inPlayState = m_finalLightState;
-      m_duration = 0;
-      if (m_inPlayState == (float)LightStateBlinking)
-         RestartBlinker(g_pplayer->m_time_msec);
+      filamentTemperature = bulb_cool_down(BULB_44, filamentTemperature, remaining_time);
    }
+   return bulb_filament_temperature_to_emission(BULB_44, (float)filamentTemperature) * maxIntensity;
+}
 
-   if (m_inPlayState == (float)LightStateBlinking)
-      UpdateBlinker(g_pplayer->m_time_msec);
+void Light::UpdateAnimation(const float diff_time_msec)
+{
+   if (m_animatorIndex >= 0) // Fading is performed in batch by the player's light animator
+      return;
+
+   UpdateTimedState(g_pplayer->m_time_msec);
 
    const float m_previousIntensity = m_currentIntensity;
 
-   const float lightState = (m_inPlayState == (float)LightStateBlinking) ? (m_d.m_rgblinkpattern[m_iblinkframe] == '1') : m_inPlayState;
+   const float lightState = GetTargetLightState();
    const float targetIntensity = m_d.m_intensity * m_d.m_intensity_scale * lightState;
    if (m_currentIntensity != targetIntensity)
    {
@@ -356,24 +367,9 @@ void Light::UpdateAnimation(const float diff_time_msec)
          }
          break;
       case FADER_INCANDESCENT:
-      {
          if (m_d.m_intensity != 0.f && m_d.m_intensity_scale != 0.f)
-         {
-            const float inv_fadeSpeed = (m_currentIntensity < targetIntensity ? m_d.m_fadeSpeedUp : m_d.m_fadeSpeedDown) / (m_d.m_intensity * m_d.m_intensity_scale); // 1.0 / (Fade speed in ms)
-            const float remaining_time = diff_time_msec * (float)(0.001 * 40.0) * inv_fadeSpeed; // Apply a speed factor (a bulb with this characteristics reaches full power between 30 and 40ms so we modulate around this)
-            if (lightState != 0.f)
-            {
-               const float U = 6.3f * sqrtf(sqrtf(lightState)); //=powf(lightState, 0.25f); // Modulating by Emission^0.25 is not fully correct (ignoring visible/non visible wavelengths) but an acceptable approximation
-               m_currentFilamentTemperature = bulb_heat_up(BULB_44, m_currentFilamentTemperature, remaining_time, U, 0.0f);
-            }
-            else
-            {
-               m_currentFilamentTemperature = bulb_cool_down(BULB_44, m_currentFilamentTemperature, remaining_time);
-            }
-            m_currentIntensity = bulb_filament_temperature_to_emission(BULB_44, (float)m_currentFilamentTemperature) * (m_d.m_intensity * m_d.m_intensity_scale);
-         }
-      }
-      break;
+            m_currentIntensity = UpdateIncandescentFader(lightState, m_currentIntensity, m_d.m_intensity * m_d.m_intensity_scale, m_d.m_fadeSpeedUp, m_d.m_fadeSpeedDown, m_currentFilamentTemperature, diff_time_msec);
+         break;
       }
    }
 
@@ -381,6 +377,193 @@ void Light::UpdateAnimation(const float diff_time_msec)
       FireGroupEvent(DISPID_AnimateEvents_Animate);
 }
 
+void Light::MarkAnimationDirty()
+{
+   if (m_animatorIndex >= 0 && g_pplayer && g_pplayer->m_lightAnimator)
+      g_pplayer->m_lightAnimator->MarkDirty(m_animatorIndex);
+}
+
+LightAnimator::LightAnimator(const vector<Light*>& lights, const U32 time_msec)
+   : m_lights(lights)
+{
+   const size_t n = m_lights.size();
+   m_intensity.resize(n);
+   m_targetIntensity.resize(n);
+   m_maxIntensity.resize(n);
+   m_lightState.resize(n);
+   m_fadeSpeedUp.resize(n);
+   m_fadeSpeedDown.resize(n);
+   m_filamentTemperature.resize(n);
+   m_fader.resize(n);
+   m_flags.resize(n, 0);
+   m_dirty.reserve(n);
+   m_timed.reserve(n);
+   m_active.reserve(n);
+   m_changedLights.reserve(n);
+   for (unsigned int i = 0; i < (unsigned int)n; ++i)
+   {
+      m_lights[i]->m_animatorIndex = (int)i;
+      Reload(i);
+      if (Refresh(i, time_msec))
+      {
+         m_flags[i] |= FLAG_TIMED;
+         m_timed.push_back(i);
+      }
+   }
+}
+
+LightAnimator::~LightAnimator()
+{
+   for (Light* light : m_lights)
+      light->m_animatorIndex = -1;
+}
+
+void LightAnimator::MarkDirty(const int index)
+{
+   if ((m_flags[index] & FLAG_DIRTY) == 0)
+   {
+      m_flags[index] |= FLAG_DIRTY;
+      m_dirty.push_back(index);
+   }
+}
+
+// Fetch fading parameters and current intensity from the light (they may have been modified by script or LiveUI)
+void LightAnimator::Reload(const unsigned int index)
+{
+   const Light* const light = m_lights[index];
+   m_intensity[index] = light->m_currentIntensity;
+   m_filamentTemperature[index] = light->m_currentFilamentTemperature;
+   m_maxIntensity[index] = light->m_d.m_intensity * light->m_d.m_intensity_scale;
+   m_fadeSpeedUp[index] = light->m_d.m_fadeSpeedUp;
+   m_fadeSpeedDown[index] = light->m_d.m_fadeSpeedDown;
+   m_fader[index] = (uint8_t)light->m_d.m_fader;
+}
+
+// Update light timed state (blink, duration) and fade target, adding it to the fading list if needed. Returns true if the light has a timed state.
+bool LightAnimator::Refresh(const unsigned int index, const U32 time_msec)
+{
+   Light* const light = m_lights[index];
+   const bool timed = light->UpdateTimedState(time_msec);
+   m_lightState[index] = light->GetTargetLightState();
+   m_targetIntensity[index] = m_maxIntensity[index] * m_lightState[index];
+   // Incandescent filaments may still need to heat up or cool down even if their emission is already at target
+   if ((m_intensity[index] != m_targetIntensity[index] || m_fader[index] == FADER_INCANDESCENT) && (m_flags[index] & FLAG_ACTIVE) == 0)
+   {
+      m_flags[index] |= FLAG_ACTIVE;
+      m_active.push_back(index);
+   }
+   return timed;
+}
+
+void LightAnimator::Update(const U32 time_msec, const float diff_time_msec)
+{
+   m_changedLights.clear();
+
+   // Lights modified since last update are refreshed this frame, together with the timed ones
+   for (const unsigned int i : m_dirty)
+   {
+      m_flags[i] &= ~FLAG_DIRTY;
+      Reload(i);
+      if ((m_flags[i] & FLAG_TIMED) == 0)
+      {
+         m_flags[i] |= FLAG_TIMED;
+         m_timed.push_back(i);
+      }
+   }
+   m_dirty.clear();
+
+   size_t nTimed = 0;
+   for (size_t k = 0; k < m_timed.size(); ++k)
+   {
+      const unsigned int i = m_timed[k];
+      if (Refresh(i, time_msec))
+         m_timed[nTimed++] = i;
+      else
+         m_flags[i] &= ~FLAG_TIMED;
+   }
+   m_timed.resize(nTimed);
+
+   if (m_active.empty() || diff_time_msec <= 0.f)
+      return;
+
+   // Fading lights: non fading and incandescent lights are directly updated while linear ones are compacted for the vectorized pass
+   m_linearIndex.clear();
+   m_linearIntensity.clear();
+   m_linearTarget.clear();
+   m_linearSpeedUp.clear();
+   m_linearSpeedDown.clear();
+   for (const unsigned int i : m_active)
+   {
+      switch (m_fader[i])
+      {
+      case FADER_NONE:
+         m_intensity[i] = m_targetIntensity[i];
+         break;
+      case FADER_LINEAR:
+         m_linearIndex.push_back(i);
+         m_linearIntensity.push_back(m_intensity[i]);
+         m_linearTarget.push_back(m_targetIntensity[i]);
+         m_linearSpeedUp.push_back(m_fadeSpeedUp[i] * diff_time_msec);
+         m_linearSpeedDown.push_back(m_fadeSpeedDown[i] * diff_time_msec);
+         break;
+      case FADER_INCANDESCENT:
+      {
+         // The filament may heat up or cool down without any emission change (below ~1500K), so track its temperature to know when the fade is done
+         const double temperature = m_filamentTemperature[i];
+         if (m_maxIntensity[i] != 0.f)
+            m_intensity[i] = UpdateIncandescentFader(m_lightState[i], m_intensity[i], m_maxIntensity[i], m_fadeSpeedUp[i], m_fadeSpeedDown[i], m_filamentTemperature[i], diff_time_msec);
+         if (m_filamentTemperature[i] == temperature)
+            m_flags[i] |= FLAG_FILAMENT_SETTLED;
+         else
+            m_flags[i] &= ~FLAG_FILAMENT_SETTLED;
+         break;
+      }
+      }
+   }
+
+   // Linear fade: move toward target by fade speed, clamped to target
+   const size_t nLinear = m_linearIndex.size();
+   float* const __restrict cur = m_linearIntensity.data();
+   const float* const __restrict target = m_linearTarget.data();
+   const float* const __restrict up = m_linearSpeedUp.data();
+   const float* const __restrict down = m_linearSpeedDown.data();
+   size_t k = 0;
+#ifdef ENABLE_SSE_OPTIMIZATIONS
+   for (; k + 4 <= nLinear; k += 4)
+   {
+      const __m128 c = _mm_loadu_ps(cur + k);
+      const __m128 t = _mm_loadu_ps(target + k);
+      const __m128 fadeUp = _mm_min_ps(_mm_add_ps(c, _mm_loadu_ps(up + k)), t);
+      const __m128 fadeDown = _mm_max_ps(_mm_sub_ps(c, _mm_loadu_ps(down + k)), t);
+      const __m128 isUp = _mm_cmplt_ps(c, t);
+      _mm_storeu_ps(cur + k, _mm_or_ps(_mm_and_ps(isUp, fadeUp), _mm_andnot_ps(isUp, fadeDown)));
+   }
+#endif
+   for (; k < nLinear; ++k)
+      cur[k] = cur[k] < target[k] ? min(cur[k] + up[k], target[k]) : max(cur[k] - down[k], target[k]);
+   for (k = 0; k < nLinear; ++k)
+      m_intensity[m_linearIndex[k]] = cur[k];
+
+   // Publish changes to the lights and drop the ones which have reached their target (incandescent: once the filament temperature is stable)
+   size_t nActive = 0;
+   for (const unsigned int i : m_active)
+   {
+      Light* const light = m_lights[i];
+      if (light->m_currentIntensity != m_intensity[i] || light->m_currentFilamentTemperature != m_filamentTemperature[i])
+      {
+         light->m_currentIntensity = m_intensity[i];
+         light->m_currentFilamentTemperature = m_filamentTemperature[i];
+         m_changedLights.push_back(light);
+      }
+      const bool fading = m_fader[i] == FADER_INCANDESCENT ? (m_flags[i] & FLAG_FILAMENT_SETTLED) == 0 : m_intensity[i] != m_targetIntensity[i];
+      if (fading)
+         m_active[nActive++] = i;
+      else
+         m_flags[i] &= ~(FLAG_ACTIVE | FLAG_FILAMENT_SETTLED);
+   }
+   m_active.resize(nActive);
+}
+
 void Light::RenderSetup(RenderDevice *device)
 {
    assert(m_rd == nullptr);
@@ -1305,6 +1488,7 @@ STDMETHODIMP Light::put_BlinkPattern(BSTR newVal)
 
    if (g_pplayer)
       RestartBlinker(g_pplayer->m_time_msec);
+   MarkAnimationDirty();
 
    return S_OK;
 }
@@ -1320,6 +1504,7 @@ STDMETHODIMP Light::put_BlinkInterval(LONG newVal)
    m_d.m_blinkinterval = newVal;
    if (g_pplayer)
       m_timenextblink = g_pplayer->m_time_msec + m_d.m_blinkinterval;
+   MarkAnimationDirty();
 
    return S_OK;
 }
@@ -1339,6 +1524,7 @@ STDMETHODIMP Light::Duration(float startState, LONG newVal, float endState)
             m_timenextblink = g_pplayer->m_time_msec + m_d.m_blinkinterval;
         }
     }
+    MarkAnimationDirty();
 
     return S_OK;
 }
@@ -1354,6 +1540,7 @@ STDMETHODIMP Light::put_Intensity(float newVal)
 {
    m_d.m_intensity = max(0.f, newVal);
    m_currentIntensity = m_d.m_intensity * m_d.m_intensity_scale * ((m_inPlayState == (float)LightStateBlinking) ? (m_d.m_rgblinkpattern[m_iblinkframe] == '1') : m_inPlayState);
+   MarkAnimationDirty();
 
    return S_OK;
 }
@@ -1380,6 +1567,7 @@ STDMETHODIMP Light::put_IntensityScale(float newVal)
 {
    m_d.m_intensity_scale = max(newVal,0.f);
    m_currentIntensity = m_d.m_intensity * m_d.m_intensity_scale * ((m_inPlayState == (float)LightStateBlinking) ? (m_d.m_rgblinkpattern[m_iblinkframe] == '1') : m_inPlayState);
+   MarkAnimationDirty();
 
    return S_OK;
 }
@@ -1446,6 +1634,7 @@ STDMETHODIMP Light::get_FadeSpeedUp(float *pVal)
 STDMETHODIMP Light::put_FadeSpeedUp(float newVal)
 {
    m_d.m_fadeSpeedUp = newVal;
+   MarkAnimationDirty();
    return S_OK;
 }
 
@@ -1458,6 +1647,7 @@ STDMETHODIMP Light::get_FadeSpeedDown(float *pVal)
 STDMETHODIMP Light::put_FadeSpeedDown(float newVal)
 {
    m_d.m_fadeSpeedDown = newVal;
+   MarkAnimationDirty();
    return S_OK;
 }
 
@@ -1542,6 +1732,7 @@ STDMETHODIMP Light::get_Fader(LONG *pVal)
 STDMETHODIMP Light::put_Fader(LONG newVal)
 {
    m_d.m_fader = (Fader)newVal;
+   MarkAnimationDirty();
    return S_OK;
 }
 
@@ -1602,6 +1793,7 @@ void Light::setInPlayState(const float newVal)
          if (m_duration > 0)
             m_duration = 0; // disable duration if a state was set this way
       }
+      MarkAnimationDirty();
    }
 }
 
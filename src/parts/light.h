@@ -145,6 +145,7 @@ public:
 
    void InitShape();
    void setInPlayState(const float newVal);
+   void MarkAnimationDirty(); // Notify the light animator that state or fading parameters were modified
 
    void RenderOutline(Sur *const psur);
 
@@ -157,6 +158,7 @@ public:
    double m_currentFilamentTemperature;
    float m_surfaceHeight;
    bool  m_lockedByLS = false;
+   int   m_animatorIndex = -1; // Index in player's light animator, -1 if not animated by it
 
 private:
    class LightCenter final : public ISelect
@@ -286,6 +288,8 @@ public:
 
    // was: class IBlink
 private:
+   friend class LightAnimator;
+
    int m_duration;
    float m_finalLightState; // 0..1=Off..On, 2=Blinking
 
@@ -311,4 +315,72 @@ private:
       m_timenextblink = cur_time_msec + m_d.m_blinkinterval;
       m_timerDurationEndTime = cur_time_msec + m_duration;
    }
+
+   // Apply duration end and blink pattern, returning true if the light still needs to be updated over time
+   bool UpdateTimedState(const U32 time_msec)
+   {
+      if ((m_duration > 0) && (m_timerDurationEndTime < time_msec))
+      {
+         m_inPlayState = m_finalLightState;
+         m_duration = 0;
+         if (m_inPlayState == (float)LightStateBlinking)
+            RestartBlinker(time_msec);
+      }
+
+      if (m_inPlayState == (float)LightStateBlinking)
+         UpdateBlinker(time_msec);
+
+      return (m_duration > 0) || (m_inPlayState == (float)LightStateBlinking);
+   }
+
+   float GetTargetLightState() const { return (m_inPlayState == (float)LightStateBlinking) ? (m_d.m_rgblinkpattern[m_iblinkframe] == '1') : m_inPlayState; }
+};
+
+// Batched light fading: during play, the fade state of all the lights is held in structure of arrays and updated once per frame.
+// Only lights with a timed state (blinking, duration) or modified since last frame get their fade target refreshed, and only
+// lights which are still fading are processed (in a vectorized pass for linear faders).
+class LightAnimator final
+{
+public:
+   LightAnimator(const vector<Light*>& lights, const U32 time_msec);
+   ~LightAnimator();
+
+   void MarkDirty(const int index);
+   void Update(const U32 time_msec, const float diff_time_msec);
+
+   // Lights whose intensity changed during last update, for event dispatch and renderer
+   const vector<Light*>& GetChangedLights() const { return m_changedLights; }
+
+private:
+   void Reload(const unsigned int index);
+   bool Refresh(const unsigned int index, const U32 time_msec);
+
+   enum : uint8_t { FLAG_DIRTY = 1, FLAG_TIMED = 2, FLAG_ACTIVE = 4, FLAG_FILAMENT_SETTLED = 8 };
+
+   vector<Light*> m_lights;
+
+   // Fade state, indexed by light
+   vector<float> m_intensity;
+   vector<float> m_targetIntensity;
+   vector<float> m_maxIntensity; // intensity * intensity scale
+   vector<float> m_lightState; // 0..1 target state (blink pattern applied)
+   vector<float> m_fadeSpeedUp;
+   vector<float> m_fadeSpeedDown;
+   vector<double> m_filamentTemperature;
+   vector<uint8_t> m_fader;
+   vector<uint8_t> m_flags;
+
+   // Work lists (light indices)
+   vector<unsigned int> m_dirty;
+   vector<unsigned int> m_timed;
+   vector<unsigned int> m_active;
+
+   // Compacted linear fader data for the vectorized pass
+   vector<unsigned int> m_linearIndex;
+   vector<float> m_linearIntensity;
+   vector<float> m_linearTarget;
+   vector<float> m_linearSpeedUp;
+   vector<float> m_linearSpeedDown;
+
+   vector<Light*> m_changedLights;
 };
@@ -177,6 +177,25 @@ STDMETHODIMP ScriptGlobalTable::StopSound(BSTR Sound)
    return S_OK;
 }
 
+STDMETHODIMP ScriptGlobalTable::GetSoundHandle(BSTR Sound, LONG *pVal)
+{
+   char szName[MAXSTRING];
+   WideCharToMultiByteNull(CP_ACP, 0, Sound, -1, szName, MAXSTRING, nullptr, nullptr);
+
+   // Handles are the sound index + 1, so that 0 means 'not found'
+   *pVal = m_pt->GetSoundIndex(szName) + 1;
+
+   return S_OK;
+}
+
+STDMETHODIMP ScriptGlobalTable::PlaySoundHandle(LONG Handle, LONG LoopCount, float volume, float pan, float randompitch, LONG pitch, VARIANT_BOOL usesame, VARIANT_BOOL restart, float front_rear_fade)
+{
+   if (g_pplayer && g_pplayer->m_PlaySound)
+      m_pt->PlaySoundIndex(Handle - 1, LoopCount, volume, pan, randompitch, pitch, usesame, restart, front_rear_fade);
+
+   return S_OK;
+}
+
 STDMETHODIMP ScriptGlobalTable::PlayMusic(BSTR str, float volume)
 {
    if (g_pplayer && g_pplayer->m_PlayMusic)
@@ -1506,6 +1525,7 @@ PinTable::~PinTable()
    m_materialMap.clear();
    m_lightMap.clear();
    m_renderprobeMap.clear();
+   m_soundMap.clear();
 
    for (size_t i = 0; i < m_vedit.size(); i++)
       m_vedit[i]->Release();
@@ -1680,14 +1700,20 @@ POINT PinTable::GetScreenPoint() const
 #define CLEAN_MATERIAL(pEditMaterial) \
 {robin_hood::unordered_map<string, Material*, StringHashFunctor, StringComparator>::const_iterator \
    it = m_materialMap.find(pEditMaterial); \
-if (it == m_materialMap.end()) \
-   pEditMaterial.clear();}
+if (it == m_materialMap.end() && !pEditMaterial.empty()) \
+{ \
+   pEditMaterial.clear(); \
+   pEdit->InvalidateSavedStream(); \
+}}
 
 #define CLEAN_IMAGE(pEditImage) \
 {robin_hood::unordered_map<string, Texture*, StringHashFunctor, StringComparator>::const_iterator \
    it = m_textureMap.find(pEditImage); \
-if (it == m_textureMap.end()) \
-   pEditImage.clear();}
+if (it == m_textureMap.end() && !pEditImage.empty()) \
+{ \
+   pEditImage.clear(); \
+   pEdit->InvalidateSavedStream(); \
+}}
 
 #define CLEAN_SURFACE(pEditSurface) \
 {if (!pEditSurface.empty()) \
@@ -1708,7 +1734,10 @@ for (size_t ie = 0; ie < m_vedit.size(); ie++) \
     } \
 } \
 if(!found) \
+{ \
     pEditSurface.clear(); \
+    pEdit->InvalidateSavedStream(); \
+} \
 }}
 
 
@@ -2474,6 +2503,9 @@ PinTable* PinTable::CopyForPlay()
    live_table->m_renderprobeMap.clear();
    for (size_t i = 0; i < live_table->m_vrenderprobe.size(); i++)
       live_table->m_renderprobeMap[live_table->m_vrenderprobe[i]->GetName()] = live_table->m_vrenderprobe[i];
+   live_table->m_soundMap.clear();
+   for (size_t i = 0; i < live_table->m_vsound.size(); i++)
+      live_table->m_soundMap.emplace(live_table->m_vsound[i]->m_szName, (int)i); // keep the first one on duplicate names, like the linear search
 
    // parse the (optional) override-physics-sets that can be set globally
    live_table->m_fOverrideGravityConstant = GRAVITYCONST * m_settings.LoadValueWithDefault(Settings::Player, "TablePhysicsGravityConstant" + std::to_string(live_table->m_overridePhysics - 1), DEFAULT_TABLE_GRAVITY);
@@ -2752,6 +2784,78 @@ HRESULT PinTable::SaveToStorage(IStorage *pstgRoot, VPXFileFeedback& feedback)
 
    feedback.AboutToProcessTable(ctotalitems);
 
+   // Game items, sounds, images and fonts are not part of the hashed data, so they are serialized (and compressed) to memory
+   // in parallel, while the table data is hashed and written, then written to the storage in order on this thread
+   ThreadPool pool(m_vpinball->GetLogicalNumberOfProcessors());
+   vector<std::future<FastIStream*>> serializedStreams;
+   serializedStreams.reserve(m_vedit.size() + m_vsound.size() + m_vimage.size() + m_vfont.size());
+   for (IEditable *const piedit : m_vedit)
+   {
+      const ItemTypeEnum type = piedit->GetItemType();
+      const auto serialize = [piedit, type] {
+         FastIStream *const pstm = new FastIStream();
+         pstm->AddRef();
+         ULONG writ;
+         pstm->Write(&type, sizeof(int), &writ);
+         piedit->SaveData(pstm, NULL, false);
+         return pstm;
+      };
+#ifdef _DEBUG
+      // Kept streams rely on each modification invalidating them: check that they still match a fresh serialization
+      if (piedit->m_savedStream)
+      {
+         FastIStream *const pstmCheck = serialize();
+         if (pstmCheck->m_cSize != piedit->m_savedStream->m_cSize || memcmp(pstmCheck->m_rg, piedit->m_savedStream->m_rg, pstmCheck->m_cSize) != 0)
+         {
+            PLOGE << "Game item '" << piedit->GetName() << "' was modified without invalidating its saved stream";
+            assert(!"Outdated saved stream");
+            piedit->InvalidateSavedStream();
+         }
+         pstmCheck->Release();
+      }
+#endif
+      // Game items not modified since the last save are written again from the stream kept from that save
+      if (piedit->m_savedStream)
+      {
+         std::promise<FastIStream*> saved;
+         piedit->m_savedStream->AddRef();
+         saved.set_value(piedit->m_savedStream);
+         serializedStreams.push_back(saved.get_future());
+         continue;
+      }
+      // Items holding an OLE font are saved from this thread, as COM objects are bound to their apartment
+      if (type == eItemDecal || type == eItemDispReel || type == eItemTextbox)
+      {
+         std::promise<FastIStream*> serialized;
+         serialized.set_value(serialize());
+         serializedStreams.push_back(serialized.get_future());
+      }
+      else
+         serializedStreams.push_back(pool.enqueue(serialize));
+   }
+   for (const PinSound *const pps : m_vsound)
+      serializedStreams.push_back(pool.enqueue([this, pps] {
+         FastIStream *const pstm = new FastIStream();
+         pstm->AddRef();
+         SaveSoundToStream(pps, pstm);
+         return pstm;
+      }));
+   for (Texture *const ppi : m_vimage)
+      serializedStreams.push_back(pool.enqueue([this, ppi] {
+         FastIStream *const pstm = new FastIStream();
+         pstm->AddRef();
+         ppi->SaveToStream(pstm, this);
+         return pstm;
+      }));
+   for (PinFont *const ppf : m_vfont)
+      serializedStreams.push_back(pool.enqueue([ppf] {
+         FastIStream *const pstm = new FastIStream();
+         pstm->AddRef();
+         ppf->SaveToStream(pstm);
+         return pstm;
+      }));
+   size_t nextStream = 0;
+
    //first save our own data
    IStorage* pstgData;
    HRESULT hr;
@@ -2790,69 +2894,35 @@ HRESULT PinTable::SaveToStorage(IStorage *pstgRoot, VPXFileFeedback& feedback)
          {
             for (size_t i = 0; i < m_vedit.size(); i++)
             {
-               const string szStmName = "GameItem" + std::to_string(i);
-               MAKE_WIDEPTR_FROMANSI(wszStmName, szStmName.c_str());
-
-               if (SUCCEEDED(hr = pstgData->CreateStream(wszStmName, STGM_DIRECT | STGM_READWRITE | STGM_SHARE_EXCLUSIVE | STGM_CREATE, 0, 0, &pstmItem)))
+               FastIStream *const pstm = serializedStreams[nextStream++].get();
+               if (m_vedit[i]->m_savedStream != pstm)
                {
-                  ULONG writ;
-                  IEditable *const piedit = m_vedit[i];
-                  const ItemTypeEnum type = piedit->GetItemType();
-                  pstmItem->Write(&type, sizeof(int), &writ);
-                  hr = piedit->SaveData(pstmItem, NULL, false);
-                  pstmItem->Release();
-                  pstmItem = nullptr;
-                  //if (FAILED(hr)) goto Error;
+                  m_vedit[i]->InvalidateSavedStream();
+                  pstm->AddRef();
+                  m_vedit[i]->m_savedStream = pstm;
                }
-
+               hr = WriteSerializedStream(pstgData, "GameItem" + std::to_string(i), pstm);
                csaveditems++;
                feedback.ItemHasBeenProcessed((int)i + 1, (int)m_vedit.size());
             }
 
             for (size_t i = 0; i < m_vsound.size(); i++)
             {
-               const string szStmName = "Sound" + std::to_string(i);
-               MAKE_WIDEPTR_FROMANSI(wszStmName, szStmName.c_str());
-
-               if (SUCCEEDED(hr = pstgData->CreateStream(wszStmName, STGM_DIRECT | STGM_READWRITE | STGM_SHARE_EXCLUSIVE | STGM_CREATE, 0, 0, &pstmItem)))
-               {
-                  SaveSoundToStream(m_vsound[i], pstmItem);
-                  pstmItem->Release();
-                  pstmItem = nullptr;
-               }
-
+               hr = WriteSerializedStream(pstgData, "Sound" + std::to_string(i), serializedStreams[nextStream++].get());
                csaveditems++;
                feedback.SoundHasBeenProcessed((int)i + 1, (int)m_vsound.size());
             }
 
             for (size_t i = 0; i < m_vimage.size(); i++)
             {
-               const string szStmName = "Image" + std::to_string(i);
-               MAKE_WIDEPTR_FROMANSI(wszStmName, szStmName.c_str());
-
-               if (SUCCEEDED(hr = pstgData->CreateStream(wszStmName, STGM_DIRECT | STGM_READWRITE | STGM_SHARE_EXCLUSIVE | STGM_CREATE, 0, 0, &pstmItem)))
-               {
-                  m_vimage[i]->SaveToStream(pstmItem, this);
-                  pstmItem->Release();
-                  pstmItem = nullptr;
-               }
-
+               hr = WriteSerializedStream(pstgData, "Image" + std::to_string(i), serializedStreams[nextStream++].get());
                csaveditems++;
                feedback.ImageHasBeenProcessed((int)i + 1, (int)m_vimage.size());
             }
 
             for (size_t i = 0; i < m_vfont.size(); i++)
             {
-               const string szStmName = "Font" + std::to_string(i);
-               MAKE_WIDEPTR_FROMANSI(wszStmName, szStmName.c_str());
-
-               if (SUCCEEDED(hr = pstgData->CreateStream(wszStmName, STGM_DIRECT | STGM_READWRITE | STGM_SHARE_EXCLUSIVE | STGM_CREATE, 0, 0, &pstmItem)))
-               {
-                  m_vfont[i]->SaveToStream(pstmItem);
-                  pstmItem->Release();
-                  pstmItem = nullptr;
-               }
-
+               hr = WriteSerializedStream(pstgData, "Font" + std::to_string(i), serializedStreams[nextStream++].get());
                csaveditems++;
                feedback.FontHasBeenProcessed((int)i + 1, (int)m_vfont.size());
             }
@@ -2924,6 +2994,10 @@ HRESULT PinTable::SaveToStorage(IStorage *pstgRoot, VPXFileFeedback& feedback)
 
    //Error:
 
+   // Release the serialized streams that were not written due to an error
+   for (; nextStream < serializedStreams.size(); nextStream++)
+      serializedStreams[nextStream].get()->Release();
+
    feedback.Done();
    m_savingActive = false;
 
@@ -2933,6 +3007,22 @@ HRESULT PinTable::SaveToStorage(IStorage *pstgRoot, VPXFileFeedback& feedback)
 #endif
 }
 
+HRESULT PinTable::WriteSerializedStream(IStorage *pstg, const string &szStmName, FastIStream *const pstmData)
+{
+   MAKE_WIDEPTR_FROMANSI(wszStmName, szStmName.c_str());
+
+   IStream *pstmItem;
+   HRESULT hr;
+   if (SUCCEEDED(hr = pstg->CreateStream(wszStmName, STGM_DIRECT | STGM_READWRITE | STGM_SHARE_EXCLUSIVE | STGM_CREATE, 0, 0, &pstmItem)))
+   {
+      ULONG writ;
+      hr = pstmItem->Write(pstmData->m_rg, pstmData->m_cSize, &writ);
+      pstmItem->Release();
+   }
+   pstmData->Release();
+   return hr;
+}
+
 HRESULT PinTable::SaveSoundToStream(const PinSound * const pps, IStream *pstm)
 {
    ULONG writ = 0;
@@ -6533,10 +6623,20 @@ void PinTable::SetDirty(SaveDirtyState sds)
 
 void PinTable::SetNonUndoableDirty(SaveDirtyState sds)
 {
+   // Changes that bypass the undo stack (materials, images, live editing, ...) may reference or modify any part.
+   // Only an actual modification marks the table dirty: the clean point bookkeeping after a (auto)save lowers the state and keeps the streams just written.
+   if (sds == eSaveDirty)
+      InvalidateSavedStreams();
    m_sdsNonUndoableDirty = sds;
    CheckDirty();
 }
 
+void PinTable::InvalidateSavedStreams()
+{
+   for (IEditable *const pedit : m_vedit)
+      pedit->InvalidateSavedStream();
+}
+
 void PinTable::CheckDirty()
 {
    const SaveDirtyState sdsNewDirtyState = (SaveDirtyState)max(max((int)m_sdsDirtyProp, (int)m_sdsDirtyScript), (int)m_sdsNonUndoableDirty);
@@ -7250,12 +7350,9 @@ HRESULT PinTable::StopSound(BSTR Sound)
    const string name(szName);
 
    // In case we were playing any of the main buffers
-   for (size_t i = 0; i < m_vsound.size(); i++)
-      if (StrCompareNoCase(m_vsound[i]->m_szName, name))
-      {
-         m_vsound[i]->Stop();
-         break;
-      }
+   const int i = GetSoundIndex(name);
+   if (i >= 0)
+      m_vsound[i]->Stop();
 
    m_vpinball->m_ps.StopCopiedWav(name);
 
@@ -7278,16 +7375,12 @@ STDMETHODIMP PinTable::PlaySound(BSTR bstr, int loopcount, float volume, float p
    WideCharToMultiByteNull(CP_ACP, 0, bstr, -1, szName, MAXSTRING, nullptr, nullptr);
    const string name(szName);
 
-   if (StrCompareNoCase("knock"s, name) || StrCompareNoCase("knocker"s, name))
-      ushock_output_knock();
-
-   size_t i;
-   for (i = 0; i < m_vsound.size(); i++)
-      if (StrCompareNoCase(m_vsound[i]->m_szName, name))
-         break;
-
-   if (i == m_vsound.size()) // did not find it
+   const int i = GetSoundIndex(name);
+   if (i < 0) // did not find it
    {
+      if (StrCompareNoCase("knock"s, name) || StrCompareNoCase("knocker"s, name))
+         ushock_output_knock();
+
       if (!name.empty() && m_pcv && g_pplayer && g_pplayer->m_hwndDebugOutput)
       {
          const string logmsg = "Request to play \"" + name + "\", but sound not found.";
@@ -7296,7 +7389,20 @@ STDMETHODIMP PinTable::PlaySound(BSTR bstr, int loopcount, float volume, float p
       return S_OK;
    }
 
-   PinSound * const pps = m_vsound[i];
+   PlaySoundIndex(i, loopcount, volume, pan, randompitch, pitch, usesame, restart, front_rear_fade);
+
+   return S_OK;
+}
+
+void PinTable::PlaySoundIndex(const int index, int loopcount, float volume, float pan, float randompitch, int pitch, VARIANT_BOOL usesame, VARIANT_BOOL restart, float front_rear_fade)
+{
+   if (index < 0 || index >= (int)m_vsound.size())
+      return;
+
+   PinSound * const pps = m_vsound[index];
+
+   if (StrCompareNoCase("knock"s, pps->m_szName) || StrCompareNoCase("knocker"s, pps->m_szName))
+      ushock_output_knock();
 
    volume += dequantizeSignedPercent(pps->m_volume);
    pan += dequantizeSignedPercent(pps->m_balance);
@@ -7306,8 +7412,6 @@ STDMETHODIMP PinTable::PlaySound(BSTR bstr, int loopcount, float volume, float p
       pan = -pan;
 
    m_vpinball->m_ps.Play(pps, volume * m_TableSoundVolume * (float)g_pplayer->m_SoundVolume, randompitch, pitch, pan, front_rear_fade, loopcount, VBTOb(usesame), VBTOb(restart));
-
-   return S_OK;
 }
 
 RenderProbe *PinTable::GetRenderProbe(const string &szName) const
@@ -7332,6 +7436,28 @@ RenderProbe *PinTable::GetRenderProbe(const string &szName) const
    return nullptr;
 }
 
+int PinTable::GetSoundIndex(const string &szName) const
+{
+   if (szName.empty())
+      return -1;
+
+   // during playback, we use the hashtable for lookup
+   if (!m_soundMap.empty())
+   {
+      const robin_hood::unordered_map<string, int, StringHashFunctor, StringComparator>::const_iterator it = m_soundMap.find(szName);
+      if (it != m_soundMap.end())
+         return it->second;
+      else
+         return -1;
+   }
+
+   for (size_t i = 0; i < m_vsound.size(); i++)
+      if (StrCompareNoCase(m_vsound[i]->m_szName, szName))
+         return (int)i;
+
+   return -1;
+}
+
 Light *PinTable::GetLight(const string &szName) const
 {
    if (szName.empty())
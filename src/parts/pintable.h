@@ -386,6 +386,7 @@ public:
    bool GetImageLink(const Texture *const ppi) const;
    PinBinary *GetImageLinkBinary(const int id);
    Light *GetLight(const string &szName) const;
+   int GetSoundIndex(const string &szName) const;
    RenderProbe *GetRenderProbe(const string &szName) const;
 
    void ShowWhereImagesUsed(vector<WhereUsedInfo> &);
@@ -475,6 +476,7 @@ public:
    HRESULT Save(const bool saveAs);
    HRESULT SaveToStorage(IStorage *pstg);
    HRESULT SaveToStorage(IStorage *pstg, VPXFileFeedback& feedback);
+   HRESULT WriteSerializedStream(IStorage *pstg, const string &szStmName, FastIStream *const pstmData); // Write a stream serialized in memory to the storage, and release it
    HRESULT SaveInfo(IStorage *pstg, HCRYPTHASH hcrypthash);
    HRESULT SaveCustomInfo(IStorage *pstg, IStream *pstmTags, HCRYPTHASH hcrypthash);
    HRESULT WriteInfoValue(IStorage *pstg, const WCHAR *const wzName, const string &szValue, HCRYPTHASH hcrypthash);
@@ -533,6 +535,7 @@ public:
 
    void SetDirty(SaveDirtyState sds);
    void SetNonUndoableDirty(SaveDirtyState sds);
+   void InvalidateSavedStreams();
    void CheckDirty();
    bool FDirty() const;
 
@@ -543,6 +546,7 @@ public:
 
    HRESULT StopSound(BSTR Sound);
    void StopAllSounds();
+   void PlaySoundIndex(const int index, int loopcount, float volume, float pan, float randompitch, int pitch, VARIANT_BOOL usesame, VARIANT_BOOL restart, float front_rear_fade);
 
    void DeleteFromLayer(IEditable *obj);
    void UpdateCollection(const int index);
@@ -880,6 +884,7 @@ private:
    robin_hood::unordered_map<string, Material *, StringHashFunctor, StringComparator> m_materialMap; // hash table to speed up material lookup by name
    robin_hood::unordered_map<string, Light *, StringHashFunctor, StringComparator> m_lightMap; // hash table to speed up light lookup by name
    robin_hood::unordered_map<string, RenderProbe *, StringHashFunctor, StringComparator> m_renderprobeMap; // hash table to speed up renderprobe lookup by name
+   robin_hood::unordered_map<string, int, StringHashFunctor, StringComparator> m_soundMap; // hash table to speed up sound lookup by name (index into m_vsound)
    bool m_moving;
 
    ToneMapper m_toneMapper = ToneMapper::TM_AGX;
@@ -915,6 +920,8 @@ public:
    STDMETHOD(LoadValue)(BSTR TableName, BSTR ValueName, /*[out, retval]*/ VARIANT *Value);
    STDMETHOD(SaveValue)(BSTR TableName, BSTR ValueName, VARIANT Value);
    STDMETHOD(StopSound)(BSTR Sound);
+   STDMETHOD(GetSoundHandle)(BSTR Sound, /*[out, retval]*/ LONG *pVal);
+   STDMETHOD(PlaySoundHandle)(LONG Handle, LONG LoopCount, float volume, float pan, float randompitch, LONG pitch, VARIANT_BOOL usesame, VARIANT_BOOL restart, float front_rear_fade);
    STDMETHOD(AddObject)(BSTR Name, IDispatch *pdisp);
 #ifdef _WIN64
    STDMETHOD(get_GetPlayerHWnd)(/*[out, retval]*/ SIZE_T *pVal);
@@ -9,9 +9,112 @@
 #include "progmesh.h"
 #include "ThreadPool.h"
 #include "renderer/Shader.h"
+#include "utils/hash.h"
 
 ThreadPool *g_pPrimitiveDecompressThreadPool = nullptr;
 
+// Tables saved before 10.11 store their primitive indices in import order, so these are reordered for the vertex cache (Forsyth) on each load,
+// which takes a noticeable time for large meshes. The reordered indices are cached on disk, keyed on the MD5 of the original indices and the vertex count.
+// The cache is shared by all tables and bounded in size: least recently used entries are evicted once the tables are loaded (see TrimMeshCache).
+struct MeshCacheHeader
+{
+   uint32_t magic;
+   uint32_t version;
+   uint64_t size;
+   uint32_t crc; // CRC-32 of the decompressed payload, checked on each cache hit
+   uint32_t padding;
+};
+static constexpr uint32_t MESH_CACHE_MAGIC = 0x48534D50u; // 'PMSH'
+static constexpr uint32_t MESH_CACHE_VERSION = 3u;
+static constexpr uintmax_t MESH_CACHE_MAX_SIZE = 512ull * 1024ull * 1024ull;
+static bool g_meshCacheWritten = false;
+static vector<string> g_meshCacheHits; // Entries used since the last trim, only marked as recently used when trimming to avoid a file write per hit
+
+static string GetMeshCacheDir(const PinTable *const table)
+{
+   if (table == nullptr || table->m_settings.LoadValueWithDefault(Settings::Player, "CacheMode"s, 1) <= 0)
+      return string();
+   return g_pvp->m_szMyPrefPath + "Cache" + PATH_SEPARATOR_CHAR + "Meshes" + PATH_SEPARATOR_CHAR;
+}
+
+static bool LoadMeshCache(const string &path, uint8_t *const dst, const size_t size)
+{
+   std::ifstream file(path, std::ios::binary);
+   if (!file.is_open())
+      return false;
+   MeshCacheHeader header;
+   if (!file.read((char *)&header, sizeof(header)) || header.magic != MESH_CACHE_MAGIC || header.version != MESH_CACHE_VERSION || header.size != size)
+      return false;
+   // Read to a temporary buffer, so that dst is left untouched for an invalid entry
+   vector<uint8_t> data(size);
+   if (!file.read((char *)data.data(), (std::streamsize)size) || (uint32_t)crc32(MZ_CRC32_INIT, data.data(), size) != header.crc)
+   {
+      PLOGE << "Invalid mesh cache entry " << path;
+      return false;
+   }
+   memcpy(dst, data.data(), size);
+   g_meshCacheHits.push_back(path);
+   return true;
+}
+
+static void SaveMeshCache(const string &path, const uint8_t *const src, const size_t size)
+{
+   // Write to a temporary file then rename, so that an interrupted write never leaves a partial entry
+   const string tmpPath = path + ".tmp";
+   try
+   {
+      std::filesystem::create_directories(std::filesystem::path(path).parent_path());
+      {
+         std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+         const MeshCacheHeader header { MESH_CACHE_MAGIC, MESH_CACHE_VERSION, size, (uint32_t)crc32(MZ_CRC32_INIT, src, size), 0 };
+         file.write((const char *)&header, sizeof(header));
+         file.write((const char *)src, (std::streamsize)size);
+         if (!file)
+            throw std::runtime_error("write failed");
+      }
+      std::filesystem::rename(tmpPath, path);
+      g_meshCacheWritten = true;
+   }
+   catch (...)
+   {
+      std::error_code ec;
+      std::filesystem::remove(tmpPath, ec);
+      PLOGE << "Failed to save mesh cache to " << path;
+   }
+}
+
+// Evicts the least recently used entries of the mesh cache until it fits in MESH_CACHE_MAX_SIZE
+static void TrimMeshCache()
+{
+   const string cacheDir = g_pvp->m_szMyPrefPath + "Cache" + PATH_SEPARATOR_CHAR + "Meshes" + PATH_SEPARATOR_CHAR;
+   std::error_code ec;
+   const auto now = std::filesystem::file_time_type::clock::now();
+   for (const string &path : g_meshCacheHits)
+      std::filesystem::last_write_time(path, now, ec);
+   g_meshCacheHits.clear();
+   vector<std::filesystem::directory_entry> entries;
+   uintmax_t totalSize = 0;
+   for (const auto &entry : std::filesystem::directory_iterator(cacheDir, ec))
+   {
+      if (!entry.is_regular_file(ec) || entry.path().extension() != ".msh")
+         continue;
+      totalSize += entry.file_size(ec);
+      entries.push_back(entry);
+   }
+   if (totalSize <= MESH_CACHE_MAX_SIZE)
+      return;
+   std::sort(entries.begin(), entries.end(), [](const std::filesystem::directory_entry &a, const std::filesystem::directory_entry &b)
+      { std::error_code ec; return a.last_write_time(ec) < b.last_write_time(ec); });
+   for (const auto &entry : entries)
+   {
+      if (totalSize <= MESH_CACHE_MAX_SIZE)
+         break;
+      const uintmax_t size = entry.file_size(ec);
+      if (std::filesystem::remove(entry.path(), ec))
+         totalSize -= size;
+   }
+}
+
 void Mesh::Clear()
 {
    m_vertices.clear();
@@ -19,6 +122,7 @@ void Mesh::Clear()
    for (size_t i = 0; i < m_animationFrames.size(); i++)
       m_animationFrames[i].m_frameVerts.clear();
    m_animationFrames.clear();
+   ReleaseAnimationStreams();
    middlePoint.x = 0.0f;
    middlePoint.y = 0.0f;
    middlePoint.z = 0.0f;
@@ -125,47 +229,119 @@ void Mesh::SaveWavefrontObj(const string& fname, const string& description)
    loader.Save(fname, description.empty() ? fname : description, *this);
 }
 
+void Mesh::BuildAnimationStreams()
+{
+   const size_t numVertices = m_vertices.size();
+   const size_t stride = (numVertices + 3) & ~(size_t)3;
+   m_animationStride = stride;
+   m_animationStreams.assign((m_animationFrames.size() * 6 + 2) * stride, 0.f);
+   for (size_t f = 0; f < m_animationFrames.size(); f++)
+   {
+      float * const __restrict dst = m_animationStreams.data() + f * 6 * stride;
+      const VertData * const __restrict src = m_animationFrames[f].m_frameVerts.data();
+      for (size_t i = 0; i < numVertices; i++)
+      {
+         dst[i             ] = src[i].x;
+         dst[i +     stride] = src[i].y;
+         dst[i + 2 * stride] = src[i].z;
+         dst[i + 3 * stride] = src[i].nx;
+         dst[i + 4 * stride] = src[i].ny;
+         dst[i + 5 * stride] = src[i].nz;
+      }
+   }
+   float * const __restrict uv = m_animationStreams.data() + m_animationFrames.size() * 6 * stride;
+   for (size_t i = 0; i < numVertices; i++)
+   {
+      uv[i         ] = m_vertices[i].tu;
+      uv[i + stride] = m_vertices[i].tv;
+   }
+   MemoryAccounting::Add(MemoryAccounting::MESH, (int64_t)(m_animationStreams.size() * sizeof(float)));
+}
+
+void Mesh::ReleaseAnimationStreams()
+{
+   MemoryAccounting::Add(MemoryAccounting::MESH, -(int64_t)(m_animationStreams.size() * sizeof(float)));
+   m_animationStreams = vector<float>();
+   m_animationStride = 0;
+}
+
+// Interpolates positions and normals between 2 frames of SoA animation streams, writing interleaved vertices (usually directly to a locked vertex buffer)
+static void LerpAnimationFrames(Vertex3D_NoTex2 * const __restrict dst, const float * const __restrict frame0, const float * const __restrict frame1, const float * const __restrict uv,
+   const size_t stride, const size_t count, const float t)
+{
+   size_t i = 0;
+#ifdef ENABLE_SSE_OPTIMIZATIONS
+   static_assert(sizeof(Vertex3D_NoTex2) == 8 * sizeof(float), "Vertex3D_NoTex2 layout must be x, y, z, nx, ny, nz, tu, tv");
+   float * const __restrict out = reinterpret_cast<float*>(dst);
+   const __m128 t4 = _mm_set1_ps(t);
+   for (; i + 4 <= count; i += 4)
+   {
+      __m128 v[8];
+      for (size_t k = 0; k < 6; k++)
+      {
+         const __m128 a = _mm_loadu_ps(frame0 + k * stride + i);
+         const __m128 b = _mm_loadu_ps(frame1 + k * stride + i);
+         v[k] = _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), t4));
+      }
+      v[6] = _mm_loadu_ps(uv + i);
+      v[7] = _mm_loadu_ps(uv + stride + i);
+      // 4 vertices of x.y.z.nx and ny.nz.tu.tv
+      _MM_TRANSPOSE4_PS(v[0], v[1], v[2], v[3]);
+      _MM_TRANSPOSE4_PS(v[4], v[5], v[6], v[7]);
+      for (size_t k = 0; k < 4; k++)
+      {
+         _mm_storeu_ps(out + (i + k) * 8,     v[k]);
+         _mm_storeu_ps(out + (i + k) * 8 + 4, v[k + 4]);
+      }
+   }
+#endif
+   for (; i < count; i++)
+   {
+      Vertex3D_NoTex2 &o = dst[i];
+      o.x  = frame0[i             ] + (frame1[i             ] - frame0[i             ]) * t;
+      o.y  = frame0[i +     stride] + (frame1[i +     stride] - frame0[i +     stride]) * t;
+      o.z  = frame0[i + 2 * stride] + (frame1[i + 2 * stride] - frame0[i + 2 * stride]) * t;
+      o.nx = frame0[i + 3 * stride] + (frame1[i + 3 * stride] - frame0[i + 3 * stride]) * t;
+      o.ny = frame0[i + 4 * stride] + (frame1[i + 4 * stride] - frame0[i + 4 * stride]) * t;
+      o.nz = frame0[i + 5 * stride] + (frame1[i + 5 * stride] - frame0[i + 5 * stride]) * t;
+      o.tu = uv[i];
+      o.tv = uv[i + stride];
+   }
+}
+
 void Mesh::UploadToVB(VertexBuffer * vb, const float frame) 
 {
    if(!vb)
       return;
 
-   if (frame >= 0.f)
+   if (vb->m_vertexFormat == VertexFormat::VF_POS_NORMAL_TEX_COMPACT)
    {
-      float intPart;
-      const float fractpart = modff(frame, &intPart);
-      const int iFrame = (int)intPart;
-
-      if (iFrame+1 < (int)m_animationFrames.size())
-      {
-          for (size_t i = 0; i < m_vertices.size(); i++)
-          {
-              const VertData& v  = m_animationFrames[iFrame  ].m_frameVerts[i];
-              const VertData& v2 = m_animationFrames[iFrame+1].m_frameVerts[i];
-              m_vertices[i].x  = v.x  + (v2.x  - v.x) *fractpart;
-              m_vertices[i].y  = v.y  + (v2.y  - v.y) *fractpart;
-              m_vertices[i].z  = v.z  + (v2.z  - v.z) *fractpart;
-              m_vertices[i].nx = v.nx + (v2.nx - v.nx)*fractpart;
-              m_vertices[i].ny = v.ny + (v2.ny - v.ny)*fractpart;
-              m_vertices[i].nz = v.nz + (v2.nz - v.nz)*fractpart;
-          }
-      }
-      else
-          for (size_t i = 0; i < m_vertices.size(); i++)
-          {
-              const VertData& v = m_animationFrames[iFrame].m_frameVerts[i];
-              m_vertices[i].x  = v.x;
-              m_vertices[i].y  = v.y;
-              m_vertices[i].z  = v.z;
-              m_vertices[i].nx = v.nx;
-              m_vertices[i].ny = v.ny;
-              m_vertices[i].nz = v.nz;
-          }
+      // Static mesh (never animated), see Primitive::RenderSetup
+      Vertex3D_Compact *buf;
+      vb->Lock(buf);
+      VertexBuffer::PackCompact(buf, m_vertices.data(), (unsigned int)m_vertices.size());
+      vb->Unlock();
+      return;
    }
 
    Vertex3D_NoTex2 *buf;
    vb->Lock(buf);
-   memcpy(buf, m_vertices.data(), sizeof(Vertex3D_NoTex2)*m_vertices.size());
+   if (frame >= 0.f && !m_animationFrames.empty())
+   {
+      if (m_animationStreams.empty())
+         BuildAnimationStreams();
+
+      float intPart;
+      const float fractpart = modff(frame, &intPart);
+      const size_t iFrame = min((size_t)intPart, m_animationFrames.size() - 1);
+      const size_t frameSize = 6 * m_animationStride;
+      const float * const frame0 = m_animationStreams.data() + iFrame * frameSize;
+      const float * const frame1 = (iFrame + 1 < m_animationFrames.size()) ? frame0 + frameSize : frame0; // last frame: no interpolation
+      const float * const uv = m_animationStreams.data() + m_animationFrames.size() * frameSize;
+      LerpAnimationFrames(buf, frame0, frame1, uv, m_animationStride, m_vertices.size(), fractpart);
+   }
+   else
+      memcpy(buf, m_vertices.data(), sizeof(Vertex3D_NoTex2)*m_vertices.size());
    vb->Unlock();
 }
 
@@ -232,6 +408,9 @@ Primitive *Primitive::CopyForPlay(PinTable *live_table) const
 {
    STANDARD_EDITABLE_COPY_FOR_PLAY_IMPL(Primitive, live_table)
    dst->m_mesh = m_mesh;
+   // Animation streams are a render cache, built (and accounted) by the mesh that uses them
+   dst->m_mesh.m_animationStreams = vector<float>();
+   dst->m_mesh.m_animationStride = 0;
    return dst;
 }
 
@@ -1192,7 +1371,12 @@ void Primitive::RenderSetup(RenderDevice *device)
    m_currentFrame = -1.f;
    m_d.m_isBackGlassImage = IsBackglass();
 
-   VertexBuffer *vertexBuffer = new VertexBuffer(m_rd, (unsigned int)m_mesh.NumVertices(), nullptr, !(m_d.m_staticRendering || m_mesh.m_animationFrames.empty()));
+   // Static meshes use the compact vertex format when its precision is enough once scaled to world space
+   const bool isDynamic = !(m_d.m_staticRendering || m_mesh.m_animationFrames.empty());
+   const float maxScale = max(max(fabsf(m_d.m_vSize.x), fabsf(m_d.m_vSize.y)), fabsf(m_d.m_vSize.z));
+   const bool compact = !isDynamic && m_rd->UseCompactVertices()
+      && VertexBuffer::CanUseCompactFormat(m_mesh.m_vertices.data(), (unsigned int)m_mesh.NumVertices(), maxScale > 0.f ? VertexBuffer::COMPACT_MAX_POSITION_ERROR / maxScale : FLT_MAX);
+   VertexBuffer *vertexBuffer = new VertexBuffer(m_rd, (unsigned int)m_mesh.NumVertices(), nullptr, isDynamic, compact ? VertexFormat::VF_POS_NORMAL_TEX_COMPACT : VertexFormat::VF_POS_NORMAL_TEX);
    IndexBuffer *indexBuffer = new IndexBuffer(m_rd, m_mesh.m_indices);
    m_meshBuffer = new MeshBuffer(m_wzName, vertexBuffer, indexBuffer, true);
 
@@ -1207,6 +1391,7 @@ void Primitive::RenderRelease()
    assert(m_rd != nullptr);
    delete m_meshBuffer;
    m_meshBuffer = nullptr;
+   m_mesh.ReleaseAnimationStreams();
    m_lightmap = nullptr;
    m_rd = nullptr;
 }
@@ -1688,11 +1873,28 @@ HRESULT Primitive::InitLoad(IStream *pstm, PinTable *ptable, int *pid, int versi
    {
       WaitForMeshDecompression(); //!! needed nowadays due to multithreaded mesh decompression
 
-      unsigned int* const tmp = reorderForsyth(m_mesh.m_indices, (int)m_mesh.NumVertices());
-      if (tmp != nullptr)
+      string cachePath;
+      const string cacheDir = GetMeshCacheDir(m_ptable);
+      const size_t indicesSize = m_mesh.NumIndices() * sizeof(unsigned int);
+      if (!cacheDir.empty() && indicesSize > 0)
       {
-         memcpy(m_mesh.m_indices.data(), tmp, m_mesh.NumIndices() * sizeof(unsigned int));
-         delete[] tmp;
+         uint8_t md5[16];
+         generateMD5((const uint8_t *)m_mesh.m_indices.data(), indicesSize, md5);
+         char key[33];
+         for (int i = 0; i < 16; ++i)
+            sprintf_s(key + i * 2, 3, "%02x", md5[i]);
+         cachePath = cacheDir + key + '_' + std::to_string(m_mesh.NumVertices()) + ".msh";
+      }
+      if (cachePath.empty() || !LoadMeshCache(cachePath, (uint8_t *)m_mesh.m_indices.data(), indicesSize))
+      {
+         unsigned int* const tmp = reorderForsyth(m_mesh.m_indices, (int)m_mesh.NumVertices());
+         if (tmp != nullptr)
+         {
+            memcpy(m_mesh.m_indices.data(), tmp, indicesSize);
+            delete[] tmp;
+            if (!cachePath.empty())
+               SaveMeshCache(cachePath, (const uint8_t *)m_mesh.m_indices.data(), indicesSize);
+         }
       }
    }
 
@@ -1777,11 +1979,19 @@ bool Primitive::LoadToken(const int id, BiffReader * const pbr)
       mz_ulong uclen = (mz_ulong)(sizeof(Mesh::VertData)*m_mesh.NumVertices());
       mz_uint8 * c = (mz_uint8 *)malloc(m_compressedAnimationVertices);
       pbr->GetStruct(c, m_compressedAnimationVertices);
-      const int error = uncompress((unsigned char *)frameData.m_frameVerts.data(), &uclen, c, m_compressedAnimationVertices);
-      if (error != Z_OK)
-         ShowError("Could not uncompress primitive animation vertex data, error "+std::to_string(error));
-      free(c);
-      m_mesh.m_animationFrames.push_back(frameData);
+      // Moving the frame keeps its vertex buffer, so the pointer stays valid when m_animationFrames grows while it is being decompressed
+      uint8_t * const frameVerts = (uint8_t *)frameData.m_frameVerts.data();
+      m_mesh.m_animationFrames.push_back(std::move(frameData));
+      if (g_pPrimitiveDecompressThreadPool == nullptr)
+         g_pPrimitiveDecompressThreadPool = new ThreadPool(g_pvp->GetLogicalNumberOfProcessors());
+
+      g_pPrimitiveDecompressThreadPool->enqueue([uclen, c, frameVerts, compressedSize = m_compressedAnimationVertices] {
+         mz_ulong uclen2 = uclen;
+         const int error = uncompress(frameVerts, &uclen2, c, compressedSize);
+         if (error != Z_OK)
+            ShowError("Could not uncompress primitive animation vertex data, error "+std::to_string(error));
+         free(c);
+      });
       break;
    }
    case FID(M3CY): pbr->GetInt(m_compressedVertices); break;
@@ -1899,6 +2109,12 @@ void Primitive::WaitForMeshDecompression()
       delete g_pPrimitiveDecompressThreadPool;
       g_pPrimitiveDecompressThreadPool = nullptr;
    }
+   // Once per load (when new entries were written), keep the mesh cache within its size bound
+   if (g_meshCacheWritten)
+   {
+      g_meshCacheWritten = false;
+      TrimMeshCache();
+   }
 }
 
 HRESULT Primitive::InitPostLoad()
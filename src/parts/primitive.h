@@ -23,6 +23,11 @@ public:
 
    vector<FrameData> m_animationFrames;
    vector<Vertex3D_NoTex2> m_vertices;
+   // Animation frames as structure of arrays for the interpolation when uploading: x, y, z, nx, ny, nz streams for each frame, followed by the tu, tv streams of the mesh.
+   // Each stream holds m_animationStride floats (vertex count padded to a multiple of 4). Built on first animated upload, released with ReleaseAnimationStreams.
+   // This roughly doubles the memory used by animated meshes (reported as MESH in MemoryAccounting).
+   vector<float> m_animationStreams;
+   size_t m_animationStride = 0;
    vector<unsigned int> m_indices;
    Vertex3Ds m_minAABound, m_maxAABound;
    bool m_validBounds = false;
@@ -36,7 +41,11 @@ public:
    size_t NumVertices() const    { return m_vertices.size(); }
    size_t NumIndices() const     { return m_indices.size(); }
    void UploadToVB(VertexBuffer * vb, const float frame);
+   void ReleaseAnimationStreams();
    void UpdateBounds();
+
+private:
+   void BuildAnimationStreams();
 };
 
 // Indices for RotAndTra:
@@ -592,6 +592,7 @@ void PhysicsEngine::UpdatePhysics()
       delta_frame = initial_time_usec - m_lastFlipTime;
       initial_time_usec -= delta_frame;
    }
+   m_simToRealTimeOffset = delta_frame;
 
    // When paused or after debugging, shift whole game forward in time
    // TODO not sure why we would need noTimeCorrect, as pause should already have shifted the timings
@@ -688,10 +689,8 @@ void PhysicsEngine::UpdatePhysics()
       //const U32 sim_msec = (U32)(m_curPhysicsFrameTime / 1000);
       const U32 cur_time_msec = (U32)(cur_time_usec / 1000);
 
-      #if !defined(ENABLE_BGFX)
-      // FIXME remove ? To be done correctly, we should process OS messages and sync back controller
-      g_pplayer->m_pininput.ProcessKeys(/*sim_msec,*/ cur_time_msec);
-      #endif
+      // Apply the input events received up to the end of this physics step (input timestamps are in real time, so convert the simulated time to real time)
+      g_pplayer->m_pininput.ProcessKeys(cur_time_msec, m_nextPhysicsFrameTime + m_simToRealTimeOffset);
 
       // FIXME remove ? move HID to a plugin, remove mixer or at least outside of physics loop
       mixer_update();
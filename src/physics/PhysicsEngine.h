@@ -31,6 +31,9 @@ public:
 
    void StartPhysics();
    void UpdatePhysics();
+   // Real time (usec() time base, like input event timestamps) up to which the machine has been simulated.
+   // Simulated time lags real time by the frame sync offset of the last update (see DJRobX's latency reduction in UpdatePhysics).
+   U64 GetCurPhysicsFrameRealTime() const { return m_curPhysicsFrameTime + m_simToRealTimeOffset; }
 
    bool IsBallCollisionHandlingSwapped() const { return m_swap_ball_collision_handling; }
    bool RecordContact(const CollisionEvent& newColl);
@@ -73,6 +76,7 @@ private:
    U64 m_curPhysicsFrameTime; // Time where the last machine simulation (physics, timers, scripts,...) stopped
    U64 m_nextPhysicsFrameTime; // Time at which the next physics update should be
    U64 m_lastFlipTime = 0;
+   U64 m_simToRealTimeOffset = 0; // Offset to add to simulated times to get the matching real time
 
    vector<HitFlipper *> m_vFlippers;
    HitPlane m_hitPlayfield; // HitPlanes cannot be part of octree (infinite size)
@@ -94,6 +94,10 @@ public:
    HitObject(IEditable* const editable) : m_editable(editable) {}
    virtual ~HitObject() {}
 
+   // Track the size of the actual derived objects in the memory accounting
+   static void* operator new(const size_t size) { MemoryAccounting::Add(MemoryAccounting::COLLIDER, (int64_t)size); return ::operator new(size); }
+   static void operator delete(void* const ptr, const size_t size) { MemoryAccounting::Add(MemoryAccounting::COLLIDER, -(int64_t)size); ::operator delete(ptr); }
+
    virtual float HitTest(const BallS& ball, const float dtime, CollisionEvent& coll) const { return -1.f; } //!! shouldn't need to do this, but for whatever reason there is a pure virtual function call triggered otherwise that refuses to be debugged (all derived classes DO implement this one!)
    virtual int GetType() const = 0;
    virtual void Collide(const CollisionEvent& coll) = 0;
@@ -214,5 +214,9 @@ typedef struct AudioUpdateMsg
    unsigned int format;          // The sample data format (see CTLPI_AUDIO_FORMAT_xxx)
    double sampleRate;            // The sample rate
    unsigned int bufferSize;      // The size of the audio buffer
-   uint8_t* buffer;              // The sample data, or null for immediate stream destruction
+   uint8_t* buffer;              // The sample data, or null for immediate stream destruction (unless readSamples is defined)
+   // Optional pull mode: if defined, the stream is announced once (without buffer) then the consumer reads the samples from its audio
+   // thread through this callback instead of receiving update messages. It must be lock free and returns the number of bytes read.
+   unsigned int (*readSamples)(void* context, uint8_t* buffer, unsigned int size);
+   void* readContext;            // Context passed to readSamples
 } AudioUpdateMsg;
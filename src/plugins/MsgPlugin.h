@@ -29,15 +29,24 @@
 //
 // The plugin API is not thread safe. If a plugin uses multithreading, it must
 // perform all needed synchronization and data copies. The 'RunOnMainThread' method
-// is the only one that may be called from any thread to request a callback to be
-// ran on the main thread, either as a blocking call if delay is negative, or as an
-// async call if delay is zero or positive.
+// may be called from any thread to request a callback to be ran on the main thread,
+// either as a blocking call if delay is negative, or as an async call if delay is zero
+// or positive. A blocking call is not performed (and logged as an error) if the main
+// thread is not processing callbacks or does not process it in time. The 'PostMsg' method may also be called from any thread to queue a
+// message that will be broadcasted from the main thread.
 //
 // To avoid message collision, each message is defined by a unique name in a 'namespace'
 // which is expected to be unique for each host/plugin. MsgId are allocated/retrieved
 // by using GetMsgID. If not needed anymore, host/plugin should call 'ReleaseMsgID' to
 // avoid reaching the implementation dependent message limits.
 //
+// Messages requesting data from a resource owned by an endpoint (for example a DMD
+// frame from a given display) should be sent using 'SendResMsg' instead of being
+// broadcasted. Subscribers registered for this resource using 'SubscribeResMsg' and
+// subscribers registered for all resources using 'SubscribeMsg' will receive it, but
+// the other resource subscribers will not. 'BroadcastMsg' is received by all
+// subscribers. 'UnsubscribeMsg' removes all the subscriptions of a callback.
+//
 // Plugins are instantiated on a thread selected by the host which may or may not be 
 // the main application thread. Therefore, unless plugin is designed for a single host 
 // which explicitely allows it, plugins are not allowed to perform any operation limited
@@ -108,4 +117,9 @@ typedef struct MsgPluginAPI
    void (MSGPIAPI *GetSetting)(const char* name_space, const char* name, char* valueBuf, unsigned int valueBufSize);
    // Threading
    void (MSGPIAPI *RunOnMainThread)(const double delayInS, const msgpi_timer_callback callback, void* userData);
+   // Resource messaging
+   void (MSGPIAPI *SubscribeResMsg)(const uint32_t endpointId, const unsigned int msgId, const uint64_t resId, const msgpi_msg_callback callback, void* userData);
+   void (MSGPIAPI *SendResMsg)(const uint32_t endpointId, const unsigned int msgId, const uint64_t resId, void* data);
+   // Cross thread messaging (data is owned by the sender until releaseCallback is called with it on the main thread after broadcasting)
+   void (MSGPIAPI *PostMsg)(const uint32_t endpointId, const unsigned int msgId, void* data, const msgpi_timer_callback releaseCallback);
 } MsgPluginAPI;
@@ -12,6 +12,7 @@
 #include <iostream>
 #include <filesystem>
 #include <chrono>
+#include <algorithm>
 
 #define MINI_CASE_SENSITIVE
 #include "mINI/ini.h"
@@ -66,7 +67,13 @@ MsgPluginManager::MsgPluginManager()
    m_api.ReleaseMsgID = ReleaseMsgID;
    m_api.GetSetting = GetSetting; 
    m_api.RunOnMainThread = RunOnMainThread;
+   m_api.SubscribeResMsg = SubscribeResMsg;
+   m_api.SendResMsg = SendResMsg;
+   m_api.PostMsg = PostMsg;
    m_apiThread = std::this_thread::get_id();
+   for (uint32_t i = 0; i < POST_QUEUE_SIZE; i++)
+      m_postQueue[i].sequence.store(i, std::memory_order_relaxed);
+   m_timers.reserve(64);
 }
 
 MsgPluginManager::~MsgPluginManager()
@@ -104,6 +111,7 @@ unsigned int MsgPluginManager::GetMsgID(const char* name_space, const char* name
    freeMsg->name_space = name_space;
    freeMsg->name = name;
    freeMsg->callbacks.clear();
+   freeMsg->resCallbacks.clear();
    return freeMsg->id;
 }
 
@@ -122,7 +130,28 @@ void MsgPluginManager::SubscribeMsg(const unsigned int endpointId, const unsigne
       for (const CallbackEntry entry : pm.m_msgs[msgId].callbacks)
          assert(entry.callback != callback);
    #endif
-   pm.m_msgs[msgId].callbacks.push_back(CallbackEntry { endpointId, callback, userData });
+   pm.m_msgs[msgId].callbacks.push_back(CallbackEntry { endpointId, callback, userData, 0 });
+}
+
+void MsgPluginManager::SubscribeResMsg(const unsigned int endpointId, const unsigned int msgId, const uint64_t resId, const msgpi_msg_callback callback, void* userData)
+{
+   MsgPluginManager& pm = GetInstance();
+#ifndef __LIBVPINBALL__
+   assert(std::this_thread::get_id() == pm.m_apiThread);
+#endif
+   assert(callback != nullptr);
+   assert(msgId < pm.m_msgs.size());
+   assert(pm.m_msgs[msgId].refCount > 0);
+   assert(1 <= endpointId && endpointId < pm.m_nextEndpointId);
+   std::vector<CallbackEntry>& resCallbacks = pm.m_msgs[msgId].resCallbacks;
+   // Keep the list sorted by resource id (and by subscription order for a given resource) to allow dispatching with a binary search
+   const auto pos = std::ranges::upper_bound(resCallbacks, resId, {}, &CallbackEntry::resId);
+   #ifdef DEBUG
+      // Callback are only allowed to be registered once per message and resource
+      for (auto it = std::ranges::lower_bound(resCallbacks, resId, {}, &CallbackEntry::resId); it != pos; ++it)
+         assert(it->callback != callback);
+   #endif
+   resCallbacks.insert(pos, CallbackEntry { endpointId, callback, userData, resId });
 }
 
 void MsgPluginManager::UnsubscribeMsg(const unsigned int msgId, const msgpi_msg_callback callback)
@@ -134,16 +163,19 @@ void MsgPluginManager::UnsubscribeMsg(const unsigned int msgId, const msgpi_msg_
    assert(callback != nullptr);
    assert(msgId < pm.m_msgs.size());
    assert(pm.m_msgs[msgId].refCount > 0);
+   bool found = false;
    for (std::vector<CallbackEntry>::iterator it = pm.m_msgs[msgId].callbacks.begin(); it != pm.m_msgs[msgId].callbacks.end(); ++it)
    {
       if (it->callback == callback)
       {
          pm.m_msgs[msgId].callbacks.erase(it);
-         return;
+         found = true;
+         break;
       }
    }
+   found |= std::erase_if(pm.m_msgs[msgId].resCallbacks, [callback](const CallbackEntry& entry) { return entry.callback == callback; }) > 0;
    // Detect invalid subscribe/unsubscribe pairs
-   assert(false);
+   assert(found);
 }
 
 void MsgPluginManager::BroadcastMsg(const unsigned int endpointId, const unsigned int msgId, void* data)
@@ -155,9 +187,52 @@ void MsgPluginManager::BroadcastMsg(const unsigned int endpointId, const unsigne
    assert(msgId < pm.m_msgs.size());
    assert(pm.m_msgs[msgId].refCount > 0);
    assert(1 <= endpointId && endpointId < pm.m_nextEndpointId);
-   for (const CallbackEntry entry : pm.m_msgs[msgId].callbacks)
+   // Iterate by index and read back the entry since subscribers are allowed to subscribe/unsubscribe while processing the message
+   for (size_t i = 0; i < pm.m_msgs[msgId].resCallbacks.size(); i++)
+   {
+      const CallbackEntry& entry = pm.m_msgs[msgId].resCallbacks[i];
       if (entry.endpointId != endpointId) // Don't broadcast to sender's endpoint
          entry.callback(msgId, entry.userData, data);
+   }
+   for (size_t i = 0; i < pm.m_msgs[msgId].callbacks.size(); i++)
+   {
+      const CallbackEntry& entry = pm.m_msgs[msgId].callbacks[i];
+      if (entry.endpointId != endpointId) // Don't broadcast to sender's endpoint
+         entry.callback(msgId, entry.userData, data);
+   }
+}
+
+void MsgPluginManager::SendResMsg(const unsigned int endpointId, const unsigned int msgId, const uint64_t resId, void* data)
+{
+   MsgPluginManager& pm = GetInstance();
+#ifndef __LIBVPINBALL__
+   assert(std::this_thread::get_id() == pm.m_apiThread);
+#endif
+   assert(msgId < pm.m_msgs.size());
+   assert(pm.m_msgs[msgId].refCount > 0);
+   assert(1 <= endpointId && endpointId < pm.m_nextEndpointId);
+   // Only dispatch to the subscribers of the requested resource, then to the ones subscribed for all resources
+   const std::vector<CallbackEntry>& resCallbacks = pm.m_msgs[msgId].resCallbacks;
+   size_t i = std::ranges::lower_bound(resCallbacks, resId, {}, &CallbackEntry::resId) - resCallbacks.begin();
+   for (; i < pm.m_msgs[msgId].resCallbacks.size() && pm.m_msgs[msgId].resCallbacks[i].resId == resId; i++)
+   {
+      const CallbackEntry& entry = pm.m_msgs[msgId].resCallbacks[i];
+      if (entry.endpointId != endpointId) // Don't send to sender's endpoint
+         entry.callback(msgId, entry.userData, data);
+   }
+   for (i = 0; i < pm.m_msgs[msgId].callbacks.size(); i++)
+   {
+      const CallbackEntry& entry = pm.m_msgs[msgId].callbacks[i];
+      if (entry.endpointId != endpointId) // Don't send to sender's endpoint
+         entry.callback(msgId, entry.userData, data);
+   }
+}
+
+void MsgPluginManager::PostMsg(const unsigned int endpointId, const unsigned int msgId, void* data, const msgpi_timer_callback releaseCallback)
+{
+   MsgPluginManager& pm = GetInstance();
+   const std::lock_guard<std::mutex> lock(pm.m_postedMsgsMutex);
+   pm.m_postedMsgs.push_back(PostedMsgEntry { endpointId, msgId, data, releaseCallback });
 }
 
 void MsgPluginManager::ReleaseMsgID(const unsigned int msgId)
@@ -191,41 +266,150 @@ void MsgPluginManager::RunOnMainThread(const double delayInS, const msgpi_timer_
       callback(userData);
       return;
    }
-   const std::lock_guard<std::mutex> lock(pm.m_timerListMutex);
    if (delayInS < 0.)
    {
-      pm.m_timers.insert(pm.m_timers.begin(), TimerEntry { callback, userData, std::chrono::high_resolution_clock::now() });
-      // FIXME block until processed
+      // Blocking call: post the callback then wait for the main thread to have run it
+      if (!pm.IsMainLoopRunning())
+      {
+         // Nothing would process the callback (player not started or already closed): fail instead of waiting forever
+         PLOGE << "Blocking RunOnMainThread call while main thread is not processing callbacks, callback was not run";
+         return;
+      }
+      std::shared_ptr<BlockingCall> call = std::make_shared<BlockingCall>();
+      pm.PostTimer(TimerEntry { callback, userData, std::chrono::high_resolution_clock::now(), 0, call });
+      std::unique_lock<std::mutex> lock(pm.m_blockingMutex);
+      if (!pm.m_blockingCondition.wait_for(lock, BLOCKING_CALL_TIMEOUT, [&call] { return call->processed; }))
+      {
+         if (call->running) // Callback is being run by the main thread, it will complete
+            pm.m_blockingCondition.wait(lock, [&call] { return call->processed; });
+         else
+         {
+            call->cancelled = true;
+            PLOGE << "Blocking RunOnMainThread call timed out, callback was cancelled";
+         }
+      }
    }
    else
    {
-      auto timer = TimerEntry { callback, userData, std::chrono::high_resolution_clock::now() + std::chrono::microseconds(static_cast<int64_t>(delayInS * 1000000)) };
-      pm.m_timers.insert(std::ranges::upper_bound(pm.m_timers.begin(), pm.m_timers.end(), timer, [](const TimerEntry &a, const TimerEntry &b) { return a.time < b.time; }), timer);
+      pm.PostTimer(TimerEntry { callback, userData, std::chrono::high_resolution_clock::now() + std::chrono::microseconds(static_cast<int64_t>(delayInS * 1000000)), 0, nullptr });
+   }
+}
+
+bool MsgPluginManager::IsMainLoopRunning() const
+{
+   const int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+   const int64_t lastProcess = m_lastProcessTime.load(std::memory_order_relaxed);
+   return lastProcess != 0 && now - lastProcess < MAIN_LOOP_TIMEOUT.count();
+}
+
+void MsgPluginManager::PostTimer(TimerEntry timer)
+{
+   timer.sequence = m_postSequence.fetch_add(1, std::memory_order_relaxed);
+
+   // Bounded MPSC queue: each cell sequence tells if it is free for the producer at this position (sequence == pos) or ready for the consumer (sequence == pos + 1)
+   uint32_t pos = m_postQueueWrite.load(std::memory_order_relaxed);
+   for (;;)
+   {
+      PostedTimer& cell = m_postQueue[pos & (POST_QUEUE_SIZE - 1)];
+      const int32_t diff = static_cast<int32_t>(cell.sequence.load(std::memory_order_acquire) - pos);
+      if (diff == 0)
+      {
+         if (m_postQueueWrite.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+         {
+            cell.timer = timer;
+            cell.sequence.store(pos + 1, std::memory_order_release);
+            return;
+         }
+      }
+      else if (diff < 0)
+      {
+         // Queue is full, fall back to a locked list to never block the producer on the main thread
+         const std::lock_guard<std::mutex> lock(m_overflowTimersMutex);
+         m_overflowTimers.push_back(timer);
+         m_hasOverflowTimers.store(true, std::memory_order_release);
+         return;
+      }
+      else
+         pos = m_postQueueWrite.load(std::memory_order_relaxed);
    }
 }
 
+void MsgPluginManager::DispatchTimer(const TimerEntry& timer)
+{
+   if (timer.blocking == nullptr)
+   {
+      timer.callback(timer.userData);
+      return;
+   }
+   {
+      const std::lock_guard<std::mutex> lock(m_blockingMutex);
+      if (timer.blocking->cancelled) // Caller gave up waiting, its user data may not be valid anymore
+         return;
+      timer.blocking->running = true;
+   }
+   timer.callback(timer.userData);
+   {
+      const std::lock_guard<std::mutex> lock(m_blockingMutex);
+      timer.blocking->processed = true;
+   }
+   m_blockingCondition.notify_all();
+}
+
 void MsgPluginManager::ProcessAsyncCallbacks()
 {
 #ifndef __LIBVPINBALL__
    assert(std::this_thread::get_id() == m_apiThread);
 #endif
-   if (m_timers.empty())
-      return;
-   std::vector<TimerEntry> timers;
    {
-      const std::lock_guard<std::mutex> lock(m_timerListMutex);
-      std::chrono::high_resolution_clock::time_point now = std::chrono::high_resolution_clock::now();
-      for (std::vector<TimerEntry>::iterator it = m_timers.begin(); it < m_timers.end();)
+      const std::lock_guard<std::mutex> lock(m_postedMsgsMutex);
+      m_dispatchedMsgs.swap(m_postedMsgs);
+   }
+   // Release lock before broadcasting to allow subscribers to post messages
+   for (const PostedMsgEntry& msg : m_dispatchedMsgs)
+   {
+      BroadcastMsg(msg.endpointId, msg.msgId, msg.data);
+      if (msg.releaseCallback)
+         msg.releaseCallback(msg.data);
+   }
+   m_dispatchedMsgs.clear();
+
+   m_lastProcessTime.store(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count(), std::memory_order_relaxed);
+
+   // Move all posted callbacks to the timer heap, then run the due ones ordered by due time then posting order. The overflow list is taken
+   // before draining the queue, so that posts made to the queue before an overflow are gathered with it (order is restored by the heap)
+   const auto isLater = [](const TimerEntry& a, const TimerEntry& b) { return a.time > b.time || (a.time == b.time && a.sequence > b.sequence); };
+   if (m_hasOverflowTimers.load(std::memory_order_acquire))
+   {
+      const std::lock_guard<std::mutex> lock(m_overflowTimersMutex);
+      for (const TimerEntry& timer : m_overflowTimers)
       {
-         if (it->time > now)
-            break;
-         timers.push_back(*it);
-         it = m_timers.erase(it);
+         m_timers.push_back(timer);
+         std::ranges::push_heap(m_timers, isLater);
       }
+      m_overflowTimers.clear();
+      m_hasOverflowTimers.store(false, std::memory_order_relaxed);
+   }
+   for (;;)
+   {
+      PostedTimer& cell = m_postQueue[m_postQueueRead & (POST_QUEUE_SIZE - 1)];
+      if (cell.sequence.load(std::memory_order_acquire) != m_postQueueRead + 1)
+         break;
+      m_timers.push_back(std::move(cell.timer));
+      cell.timer.blocking = nullptr;
+      cell.sequence.store(m_postQueueRead + POST_QUEUE_SIZE, std::memory_order_release);
+      m_postQueueRead++;
+      std::ranges::push_heap(m_timers, isLater);
+   }
+
+   // Run due timers (callbacks posting new timers go through the post queue, so the heap is not modified while processing it)
+   const std::chrono::high_resolution_clock::time_point now = std::chrono::high_resolution_clock::now();
+   while (!m_timers.empty() && m_timers.front().time <= now)
+   {
+      std::ranges::pop_heap(m_timers, isLater);
+      const TimerEntry timer = m_timers.back();
+      m_timers.pop_back();
+      DispatchTimer(timer);
    }
-   // Release lock before calling callbacks to avoid deadlock
-   for (auto it = timers.begin(); it < timers.end(); ++it)
-      it->callback(it->userData);
 }
 
 
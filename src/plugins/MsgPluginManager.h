@@ -13,6 +13,8 @@
 #include <string>
 #include <thread>
 #include <mutex>
+#include <atomic>
+#include <condition_variable>
 #include <memory>
 #include <functional>
 
@@ -102,6 +104,9 @@ private:
    static void ReleaseMsgID(const unsigned int msgId);
    static void GetSetting(const char* name_space, const char* name, char* valueBuf, unsigned int valueBufSize);
    static void RunOnMainThread(const double delayInS, const msgpi_timer_callback callback, void* userData);
+   static void SubscribeResMsg(const unsigned int endpointId, const unsigned int msgId, const uint64_t resId, const msgpi_msg_callback callback, void* userData);
+   static void SendResMsg(const unsigned int endpointId, const unsigned int msgId, const uint64_t resId, void* data);
+   static void PostMsg(const unsigned int endpointId, const unsigned int msgId, void* data, const msgpi_timer_callback releaseCallback);
 
    std::vector<std::shared_ptr<MsgPlugin>> m_plugins;
 
@@ -110,6 +115,7 @@ private:
       unsigned int endpointId;
       msgpi_msg_callback callback;
       void* userData;
+      uint64_t resId;
    };
    struct MsgEntry
    {
@@ -117,18 +123,66 @@ private:
       std::string name_space;
       std::string name;
       unsigned int id;
-      std::vector<CallbackEntry> callbacks;
+      std::vector<CallbackEntry> callbacks; // Subscribers for all resources
+      std::vector<CallbackEntry> resCallbacks; // Subscribers for a single resource, sorted by resource id
    };
    std::vector<MsgEntry> m_msgs;
 
+   struct PostedMsgEntry
+   {
+      unsigned int endpointId;
+      unsigned int msgId;
+      void* data;
+      msgpi_timer_callback releaseCallback;
+   };
+   std::vector<PostedMsgEntry> m_postedMsgs;
+   std::vector<PostedMsgEntry> m_dispatchedMsgs; // Swapped with the posted list to avoid reallocating each frame
+   std::mutex m_postedMsgsMutex;
+
+   // State of a blocking call, shared with the caller since it may give up waiting (all fields guarded by m_blockingMutex)
+   struct BlockingCall
+   {
+      bool running = false;
+      bool processed = false;
+      bool cancelled = false;
+   };
    struct TimerEntry
    {
       msgpi_timer_callback callback;
       void* userData;
       std::chrono::high_resolution_clock::time_point time;
+      uint64_t sequence; // Posting order, used to run timers with the same due time in the order they were posted
+      std::shared_ptr<BlockingCall> blocking; // Set for blocking calls, signaled through m_blockingCondition once the callback has been run
    };
+   void PostTimer(TimerEntry timer);
+   void DispatchTimer(const TimerEntry& timer);
+   bool IsMainLoopRunning() const;
+
+   // Bounded lock free multiple producer/single consumer queue used to post callbacks from any thread (power of 2 size)
+   static constexpr uint32_t POST_QUEUE_SIZE = 1024;
+   struct PostedTimer
+   {
+      std::atomic<uint32_t> sequence;
+      TimerEntry timer;
+   };
+   PostedTimer m_postQueue[POST_QUEUE_SIZE];
+   std::atomic<uint32_t> m_postQueueWrite = 0;
+   uint32_t m_postQueueRead = 0;
+   std::atomic<uint64_t> m_postSequence = 0;
+   // Used when the post queue is full
+   std::vector<TimerEntry> m_overflowTimers;
+   std::atomic<bool> m_hasOverflowTimers = false;
+   std::mutex m_overflowTimersMutex;
+
+   // Posted timers, only accessed from the main thread, stored as a binary heap on their due time then posting order
    std::vector<TimerEntry> m_timers;
-   std::mutex m_timerListMutex;
+
+   // Blocking calls are only waited for if the main thread processes callbacks (i.e. the player loop is running), and for a bounded time
+   static constexpr std::chrono::milliseconds BLOCKING_CALL_TIMEOUT { 2000 };
+   static constexpr std::chrono::milliseconds MAIN_LOOP_TIMEOUT { 500 };
+   std::atomic<int64_t> m_lastProcessTime = 0; // steady_clock time of the last ProcessAsyncCallbacks, in ms
+   std::mutex m_blockingMutex;
+   std::condition_variable m_blockingCondition;
 
    std::function<void(const char*, const char*, char*, unsigned int)> m_settingHandler = 
       [](const char* name_space, const char* name, char* valueBuf, unsigned int valueBufSize) { valueBuf[0] = 0; };
@@ -174,6 +174,7 @@ IndexBuffer::IndexBuffer(RenderDevice* rd, const unsigned int numIndices, const
       m_rd->m_pendingSharedIndexBuffers.push_back(m_sharedBuffer);
    }
    m_indexOffset = m_sharedBuffer->Add(this);
+   MemoryAccounting::Add(MemoryAccounting::MESH, m_size);
    m_offset = m_indexOffset * m_sizePerIndex;
 }
 
@@ -207,6 +208,7 @@ IndexBuffer::IndexBuffer(RenderDevice* rd, const vector<unsigned int>& indices)
 
 IndexBuffer::~IndexBuffer()
 {
+   MemoryAccounting::Add(MemoryAccounting::MESH, -(int64_t)m_size);
    if (m_sharedBuffer->Remove(this))
    {
       RemoveFromVectorSingle(m_rd->m_pendingSharedIndexBuffers, m_sharedBuffer);
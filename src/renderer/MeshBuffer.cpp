@@ -120,6 +120,14 @@ void MeshBuffer::bind()
             glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 32, (void*)12);
             glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 32, (void*)24);
             break;
+         case VertexFormat::VF_POS_NORMAL_TEX_COMPACT:
+            glEnableVertexAttribArray(0); // Position
+            glEnableVertexAttribArray(1); // Normal
+            glEnableVertexAttribArray(2); // Texture Coordinate
+            glVertexAttribPointer(0, 4, GL_HALF_FLOAT, GL_FALSE, 20, (void*)0);
+            glVertexAttribPointer(1, 4, GL_SHORT, GL_TRUE, 20, (void*)8);
+            glVertexAttribPointer(2, 2, GL_SHORT, GL_TRUE, 20, (void*)16);
+            break;
          case VertexFormat::VF_POS_TEX:
             glEnableVertexAttribArray(0); // Position
             glEnableVertexAttribArray(1); // Texture Coordinate
@@ -159,7 +167,7 @@ void MeshBuffer::bind()
    glGetVertexAttribiv(1, GL_VERTEX_ATTRIB_ARRAY_ENABLED, &enabled);
    assert(enabled);
    glGetVertexAttribiv(2, GL_VERTEX_ATTRIB_ARRAY_ENABLED, &enabled);
-   assert(m_vb->m_vertexFormat == VertexFormat::VF_POS_NORMAL_TEX ? enabled : !enabled);
+   assert(m_vb->m_vertexFormat != VertexFormat::VF_POS_TEX ? enabled : !enabled);
    GLint buffer;
    glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &buffer);
    assert(buffer == m_vb->GetBuffer());
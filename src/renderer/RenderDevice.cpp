@@ -191,6 +191,13 @@ constexpr D3DVERTEXELEMENT9 VertexNormalTexelElement[] =
    { 0, 6 * sizeof(float), D3DDECLTYPE_FLOAT2, D3DDECLMETHOD_DEFAULT, D3DDECLUSAGE_TEXCOORD, 0 },  // tex0
    D3DDECL_END()
 };
+constexpr D3DVERTEXELEMENT9 VertexNormalTexelCompactElement[] =
+{
+   { 0,  0, D3DDECLTYPE_FLOAT16_4, D3DDECLMETHOD_DEFAULT, D3DDECLUSAGE_POSITION, 0 },  // pos
+   { 0,  8, D3DDECLTYPE_SHORT4N,   D3DDECLMETHOD_DEFAULT, D3DDECLUSAGE_NORMAL,   0 },  // normal
+   { 0, 16, D3DDECLTYPE_SHORT2N,   D3DDECLMETHOD_DEFAULT, D3DDECLUSAGE_TEXCOORD, 0 },  // tex0
+   D3DDECL_END()
+};
 #endif
 
 static unsigned int ComputePrimitiveCount(const RenderDevice::PrimitiveTypes type, const int vertexCount)
@@ -1118,6 +1125,7 @@ RenderDevice::RenderDevice(VPX::Window* const wnd, const bool isVR, const int nE
    #endif
 
    // create default vertex declarations for shaders
+   const bool compactVertices = g_pplayer->m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "CompactVertices"s, true);
    #if defined(ENABLE_BGFX)
    m_pVertexTexelDeclaration = new bgfx::VertexLayout; // TODO remove Pos/TexCoord format and only use one Pos/Normal/TexCoord
    m_pVertexTexelDeclaration->begin()
@@ -1130,10 +1138,24 @@ RenderDevice::RenderDevice(VPX::Window* const wnd, const bool isVR, const int nE
       .add(bgfx::Attrib::Normal, 3, bgfx::AttribType::Float)
       .add(bgfx::Attrib::TexCoord0, 2, bgfx::AttribType::Float)
       .end();
+   m_pVertexNormalTexelCompactDeclaration = new bgfx::VertexLayout;
+   m_pVertexNormalTexelCompactDeclaration->begin()
+      .add(bgfx::Attrib::Position, 4, bgfx::AttribType::Half)
+      .add(bgfx::Attrib::Normal, 4, bgfx::AttribType::Int16, true)
+      .add(bgfx::Attrib::TexCoord0, 2, bgfx::AttribType::Int16, true)
+      .end();
+   m_useCompactVertices = compactVertices && (bgfx::getCaps()->supported & BGFX_CAPS_VERTEX_ATTRIB_HALF);
+   #elif defined(ENABLE_OPENGL)
+   m_useCompactVertices = compactVertices; // Half float and normalized short attributes are core since OpenGL 3.0 / OpenGL ES 3.0
    #elif defined(ENABLE_DX9)
    CHECKD3D(m_pD3DDevice->CreateVertexDeclaration(VertexTexelElement, &m_pVertexTexelDeclaration));
    CHECKD3D(m_pD3DDevice->CreateVertexDeclaration(VertexNormalTexelElement, &m_pVertexNormalTexelDeclaration));
+   constexpr DWORD compactDeclTypes = D3DDTCAPS_FLOAT16_4 | D3DDTCAPS_SHORT4N | D3DDTCAPS_SHORT2N;
+   m_useCompactVertices = compactVertices && (caps.DeclTypes & compactDeclTypes) == compactDeclTypes;
+   if (m_useCompactVertices)
+      CHECKD3D(m_pD3DDevice->CreateVertexDeclaration(VertexNormalTexelCompactElement, &m_pVertexNormalTexelCompactDeclaration));
    #endif
+   PLOGI << "Compact vertex format for static meshes: " << (m_useCompactVertices ? "enabled" : "disabled");
 
    // Vertex buffers
    static constexpr float verts[4 * 5] =
@@ -1258,6 +1280,7 @@ RenderDevice::~RenderDevice()
       m_pD3DDevice->SetDepthStencilSurface(nullptr);
       SAFE_RELEASE(m_pVertexTexelDeclaration);
       SAFE_RELEASE(m_pVertexNormalTexelDeclaration);
+      SAFE_RELEASE(m_pVertexNormalTexelCompactDeclaration);
    #endif
 
    UnbindSampler(nullptr);
@@ -1290,6 +1313,7 @@ RenderDevice::~RenderDevice()
 #if defined(ENABLE_BGFX)
    delete m_pVertexTexelDeclaration;
    delete m_pVertexNormalTexelDeclaration;
+   delete m_pVertexNormalTexelCompactDeclaration;
 
    // Shutdown BGFX once all native resources have been cleaned up
    m_frameReadySem.post();
@@ -187,6 +187,7 @@ public:
    const bool m_compressTextures;
 
    bool UseLowPrecision() const { return m_useLowPrecision; }
+   bool UseCompactVertices() const { return m_useCompactVertices; }
 
    unsigned int m_vsyncCount = 0;
 
@@ -230,6 +231,7 @@ private:
    const bool m_isVR;
 
    bool m_useLowPrecision = false; // OpenGL ES use low precision float and needs some clamping to avoid artifacts, but the clamping causes artefacts if applied with VR scene scaling on other backends.
+   bool m_useCompactVertices = false; // Static meshes may use VF_POS_NORMAL_TEX_COMPACT (enabled by user setting and supported by the backend)
 
    RenderFrame m_renderFrame;
    RenderPass* m_currentPass = nullptr;
@@ -273,6 +275,7 @@ public:
    }
    bgfx::VertexLayout* m_pVertexTexelDeclaration = nullptr;
    bgfx::VertexLayout* m_pVertexNormalTexelDeclaration = nullptr;
+   bgfx::VertexLayout* m_pVertexNormalTexelCompactDeclaration = nullptr;
    int m_activeViewId = -1;
    uint64_t m_bgfxState = 0L;
 
@@ -314,6 +317,7 @@ public:
    IDirect3DVertexDeclaration9* m_currentVertexDeclaration = nullptr;
    IDirect3DVertexDeclaration9* m_pVertexTexelDeclaration = nullptr;
    IDirect3DVertexDeclaration9* m_pVertexNormalTexelDeclaration = nullptr;
+   IDirect3DVertexDeclaration9* m_pVertexNormalTexelCompactDeclaration = nullptr;
 
    bool m_autogen_mipmap;
    bool m_useNvidiaApi;
@@ -507,359 +507,238 @@ void Renderer::SwapAORenderTargets()
    m_pAORenderTarget2 = tmpAO;
 }
 
-BaseTexture* Renderer::EnvmapPrecalc(const Texture* envTex, const unsigned int rad_env_xres, const unsigned int rad_env_yres)
+// Fetch a linear RGB texel from an environment map, whatever its storage format.
+// 8 bit formats are stored in R, G, B(, A) byte order (FreeImage BGRA is swizzled on load, see copy_bgra_rgba), so red is byte 0, not the 0x00FF0000 DWORD mask.
+static void GetEnvmapTexel(const void* const __restrict envmap, const BaseTexture::Format env_format, const unsigned int offs, float& r, float& g, float& b)
 {
-   const void* __restrict envmap = envTex->m_pdsBuffer->data();
-   const unsigned int env_xres = envTex->m_pdsBuffer->width();
-   const unsigned int env_yres = envTex->m_pdsBuffer->height();
-   BaseTexture::Format env_format = envTex->m_pdsBuffer->m_format;
-   const BaseTexture::Format rad_format = (env_format == BaseTexture::RGB_FP16 || env_format == BaseTexture::RGB_FP32) ? env_format : BaseTexture::SRGB;
-   BaseTexture* radTex = new BaseTexture(rad_env_xres, rad_env_yres, rad_format);
-   BYTE* const __restrict rad_envmap = radTex->data();
-   bool free_envmap = false;
-
-#define PREFILTER_ENVMAP_DIFFUSE
-#ifdef PREFILTER_ENVMAP_DIFFUSE
-   // pre-filter envmap with a gauss (separable/two passes: x and y)
-   //!!! not correct to pre-filter like this, but barely visible in the end, and helps to keep number of samples low (otherwise one would have to use >64k samples instead of 4k!)
-   if ((env_format == BaseTexture::RGB_FP16 || env_format == BaseTexture::RGB_FP32) && env_xres > 64)
-   {
-      const float scale_factor = (float)env_xres*(float)(1.0 / 64.);
-      const int xs = (int)(scale_factor*0.5f + 0.5f);
-      void* const __restrict envmap2 = malloc(env_xres * env_yres * (3 * 4));
-      void* const __restrict envmap3 = malloc(env_xres * env_yres * (3 * 4));
-      const float sigma = (scale_factor - 1.f)*0.25f;
-      float* const __restrict weights = (float*)malloc((xs * 2 + 1) * 4);
-      for (int x = 0; x < (xs * 2 + 1); ++x)
-         weights[x] = (1.f / sqrtf((float)(2.*M_PI)*sigma*sigma))*expf(-(float)((x - xs)*(x - xs)) / (2.f*sigma*sigma));
-
-      // x-pass:
-
-      for (int y = 0; y < (int)env_yres; ++y)
-      {
-         const int yoffs = y * env_xres * 3;
-         for (int x = 0; x < (int)env_xres; ++x)
-         {
-            float sum_r = 0.f, sum_g = 0.f, sum_b = 0.f, sum_w = 0.f;
-            for (int xt2 = 0; xt2 <= xs * 2; ++xt2)
-            {
-               int xt = xt2 + (x - xs);
-               if (xt < 0)
-                  xt += env_xres;
-               else if (xt >= (int)env_xres)
-                  xt -= env_xres;
-               const float w = weights[xt2];
-               const unsigned int offs = xt * 3 + yoffs;
-               if (env_format == BaseTexture::RGB_FP16)
-               {
-                  sum_r += half2float(((const unsigned short*)envmap)[offs    ]) * w;
-                  sum_g += half2float(((const unsigned short*)envmap)[offs + 1]) * w;
-                  sum_b += half2float(((const unsigned short*)envmap)[offs + 2]) * w;
-               }
-               else
-               {
-                  sum_r += ((const float*)envmap)[offs    ] * w;
-                  sum_g += ((const float*)envmap)[offs + 1] * w;
-                  sum_b += ((const float*)envmap)[offs + 2] * w;
-               }
-               sum_w += w;
-            }
-
-            const unsigned int offs = (x + y * env_xres) * 3;
-            const float inv_sum = 1.0f / sum_w;
-            ((float*)envmap2)[offs    ] = sum_r * inv_sum;
-            ((float*)envmap2)[offs + 1] = sum_g * inv_sum;
-            ((float*)envmap2)[offs + 2] = sum_b * inv_sum;
-         }
-      }
-
-      // y-pass:
-
-      for (int y = 0; y < (int)env_yres; ++y)
-         for (int x = 0; x < (int)env_xres; ++x)
-         {
-            float sum_r = 0.f, sum_g = 0.f, sum_b = 0.f, sum_w = 0.f;
-            const int yt_end = min(y + xs, (int)env_yres - 1) - (y - xs);
-            int offs = x * 3 + max(y - xs, 0)*(env_xres * 3);
-            for (int yt = max(y - xs, 0) - (y - xs); yt <= yt_end; ++yt, offs += env_xres * 3)
-            {
-               const float w = weights[yt];
-               sum_r += ((float*)envmap2)[offs] * w;
-               sum_g += ((float*)envmap2)[offs + 1] * w;
-               sum_b += ((float*)envmap2)[offs + 2] * w;
-               sum_w += w;
-            }
-
-            offs = (x + y * env_xres) * 3;
-            const float inv_sum = 1.0f / sum_w;
-            ((float*)envmap3)[offs]     = sum_r * inv_sum;
-            ((float*)envmap3)[offs + 1] = sum_g * inv_sum;
-            ((float*)envmap3)[offs + 2] = sum_b * inv_sum;
-         }
-
-      envmap = envmap3;
-      env_format = BaseTexture::RGB_FP32;
-      free((void*)envmap2);
-      free(weights);
-      free_envmap = true;
+   switch (env_format)
+   {
+   case BaseTexture::RGB_FP16:
+      r = half2float(((const unsigned short*)envmap)[offs*3  ]);
+      g = half2float(((const unsigned short*)envmap)[offs*3+1]);
+      b = half2float(((const unsigned short*)envmap)[offs*3+2]);
+      break;
+   case BaseTexture::RGBA_FP16:
+      r = half2float(((const unsigned short*)envmap)[offs*4  ]);
+      g = half2float(((const unsigned short*)envmap)[offs*4+1]);
+      b = half2float(((const unsigned short*)envmap)[offs*4+2]);
+      break;
+   case BaseTexture::RGB_FP32:
+      r = ((const float*)envmap)[offs*3  ];
+      g = ((const float*)envmap)[offs*3+1];
+      b = ((const float*)envmap)[offs*3+2];
+      break;
+   case BaseTexture::RGBA_FP32:
+      r = ((const float*)envmap)[offs*4  ];
+      g = ((const float*)envmap)[offs*4+1];
+      b = ((const float*)envmap)[offs*4+2];
+      break;
+   case BaseTexture::RGB:
+      r = (float)((const BYTE*)envmap)[offs*3  ] * (float)(1.0 / 255.0);
+      g = (float)((const BYTE*)envmap)[offs*3+1] * (float)(1.0 / 255.0);
+      b = (float)((const BYTE*)envmap)[offs*3+2] * (float)(1.0 / 255.0);
+      break;
+   case BaseTexture::RGBA:
+      r = (float)((const BYTE*)envmap)[offs*4  ] * (float)(1.0 / 255.0);
+      g = (float)((const BYTE*)envmap)[offs*4+1] * (float)(1.0 / 255.0);
+      b = (float)((const BYTE*)envmap)[offs*4+2] * (float)(1.0 / 255.0);
+      break;
+   case BaseTexture::SRGB:
+      r = invGammaApprox((float)((const BYTE*)envmap)[offs*3  ] * (float)(1.0 / 255.0));
+      g = invGammaApprox((float)((const BYTE*)envmap)[offs*3+1] * (float)(1.0 / 255.0));
+      b = invGammaApprox((float)((const BYTE*)envmap)[offs*3+2] * (float)(1.0 / 255.0));
+      break;
+   case BaseTexture::SRGBA:
+      r = invGammaApprox((float)((const BYTE*)envmap)[offs*4  ] * (float)(1.0 / 255.0));
+      g = invGammaApprox((float)((const BYTE*)envmap)[offs*4+1] * (float)(1.0 / 255.0));
+      b = invGammaApprox((float)((const BYTE*)envmap)[offs*4+2] * (float)(1.0 / 255.0));
+      break;
+   default:
+      assert(!"unknown format");
+      r = g = b = 0.f;
    }
-#endif
+}
+
+// Project the environment onto the 9 first real spherical harmonics (order 2), then evaluate the cosine convolved irradiance
+// for each output texel (see Ramamoorthi & Hanrahan, "An Efficient Representation for Irradiance Environment Maps", 2001).
+// Order 2 captures the irradiance with an average error below 3%, and this runs in a few milliseconds (one pass over the
+// environment map) compared to the brute force hemisphere sampling below.
+static void EnvmapPrecalcSH(const BaseTexture* const envTex, BaseTexture* const radTex)
+{
+   const void* const __restrict envmap = envTex->datac();
+   const unsigned int env_xres = envTex->width();
+   const unsigned int env_yres = envTex->height();
+   const BaseTexture::Format env_format = envTex->m_format;
 
-   // brute force sampling over hemisphere for each normal direction of the to-be-(ir)radiance-baked environment
-   // not the fastest solution, could do a "cosine convolution" over the picture instead (where also just 1024 or x samples could be used per pixel)
-   //!! (note though that even 4096 samples can be too low if very bright spots (i.e. sun) in the image! see Delta_2k.hdr -> thus pre-filter enabled above!)
-   // but with this implementation one can also have custom maps/LUTs for glossy, etc. later-on
+   // Projection: each envmap row is integrated on its own (parallel), then rows are summed up
+   vector<float> row_sh(env_yres * 27);
    {
       ThreadPool pool(g_pvp->GetLogicalNumberOfProcessors());
-
-      for (unsigned int y = 0; y < rad_env_yres; ++y) {
-         pool.enqueue([y, rad_envmap, rad_format, rad_env_xres, rad_env_yres, envmap, env_format, env_xres, env_yres] {
-            for (unsigned int x = 0; x < rad_env_xres; ++x)
+      for (unsigned int y = 0; y < env_yres; ++y)
+      {
+         pool.enqueue([y, &row_sh, envmap, env_format, env_xres, env_yres] {
+            // same mapping as the envmap lookup done in the shaders: u = atan2(l.y, l.x) / (2 PI) + 0.5, v = acos(l.z) / PI
+            const float theta = ((float)y + 0.5f) * (float)(M_PI / env_yres);
+            const float sin_theta = sinf(theta);
+            const float z = cosf(theta);
+            const float solid_angle = sin_theta * (float)(2.0 * M_PI * M_PI) / (float)(env_xres * env_yres);
+            float sh[27] = {};
+            for (unsigned int x = 0; x < env_xres; ++x)
             {
-               // transfo from envmap to normal direction
-               const float phi = (float)x / (float)rad_env_xres * (float)(2.0*M_PI) + (float)M_PI;
-               const float theta = (float)y / (float)rad_env_yres * (float)M_PI;
-               const Vertex3Ds n(sinf(theta) * cosf(phi), sinf(theta) * sinf(phi), cosf(theta));
-
-               // draw x samples over hemisphere and collect cosine weighted environment map samples
-
-               float sum_r = 0.f, sum_g = 0.f, sum_b = 0.f;
-
-               constexpr unsigned int num_samples = 4096;
-               for (unsigned int s = 0; s < num_samples; ++s)
-               {
-                  //!! discard directions pointing below the playfield?? or give them another "average playfield" color??
-#define USE_ENVMAP_PRECALC_COSINE
-#ifndef USE_ENVMAP_PRECALC_COSINE
-                  //!! as we do not use importance sampling on the environment, just not being smart -could- be better for high frequency environments
-                  Vertex3Ds l = sphere_sample((float)s*(float)(1.0/num_samples), radical_inverse(s)); // QMC hammersley point set
-                  float NdotL = l.Dot(n);
-                  if (NdotL < 0.0f) // flip if on backside of hemisphere
-                  {
-                     NdotL = -NdotL;
-                     l = -l;
-                  }
-#else
-                  //Vertex3Ds cos_hemisphere_sample(const Vertex3Ds &normal, Vertex2D uv) { float theta = (float)(2.*M_PI) * uv.x; uv.y = 2.f * uv.y - 1.f; Vertex3Ds spherePoint(sqrt(1.f - uv.y * uv.y) * Vertex2D(cosf(theta), sinf(theta)), uv.y); return normalize(normal + spherePoint); }
-                  const Vertex3Ds l = rotate_to_vector_upper(cos_hemisphere_sample((float)s*(float)(1.0 / num_samples), radical_inverse(s)), n); // QMC hammersley point set
-#endif
-                  // transfo from light direction to envmap
-                  // approximations seem to be good enough!
-                  const float u = atan2_approx_div2PI(l.y, l.x) + 0.5f; //atan2f(l.y, l.x) * (float)(0.5 / M_PI) + 0.5f;
-                  const float v = acos_approx_divPI(l.z); //acosf(l.z) * (float)(1.0 / M_PI);
-
-                  float r, g, b;
-                  unsigned int offs = (int)(u*(float)env_xres) + (int)(v*(float)env_yres)*env_xres;
-                  if (offs >= env_yres * env_xres)
-                     offs = 0;
-                  if (env_format == BaseTexture::RGB_FP16)
-                  {
-                     r = half2float(((const unsigned short*)envmap)[offs*3  ]);
-                     g = half2float(((const unsigned short*)envmap)[offs*3+1]);
-                     b = half2float(((const unsigned short*)envmap)[offs*3+2]);
-                  }
-                  else if (env_format == BaseTexture::RGBA_FP16)
-                  {
-                     r = half2float(((const unsigned short*)envmap)[offs*4  ]);
-                     g = half2float(((const unsigned short*)envmap)[offs*4+1]);
-                     b = half2float(((const unsigned short*)envmap)[offs*4+2]);
-                  }
-                  else if (env_format == BaseTexture::RGB_FP32)
-                  {
-                     r = ((const float*)envmap)[offs*3  ];
-                     g = ((const float*)envmap)[offs*3+1];
-                     b = ((const float*)envmap)[offs*3+2];
-                  }
-                  else if (env_format == BaseTexture::RGBA_FP32)
-                  {
-                     r = ((const float*)envmap)[offs*4];
-                     g = ((const float*)envmap)[offs*4+1];
-                     b = ((const float*)envmap)[offs*4+2];
-                  }
-                  else if (env_format == BaseTexture::RGB)
-                  {
-                     r = (float)((const BYTE*)envmap)[offs*3  ] * (float)(1.0 / 255.0);
-                     g = (float)((const BYTE*)envmap)[offs*3+1] * (float)(1.0 / 255.0);
-                     b = (float)((const BYTE*)envmap)[offs*3+2] * (float)(1.0 / 255.0);
-                  }
-                  else if (env_format == BaseTexture::RGBA)
-                  {
-                     const DWORD rgb = ((const DWORD*)envmap)[offs];
-                     r = (float)(rgb & 0x00FF0000) * (float)(1.0 / 16711680.0);
-                     g = (float)(rgb & 0x0000FF00) * (float)(1.0 /    65280.0);
-                     b = (float)(rgb & 0x000000FF) * (float)(1.0 /      255.0);
-                  }
-                  else if (env_format == BaseTexture::SRGB)
-                  {
-                     r = invGammaApprox((float)((const BYTE*)envmap)[offs*3  ] * (float)(1.0 / 255.0));
-                     g = invGammaApprox((float)((const BYTE*)envmap)[offs*3+1] * (float)(1.0 / 255.0));
-                     b = invGammaApprox((float)((const BYTE*)envmap)[offs*3+2] * (float)(1.0 / 255.0));
-                  }
-                  else if (env_format == BaseTexture::SRGBA)
-                  {
-                     const DWORD rgb = ((const DWORD*)envmap)[offs];
-                     r = invGammaApprox((float)(rgb & 0x00FF0000) * (float)(1.0 / 16711680.0));
-                     g = invGammaApprox((float)(rgb & 0x0000FF00) * (float)(1.0 /    65280.0));
-                     b = invGammaApprox((float)(rgb & 0x000000FF) * (float)(1.0 /      255.0));
-                  }
-                  else
-                     assert(!"unknown format");
-#ifndef USE_ENVMAP_PRECALC_COSINE
-                  sum_r += r * NdotL;
-                  sum_g += g * NdotL;
-                  sum_b += b * NdotL;
-#else
-                  sum_r += r;
-                  sum_g += g;
-                  sum_b += b;
-#endif
-               }
-
-
-               // average all samples
-#ifndef USE_ENVMAP_PRECALC_COSINE
-               sum_r *= (float)(2.0 / num_samples); // pre-divides by PI for final radiance/color lookup in shader
-               sum_g *= (float)(2.0 / num_samples);
-               sum_b *= (float)(2.0 / num_samples);
-#else
-               sum_r *= (float)(1.0 / num_samples); // pre-divides by PI for final radiance/color lookup in shader
-               sum_g *= (float)(1.0 / num_samples);
-               sum_b *= (float)(1.0 / num_samples);
-#endif
-               const unsigned int offs = (y*rad_env_xres + x) * 3;
-               if (rad_format == BaseTexture::RGB_FP16)
+               const float phi = ((float)x + 0.5f) * (float)(2.0 * M_PI / env_xres) - (float)M_PI;
+               const float dx = sin_theta * cosf(phi);
+               const float dy = sin_theta * sinf(phi);
+               float r, g, b;
+               GetEnvmapTexel(envmap, env_format, y * env_xres + x, r, g, b);
+               const float basis[9] = {
+                  0.282095f,
+                  0.488603f * dy, 0.488603f * z, 0.488603f * dx,
+                  1.092548f * dx * dy, 1.092548f * dy * z, 0.315392f * (3.f * z * z - 1.f), 1.092548f * dx * z, 0.546274f * (dx * dx - dy * dy) };
+               for (unsigned int i = 0; i < 9; ++i)
                {
-                  ((unsigned short*)rad_envmap)[offs  ] = float2half_noLUT(sum_r);
-                  ((unsigned short*)rad_envmap)[offs+1] = float2half_noLUT(sum_g);
-                  ((unsigned short*)rad_envmap)[offs+2] = float2half_noLUT(sum_b);
-               }
-               else if (rad_format == BaseTexture::RGB_FP32)
-               {
-                  ((float*)rad_envmap)[offs  ] = sum_r;
-                  ((float*)rad_envmap)[offs+1] = sum_g;
-                  ((float*)rad_envmap)[offs+2] = sum_b;
-               }
-               else if (rad_format == BaseTexture::SRGB)
-               {
-                  rad_envmap[offs  ] = (BYTE)clamp(gammaApprox(sum_r) * 255.f, 0.f, 255.f);
-                  rad_envmap[offs+1] = (BYTE)clamp(gammaApprox(sum_g) * 255.f, 0.f, 255.f);
-                  rad_envmap[offs+2] = (BYTE)clamp(gammaApprox(sum_b) * 255.f, 0.f, 255.f);
+                  const float w = basis[i] * solid_angle;
+                  sh[i * 3    ] += r * w;
+                  sh[i * 3 + 1] += g * w;
+                  sh[i * 3 + 2] += b * w;
                }
             }
+            memcpy(&row_sh[y * 27], sh, sizeof(sh));
          });
       }
-
       pool.wait_until_empty();
       pool.wait_until_nothing_in_flight();
    }
+   float sh[27] = {};
+   for (unsigned int y = 0; y < env_yres; ++y)
+      for (unsigned int i = 0; i < 27; ++i)
+         sh[i] += row_sh[y * 27 + i];
+
+   // Apply the clamped cosine lobe convolution (A0 = PI, A1 = 2 PI / 3, A2 = PI / 4), pre-divided by PI for final radiance/color lookup in shader
+   for (unsigned int i = 0; i < 27; ++i)
+      sh[i] *= (i < 3) ? 1.f : (i < 12) ? (float)(2.0 / 3.0) : 0.25f;
 
-   /* ///!!! QA-test above multithreading implementation.
-   //!! this is exactly the same code as above, so can be deleted at some point, as it only checks the multithreaded results with a singlethreaded implementation!
+   // Evaluation
+   const unsigned int rad_env_xres = radTex->width();
+   const unsigned int rad_env_yres = radTex->height();
+   const BaseTexture::Format rad_format = radTex->m_format;
+   BYTE* const __restrict rad_envmap = radTex->data();
    for (unsigned int y = 0; y < rad_env_yres; ++y)
+   {
+      const float theta = (float)y / (float)rad_env_yres * (float)M_PI;
+      const float sin_theta = sinf(theta);
+      const float z = cosf(theta);
       for (unsigned int x = 0; x < rad_env_xres; ++x)
       {
-         // trafo from envmap to normal direction
+         // transfo from envmap to normal direction
          const float phi = (float)x / (float)rad_env_xres * (float)(2.0*M_PI) + (float)M_PI;
-         const float theta = (float)y / (float)rad_env_yres * (float)M_PI;
-         const Vertex3Ds n(sinf(theta) * cosf(phi), sinf(theta) * sinf(phi), cosf(theta));
-
-         // draw x samples over hemisphere and collect cosine weighted environment map samples
-         float sum[3];
-         sum[0] = sum[1] = sum[2] = 0.0f;
-
-         const unsigned int num_samples = 4096;
-         for (unsigned int s = 0; s < num_samples; ++s)
+         const float nx = sin_theta * cosf(phi);
+         const float ny = sin_theta * sinf(phi);
+         const float basis[9] = {
+            0.282095f,
+            0.488603f * ny, 0.488603f * z, 0.488603f * nx,
+            1.092548f * nx * ny, 1.092548f * ny * z, 0.315392f * (3.f * z * z - 1.f), 1.092548f * nx * z, 0.546274f * (nx * nx - ny * ny) };
+         float sum_r = 0.f, sum_g = 0.f, sum_b = 0.f;
+         for (unsigned int i = 0; i < 9; ++i)
          {
-            //!! discard directions pointing below the playfield?? or give them another "average playfield" color??
-#define USE_ENVMAP_PRECALC_COSINE
-#ifndef USE_ENVMAP_PRECALC_COSINE
-            //!! as we do not use importance sampling on the environment, just not being smart -could- be better for high frequency environments
-            Vertex3Ds l = sphere_sample((float)s*(float)(1.0 / num_samples), radical_inverse(s)); // QMC hammersley point set
-            float NdotL = l.Dot(n);
-            if (NdotL < 0.0f) // flip if on backside of hemisphere
-            {
-               NdotL = -NdotL;
-               l = -l;
-            }
-#else
-            //Vertex3Ds cos_hemisphere_sample(const Vertex3Ds &normal, Vertex2D uv) { float theta = (float)(2.*M_PI) * uv.x; uv.y = 2.f * uv.y - 1.f; Vertex3Ds spherePoint(sqrt(1.f - uv.y * uv.y) * Vertex2D(cosf(theta), sinf(theta)), uv.y); return normalize(normal + spherePoint); }
-            const Vertex3Ds l = rotate_to_vector_upper(cos_hemisphere_sample((float)s*(float)(1.0 / num_samples), radical_inverse(s)), n); // QMC hammersley point set
-#endif
-            // trafo from light direction to envmap
-            // approximations seem to be good enough!
-            const float u = atan2_approx_div2PI(l.y, l.x) + 0.5f; //atan2f(l.y, l.x) * (float)(0.5 / M_PI) + 0.5f;
-            const float v = acos_approx_divPI(l.z); //acosf(l.z) * (float)(1.0 / M_PI);
-
-            float r, g, b;
-            if (isHDR)
-            {
-               unsigned int offs = ((int)(u*(float)env_xres) + (int)(v*(float)env_yres)*env_xres) * 3;
-               if (offs >= env_yres * env_xres * 3)
-                  offs = 0;
-               r = ((float*)envmap)[offs];
-               g = ((float*)envmap)[offs + 1];
-               b = ((float*)envmap)[offs + 2];
-            }
-            else
-            {
-               unsigned int offs = (int)(u*(float)env_xres) + (int)(v*(float)env_yres)*env_xres;
-               if (offs >= env_yres * env_xres)
-                  offs = 0;
-               const DWORD rgb = ((DWORD*)envmap)[offs];
-               r = invGammaApprox((float)(rgb & 255) * (float)(1.0 / 255.0));
-               g = invGammaApprox((float)(rgb & 65280) * (float)(1.0 / 65280.0));
-               b = invGammaApprox((float)(rgb & 16711680) * (float)(1.0 / 16711680.0));
-            }
-#ifndef USE_ENVMAP_PRECALC_COSINE
-            sum[0] += r * NdotL;
-            sum[1] += g * NdotL;
-            sum[2] += b * NdotL;
-#else
-            sum[0] += r;
-            sum[1] += g;
-            sum[2] += b;
-#endif
+            sum_r += sh[i * 3    ] * basis[i];
+            sum_g += sh[i * 3 + 1] * basis[i];
+            sum_b += sh[i * 3 + 2] * basis[i];
          }
+         // Order 2 truncation may ring to slightly negative values opposite to very bright spots
+         sum_r = max(sum_r, 0.f);
+         sum_g = max(sum_g, 0.f);
+         sum_b = max(sum_b, 0.f);
 
-         // average all samples
-#ifndef USE_ENVMAP_PRECALC_COSINE
-         sum[0] *= (float)(2.0 / num_samples); // pre-divides by PI for final radiance/color lookup in shader
-         sum[1] *= (float)(2.0 / num_samples);
-         sum[2] *= (float)(2.0 / num_samples);
-#else
-         sum[0] *= (float)(1.0 / num_samples); // pre-divides by PI for final radiance/color lookup in shader
-         sum[1] *= (float)(1.0 / num_samples);
-         sum[2] *= (float)(1.0 / num_samples);
-#endif
-         if (isHDR)
+         const unsigned int offs = (y*rad_env_xres + x) * 3;
+         if (rad_format == BaseTexture::RGB_FP16)
          {
-            const unsigned int offs = (y*rad_env_xres + x) * 3;
-            if (((float*)rad_envmap)[offs] != sum[0] ||
-                ((float*)rad_envmap)[offs + 1] != sum[1] ||
-                ((float*)rad_envmap)[offs + 2] != sum[2])
-            {
-               char tmp[911];
-               sprintf(tmp, "%d %d %f=%f %f=%f %f=%f ", x, y, ((float*)rad_envmap)[offs], sum[0], ((float*)rad_envmap)[offs + 1], sum[1], ((float*)rad_envmap)[offs + 2], sum[2]);
-               ::OutputDebugString(tmp);
-            }
+            ((unsigned short*)rad_envmap)[offs  ] = float2half_noLUT(sum_r);
+            ((unsigned short*)rad_envmap)[offs+1] = float2half_noLUT(sum_g);
+            ((unsigned short*)rad_envmap)[offs+2] = float2half_noLUT(sum_b);
          }
-         else
+         else if (rad_format == BaseTexture::RGB_FP32)
+         {
+            ((float*)rad_envmap)[offs  ] = sum_r;
+            ((float*)rad_envmap)[offs+1] = sum_g;
+            ((float*)rad_envmap)[offs+2] = sum_b;
+         }
+         else if (rad_format == BaseTexture::SRGB)
          {
-            sum[0] = gammaApprox(sum[0]);
-            sum[1] = gammaApprox(sum[1]);
-            sum[2] = gammaApprox(sum[2]);
-            if (
-                ((DWORD*)rad_envmap)[y*rad_env_xres + x] != ((int)(sum[0] * 255.0f)) | (((int)(sum[1] * 255.0f)) << 8) | (((int)(sum[2] * 255.0f)) << 16))
-                g_pvp->MessageBox("Not OK", "Not OK", MB_OK);
+            rad_envmap[offs  ] = (BYTE)clamp(gammaApprox(sum_r) * 255.f, 0.f, 255.f);
+            rad_envmap[offs+1] = (BYTE)clamp(gammaApprox(sum_g) * 255.f, 0.f, 255.f);
+            rad_envmap[offs+2] = (BYTE)clamp(gammaApprox(sum_b) * 255.f, 0.f, 255.f);
          }
       }
+   }
+}
 
-   ///!!! */
+// Cached irradiance maps are raw dumps of the radiance texture, validated against a small header
+struct EnvmapCacheHeader
+{
+   uint32_t magic;
+   uint32_t version;
+   uint32_t width, height;
+   uint32_t format;
+};
+static constexpr uint32_t ENVMAP_CACHE_MAGIC = 0x52524E45u; // 'ENRR'
+static constexpr uint32_t ENVMAP_CACHE_VERSION = 1u;
+
+static bool LoadEnvmapCache(const string& path, BaseTexture* const radTex)
+{
+   std::ifstream file(path, std::ios::binary);
+   if (!file.is_open())
+      return false;
+   EnvmapCacheHeader header;
+   if (!file.read((char*)&header, sizeof(header))
+    || header.magic != ENVMAP_CACHE_MAGIC || header.version != ENVMAP_CACHE_VERSION
+    || header.width != radTex->width() || header.height != radTex->height() || header.format != (uint32_t)radTex->m_format)
+      return false;
+   return !!file.read((char*)radTex->data(), (std::streamsize)radTex->pitch() * radTex->height());
+}
 
-#ifdef PREFILTER_ENVMAP_DIFFUSE
-   if (free_envmap)
-      free((void*)envmap);
-#endif
+static void SaveEnvmapCache(const string& path, const BaseTexture* const radTex)
+{
+   try
+   {
+      std::filesystem::create_directories(std::filesystem::path(path).parent_path());
+      std::ofstream file(path, std::ios::binary | std::ios::trunc);
+      const EnvmapCacheHeader header { ENVMAP_CACHE_MAGIC, ENVMAP_CACHE_VERSION, radTex->width(), radTex->height(), (uint32_t)radTex->m_format };
+      file.write((const char*)&header, sizeof(header));
+      file.write((const char*)radTex->datac(), (std::streamsize)radTex->pitch() * radTex->height());
+   }
+   catch (...)
+   {
+      PLOGE << "Failed to save environment irradiance cache to " << path;
+   }
+}
+
+BaseTexture* Renderer::EnvmapPrecalc(const Texture* envTex, const unsigned int rad_env_xres, const unsigned int rad_env_yres)
+{
+   const BaseTexture::Format env_format = envTex->m_pdsBuffer->m_format;
+   const BaseTexture::Format rad_format = (env_format == BaseTexture::RGB_FP16 || env_format == BaseTexture::RGB_FP32) ? env_format : BaseTexture::SRGB;
+   BaseTexture* radTex = new BaseTexture(rad_env_xres, rad_env_yres, rad_format);
+
+   // The irradiance only depends on the environment texture, so it is cached on disk, keyed on the texture hash
+   string cachePath;
+   if (m_table->m_settings.LoadValueWithDefault(Settings::Player, "CacheMode"s, 1) > 0)
+   {
+      const uint8_t* const md5 = envTex->m_pdsBuffer->GetMD5Hash();
+      char key[33];
+      for (int i = 0; i < 16; ++i)
+         sprintf_s(key + i * 2, 3, "%02x", md5[i]);
+      cachePath = g_pvp->m_szMyPrefPath + "Cache" + PATH_SEPARATOR_CHAR + "Envmaps" + PATH_SEPARATOR_CHAR + key + '_' + std::to_string(rad_env_xres) + 'x' + std::to_string(rad_env_yres) + ".irr";
+   }
+
+   if (!cachePath.empty() && LoadEnvmapCache(cachePath, radTex))
+   {
+      PLOGI << "Environment map radiance loaded from cache " << cachePath;
+   }
+   else
+   {
+      EnvmapPrecalcSH(envTex->m_pdsBuffer, radTex);
+      if (!cachePath.empty())
+         SaveEnvmapCache(cachePath, radTex);
+   }
 
 #ifdef __OPENGLES__
    if (radTex->m_format == BaseTexture::SRGB || radTex->m_format == BaseTexture::RGB_FP16) {
@@ -25,6 +25,10 @@ Sampler::Sampler(RenderDevice* rd, const BaseTexture* const surf, const bool for
    m_filter(filter)
 {
    m_rd->m_curTextureUpdates++;
+   // Estimated GPU size: 3 channel formats are padded to 4 channels by most drivers, and mipmaps add a third
+   const unsigned int texelSize = surf->pitch() / max(surf->width(), 1u);
+   m_gpuMemory = (int64_t)m_width * m_height * (surf->has_alpha() ? texelSize : (texelSize * 4 / 3)) * 4 / 3;
+   MemoryAccounting::Add(MemoryAccounting::TEXTURE_GPU, m_gpuMemory);
 #if defined(ENABLE_BGFX)
    m_isLinear = true;
    bool add_alpha = false;
@@ -196,6 +200,7 @@ Sampler::~Sampler()
 {
    if (m_rd)
       m_rd->UnbindSampler(this);
+   MemoryAccounting::Add(MemoryAccounting::TEXTURE_GPU, -m_gpuMemory);
 
    #if defined(ENABLE_BGFX)
    if (m_textureUpdate)
@@ -92,6 +92,7 @@ private:
    SamplerAddressMode m_clampu;
    SamplerAddressMode m_clampv;
    SamplerFilter m_filter;
+   int64_t m_gpuMemory = 0; // Estimated GPU memory size, reported to the memory accounting
 
 #if defined(ENABLE_BGFX)
    string m_name;
@@ -30,10 +30,12 @@ BaseTexture::BaseTexture(const unsigned int w, const unsigned int h, const Forma
    , m_format(format)
 {
    m_data = new BYTE[(format == RGBA || format == SRGBA || format == RGBA_FP16 ? 4 : (format == BW ? 1 : 3)) * ((format == RGB_FP32 || format == RGBA_FP32) ? 4 : (format == RGB_FP16 || format == RGBA_FP16) ? 2 : 1) * w * h];
+   MemoryAccounting::Add(MemoryAccounting::TEXTURE_CPU, (int64_t)pitch() * m_height);
 }
 
 BaseTexture::~BaseTexture()
 {
+   MemoryAccounting::Add(MemoryAccounting::TEXTURE_CPU, -(int64_t)pitch() * m_height);
    delete[] m_data;
 }
 
@@ -425,6 +427,7 @@ void BaseTexture::AddAlpha()
 
    SetIsOpaque(true);
    m_isMD5Dirty = true;
+   const int64_t prevSize = (int64_t)pitch() * m_height;
 
    switch (m_format)
    {
@@ -475,6 +478,7 @@ void BaseTexture::AddAlpha()
       delete[] m_data;
       m_data = new_data;
    }
+   MemoryAccounting::Add(MemoryAccounting::TEXTURE_CPU, (int64_t)pitch() * m_height - prevSize);
 }
 
 void BaseTexture::RemoveAlpha()
@@ -484,6 +488,7 @@ void BaseTexture::RemoveAlpha()
 
    SetIsOpaque(true);
    m_isMD5Dirty = true;
+   const int64_t prevSize = (int64_t)pitch() * m_height;
 
    switch (m_format)
    {
@@ -503,6 +508,7 @@ void BaseTexture::RemoveAlpha()
       }
    delete[] m_data;
    m_data = new_data;
+   MemoryAccounting::Add(MemoryAccounting::TEXTURE_CPU, (int64_t)pitch() * m_height - prevSize);
 }
 
 BaseTexture* BaseTexture::ToBGRA()
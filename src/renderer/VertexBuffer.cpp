@@ -6,6 +6,17 @@
 #include "Shader.h"
 
 
+static unsigned int GetVertexSize(const VertexFormat fmt)
+{
+   switch (fmt)
+   {
+   case VertexFormat::VF_POS_TEX: return sizeof(Vertex3D_TexelOnly);
+   case VertexFormat::VF_POS_NORMAL_TEX: return sizeof(Vertex3D_NoTex2);
+   case VertexFormat::VF_POS_NORMAL_TEX_COMPACT: return sizeof(Vertex3D_Compact);
+   default: assert(false); return 0;
+   }
+}
+
 class SharedVertexBuffer final : public SharedBuffer<VertexFormat, VertexBuffer>
 {
 public:
@@ -32,11 +43,12 @@ public:
 };
 
 SharedVertexBuffer::SharedVertexBuffer(RenderDevice* const rd, VertexFormat fmt, bool stat)
-   : SharedBuffer(fmt, fmt ==  VertexFormat::VF_POS_NORMAL_TEX ? sizeof(Vertex3D_NoTex2) : sizeof(Vertex3D_TexelOnly), stat)
+   : SharedBuffer(fmt, GetVertexSize(fmt), stat)
 #if defined(ENABLE_DX9) || defined(ENABLE_BGFX)
    , m_vertexDeclaration(
-      fmt == VertexFormat::VF_POS_NORMAL_TEX ? rd->m_pVertexNormalTexelDeclaration :
-      fmt == VertexFormat::VF_POS_TEX        ? rd->m_pVertexTexelDeclaration : nullptr)
+      fmt == VertexFormat::VF_POS_NORMAL_TEX         ? rd->m_pVertexNormalTexelDeclaration :
+      fmt == VertexFormat::VF_POS_NORMAL_TEX_COMPACT ? rd->m_pVertexNormalTexelCompactDeclaration :
+      fmt == VertexFormat::VF_POS_TEX                ? rd->m_pVertexTexelDeclaration : nullptr)
 #endif
 {
 }
@@ -168,10 +180,11 @@ VertexBuffer::VertexBuffer(RenderDevice* rd, const unsigned int vertexCount, con
    : m_rd(rd)
    , m_count(vertexCount)
    , m_vertexFormat(fmt)
-   , m_sizePerVertex(fmt ==  VertexFormat::VF_POS_NORMAL_TEX ? sizeof(Vertex3D_NoTex2) : sizeof(Vertex3D_TexelOnly))
+   , m_sizePerVertex(GetVertexSize(fmt))
    , m_isStatic(!isDynamic)
-   , m_size(vertexCount * (fmt ==  VertexFormat::VF_POS_NORMAL_TEX ? sizeof(Vertex3D_NoTex2) : sizeof(Vertex3D_TexelOnly)))
+   , m_size(vertexCount * GetVertexSize(fmt))
 {
+   assert(fmt != VertexFormat::VF_POS_NORMAL_TEX_COMPACT || (m_rd->UseCompactVertices() && m_isStatic));
    // Disabled since OpenGL ES does not support glDrawElementsBaseVertex, but now that we remap the indices when creating the index buffer it should be good
    for (SharedVertexBuffer* block : m_rd->m_pendingSharedVertexBuffers)
    {
@@ -187,6 +200,7 @@ VertexBuffer::VertexBuffer(RenderDevice* rd, const unsigned int vertexCount, con
       m_rd->m_pendingSharedVertexBuffers.push_back(m_sharedBuffer);
    }
    m_vertexOffset = m_sharedBuffer->Add(this);
+   MemoryAccounting::Add(MemoryAccounting::MESH, m_size);
    m_offset = m_vertexOffset * m_sizePerVertex;
    if (verts != nullptr)
    {
@@ -199,6 +213,7 @@ VertexBuffer::VertexBuffer(RenderDevice* rd, const unsigned int vertexCount, con
 
 VertexBuffer::~VertexBuffer()
 {
+   MemoryAccounting::Add(MemoryAccounting::MESH, -(int64_t)m_size);
    if (m_sharedBuffer->Remove(this))
    {
       RemoveFromVectorSingle(m_rd->m_pendingSharedVertexBuffers, m_sharedBuffer);
@@ -208,6 +223,46 @@ VertexBuffer::~VertexBuffer()
 
 bool VertexBuffer::IsSharedBuffer() const { return m_sharedBuffer->IsShared(); }
 
+bool VertexBuffer::CanUseCompactFormat(const Vertex3D_NoTex2* const verts, const unsigned int count, const float maxPositionError)
+{
+   for (unsigned int i = 0; i < count; i++)
+   {
+      const Vertex3D_NoTex2& v = verts[i];
+      // Negated tests to also reject NaNs
+      if (!(fabsf(v.tu) <= 1.f && fabsf(v.tv) <= 1.f && fabsf(v.nx) <= 1.f && fabsf(v.ny) <= 1.f && fabsf(v.nz) <= 1.f))
+         return false;
+      if (!(fabsf(half2float(float2half(v.x)) - v.x) <= maxPositionError
+         && fabsf(half2float(float2half(v.y)) - v.y) <= maxPositionError
+         && fabsf(half2float(float2half(v.z)) - v.z) <= maxPositionError))
+         return false;
+   }
+   return true;
+}
+
+static inline short FloatToSnorm16(const float v)
+{
+   return (short)clamp((int)lroundf(v * 32767.f), -32767, 32767);
+}
+
+void VertexBuffer::PackCompact(Vertex3D_Compact* const __restrict dst, const Vertex3D_NoTex2* const __restrict src, const unsigned int count)
+{
+   for (unsigned int i = 0; i < count; i++)
+   {
+      const Vertex3D_NoTex2& v = src[i];
+      Vertex3D_Compact& o = dst[i];
+      o.x = float2half(v.x);
+      o.y = float2half(v.y);
+      o.z = float2half(v.z);
+      o.w = float2half(1.f);
+      o.nx = FloatToSnorm16(v.nx);
+      o.ny = FloatToSnorm16(v.ny);
+      o.nz = FloatToSnorm16(v.nz);
+      o.nw = 0;
+      o.tu = FloatToSnorm16(v.tu);
+      o.tv = FloatToSnorm16(v.tv);
+   }
+}
+
 #if defined(ENABLE_BGFX)
 bgfx::VertexBufferHandle VertexBuffer::GetStaticBuffer() const { return m_sharedBuffer->m_vb; }
 bgfx::DynamicVertexBufferHandle VertexBuffer::GetDynamicBuffer() const { return m_sharedBuffer->m_dvb; }
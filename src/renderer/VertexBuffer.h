@@ -24,6 +24,12 @@ public:
    void Unlock();
    void Upload();
 
+   // Static meshes may be stored with the compact vertex format if the backend supports it and it is precise enough:
+   // positions must round trip through half floats with an error below maxPositionError, texture coordinates must be in -1..1
+   static constexpr float COMPACT_MAX_POSITION_ERROR = 0.1f; // Maximum error in table units (~0.05mm) after object to world transform
+   static bool CanUseCompactFormat(const Vertex3D_NoTex2* const verts, const unsigned int count, const float maxPositionError);
+   static void PackCompact(Vertex3D_Compact* const __restrict dst, const Vertex3D_NoTex2* const __restrict src, const unsigned int count);
+
    RenderDevice* const m_rd;
    const bool m_isStatic; // True if this array is static and can not be modified after first upload
    const VertexFormat m_vertexFormat; // Vertex format (position of each attributes inside data stream)
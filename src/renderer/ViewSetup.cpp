@@ -138,7 +138,8 @@ float ViewSetup::GetRealToVirtualScale(const PinTable* const table) const
    if (mMode == VLM_WINDOW)
    {
       float windowBotZ = GetWindowBottomZOFfset(table), windowTopZ = GetWindowTopZOFfset(table);
-      const float screenHeight = table->m_settings.LoadValueWithDefault(Settings::Player, "ScreenWidth"s, 0.0f); // Physical width (always measured in landscape orientation) is the height in window mode
+      static const Settings::Handle screenWidthHandle = Settings::GetHandle(Settings::Player, "ScreenWidth"s);
+      const float screenHeight = table->m_settings.GetFloat(screenWidthHandle, 0.0f); // Physical width (always measured in landscape orientation) is the height in window mode
       // const float inc = atan2f(mSceneScaleZ * (windowTopZ - windowBotZ), mSceneScaleY * table->m_bottom);
       const float inc = atan2f(windowTopZ - windowBotZ, table->m_bottom);
       return screenHeight <= 1.f ? 1.f : (VPUTOCM(table->m_bottom) / cosf(inc)) / screenHeight; // Ratio between screen height in virtual world to real world screen height
@@ -345,7 +346,8 @@ void ViewSetup::ComputeMVP(const PinTable* const table, const float aspect, cons
       const Vertex3Ds bottom = fit * Vertex3Ds{centerAxis, table->m_bottom, windowBotZ};
       const float xmin = zNear * min(bottom.x, top.x), xmax = zNear * max(bottom.x, top.x);
       const float ymin = zNear * min(bottom.y, top.y), ymax = zNear * max(bottom.y, top.y);
-      const float screenHeight = table->m_settings.LoadValueWithDefault(Settings::Player, "ScreenWidth"s, 0.0f); // Physical width (always measured in landscape orientation) is the height in window mode
+      static const Settings::Handle screenWidthHandle = Settings::GetHandle(Settings::Player, "ScreenWidth"s);
+      const float screenHeight = table->m_settings.GetFloat(screenWidthHandle, 0.0f); // Physical width (always measured in landscape orientation) is the height in window mode
       float offsetScale;
       if ((quadrant & 1) == 0) // 0 & 180
       {
@@ -381,7 +383,8 @@ void ViewSetup::ComputeMVP(const PinTable* const table, const float aspect, cons
       // Since the table is scaled to 'real world units' (that is to say same scale as the user measures), we directly use the user settings for IPD,.. without any scaling
 
       // 63mm is the average distance between eyes (varies from 54 to 74mm between adults, 43 to 58mm for children)
-      const float eyeSeparation = MMTOVPU(table->m_settings.LoadValueWithDefault(Settings::Player, "Stereo3DEyeSeparation"s, 63.0f));
+      static const Settings::Handle eyeSeparationHandle = Settings::GetHandle(Settings::Player, "Stereo3DEyeSeparation"s);
+      const float eyeSeparation = MMTOVPU(table->m_settings.GetFloat(eyeSeparationHandle, 63.0f));
 
       // Z where the stereo separation is 0:
       // - for cabinet (window) mode, we use the orthogonal distance to the screen (window)
@@ -1214,6 +1214,28 @@ void LiveUI::UpdatePerfOverlay()
       ImGui::NewLine();
    }
 
+   // Memory used per subsystem
+   if ((m_show_fps == 2) && ImGui::BeginTable("Memory", 3, ImGuiTableFlags_Borders))
+   {
+      ImGui::TableSetupColumn("Memory", ImGuiTableColumnFlags_WidthFixed);
+      ImGui::TableSetupColumn("Current", ImGuiTableColumnFlags_WidthFixed);
+      ImGui::TableSetupColumn("Peak", ImGuiTableColumnFlags_WidthFixed);
+      ImGui::TableHeadersRow();
+      for (int i = 0; i < MemoryAccounting::TAG_COUNT; i++)
+      {
+         const MemoryAccounting::Tag tag = (MemoryAccounting::Tag)i;
+         ImGui::TableNextRow();
+         ImGui::TableNextColumn(); ImGui::Text("%s%s", MemoryAccounting::GetName(tag), MemoryAccounting::IsEstimated(tag) ? " (est.)" : "");
+         ImGui::TableNextColumn(); ImGui::Text("%6.1fMiB", (double)MemoryAccounting::GetCurrent(tag) / (1024. * 1024.));
+         ImGui::TableNextColumn(); ImGui::Text("%6.1fMiB", (double)MemoryAccounting::GetPeak(tag) / (1024. * 1024.));
+      }
+      ImGui::TableNextRow();
+      ImGui::TableNextColumn(); ImGui::Text("Process");
+      ImGui::TableNextColumn(); ImGui::Text("%6.1fMiB", (double)MemoryAccounting::GetProcessMemory() / (1024. * 1024.));
+      ImGui::EndTable();
+      ImGui::NewLine();
+   }
+
    // Display simple FPS window
    #if defined(ENABLE_BGFX)
    // TODO We are missing a way to evaluate properly if we are syncing on display or not
@@ -4837,6 +4859,8 @@ void LiveUI::LightProperties(bool is_live, Light *startup_light, Light *live_lig
       ImGui::EndDisabled();
       ImGui::EndTable();
    }
+   if (is_live && live_light)
+      live_light->MarkAnimationDirty(); // Properties may have been edited directly
 }
 
 void LiveUI::PrimitiveProperties(bool is_live, Primitive *startup_obj, Primitive *live_obj)
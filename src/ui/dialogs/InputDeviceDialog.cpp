@@ -61,7 +61,10 @@ void DeviceTreeView::SetAllItemStates(const bool checked)
             {
                ISelect* const psel = pedit->GetISelect();
                if (psel != nullptr)
+               {
                   psel->m_isVisible = checked;
+                  pedit->InvalidateSavedStream();
+               }
             }
          }
 
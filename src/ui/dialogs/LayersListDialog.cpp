@@ -79,7 +79,10 @@ void LayersListDialog::DeleteLayer()
          {
             ISelect* const psel = pedit->GetISelect();
             if (psel != nullptr)
+            {
                psel->m_layerName = fillLayerName;
+               pedit->InvalidateSavedStream();
+            }
             m_layerTreeView.AddElement(pedit->GetName(), pedit);
          }
       }
@@ -327,6 +330,7 @@ void LayersListDialog::OnAssignButton()
    {
       ISelect* const psel = m_activeTable->m_vmultisel.ElementAt(t);
       IEditable* const pedit = psel->GetIEditable();
+      pedit->InvalidateSavedStream();
       psel->m_layerName = layerName;
       const HTREEITEM oldItem = m_layerTreeView.GetItemByElement(pedit);
       m_layerTreeView.AddElement(pedit->GetName(), pedit);
@@ -367,6 +371,7 @@ void LayersListDialog::AssignToLayerByIndex(size_t index)
    {
       ISelect* const psel = m_activeTable->m_vmultisel.ElementAt(t);
       IEditable* const pedit = psel->GetIEditable();
+      pedit->InvalidateSavedStream();
       psel->m_layerName = layerList[index];
       
       const HTREEITEM oldItem = m_layerTreeView.GetItemByElement(pedit);
@@ -687,7 +692,10 @@ void LayerTreeView::SetAllItemStates(const bool checked)
             {
                ISelect* const psel = pedit->GetISelect();
                if (psel != nullptr)
+               {
                   psel->m_isVisible = checked;
+                  pedit->InvalidateSavedStream();
+               }
             }
          }
 
@@ -867,7 +875,10 @@ LRESULT LayerTreeView::WndProc(UINT msg, WPARAM wparam, LPARAM lparam)
                   ISelect* const psel = pedit->GetISelect();
                   const HTREEITEM hLayerItem = GetLayerByItem(hSelectedDrop);
                   if (psel != nullptr)
+                  {
                      psel->m_layerName = GetLayerName(hLayerItem);
+                     pedit->InvalidateSavedStream();
+                  }
                   const HTREEITEM oldItem = GetItemByElement(pedit);
                   DeleteItem(oldItem);
                   AddElementToLayer(hLayerItem, pedit->GetName(), pedit);
@@ -949,7 +960,10 @@ LRESULT LayerTreeView::OnNotifyReflect(WPARAM wparam, LPARAM lparam)
          {
             ISelect* const psel = m_activeTable->m_vedit[t]->GetISelect();
             if (psel != nullptr && psel->m_layerName == oldName)
+            {
                psel->m_layerName = newName;
+               m_activeTable->m_vedit[t]->InvalidateSavedStream();
+            }
          }
       }
       else
@@ -999,7 +1013,10 @@ LRESULT LayerTreeView::OnNMClick(LPNMHDR lpnmh)
                      {
                         ISelect* const psel = pedit->GetISelect();
                         if (psel != nullptr)
+                        {
                            psel->m_isVisible = checked;
+                           pedit->InvalidateSavedStream();
+                        }
                      }
                   }
 
@@ -1014,7 +1031,10 @@ LRESULT LayerTreeView::OnNMClick(LPNMHDR lpnmh)
                {
                   ISelect* const psel = pedit->GetISelect();
                   if (psel != nullptr)
+                  {
                      psel->m_isVisible = IsItemChecked(tvItem.hItem);
+                     pedit->InvalidateSavedStream();
+                  }
                }
             }
          }
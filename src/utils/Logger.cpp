@@ -4,6 +4,10 @@
 #include "Logger.h"
 
 #include <plog/Init.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
 #include <plog/Formatters/TxtFormatter.h>
 #include <plog/Appenders/RollingFileAppender.h>
 #ifdef __STANDALONE__
@@ -48,6 +52,243 @@ private:
    std::thread::id m_uiThreadId;
 };
 
+// Asynchronous appender: each logging thread serializes its records as binary blobs (fixed header with the
+// record fields followed by the function name and message) into its own lock free ring buffer. A background
+// thread collects them, restores the global order and forwards them to the actual (file/console) appenders.
+// This way, logging from the physics or render threads does not stall on slow storage (SD cards, ...).
+// Errors are flushed synchronously to ensure they reach the log before a possible crash.
+class AsyncAppender final : public plog::IAppender
+{
+public:
+   AsyncAppender()
+   {
+      m_writerThread = std::thread(&AsyncAppender::WriterLoop, this);
+   }
+
+   ~AsyncAppender() override
+   {
+      {
+         std::lock_guard lock(m_wakeMutex);
+         m_running = false;
+      }
+      m_wakeCondition.notify_one();
+      m_writerThread.join();
+      Flush();
+   }
+
+   // Appenders must be added before this appender is registered to a logger
+   void AddAppender(plog::IAppender* appender) { m_appenders.push_back(appender); }
+
+   void write(const plog::Record &record) PLOG_OVERRIDE
+   {
+      LogRing *const ring = GetThreadRing();
+
+      const char *const func = record.getFunc();
+      const plog::util::nchar *const message = record.getMessage();
+      const size_t funcLength = strlen(func);
+      size_t messageLength = std::char_traits<plog::util::nchar>::length(message);
+      constexpr size_t maxPayload = LogRing::CAPACITY / 4 - sizeof(RecordHeader);
+      if (funcLength + messageLength * sizeof(plog::util::nchar) > maxPayload)
+         messageLength = (maxPayload - funcLength) / sizeof(plog::util::nchar);
+      const size_t size = (sizeof(RecordHeader) + funcLength + messageLength * sizeof(plog::util::nchar) + 7) & ~static_cast<size_t>(7);
+
+      const size_t head = ring->m_head.load(std::memory_order_relaxed);
+      const size_t offset = head & (LogRing::CAPACITY - 1);
+      const size_t padding = (offset + size > LogRing::CAPACITY) ? LogRing::CAPACITY - offset : 0;
+      size_t tail = ring->m_tail.load(std::memory_order_acquire);
+      if (LogRing::CAPACITY - (head - tail) < padding + size)
+      {
+         // Ring is full (burst of logs faster than the writer): fall back to writing synchronously instead of losing records
+         Flush();
+         tail = ring->m_tail.load(std::memory_order_acquire);
+      }
+      if (padding)
+      {
+         constexpr uint32_t wrapMarker = 0;
+         memcpy(ring->m_buffer + offset, &wrapMarker, sizeof(wrapMarker));
+      }
+
+      RecordHeader header;
+      header.size = static_cast<uint32_t>(size);
+      header.funcLength = static_cast<uint32_t>(funcLength);
+      header.messageLength = static_cast<uint32_t>(messageLength);
+      header.sequence = m_sequence.fetch_add(1, std::memory_order_relaxed);
+      header.time = record.getTime();
+      header.file = record.getFile();
+      header.object = record.getObject();
+      header.line = record.getLine();
+      header.tid = record.getTid();
+      header.instanceId = record.getInstanceId();
+      header.severity = record.getSeverity();
+      uint8_t *const dst = ring->m_buffer + ((head + padding) & (LogRing::CAPACITY - 1));
+      memcpy(dst, &header, sizeof(RecordHeader));
+      memcpy(dst + sizeof(RecordHeader), func, funcLength);
+      memcpy(dst + sizeof(RecordHeader) + funcLength, message, messageLength * sizeof(plog::util::nchar));
+      ring->m_head.store(head + padding + size, std::memory_order_release);
+
+      if (header.severity <= plog::error)
+         Flush();
+      else if (head + padding + size - tail > LogRing::CAPACITY / 4)
+         m_wakeCondition.notify_one();
+   }
+
+   // Format and write all pending records from the calling thread
+   void Flush()
+   {
+      std::lock_guard drainLock(m_drainMutex);
+      {
+         std::lock_guard ringsLock(m_ringsMutex);
+         m_drainRings.clear();
+         for (const auto &ring : m_rings)
+            m_drainRings.push_back(ring.get());
+      }
+
+      m_pending.clear();
+      for (LogRing *const ring : m_drainRings)
+      {
+         const size_t head = ring->m_head.load(std::memory_order_acquire);
+         size_t tail = ring->m_tail.load(std::memory_order_relaxed);
+         while (tail != head)
+         {
+            const uint8_t *const src = ring->m_buffer + (tail & (LogRing::CAPACITY - 1));
+            RecordHeader header;
+            memcpy(&header, src, sizeof(RecordHeader::size));
+            if (header.size == 0) // wrap marker
+            {
+               tail += LogRing::CAPACITY - (tail & (LogRing::CAPACITY - 1));
+               continue;
+            }
+            memcpy(&header, src, sizeof(RecordHeader));
+            PendingRecord &pending = m_pending.emplace_back();
+            pending.header = header;
+            pending.func.assign(reinterpret_cast<const char *>(src + sizeof(RecordHeader)), header.funcLength);
+            pending.message.resize(header.messageLength);
+            memcpy(pending.message.data(), src + sizeof(RecordHeader) + header.funcLength, header.messageLength * sizeof(plog::util::nchar));
+            tail += header.size;
+         }
+         ring->m_tail.store(tail, std::memory_order_release);
+      }
+
+      std::sort(m_pending.begin(), m_pending.end(), [](const PendingRecord &a, const PendingRecord &b) { return a.header.sequence < b.header.sequence; });
+      for (const PendingRecord &pending : m_pending)
+      {
+         const AsyncRecord record(pending);
+         for (plog::IAppender *const appender : m_appenders)
+            appender->write(record);
+      }
+   }
+
+private:
+   struct RecordHeader
+   {
+      uint32_t size; // Size of the whole record (header + payload, 8 bytes aligned), 0 marks a wrap to the beginning of the ring
+      uint32_t funcLength;
+      uint32_t messageLength;
+      plog::Severity severity;
+      uint64_t sequence;
+      plog::util::Time time;
+      const char* file;
+      const void* object;
+      size_t line;
+      unsigned int tid;
+      int instanceId;
+   };
+
+   struct LogRing
+   {
+      static constexpr size_t CAPACITY = 128 * 1024; // Must be a power of 2
+      alignas(64) std::atomic<size_t> m_head { 0 }; // Written by the logging thread
+      alignas(64) std::atomic<size_t> m_tail { 0 }; // Written by the draining thread
+      std::atomic<bool> m_owned { true };
+      alignas(64) uint8_t m_buffer[CAPACITY];
+   };
+
+   struct PendingRecord
+   {
+      RecordHeader header;
+      std::string func;
+      plog::util::nstring message;
+   };
+
+   class AsyncRecord final : public plog::Record
+   {
+   public:
+      explicit AsyncRecord(const PendingRecord &pending)
+         : plog::Record(pending.header.severity, "", pending.header.line, pending.header.file, pending.header.object, pending.header.instanceId)
+         , m_pending(pending)
+      {
+      }
+      const plog::util::Time &getTime() const override { return m_pending.header.time; }
+      unsigned int getTid() const override { return m_pending.header.tid; }
+      const plog::util::nchar *getMessage() const override { return m_pending.message.c_str(); }
+      const char *getFunc() const override { return m_pending.func.c_str(); }
+
+   private:
+      const PendingRecord &m_pending;
+   };
+
+   // Give back the ring buffer for reuse by another thread when the logging thread exits
+   struct ThreadRing
+   {
+      ~ThreadRing()
+      {
+         if (m_ring)
+            m_ring->m_owned.store(false, std::memory_order_release);
+      }
+      LogRing *m_ring = nullptr;
+   };
+
+   LogRing *GetThreadRing()
+   {
+      static thread_local ThreadRing threadRing;
+      if (threadRing.m_ring == nullptr)
+      {
+         std::lock_guard lock(m_ringsMutex);
+         for (const auto &ring : m_rings)
+         {
+            if (!ring->m_owned.load(std::memory_order_acquire) && ring->m_head.load(std::memory_order_relaxed) == ring->m_tail.load(std::memory_order_acquire))
+            {
+               ring->m_owned.store(true, std::memory_order_relaxed);
+               threadRing.m_ring = ring.get();
+               break;
+            }
+         }
+         if (threadRing.m_ring == nullptr)
+            threadRing.m_ring = m_rings.emplace_back(std::make_unique<LogRing>()).get();
+      }
+      return threadRing.m_ring;
+   }
+
+   void WriterLoop()
+   {
+      std::unique_lock lock(m_wakeMutex);
+      while (m_running)
+      {
+         m_wakeCondition.wait_for(lock, std::chrono::milliseconds(50));
+         lock.unlock();
+         Flush();
+         lock.lock();
+      }
+   }
+
+   vector<plog::IAppender *> m_appenders;
+
+   std::atomic<uint64_t> m_sequence { 0 };
+   std::mutex m_ringsMutex;
+   vector<std::unique_ptr<LogRing>> m_rings;
+
+   std::mutex m_drainMutex;
+   vector<LogRing *> m_drainRings;
+   vector<PendingRecord> m_pending;
+
+   std::mutex m_wakeMutex;
+   std::condition_variable m_wakeCondition;
+   bool m_running = true;
+   std::thread m_writerThread;
+};
+
+static AsyncAppender* s_asyncAppender = nullptr;
+
 Logger* Logger::m_pInstance = nullptr;
 
 Logger* Logger::GetInstance()
@@ -69,22 +310,28 @@ void Logger::SetupLogger(const bool enable)
          initialized = true;
          string szLogPath = g_pvp->m_szMyPrefPath + "vpinball.log";
          static plog::RollingFileAppender<plog::TxtFormatter> fileAppender(szLogPath.c_str(), 1024 * 1024 * 5, 1);
-         static DebugAppender debugAppender;
-         plog::Logger<PLOG_DEFAULT_INSTANCE_ID>::getInstance()->addAppender(&debugAppender);
-         plog::Logger<PLOG_DEFAULT_INSTANCE_ID>::getInstance()->addAppender(&fileAppender);
-         plog::Logger<PLOG_NO_DBG_OUT_INSTANCE_ID>::getInstance()->addAppender(&fileAppender);
-
 #ifdef __STANDALONE__
 #ifndef __ANDROID__
          static plog::ColorConsoleAppender<plog::TxtFormatter> consoleAppender;
-         plog::Logger<PLOG_DEFAULT_INSTANCE_ID>::getInstance()->addAppender(&consoleAppender);
-         plog::Logger<PLOG_NO_DBG_OUT_INSTANCE_ID>::getInstance()->addAppender(&consoleAppender);
 #else
          static plog::AndroidAppender<plog::TxtFormatter> androidAppender("vpinball");
-         plog::Logger<PLOG_DEFAULT_INSTANCE_ID>::getInstance()->addAppender(&androidAppender);
-         plog::Logger<PLOG_NO_DBG_OUT_INSTANCE_ID>::getInstance()->addAppender(&androidAppender);
 #endif
 #endif
+         // File and console outputs are written from a background thread, the debug window is fed synchronously from the UI thread
+         static AsyncAppender asyncAppender;
+         asyncAppender.AddAppender(&fileAppender);
+#ifdef __STANDALONE__
+#ifndef __ANDROID__
+         asyncAppender.AddAppender(&consoleAppender);
+#else
+         asyncAppender.AddAppender(&androidAppender);
+#endif
+#endif
+         s_asyncAppender = &asyncAppender;
+         static DebugAppender debugAppender;
+         plog::Logger<PLOG_DEFAULT_INSTANCE_ID>::getInstance()->addAppender(&debugAppender);
+         plog::Logger<PLOG_DEFAULT_INSTANCE_ID>::getInstance()->addAppender(&asyncAppender);
+         plog::Logger<PLOG_NO_DBG_OUT_INSTANCE_ID>::getInstance()->addAppender(&asyncAppender);
       }
       #ifdef _DEBUG
       maxLogSeverity = plog::debug;
@@ -102,6 +349,12 @@ void Logger::Init()
    plog::init<PLOG_NO_DBG_OUT_INSTANCE_ID>(); // Logger that does not show in the debug window to avoid duplicated messages
 }
 
+void Logger::Flush()
+{
+   if (s_asyncAppender)
+      s_asyncAppender->Flush();
+}
+
 void Logger::Truncate()
 {
    std::string szLogPath = g_pvp->m_szMyPrefPath + "vpinball.log";
@@ -15,6 +15,7 @@ public:
 
    void Init();
    void SetupLogger(const bool enable);
+   void Flush(); // Write out pending asynchronous log records
    void Truncate();
 
 private:
@@ -0,0 +1,104 @@
+// license:GPLv3+
+
+#include "core/stdafx.h"
+#include "MemoryAccounting.h"
+
+#include <atomic>
+#include <sstream>
+#if defined(_MSC_VER)
+#include "psapi.h"
+#pragma comment(lib, "Psapi")
+#elif defined(__APPLE__)
+#include <mach/mach.h>
+#elif !defined(_WIN32)
+#include <unistd.h>
+#endif
+
+static std::atomic<int64_t> s_current[MemoryAccounting::TAG_COUNT];
+static std::atomic<int64_t> s_peak[MemoryAccounting::TAG_COUNT];
+
+void MemoryAccounting::Add(const Tag tag, const int64_t bytes)
+{
+   const int64_t current = s_current[tag].fetch_add(bytes, std::memory_order_relaxed) + bytes;
+   int64_t peak = s_peak[tag].load(std::memory_order_relaxed);
+   while (current > peak && !s_peak[tag].compare_exchange_weak(peak, current, std::memory_order_relaxed)) { }
+}
+
+void MemoryAccounting::Reset(const Tag tag)
+{
+   s_current[tag] = 0;
+}
+
+int64_t MemoryAccounting::GetCurrent(const Tag tag)
+{
+   return s_current[tag].load(std::memory_order_relaxed);
+}
+
+int64_t MemoryAccounting::GetPeak(const Tag tag)
+{
+   return s_peak[tag].load(std::memory_order_relaxed);
+}
+
+const char* MemoryAccounting::GetName(const Tag tag)
+{
+   switch (tag)
+   {
+   case TEXTURE_CPU: return "Textures (CPU)";
+   case TEXTURE_GPU: return "Textures (GPU)";
+   case MESH: return "Meshes";
+   case COLLIDER: return "Colliders";
+   case SOUND: return "Sounds";
+   case SCRIPT: return "Script engine";
+   case PLUGIN: return "Plugins";
+   default: return "Unknown";
+   }
+}
+
+size_t MemoryAccounting::GetProcessMemory()
+{
+#if defined(_MSC_VER)
+   PROCESS_MEMORY_COUNTERS_EX pmc;
+   if (GetProcessMemoryInfo(GetCurrentProcess(), (PROCESS_MEMORY_COUNTERS*)&pmc, sizeof(pmc)))
+      return pmc.PrivateUsage;
+   return 0;
+#elif defined(__APPLE__)
+   mach_task_basic_info info;
+   mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+   if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, (task_info_t)&info, &count) == KERN_SUCCESS)
+      return info.resident_size;
+   return 0;
+#elif !defined(_WIN32)
+   size_t size = 0, resident = 0;
+   FILE* const f = fopen("/proc/self/statm", "r");
+   if (f)
+   {
+      if (fscanf(f, "%zu %zu", &size, &resident) != 2)
+         resident = 0;
+      fclose(f);
+   }
+   return resident * (size_t)sysconf(_SC_PAGESIZE);
+#else
+   return 0;
+#endif
+}
+
+string MemoryAccounting::GetReport()
+{
+   std::ostringstream report;
+   report << std::fixed << std::setprecision(1);
+   report << "Memory usage (current / peak, ~ for estimates):\n";
+   for (int i = 0; i < TAG_COUNT; i++)
+   {
+      const Tag tag = (Tag)i;
+      report << (IsEstimated(tag) ? "~ " : "  ") << std::left << std::setw(16) << GetName(tag) << std::right
+             << std::setw(9) << (double)GetCurrent(tag) * (1.0 / (1024. * 1024.)) << " MiB / "
+             << std::setw(9) << (double)GetPeak(tag) * (1.0 / (1024. * 1024.)) << " MiB\n";
+   }
+   report << "  " << std::left << std::setw(16) << "Process" << std::right << std::setw(9) << (double)GetProcessMemory() * (1.0 / (1024. * 1024.)) << " MiB";
+   return report.str();
+}
+
+void MemoryAccounting::LogReport()
+{
+   PLOGI << GetReport();
+}
@@ -0,0 +1,55 @@
+// license:GPLv3+
+
+#pragma once
+
+// Per subsystem memory accounting, to find out which part of a table uses the memory.
+// Textures, buffers, colliders and sounds report their own allocations, while the script engine and
+// plugins, which allocate out of our control, are estimated from the process memory growth while they
+// start up (see ProcessGrowthScope).
+class MemoryAccounting final
+{
+public:
+   enum Tag
+   {
+      TEXTURE_CPU, // Decoded images in system memory
+      TEXTURE_GPU, // Textures uploaded to the GPU, including their mipmaps (estimated from their format)
+      MESH,        // Vertex and index buffers
+      COLLIDER,    // Physics hit objects
+      SOUND,       // Sound data and decoded samples of the software mixer
+      SCRIPT,      // Script engine and objects created by the script while starting (estimated)
+      PLUGIN,      // Plugins while starting the game (estimated)
+      TAG_COUNT
+   };
+
+   static void Add(const Tag tag, const int64_t bytes);
+   static void Reset(const Tag tag);
+   static int64_t GetCurrent(const Tag tag);
+   static int64_t GetPeak(const Tag tag);
+   static const char* GetName(const Tag tag);
+   static bool IsEstimated(const Tag tag) { return tag == SCRIPT || tag == PLUGIN; }
+
+   static size_t GetProcessMemory(); // Private (Windows) or resident memory of the process, 0 if not available
+
+   static string GetReport();
+   static void LogReport();
+
+   // Accounts the process memory growth during the lifetime of the scope to the given tag
+   class ProcessGrowthScope final
+   {
+   public:
+      ProcessGrowthScope(const Tag tag) : m_tag(tag), m_start(GetProcessMemory()) { }
+      ~ProcessGrowthScope()
+      {
+         const size_t end = GetProcessMemory();
+         if (end > m_start)
+            Add(m_tag, (int64_t)(end - m_start));
+      }
+
+   private:
+      const Tag m_tag;
+      const size_t m_start;
+   };
+
+private:
+   MemoryAccounting() = delete;
+};
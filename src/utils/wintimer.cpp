@@ -2,6 +2,7 @@
 
 #include "core/stdafx.h"
 #include <ctime>
+#include <fstream>
 //#ifndef _MSC_VER
 //#include <unistd.h>
 //#endif
@@ -475,3 +476,85 @@ int _tmain(int argc, _TCHAR* argv[])
     return 0;
 }
 #endif
+
+bool FrameProfiler::ExportTrace(const string& path, const vector<const FrameProfiler*>& profilers)
+{
+   static const char* const sectionNames[PROFILE_COUNT] = {
+      "Misc", "Script", "Physics", "Sleep", "Prepare Frame", "Custom 1", "Custom 2", "Custom 3",
+      "Render Wait", "Render Submit", "Render Flip", "Render Sleep",
+      "Frame", "Input", "Input to Present" };
+
+   // Events still being written by a running profiler may overwrite the oldest ones of a full ring, so skip a few of them
+   constexpr size_t overwriteGuard = 64;
+   struct Range { size_t first, last; };
+   vector<Range> ranges;
+   unsigned long long origin = ~0ull;
+   for (const FrameProfiler* profiler : profilers)
+   {
+      const size_t last = profiler->m_traceEvents ? profiler->m_traceCount.load(std::memory_order_acquire) : 0;
+      const size_t first = last > TRACE_CAPACITY ? last - TRACE_CAPACITY + overwriteGuard : 0;
+      ranges.push_back({ first, last });
+      for (size_t pos = first; pos < last; pos++)
+         origin = min(origin, profiler->m_traceEvents[pos & (TRACE_CAPACITY - 1)].start);
+   }
+   if (origin == ~0ull)
+      return false;
+
+   std::ofstream out(path, std::ios::out | std::ios::trunc);
+   if (!out.is_open())
+   {
+      PLOGE << "Failed to write profiler trace to " << path;
+      return false;
+   }
+
+   const auto escape = [](const string& text)
+   {
+      string escaped;
+      for (const char c : text)
+      {
+         if (c == '"' || c == '\\')
+            escaped += '\\';
+         if (static_cast<unsigned char>(c) >= ' ')
+            escaped += c;
+      }
+      return escaped;
+   };
+
+   // Chrome Trace Event JSON format, timestamps and durations are in microseconds
+   out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+   out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"Visual Pinball\"}}";
+   for (size_t i = 0; i < profilers.size(); i++)
+   {
+      const FrameProfiler* const profiler = profilers[i];
+      const string threadName = escape(profiler->m_traceThreadName.empty() ? "Thread " + std::to_string(i) : profiler->m_traceThreadName);
+      // Each profiler has 2 tracks: one with the sections, one with the overall frames
+      const size_t sectionTid = i * 2 + 1, frameTid = i * 2 + 2;
+      out << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << sectionTid << ",\"args\":{\"name\":\"" << threadName << "\"}}";
+      out << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << frameTid << ",\"args\":{\"name\":\"" << threadName << " frames\"}}";
+      for (size_t pos = ranges[i].first; pos < ranges[i].last; pos++)
+      {
+         const TraceEvent& event = profiler->m_traceEvents[pos & (TRACE_CAPACITY - 1)];
+         const unsigned long long ts = event.start - origin;
+         switch (event.section)
+         {
+         case PROFILE_INPUT_POLL_PERIOD:
+            out << ",\n{\"name\":\"Input\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":" << sectionTid << ",\"ts\":" << ts << '}';
+            break;
+         case PROFILE_FRAME:
+            out << ",\n{\"name\":\"Frame\",\"ph\":\"X\",\"pid\":1,\"tid\":" << frameTid << ",\"ts\":" << ts << ",\"dur\":" << event.duration << '}';
+            break;
+         case PROFILE_SCRIPT:
+            out << ",\n{\"name\":\"" << (event.timerName[0] ? escape(event.timerName) : sectionNames[event.section]) << "\",\"cat\":\"script\",\"ph\":\"X\",\"pid\":1,\"tid\":" << sectionTid
+                << ",\"ts\":" << ts << ",\"dur\":" << event.duration << ",\"args\":{\"event\":\"" << escape(GetScriptEventName(event.dispId)) << "\"}}";
+            break;
+         default:
+            out << ",\n{\"name\":\"" << sectionNames[event.section] << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << sectionTid << ",\"ts\":" << ts << ",\"dur\":" << event.duration << '}';
+            break;
+         }
+      }
+   }
+   out << "\n]}\n";
+   out.close();
+   PLOGI << "Profiler trace exported to " << path;
+   return true;
+}
@@ -5,6 +5,9 @@
 #ifdef __STANDALONE__
 #include <climits>
 #endif
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <thread>
 
 #include "robin_hood.h"
@@ -148,7 +151,13 @@ public:
          m_presentedCount++;
       }
       m_processInputTimeStampOnPrepare = m_processInputTimeStamp;
-      m_profileTimeStamp = usec();
+      const unsigned long long ts = usec();
+      if (m_traceEvents && m_frameIndex > 0)
+      {
+         AddTraceEvent(m_profileSection, m_profileTimeStamp, ts);
+         AddTraceEvent(PROFILE_FRAME, m_frameTimeStamp, ts);
+      }
+      m_profileTimeStamp = ts;
       if (m_frameIndex > 0)
       {
          unsigned int frameLength = (unsigned int)(m_profileTimeStamp - m_frameTimeStamp);
@@ -187,6 +196,16 @@ public:
       m_profileIndex = (m_profileIndex + 1) % N_SAMPLES;
       memset(m_profileData[m_profileIndex], 0, sizeof(m_profileData[0]));
       memset(m_profileDataStart[m_profileIndex], 0, sizeof(m_profileDataStart[0]));
+      if (m_accumulateScriptEvents)
+      {
+         std::lock_guard lock(m_scriptEventTotalsMutex);
+         for (const auto& [id, tick] : m_scriptEventData)
+         {
+            EventTick& total = m_scriptEventTotals[id];
+            total.callCount += tick.callCount;
+            total.totalLength += tick.totalLength;
+         }
+      }
       m_scriptEventData.clear();
       m_profileTimersPos = 0;
       m_profileTimers[m_profileTimersPos] = 0;
@@ -199,6 +218,8 @@ public:
       assert(m_threadLock == std::this_thread::get_id());
       assert(0 <= section && section < PROFILE_COUNT);
       const unsigned long long ts = usec();
+      if (m_traceEvents && ts > m_profileTimeStamp)
+         AddTraceEvent(m_profileSection, m_profileTimeStamp, ts);
       m_profileDataEnd[m_profileIndex][m_profileSection] = ts;
       m_profileData[m_profileIndex][m_profileSection] += (unsigned int)(ts - m_profileTimeStamp);
       m_profileTimeStamp = ts;
@@ -244,6 +265,7 @@ public:
       assert(m_threadLock == std::this_thread::get_id());
       EnterProfileSection(PROFILE_SCRIPT);
       m_scriptEventDispID = id;
+      m_traceTimerName = timer_name;
       // For the time being, just store a list of the timer called during the script profile section
       if (timer_name)
       {
@@ -438,6 +460,8 @@ public:
    void OnProcessInput()
    {
       unsigned long long ts = usec();
+      if (m_traceEvents)
+         AddTraceEvent(PROFILE_INPUT_POLL_PERIOD, ts, ts);
       if (m_processInputTimeStamp != 0)
       {
          unsigned int elapsed = (unsigned int)(ts - m_processInputTimeStamp);
@@ -461,11 +485,70 @@ public:
       m_threadLock = std::this_thread::get_id();
    }
 
+   // Timeline capture: when enabled, each section (with its begin/end timestamps), frame and input processing is recorded
+   // in a ring buffer keeping the most recent events. They can be exported as a Chrome Trace Event JSON file to be inspected
+   // in chrome://tracing or https://ui.perfetto.dev. Must be enabled before the profiled thread starts using the profiler.
+   void EnableTraceCapture(const string& threadName)
+   {
+      if (m_traceEvents == nullptr)
+         m_traceEvents = std::make_unique<TraceEvent[]>(TRACE_CAPACITY);
+      m_traceThreadName = threadName;
+   }
+
+   // Export the captured events of the given profilers to a single timeline (one track per profiler thread)
+   static bool ExportTrace(const string& path, const vector<const FrameProfiler*>& profilers);
+
+   struct EventTick
+   {
+      unsigned int callCount = 0;
+      unsigned int totalLength = 0;
+   };
+
+   // Script timings per event accumulated over the frames since the previous call (for reporting from another thread, f.e. web server telemetry).
+   // Accumulation only starts after the first call.
+   robin_hood::unordered_map<DISPID, EventTick> TakeScriptEventTotals()
+   {
+      std::lock_guard lock(m_scriptEventTotalsMutex);
+      m_accumulateScriptEvents = true;
+      robin_hood::unordered_map<DISPID, EventTick> totals;
+      std::swap(totals, m_scriptEventTotals);
+      return totals;
+   }
+
+   static string GetScriptEventName(const DISPID id)
+   {
+      switch (id)
+      {
+      case 1000: return "GameEvents:KeyDown"s;
+      case 1001: return "GameEvents:KeyUp"s;
+      case 1002: return "GameEvents:Init"s;
+      case 1003: return "GameEvents:MusicDone"s;
+      case 1004: return "GameEvents:Exit"s;
+      case 1005: return "GameEvents:Paused"s;
+      case 1006: return "GameEvents:UnPaused"s;
+      case 1007: return "GameEvents:OptionEvent"s;
+      case 1101: return "SurfaceEvents:Slingshot"s;
+      case 1200: return "FlipperEvents:Collide"s;
+      case 1300: return "TimerEvents:Timer"s;
+      case 1301: return "SpinnerEvents:Spin"s;
+      case 1302: return "TargetEvents:Dropped"s;
+      case 1303: return "TargetEvents:Raised"s;
+      case 1320: return "LightSeqEvents:PlayDone"s;
+      case 1400: return "HitEvents:Hit"s;
+      case 1401: return "HitEvents:Unhit"s;
+      case 1402: return "LimitEvents:EOS"s;
+      case 1403: return "LimitEvents:BOS"s;
+      case 1404: return "AnimateEvents:Animate"s;
+      default: return "DispID[" + std::to_string(id) + ']';
+      }
+   }
+
 private:
    constexpr static unsigned int N_SAMPLES = 1000; // Number of samples to store. Must be kept quite high to be able to do a 1s sliding average (so at 1000FPS, needs 100 samples)
    constexpr static unsigned int N_WORST = 10; // Number of longest frames to keep detailed profile timing
    constexpr static unsigned int STACK_SIZE = 100;
    constexpr static unsigned int MAX_TIMER_LOG = 1024;
+   constexpr static size_t TRACE_CAPACITY = 128 * 1024; // Must be a power of 2
 
    bool m_logWorstFrame = false;
 
@@ -477,13 +560,11 @@ private:
    int m_profileSectionStackPos = 0;
    ProfileSection m_profileSectionStack[STACK_SIZE];
    ProfileSection m_profileSection = PROFILE_MISC;
-   struct EventTick
-   {
-      unsigned int callCount = 0;
-      unsigned int totalLength = 0;
-   };
    DISPID m_scriptEventDispID = 0;
    robin_hood::unordered_map<DISPID, EventTick> m_scriptEventData;
+   std::atomic<bool> m_accumulateScriptEvents = false;
+   std::mutex m_scriptEventTotalsMutex;
+   robin_hood::unordered_map<DISPID, EventTick> m_scriptEventTotals;
 
    // Overall frame
    unsigned int m_frameIndex = -1;
@@ -511,6 +592,34 @@ private:
    size_t m_profileTimersPos = 0;
    unsigned long long m_profileTimerTimeStamp;
 
+   // Timeline capture
+   struct TraceEvent
+   {
+      unsigned long long start;
+      unsigned int duration;
+      ProfileSection section;
+      DISPID dispId;
+      char timerName[28];
+   };
+   std::unique_ptr<TraceEvent[]> m_traceEvents;
+   std::atomic<size_t> m_traceCount = 0;
+   string m_traceThreadName;
+   const char* m_traceTimerName = nullptr;
+
+   void AddTraceEvent(const ProfileSection section, const unsigned long long start, const unsigned long long end)
+   {
+      const size_t pos = m_traceCount.load(std::memory_order_relaxed);
+      TraceEvent& event = m_traceEvents[pos & (TRACE_CAPACITY - 1)];
+      event.start = start;
+      event.duration = (unsigned int)(end - start);
+      event.section = section;
+      event.dispId = section == PROFILE_SCRIPT ? m_scriptEventDispID : 0;
+      const size_t len = (section == PROFILE_SCRIPT && m_traceTimerName) ? min(strlen(m_traceTimerName), sizeof(event.timerName) - 1) : 0;
+      memcpy(event.timerName, m_traceTimerName, len);
+      event.timerName[len] = '\0';
+      m_traceCount.store(pos + 1, std::memory_order_release);
+   }
+
    // Worst frames data
    unsigned int m_leastWorstFrameLength;
    unsigned int m_profileWorstData[N_WORST][PROFILE_COUNT];
@@ -524,31 +633,7 @@ private:
       std::stringstream ss;
       for (auto v : eventData)
       {
-         string name;
-         switch (v.first)
-         {
-         case 1000: name = "GameEvents:KeyDown"s; break;
-         case 1001: name = "GameEvents:KeyUp"s; break;
-         case 1002: name = "GameEvents:Init"s; break;
-         case 1003: name = "GameEvents:MusicDone"s; break;
-         case 1004: name = "GameEvents:Exit"s; break;
-         case 1005: name = "GameEvents:Paused"s; break;
-         case 1006: name = "GameEvents:UnPaused"s; break;
-         case 1007: name = "GameEvents:OptionEvent"s; break;
-         case 1101: name = "SurfaceEvents:Slingshot"s; break;
-         case 1200: name = "FlipperEvents:Collide"s; break;
-         case 1300: name = "TimerEvents:Timer"s; break;
-         case 1301: name = "SpinnerEvents:Spin"s; break;
-         case 1302: name = "TargetEvents:Dropped"s; break;
-         case 1303: name = "TargetEvents:Raised"s; break;
-         case 1320: name = "LightSeqEvents:PlayDone"s; break;
-         case 1400: name = "HitEvents:Hit"s; break;
-         case 1401: name = "HitEvents:Unhit"s; break;
-         case 1402: name = "LimitEvents:EOS"s; break;
-         case 1403: name = "LimitEvents:BOS"s; break;
-         case 1404: name = "AnimateEvents:Animate"s; break;
-         default: name = "DispID[" + std::to_string(v.first) + ']';
-         }
+         const string name = GetScriptEventName(v.first);
          // ss << " spent in " << std::setw(3) << v.second.callCount << " calls of " << name;
          if (v.first == 1300)
          {
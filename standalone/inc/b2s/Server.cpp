@@ -37,16 +37,16 @@ Server::Server()
    m_pCollectGIStringsData = new B2SCollectData(m_pB2SSettings->GetGIStringsSkipFrames());
    m_pCollectLEDsData = new B2SCollectData(m_pB2SSettings->GetLEDsSkipFrames());
 
-   m_pTimer = new VP::Timer();
-   m_pTimer->SetInterval(37);
-   m_pTimer->SetElapsedListener(std::bind(&Server::TimerElapsed, this, std::placeholders::_1));
+   m_pUpdateThread = nullptr;
+   m_updateThreadRunning = false;
+   m_stateChanged = false;
 
    srand(time(0));
 }
 
 Server::~Server()
 {
-   delete m_pTimer;
+   StopUpdateThread();
 
    m_pB2SData->FreeVPinMAME();
 
@@ -57,95 +57,125 @@ Server::~Server()
       m_pB2SSettings->GetPluginHost()->UnregisterAllPlugins();
 }
 
-void Server::TimerElapsed(VP::Timer* pTimer)
+void Server::StartUpdateThread()
 {
-   // have a look for important pollings
-   static int counter = 0;
-   static bool callLamps = false;
-   static bool callSolenoids = false;
-   static bool callGIStrings = false;
-   static bool callLEDs = false;
-   static bool logged = false;
+   if (m_pUpdateThread)
+      return;
+
+   // size the scratch buffer for the largest change list the controller can report (LEDs report 3 values per entry)
+   m_changedStates.resize(3 * max(max(PinmameGetMaxLamps(), PinmameGetMaxSolenoids()), max(PinmameGetMaxGIs(), PinmameGetMaxLEDs())));
+
+   m_updateThreadRunning = true;
+   m_stateChanged = false;
+   m_pB2SData->GetVPinMAME()->SetStateChangedListener([this]() {
+      {
+         std::lock_guard<std::mutex> lock(m_updateMutex);
+         m_stateChanged = true;
+      }
+      m_updateCondition.notify_one();
+   });
 
-   if (counter <= 25) {
-      counter++;
-      callLamps = !m_changedLampsCalled && (m_pB2SData->IsUseRomLamps() || m_pB2SData->IsUseAnimationLamps());
-      callSolenoids = !m_changedSolenoidsCalled && (m_pB2SData->IsUseRomSolenoids() || m_pB2SData->IsUseAnimationSolenoids());
-      callGIStrings = !m_changedGIStringsCalled && (m_pB2SData->IsUseRomGIStrings() || m_pB2SData->IsUseAnimationGIStrings());
-      callLEDs = !m_changedLEDsCalled && (m_pB2SData->IsUseLEDs() || m_pB2SData->IsUseLEDDisplays() || m_pB2SData->IsUseReels());
+   m_pUpdateThread = new std::thread(&Server::UpdateThread, this);
+}
+
+void Server::StopUpdateThread()
+{
+   if (!m_pUpdateThread)
+      return;
+
+   m_pB2SData->GetVPinMAME()->SetStateChangedListener(nullptr);
+
+   {
+      std::lock_guard<std::mutex> lock(m_updateMutex);
+      m_updateThreadRunning = false;
    }
-   else {
-      if (m_pB2SSettings->IsROMControlled()) {
-         bool changed = false;
-         if (callLamps) {
-            if (!m_changedLampsCalled) {
-               VARIANT ret;
-               VariantInit(&ret);
-               GetChangedLamps(&ret);
-               VariantClear(&ret);
-            }
-            else {
-               callLamps = false;
-               changed = true;
-            }
+   m_updateCondition.notify_one();
+
+   m_pUpdateThread->join();
+   delete m_pUpdateThread;
+   m_pUpdateThread = nullptr;
+}
+
+void Server::UpdateThread()
+{
+   // have a look for important pollings during the first second, then only process what the script does not fetch itself
+   const Uint64 startTicks = SDL_GetTicks();
+   bool callLamps = false;
+   bool callSolenoids = false;
+   bool callGIStrings = false;
+   bool callLEDs = false;
+   bool logged = false;
+
+   // changes are processed as soon as the controller notifies them, the skip frames settings only throttle how often the collected data is shown;
+   // without notification, the thread only wakes up to show the data held back by this throttle
+   while (true) {
+      bool query;
+      {
+         const auto showTime = std::min(std::min(m_pCollectLampsData->GetShowTime(), m_pCollectSolenoidsData->GetShowTime()),
+            std::min(m_pCollectGIStringsData->GetShowTime(), m_pCollectLEDsData->GetShowTime()));
+         std::unique_lock<std::mutex> lock(m_updateMutex);
+         const auto wake = [this]() { return m_stateChanged || !m_updateThreadRunning; };
+         if (showTime == std::chrono::steady_clock::time_point::max())
+            m_updateCondition.wait(lock, wake);
+         else
+            m_updateCondition.wait_until(lock, showTime, wake);
+         if (!m_updateThreadRunning)
+            break;
+         query = m_stateChanged;
+         m_stateChanged = false;
+      }
+
+      if (SDL_GetTicks() - startTicks <= 1000) {
+         callLamps = !m_changedLampsCalled && (m_pB2SData->IsUseRomLamps() || m_pB2SData->IsUseAnimationLamps());
+         callSolenoids = !m_changedSolenoidsCalled && (m_pB2SData->IsUseRomSolenoids() || m_pB2SData->IsUseAnimationSolenoids());
+         callGIStrings = !m_changedGIStringsCalled && (m_pB2SData->IsUseRomGIStrings() || m_pB2SData->IsUseAnimationGIStrings());
+         callLEDs = !m_changedLEDsCalled && (m_pB2SData->IsUseLEDs() || m_pB2SData->IsUseLEDDisplays() || m_pB2SData->IsUseReels());
+         continue;
+      }
+
+      if (!m_pB2SSettings->IsROMControlled())
+         continue;
+
+      bool changed = false;
+      if (callLamps) {
+         if (!m_changedLampsCalled)
+            ProcessChangedLamps(query);
+         else {
+            callLamps = false;
+            changed = true;
          }
-         if (callSolenoids) {
-            if (!m_changedSolenoidsCalled) {
-               VARIANT ret;
-               VariantInit(&ret);
-               GetChangedSolenoids(&ret);
-               VariantClear(&ret);
-            }
-            else {
-               callSolenoids = false;
-               changed = true;
-            }
+      }
+      if (callSolenoids) {
+         if (!m_changedSolenoidsCalled)
+            ProcessChangedSolenoids(query);
+         else {
+            callSolenoids = false;
+            changed = true;
          }
-         if (callGIStrings) {
-            if (!m_changedGIStringsCalled) {
-               VARIANT ret;
-               VariantInit(&ret);
-               GetChangedGIStrings(&ret);
-               VariantClear(&ret);
-            }
-            else {
-               callGIStrings = false;
-               changed = true;
-            }
+      }
+      if (callGIStrings) {
+         if (!m_changedGIStringsCalled)
+            ProcessChangedGIStrings(query);
+         else {
+            callGIStrings = false;
+            changed = true;
          }
-         if (callLEDs) {
-            if (!m_changedLEDsCalled) {
-               VARIANT varMask1;
-               VariantInit(&varMask1);
-               V_VT(&varMask1) = VT_I4;
-               V_I4(&varMask1) = 0xFFFFFFFF;
-
-               VARIANT varMask2;
-               VariantInit(&varMask2);
-               V_VT(&varMask2) = VT_I4;
-               V_I4(&varMask2) = 0;
-
-               VARIANT ret;
-               VariantInit(&ret);
-               GetChangedLEDs(varMask1, varMask1, varMask2, varMask2, &ret);
-               VariantClear(&ret);
-               VariantClear(&varMask1);
-               VariantClear(&varMask2);
-            }
-            else {
-               callLEDs = false;
-               changed = true;
-            }
+      }
+      if (callLEDs) {
+         if (!m_changedLEDsCalled)
+            ProcessChangedLEDs(query);
+         else {
+            callLEDs = false;
+            changed = true;
          }
+      }
 
-         if (!logged || changed) {
-            PLOGI.printf("B2S polling status: lamps=%d, solenoids=%d, giStrings=%d, leds=%d", callLamps, callSolenoids, callGIStrings, callLEDs);
-
-            if (!callLamps && !callSolenoids && !callGIStrings && !callLEDs)
-               pTimer->Stop();
+      if (!logged || changed) {
+         PLOGI.printf("B2S polling status: lamps=%d, solenoids=%d, giStrings=%d, leds=%d", callLamps, callSolenoids, callGIStrings, callLEDs);
+         logged = true;
 
-            logged = true;
-         }
+         if (!callLamps && !callSolenoids && !callGIStrings && !callLEDs)
+            break;
       }
    }
 }
@@ -345,8 +375,8 @@ STDMETHODIMP Server::Run(VARIANT handle)
 
       VariantClear(&var0);
 
-      // start end timer
-      m_pTimer->Start();
+      // start processing controller state changes
+      StartUpdateThread();
    }
 
    return S_OK;
@@ -354,7 +384,7 @@ STDMETHODIMP Server::Run(VARIANT handle)
 
 STDMETHODIMP Server::Stop()
 {
-   m_pTimer->Stop();
+   StopUpdateThread();
    HideBackglassForm();
 
    m_pB2SData->Stop();
@@ -1427,6 +1457,8 @@ STDMETHODIMP Server::B2SMapSound(VARIANT digit, BSTR soundname)
    return S_OK;
 }
 
+// B2S has its own VPinMAME controller instance, which reads the changes shared with the script controller through its own
+// cursors, so polling from the update thread does not steal the changes the script is waiting for (and vice versa)
 HRESULT Server::GetChangedLamps(VARIANT *pRetVal)
 {
    HRESULT hres = m_pB2SData->GetVPinMAME()->get_ChangedLamps(pRetVal);
@@ -1508,6 +1540,124 @@ HRESULT Server::GetChangedLEDs(VARIANT mask2, VARIANT mask1, VARIANT mask3, VARI
    return hres;
 }
 
+// Without a controller notification there are no changes to query, but the collected data held back by the skip frames throttle may be due to be shown
+void Server::ProcessChangedLamps(const bool query)
+{
+   // plugins get the changes as a SAFEARRAY, so only take the allocation free path without them
+   if (m_pB2SSettings->ArePluginsOn()) {
+      VARIANT ret;
+      VariantInit(&ret);
+      GetChangedLamps(&ret);
+      VariantClear(&ret);
+      return;
+   }
+
+   int count = 0;
+   if (query)
+      count = m_pB2SData->GetVPinMAME()->GetChangedLampsState(m_changedStates.data(), (int)m_changedStates.size());
+   if (m_pB2SData->IsLampsData())
+      CheckLamps(m_changedStates.data(), count);
+}
+
+void Server::ProcessChangedSolenoids(const bool query)
+{
+   if (m_pB2SSettings->ArePluginsOn()) {
+      VARIANT ret;
+      VariantInit(&ret);
+      GetChangedSolenoids(&ret);
+      VariantClear(&ret);
+      return;
+   }
+
+   int count = 0;
+   if (query)
+      count = m_pB2SData->GetVPinMAME()->GetChangedSolenoidsState(m_changedStates.data(), (int)m_changedStates.size());
+   if (m_pB2SData->IsSolenoidsData())
+      CheckSolenoids(m_changedStates.data(), count);
+}
+
+void Server::ProcessChangedGIStrings(const bool query)
+{
+   if (m_pB2SSettings->ArePluginsOn()) {
+      VARIANT ret;
+      VariantInit(&ret);
+      GetChangedGIStrings(&ret);
+      VariantClear(&ret);
+      return;
+   }
+
+   int count = 0;
+   if (query)
+      count = m_pB2SData->GetVPinMAME()->GetChangedGIsState(m_changedStates.data(), (int)m_changedStates.size());
+   if (m_pB2SData->IsGIStringsData())
+      CheckGIStrings(m_changedStates.data(), count);
+}
+
+void Server::ProcessChangedLEDs(const bool query)
+{
+   if (m_pB2SSettings->ArePluginsOn()) {
+      VARIANT varMask1;
+      VariantInit(&varMask1);
+      V_VT(&varMask1) = VT_I4;
+      V_I4(&varMask1) = 0xFFFFFFFF;
+
+      VARIANT varMask2;
+      VariantInit(&varMask2);
+      V_VT(&varMask2) = VT_I4;
+      V_I4(&varMask2) = 0;
+
+      VARIANT ret;
+      VariantInit(&ret);
+      GetChangedLEDs(varMask1, varMask1, varMask2, varMask2, &ret);
+      VariantClear(&ret);
+      VariantClear(&varMask1);
+      VariantClear(&varMask2);
+      return;
+   }
+
+   int count = 0;
+   if (query)
+      count = m_pB2SData->GetVPinMAME()->GetChangedLEDsState(~0ull, 0, m_changedStates.data(), (int)m_changedStates.size());
+   if (m_pB2SData->IsLEDsData())
+      CheckLEDs(m_changedStates.data(), count, 3);
+}
+
+int Server::GetChangedStates(SAFEARRAY* psa, int valueIndex, vector<int>& states)
+{
+   if (!psa)
+      return 0;
+
+   LONG uCount = 0;
+   LONG lBound;
+   LONG uBound;
+
+   if (SUCCEEDED(SafeArrayGetLBound(psa, 1, &lBound))) {
+      if (SUCCEEDED(SafeArrayGetUBound(psa, 1, &uBound)))
+         uCount = uBound - lBound + 1;
+   }
+
+   states.resize(uCount * 2);
+
+   LONG ix[2];
+   VARIANT varValue;
+
+   for (ix[0] = 0; ix[0] < uCount; ix[0]++) {
+      ix[1] = 0;
+      VariantInit(&varValue);
+      SafeArrayGetElement(psa, ix, &varValue);
+      states[ix[0] * 2] = V_I4(&varValue);
+      VariantClear(&varValue);
+
+      ix[1] = valueIndex;
+      VariantInit(&varValue);
+      SafeArrayGetElement(psa, ix, &varValue);
+      states[ix[0] * 2 + 1] = V_I4(&varValue);
+      VariantClear(&varValue);
+   }
+
+   return uCount;
+}
+
 void Server::CheckGetMech(int number, int mech)
 {
    if (number > 0) {
@@ -1527,55 +1677,36 @@ void Server::CheckGetMech(int number, int mech)
 }
 
 void Server::CheckLamps(SAFEARRAY* psa)
+{
+   vector<int> states;
+   const int count = GetChangedStates(psa, 1, states);
+   CheckLamps(states.data(), count);
+}
+
+void Server::CheckLamps(const int* pStates, int count)
 {
    int lampId;
    bool lampState;
 
-   if (psa) {
-      LONG uCount = 0;
-      LONG lBound;
-      LONG uBound;
-
-      if (SUCCEEDED(SafeArrayGetLBound(psa, 1, &lBound))) {
-         if (SUCCEEDED(SafeArrayGetUBound(psa, 1, &uBound)))
-            uCount = uBound - lBound + 1;
-      }
-
-      LONG ix[2];
-      VARIANT varValue;
-
-      for (ix[0] = 0; ix[0] < uCount; ix[0]++) {
-         ix[1] = 0;
-         VariantInit(&varValue);
-         SafeArrayGetElement(psa, ix, &varValue);
-         lampId = V_I4(&varValue);
-         VariantClear(&varValue);
-
-         ix[1] = 1;
-         VariantInit(&varValue);
-         SafeArrayGetElement(psa, ix, &varValue);
-         lampState = (V_I4(&varValue) > m_lampThreshold);
-         VariantClear(&varValue);
-
-         if (m_pB2SData->IsUseRomLamps() || m_pB2SData->IsUseAnimationLamps()) {
-            // collect illumination data
-            if (m_pFormBackglass->GetTopRomIDType() == eRomIDType_Lamp && m_pFormBackglass->GetTopRomID() == lampId) 
-               m_pCollectLampsData->Add(lampId, new CollectData((int)lampState, eCollectedDataType_TopImage));
-            else if (m_pFormBackglass->GetSecondRomIDType() == eRomIDType_Lamp && m_pFormBackglass->GetSecondRomID() == lampId)
-               m_pCollectLampsData->Add(lampId, new CollectData((int)lampState, eCollectedDataType_SecondImage));
-            if (m_pB2SData->GetUsedRomLampIDs()->contains(lampId))
-               m_pCollectLampsData->Add(lampId, new CollectData((int)lampState, eCollectedDataType_Standard));
-
-            // collect animation data
-            if (m_pB2SData->GetUsedAnimationLampIDs()->contains(lampId) || m_pB2SData->GetUsedRandomAnimationLampIDs()->contains(lampId))
-               m_pCollectLampsData->Add(lampId, new CollectData((int)lampState, eCollectedDataType_Animation));
-         }
+   for (int i = 0; i < count; i++, pStates += 2) {
+      lampId = pStates[0];
+      lampState = (pStates[1] > m_lampThreshold);
+
+      if (m_pB2SData->IsUseRomLamps() || m_pB2SData->IsUseAnimationLamps()) {
+         // collect illumination data
+         if (m_pFormBackglass->GetTopRomIDType() == eRomIDType_Lamp && m_pFormBackglass->GetTopRomID() == lampId) 
+            m_pCollectLampsData->Add(lampId, new CollectData((int)lampState, eCollectedDataType_TopImage));
+         else if (m_pFormBackglass->GetSecondRomIDType() == eRomIDType_Lamp && m_pFormBackglass->GetSecondRomID() == lampId)
+            m_pCollectLampsData->Add(lampId, new CollectData((int)lampState, eCollectedDataType_SecondImage));
+         if (m_pB2SData->GetUsedRomLampIDs()->contains(lampId))
+            m_pCollectLampsData->Add(lampId, new CollectData((int)lampState, eCollectedDataType_Standard));
+
+         // collect animation data
+         if (m_pB2SData->GetUsedAnimationLampIDs()->contains(lampId) || m_pB2SData->GetUsedRandomAnimationLampIDs()->contains(lampId))
+            m_pCollectLampsData->Add(lampId, new CollectData((int)lampState, eCollectedDataType_Animation));
       }
    }
 
-   // one collection loop is done
-   m_pCollectLampsData->DataAdded();
-
    // maybe show the collected data
    if (m_pCollectLampsData->ShowData()) {
       m_pCollectLampsData->Lock();
@@ -1684,55 +1815,36 @@ void Server::CheckLamps(SAFEARRAY* psa)
 }
 
 void Server::CheckSolenoids(SAFEARRAY* psa)
+{
+   vector<int> states;
+   const int count = GetChangedStates(psa, 1, states);
+   CheckSolenoids(states.data(), count);
+}
+
+void Server::CheckSolenoids(const int* pStates, int count)
 {
    int solenoidId;
    int solenoidState;
 
-   if (psa) {
-      LONG uCount = 0;
-      LONG lBound;
-      LONG uBound;
-
-      if (SUCCEEDED(SafeArrayGetLBound(psa, 1, &lBound))) {
-         if (SUCCEEDED(SafeArrayGetUBound(psa, 1, &uBound)))
-            uCount = uBound - lBound + 1;
-      }
-
-      LONG ix[2];
-      VARIANT varValue;
-
-      for (ix[0] = 0; ix[0] < uCount; ix[0]++) {
-         ix[1] = 0;
-         VariantInit(&varValue);
-         SafeArrayGetElement(psa, ix, &varValue);
-         solenoidId = V_I4(&varValue);
-         VariantClear(&varValue);
-
-         ix[1] = 1;
-         VariantInit(&varValue);
-         SafeArrayGetElement(psa, ix, &varValue);
-         solenoidState = V_I4(&varValue);
-         VariantClear(&varValue);
-
-         if (m_pB2SData->IsUseRomSolenoids() || m_pB2SData->IsUseAnimationSolenoids()) {
-            // collect illumination data
-            if (m_pFormBackglass->GetTopRomIDType() == eRomIDType_Solenoid && m_pFormBackglass->GetTopRomID() == solenoidId)
-               m_pCollectSolenoidsData->Add(solenoidId, new CollectData(solenoidState, eCollectedDataType_TopImage));
-            else if (m_pFormBackglass->GetSecondRomIDType() == eRomIDType_Solenoid && m_pFormBackglass->GetSecondRomID() == solenoidId)
-               m_pCollectSolenoidsData->Add(solenoidId, new CollectData(solenoidState, eCollectedDataType_SecondImage));
-            if (m_pB2SData->GetUsedRomSolenoidIDs()->contains(solenoidId))
-               m_pCollectSolenoidsData->Add(solenoidId, new CollectData(solenoidState, eCollectedDataType_Standard));
-
-            // collect animation data
-            if (m_pB2SData->GetUsedAnimationSolenoidIDs()->contains(solenoidId) || m_pB2SData->GetUsedRandomAnimationSolenoidIDs()->contains(solenoidId))
-               m_pCollectSolenoidsData->Add(solenoidId, new CollectData(solenoidState, eCollectedDataType_Animation));
-         }
+   for (int i = 0; i < count; i++, pStates += 2) {
+      solenoidId = pStates[0];
+      solenoidState = pStates[1];
+
+      if (m_pB2SData->IsUseRomSolenoids() || m_pB2SData->IsUseAnimationSolenoids()) {
+         // collect illumination data
+         if (m_pFormBackglass->GetTopRomIDType() == eRomIDType_Solenoid && m_pFormBackglass->GetTopRomID() == solenoidId)
+            m_pCollectSolenoidsData->Add(solenoidId, new CollectData(solenoidState, eCollectedDataType_TopImage));
+         else if (m_pFormBackglass->GetSecondRomIDType() == eRomIDType_Solenoid && m_pFormBackglass->GetSecondRomID() == solenoidId)
+            m_pCollectSolenoidsData->Add(solenoidId, new CollectData(solenoidState, eCollectedDataType_SecondImage));
+         if (m_pB2SData->GetUsedRomSolenoidIDs()->contains(solenoidId))
+            m_pCollectSolenoidsData->Add(solenoidId, new CollectData(solenoidState, eCollectedDataType_Standard));
+
+         // collect animation data
+         if (m_pB2SData->GetUsedAnimationSolenoidIDs()->contains(solenoidId) || m_pB2SData->GetUsedRandomAnimationSolenoidIDs()->contains(solenoidId))
+            m_pCollectSolenoidsData->Add(solenoidId, new CollectData(solenoidState, eCollectedDataType_Animation));
       }
    }
 
-   // one collection loop is done
-   m_pCollectSolenoidsData->DataAdded();
-
    // maybe show the collected data
    if (m_pCollectSolenoidsData->ShowData()) {
       m_pCollectSolenoidsData->Lock();
@@ -1841,55 +1953,36 @@ void Server::CheckSolenoids(SAFEARRAY* psa)
 }
 
 void Server::CheckGIStrings(SAFEARRAY* psa)
+{
+   vector<int> states;
+   const int count = GetChangedStates(psa, 1, states);
+   CheckGIStrings(states.data(), count);
+}
+
+void Server::CheckGIStrings(const int* pStates, int count)
 {
    int giStringId;
    bool giStringBool;
 
-   if (psa) {
-      LONG uCount = 0;
-      LONG lBound;
-      LONG uBound;
-
-      if (SUCCEEDED(SafeArrayGetLBound(psa, 1, &lBound))) {
-         if (SUCCEEDED(SafeArrayGetUBound(psa, 1, &uBound)))
-            uCount = uBound - lBound + 1;
-      }
-
-      LONG ix[2];
-      VARIANT varValue;
-
-      for (ix[0] = 0; ix[0] < uCount; ix[0]++) {
-         ix[1] = 0;
-         VariantInit(&varValue);
-         SafeArrayGetElement(psa, ix, &varValue);
-         giStringId = V_I4(&varValue) + 1;
-         VariantClear(&varValue);
-
-         ix[1] = 1;
-         VariantInit(&varValue);
-         SafeArrayGetElement(psa, ix, &varValue);
-         giStringBool = (V_I4(&varValue) > m_giStringThreshold);
-         VariantClear(&varValue);
-
-         if (m_pB2SData->IsUseRomGIStrings() || m_pB2SData->IsUseAnimationGIStrings()) {
-            // collect illumination data
-            if (m_pFormBackglass->GetTopRomIDType() == eRomIDType_GIString && m_pFormBackglass->GetTopRomID() == giStringId)
-               m_pCollectGIStringsData->Add(giStringId, new CollectData((int)giStringBool, eCollectedDataType_TopImage));
-            else if (m_pFormBackglass->GetSecondRomIDType() == eRomIDType_GIString && m_pFormBackglass->GetSecondRomID() == giStringId)
-               m_pCollectGIStringsData->Add(giStringId, new CollectData((int)giStringBool, eCollectedDataType_SecondImage));
-            if (m_pB2SData->GetUsedRomGIStringIDs()->contains(giStringId))
-               m_pCollectGIStringsData->Add(giStringId, new CollectData((int)giStringBool, eCollectedDataType_Standard));
-
-            // collect animation data
-            if (m_pB2SData->GetUsedAnimationGIStringIDs()->contains(giStringId) || m_pB2SData->GetUsedRandomAnimationGIStringIDs()->contains(giStringId))
-               m_pCollectGIStringsData->Add(giStringId, new CollectData((int)giStringBool, eCollectedDataType_Animation));
-         }
+   for (int i = 0; i < count; i++, pStates += 2) {
+      giStringId = pStates[0] + 1;
+      giStringBool = (pStates[1] > m_giStringThreshold);
+
+      if (m_pB2SData->IsUseRomGIStrings() || m_pB2SData->IsUseAnimationGIStrings()) {
+         // collect illumination data
+         if (m_pFormBackglass->GetTopRomIDType() == eRomIDType_GIString && m_pFormBackglass->GetTopRomID() == giStringId)
+            m_pCollectGIStringsData->Add(giStringId, new CollectData((int)giStringBool, eCollectedDataType_TopImage));
+         else if (m_pFormBackglass->GetSecondRomIDType() == eRomIDType_GIString && m_pFormBackglass->GetSecondRomID() == giStringId)
+            m_pCollectGIStringsData->Add(giStringId, new CollectData((int)giStringBool, eCollectedDataType_SecondImage));
+         if (m_pB2SData->GetUsedRomGIStringIDs()->contains(giStringId))
+            m_pCollectGIStringsData->Add(giStringId, new CollectData((int)giStringBool, eCollectedDataType_Standard));
+
+         // collect animation data
+         if (m_pB2SData->GetUsedAnimationGIStringIDs()->contains(giStringId) || m_pB2SData->GetUsedRandomAnimationGIStringIDs()->contains(giStringId))
+            m_pCollectGIStringsData->Add(giStringId, new CollectData((int)giStringBool, eCollectedDataType_Animation));
       }
    }
 
-   // one collection loop is done
-   m_pCollectGIStringsData->DataAdded();
-
    // maybe show the collected data
    if (m_pCollectGIStringsData->ShowData()) {
       m_pCollectGIStringsData->Lock();
@@ -1998,45 +2091,26 @@ void Server::CheckGIStrings(SAFEARRAY* psa)
 }
 
 void Server::CheckLEDs(SAFEARRAY* psa)
+{
+   vector<int> states;
+   const int count = GetChangedStates(psa, 2, states);
+   CheckLEDs(states.data(), count, 2);
+}
+
+void Server::CheckLEDs(const int* pStates, int count, int stride)
 {
    int digit;
    int value;
 
-   if (psa) {
-      LONG uCount = 0;
-      LONG lBound;
-      LONG uBound;
+   for (int i = 0; i < count; i++, pStates += stride) {
+      digit = pStates[0];
+      value = pStates[stride - 1];
 
-      if (SUCCEEDED(SafeArrayGetLBound(psa, 1, &lBound))) {
-         if (SUCCEEDED(SafeArrayGetUBound(psa, 1, &uBound)))
-            uCount = uBound - lBound + 1;
-      }
-
-      LONG ix[2];
-      VARIANT varValue;
-
-      for (ix[0] = 0; ix[0] < uCount; ix[0]++) {
-         ix[1] = 0;
-         VariantInit(&varValue);
-         SafeArrayGetElement(psa, ix, &varValue);
-         digit = V_I4(&varValue);
-         VariantClear(&varValue);
-
-         ix[1] = 2;
-         VariantInit(&varValue);
-         SafeArrayGetElement(psa, ix, &varValue);
-         value = V_I4(&varValue);
-         VariantClear(&varValue);
-
-         // check whether leds are used
-         if (m_pB2SData->IsUseLEDs() || m_pB2SData->IsUseLEDDisplays() || m_pB2SData->IsUseReels())
-            m_pCollectLEDsData->Add(digit, new CollectData(value, 0));
-      }
+      // check whether leds are used
+      if (m_pB2SData->IsUseLEDs() || m_pB2SData->IsUseLEDDisplays() || m_pB2SData->IsUseReels())
+         m_pCollectLEDsData->Add(digit, new CollectData(value, 0));
    }
 
-   // one collection loop is done
-   m_pCollectLEDsData->DataAdded();
-
    // maybe show the collected data
    if (m_pCollectLEDsData->ShowData()) {
       bool useLEDs = m_pB2SData->IsUseLEDs() && m_pB2SSettings->GetUsedLEDType() == eLEDTypes_Rendered;
@@ -8,6 +8,10 @@
 #include "../common/Timer.h"
 #include "../common/Window.h"
 
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
 class Server : public IDispatch
 {
 public:
@@ -173,16 +177,27 @@ public:
    STDMETHOD(B2SMapSound)(VARIANT digit, BSTR soundname);
 
 private:
-   void TimerElapsed(VP::Timer* pTimer);
+   void StartUpdateThread();
+   void StopUpdateThread();
+   void UpdateThread();
+   void ProcessChangedLamps(const bool query);
+   void ProcessChangedSolenoids(const bool query);
+   void ProcessChangedGIStrings(const bool query);
+   void ProcessChangedLEDs(const bool query);
    HRESULT GetChangedLamps(VARIANT *pRetVal);
    HRESULT GetChangedSolenoids(VARIANT *pRetVal);
    HRESULT GetChangedGIStrings(VARIANT *pRetVal);
    HRESULT GetChangedLEDs(VARIANT mask2, VARIANT mask1, VARIANT mask3, VARIANT mask4, VARIANT *pRetVal);
    void CheckGetMech(int number, int mech);
+   static int GetChangedStates(SAFEARRAY* psa, int valueIndex, vector<int>& states);
    void CheckLamps(SAFEARRAY* psa);
+   void CheckLamps(const int* pStates, int count);
    void CheckSolenoids(SAFEARRAY* psa);
+   void CheckSolenoids(const int* pStates, int count);
    void CheckGIStrings(SAFEARRAY* psa);
+   void CheckGIStrings(const int* pStates, int count);
    void CheckLEDs(SAFEARRAY* psa);
+   void CheckLEDs(const int* pStates, int count, int stride);
    void MyB2SSetData(int id, int value);
    void MyB2SSetData(const string& groupname, int value);
    void MyB2SSetLED(int digit, int value);
@@ -225,7 +240,12 @@ private:
    B2SCollectData* m_pCollectGIStringsData;
    B2SCollectData* m_pCollectLEDsData;
    string m_szPath;
-   VP::Timer* m_pTimer;
+   std::thread* m_pUpdateThread;
+   std::mutex m_updateMutex;
+   std::condition_variable m_updateCondition;
+   bool m_updateThreadRunning;
+   bool m_stateChanged;
+   vector<int> m_changedStates;
 
    ULONG m_dwRef = 0;
 };
@@ -5,7 +5,7 @@
 
 B2SCollectData::B2SCollectData(int skipFrames)
 {
-   m_skipFrames = skipFrames;
+   m_showTime = std::chrono::steady_clock::now() + GetThrottle(skipFrames);
 }
 
 bool B2SCollectData::Add(int key, CollectData* pCollectData)
@@ -30,24 +30,30 @@ bool B2SCollectData::Add(int key, CollectData* pCollectData)
    return ret;
 }
 
-void B2SCollectData::DataAdded()
+bool B2SCollectData::ShowData()
 {
-   m_skipFrames--;
-}
+   m_mutex.lock();
+   const bool show = !empty() && std::chrono::steady_clock::now() >= m_showTime;
+   m_mutex.unlock();
 
-bool B2SCollectData::ShowData() const
-{
-   return (m_skipFrames < 0);
+   return show;
 }
 
 void B2SCollectData::ClearData(int skipFrames)
 {
    m_mutex.lock();
    clear();
+   m_showTime = std::chrono::steady_clock::now() + GetThrottle(skipFrames);
+   m_mutex.unlock();
+}
+
+std::chrono::steady_clock::time_point B2SCollectData::GetShowTime()
+{
+   m_mutex.lock();
+   const auto showTime = empty() ? std::chrono::steady_clock::time_point::max() : m_showTime;
    m_mutex.unlock();
 
-   if (m_skipFrames <= 0)
-      m_skipFrames = skipFrames;
+   return showTime;
 }
 
 void B2SCollectData::Lock()
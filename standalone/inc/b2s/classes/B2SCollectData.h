@@ -1,24 +1,30 @@
 #pragma once
 
+#include <chrono>
 #include <map>
 #include <mutex>
 
 class CollectData;
 
+// Changes collected for one kind of outputs, shown at most once per skip frames period.
+// The skip frames settings count ticks of the former 37ms polling timer, and are applied as a time based throttle.
 class B2SCollectData : public std::map<int, CollectData*>
 {
 public:
    B2SCollectData(int skipFrames);
 
    bool Add(int key, CollectData* pCollectData);
-   void DataAdded();
-   bool ShowData() const;
+   bool ShowData();
    void ClearData(int skipFrames);
+   // Time at which the collected data is due to be shown, or time_point::max() if nothing is collected
+   std::chrono::steady_clock::time_point GetShowTime();
 
    void Lock();
    void Unlock();
 
 private:
-   int m_skipFrames;
+   static std::chrono::steady_clock::duration GetThrottle(int skipFrames) { return std::chrono::milliseconds(37) * (skipFrames > 0 ? skipFrames : 0); }
+
+   std::chrono::steady_clock::time_point m_showTime; // collected data is held back until this time
    std::mutex m_mutex;
 };
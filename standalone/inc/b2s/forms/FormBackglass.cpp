@@ -18,6 +18,107 @@
 
 #include <SDL3_image/SDL_image.h>
 #include "tinyxml2/tinyxml2.h"
+#include "ThreadPool.h"
+
+static constexpr uint32_t B2S_CACHE_MAGIC = 0x43533242u; // 'B2SC'
+static constexpr uint32_t B2S_CACHE_VERSION = 1u;
+
+// Collect all base64 encoded image attributes of the directb2s file, in document order
+static void CollectImageAttributes(const tinyxml2::XMLElement* pNode, vector<const char*>& images)
+{
+   for (auto pElement = pNode->FirstChildElement(); pElement != nullptr; pElement = pElement->NextSiblingElement()) {
+      const string elementName = pElement->Name();
+      const bool isBackglassImage = (elementName == "BackglassOffImage" || elementName == "BackglassOnImage" || elementName == "BackglassImage" || elementName == "DMDImage");
+      for (auto pAttribute = pElement->FirstAttribute(); pAttribute != nullptr; pAttribute = pAttribute->Next()) {
+         const char* const name = pAttribute->Name();
+         if (strcmp(name, "Image") == 0 || strcmp(name, "OffImage") == 0 || strncmp(name, "IntermediateImage", 17) == 0 || (isBackglassImage && strcmp(name, "Value") == 0))
+            images.push_back(pAttribute->Value());
+      }
+      CollectImageAttributes(pElement, images);
+   }
+}
+
+// Disk cache of decoded surfaces: a list of named raw surfaces.
+// The file is not trusted: any value out of the expected bounds is treated as a cache miss, falling back to decoding the images.
+static bool LoadSurfaceCache(const string& szFilename, std::unordered_map<string, SDL_Surface*>& surfaces)
+{
+   constexpr uint32_t maxKeyLength = 4096;
+   constexpr int32_t maxSurfaceSize = 16384;
+   std::ifstream file(szFilename, std::ios::binary | std::ios::ate);
+   if (!file.is_open())
+      return false;
+   const int64_t fileSize = (int64_t)file.tellg();
+   file.seekg(0);
+   const auto remaining = [&file, fileSize]() { return fileSize - (int64_t)file.tellg(); };
+   uint32_t header[3];
+   if (!file.read((char*)header, sizeof(header)) || header[0] != B2S_CACHE_MAGIC || header[1] != B2S_CACHE_VERSION)
+      return false;
+   for (uint32_t i = 0; i < header[2]; i++) {
+      uint32_t keyLength;
+      int32_t desc[4]; // width, height, pixel format, pitch
+      if (!file.read((char*)&keyLength, sizeof(keyLength)) || keyLength > maxKeyLength || (int64_t)keyLength > remaining())
+         break;
+      string key(keyLength, '\0');
+      if (!file.read(key.data(), keyLength) || !file.read((char*)desc, sizeof(desc)))
+         break;
+      const int32_t width = desc[0], height = desc[1], pitch = desc[3];
+      const SDL_PixelFormat format = (SDL_PixelFormat)desc[2];
+      if (width <= 0 || height <= 0 || width > maxSurfaceSize || height > maxSurfaceSize || SDL_ISPIXELFORMAT_FOURCC(format))
+         break;
+      const SDL_PixelFormatDetails* const pDetails = SDL_GetPixelFormatDetails(format);
+      if (!pDetails || pDetails->bytes_per_pixel == 0)
+         break;
+      const int32_t rowLength = width * pDetails->bytes_per_pixel;
+      if (pitch < rowLength || pitch > rowLength + 64 || (int64_t)pitch * height > remaining())
+         break;
+      SDL_Surface* const pSurface = SDL_CreateSurface(width, height, format);
+      if (!pSurface)
+         break;
+      bool ok = true;
+      for (int y = 0; ok && y < height; y++)
+         ok = file.read((char*)pSurface->pixels + y * pSurface->pitch, rowLength) && file.seekg(pitch - rowLength, std::ios::cur);
+      if (!ok) {
+         SDL_DestroySurface(pSurface);
+         break;
+      }
+      const auto existing = surfaces.find(key);
+      if (existing != surfaces.end()) {
+         SDL_DestroySurface(existing->second);
+         existing->second = pSurface;
+      }
+      else
+         surfaces[key] = pSurface;
+   }
+   if (surfaces.size() != header[2] || remaining() != 0) {
+      for (auto& [key, pSurface] : surfaces)
+         SDL_DestroySurface(pSurface);
+      surfaces.clear();
+      return false;
+   }
+   return true;
+}
+
+static void SaveSurfaceCache(const string& szFilename, const vector<std::pair<string, SDL_Surface*>>& surfaces)
+{
+   try {
+      std::filesystem::create_directories(std::filesystem::path(szFilename).parent_path());
+      std::ofstream file(szFilename, std::ios::binary | std::ios::trunc);
+      const uint32_t header[3] = { B2S_CACHE_MAGIC, B2S_CACHE_VERSION, (uint32_t)surfaces.size() };
+      file.write((const char*)header, sizeof(header));
+      for (const auto& [key, pSurface] : surfaces) {
+         const uint32_t keyLength = (uint32_t)key.length();
+         const int32_t desc[4] = { pSurface->w, pSurface->h, (int32_t)pSurface->format, pSurface->pitch };
+         file.write((const char*)&keyLength, sizeof(keyLength));
+         file.write(key.data(), keyLength);
+         file.write((const char*)desc, sizeof(desc));
+         file.write((const char*)pSurface->pixels, (std::streamsize)pSurface->pitch * pSurface->h);
+      }
+      PLOGI.printf("directb2s image cache saved to: %s", szFilename.c_str());
+   }
+   catch (...) {
+      PLOGE.printf("Failed to save directb2s image cache to: %s", szFilename.c_str());
+   }
+}
 
 FormBackglass::FormBackglass()
 {
@@ -386,6 +487,18 @@ void FormBackglass::LoadB2SData()
 
       auto topnode = b2sTree.FirstChildElement("DirectB2SData");
 
+      // decode all images upfront, or get them from the disk cache (keyed on the file hash)
+      string szCacheFilename;
+      if (g_pplayer->m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "CacheMode"s, 1) > 0) {
+         uint8_t md5[16];
+         generateMD5((const uint8_t*)xml.data(), xml.size(), md5);
+         char key[33];
+         for (int i = 0; i < 16; i++)
+            snprintf(key + i * 2, 3, "%02x", md5[i]);
+         szCacheFilename = g_pvp->m_szMyPrefPath + "Cache" + PATH_SEPARATOR_CHAR + "B2S" + PATH_SEPARATOR_CHAR + key + ".cache";
+      }
+      PreloadImages(topnode, szCacheFilename);
+
       bool mergeBulbs = true;
       if (topnode->FirstChildElement("MergeBulbs"))
          mergeBulbs = (topnode->FirstChildElement("MergeBulbs")->IntAttribute("Value") != 0);
@@ -1219,11 +1332,60 @@ void FormBackglass::LoadB2SData()
          }
       }
 
+      if (m_saveSurfaceCache)
+         SaveSurfaceCache(szCacheFilename, m_surfacesToCache);
+
       m_pB2SData->SetValid(true);
    }
 
    catch (...) {
    }
+
+   // release preloaded images that were not used
+   for (auto& [pAttribute, pSurface] : m_preloadedImages)
+      SDL_DestroySurface(pSurface);
+   m_preloadedImages.clear();
+   for (auto& [key, pSurface] : m_cachedSurfaces)
+      SDL_DestroySurface(pSurface);
+   m_cachedSurfaces.clear();
+   m_surfacesToCache.clear();
+   m_saveSurfaceCache = false;
+}
+
+void FormBackglass::PreloadImages(tinyxml2::XMLElement* pTopNode, const string& szCacheFilename)
+{
+   vector<const char*> images;
+   CollectImageAttributes(pTopNode, images);
+
+   if (!szCacheFilename.empty() && LoadSurfaceCache(szCacheFilename, m_cachedSurfaces)) {
+      PLOGI.printf("directb2s image cache found at: %s", szCacheFilename.c_str());
+      for (size_t i = 0; i < images.size(); i++) {
+         auto it = m_cachedSurfaces.find('I' + std::to_string(i));
+         if (it != m_cachedSurfaces.end()) {
+            m_preloadedImages[images[i]] = it->second;
+            m_cachedSurfaces.erase(it);
+         }
+      }
+      return;
+   }
+
+   vector<SDL_Surface*> surfaces(images.size(), nullptr);
+   {
+      ThreadPool pool(g_pvp->GetLogicalNumberOfProcessors());
+      for (size_t i = 0; i < images.size(); i++)
+         pool.enqueue([i, &images, &surfaces] { surfaces[i] = DecodeBase64Image(images[i]); });
+      pool.wait_until_empty();
+      pool.wait_until_nothing_in_flight();
+   }
+
+   m_saveSurfaceCache = !szCacheFilename.empty();
+   for (size_t i = 0; i < images.size(); i++) {
+      if (!surfaces[i])
+         continue;
+      m_preloadedImages[images[i]] = surfaces[i];
+      if (m_saveSurfaceCache)
+         m_surfacesToCache.emplace_back('I' + std::to_string(i), surfaces[i]);
+   }
 }
 
 void FormBackglass::InitB2SScreen()
@@ -1364,15 +1526,41 @@ void FormBackglass::RotateImage(B2SPictureBox* pPicbox, int rotationsteps, eSnip
       m_rotateAngle = 360 / rotationsteps;
       //assert(360%rotationsteps == 0);
 
-      // rotate the image the whole circle
-      int rotatingAngle = 0;
-      int index = 0;
-      while (rotatingAngle < 360) {
-         SDL_Surface* pImage = RotateSurface(pPicbox->GetBackgroundImage(), rotationdirection == eSnippitRotationDirection_AntiClockwise ? rotatingAngle : 360 - rotatingAngle);
-         (*m_pB2SData->GetRotatingImages())[romid][pPicbox->GetPictureBoxType() == ePictureBoxType_MechRotatingImage ? index : rotatingAngle] = pImage;
-         rotatingAngle += m_rotateAngle;
-         index++;
+      // rotate the image the whole circle (getting rotated images from the disk cache or computing them in parallel)
+      vector<int> angles;
+      for (int rotatingAngle = 0; rotatingAngle < 360; rotatingAngle += m_rotateAngle)
+         angles.push_back(rotatingAngle);
+      vector<SDL_Surface*> images(angles.size(), nullptr);
+      vector<size_t> toRotate;
+      for (size_t index = 0; index < angles.size(); index++) {
+         auto it = m_cachedSurfaces.find('R' + pPicbox->GetName() + '_' + std::to_string(angles[index]));
+         if (it != m_cachedSurfaces.end()) {
+            images[index] = it->second;
+            m_cachedSurfaces.erase(it);
+         }
+         else
+            toRotate.push_back(index);
+      }
+      if (!toRotate.empty()) {
+         SDL_Surface* const pSource = pPicbox->GetBackgroundImage();
+         SDL_LockSurface(pSource);
+         {
+            ThreadPool pool(g_pvp->GetLogicalNumberOfProcessors());
+            for (const size_t index : toRotate)
+               pool.enqueue([index, pSource, rotationdirection, &angles, &images] {
+                  images[index] = RotateLockedSurface(pSource, rotationdirection == eSnippitRotationDirection_AntiClockwise ? angles[index] : 360 - angles[index]);
+               });
+            pool.wait_until_empty();
+            pool.wait_until_nothing_in_flight();
+         }
+         SDL_UnlockSurface(pSource);
+         if (m_saveSurfaceCache) {
+            for (const size_t index : toRotate)
+               m_surfacesToCache.emplace_back('R' + pPicbox->GetName() + '_' + std::to_string(angles[index]), images[index]);
+         }
       }
+      for (size_t index = 0; index < angles.size(); index++)
+         (*m_pB2SData->GetRotatingImages())[romid][pPicbox->GetPictureBoxType() == ePictureBoxType_MechRotatingImage ? (int)index : angles[index]] = images[index];
    }
 }
 
@@ -1466,7 +1654,13 @@ void FormBackglass::CheckBulbs(int romid, eRomIDType romidtype, bool rominverted
 SDL_Surface* FormBackglass::RotateSurface(SDL_Surface* source, int angle)
 {
    SDL_LockSurface(source);
+   SDL_Surface* const destination = RotateLockedSurface(source, angle);
+   SDL_UnlockSurface(source);
+   return destination;
+}
 
+SDL_Surface* FormBackglass::RotateLockedSurface(SDL_Surface* source, int angle)
+{
    SDL_Surface* const destination = SDL_CreateSurface(source->w, source->h, source->format);
 
    const float radians = -(float)angle * (float)(M_PI / 180.0);
@@ -1494,8 +1688,6 @@ SDL_Surface* FormBackglass::RotateSurface(SDL_Surface* source, int angle)
       }
    }
 
-   SDL_UnlockSurface(source);
-
    return destination;
 }
 
@@ -1510,7 +1702,22 @@ SDL_Surface* FormBackglass::ResizeSurface(SDL_Surface* original, int newWidth, i
     return newSurface;
 }
 
-SDL_Surface* FormBackglass::Base64ToImage(const string& image)
+SDL_Surface* FormBackglass::Base64ToImage(const char* image)
+{
+   if (!image)
+      return NULL;
+
+   auto it = m_preloadedImages.find(image);
+   if (it != m_preloadedImages.end()) {
+      SDL_Surface* const pImage = it->second;
+      m_preloadedImages.erase(it);
+      return pImage;
+   }
+
+   return DecodeBase64Image(image);
+}
+
+SDL_Surface* FormBackglass::DecodeBase64Image(const string& image)
 {
    vector<unsigned char> imageData = base64_decode(image);
    SDL_IOStream* rwops = SDL_IOFromConstMem(imageData.data(), imageData.size());
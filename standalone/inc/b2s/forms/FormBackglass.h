@@ -8,6 +8,7 @@
 class B2SScreen;
 class B2SAnimation;
 class FormDMD;
+namespace tinyxml2 { class XMLElement; }
 
 class FormBackglass : public Form
 {
@@ -60,6 +61,7 @@ private:
    void RotateTimerTick(VP::Timer* pTimer);
    eLEDTypes GetLEDType();
    void LoadB2SData();
+   void PreloadImages(tinyxml2::XMLElement* pTopNode, const string& szCacheFilename);
    void InitB2SScreen();
    void ResizeSomeImages();
    void ShowStartupSnippits();
@@ -71,11 +73,13 @@ private:
    SDL_Surface* CreateLightImage(SDL_Surface* image, eDualMode dualmode, const string& firstromkey_, const string& secondromkey_);
    SDL_Surface* CreateLightImage(SDL_Surface* image, eDualMode dualmode, const string& firstromkey_, const string& secondromkey_, int& romid, eRomIDType& romidtype, bool& rominverted);
    void CheckBulbs(int romid, eRomIDType romidtype, bool rominverted, eDualMode dualmode);
-   SDL_Surface* Base64ToImage(const string& image);
+   SDL_Surface* Base64ToImage(const char* image);
+   static SDL_Surface* DecodeBase64Image(const string& image);
    Sound* Base64ToWav(const string& data);
    OLE_COLOR String2Color(const string& color);
    SDL_Surface* ResizeSurface(SDL_Surface* original, int newWidth, int newHeight);
    SDL_Surface* RotateSurface(SDL_Surface* source, int angle);
+   static SDL_Surface* RotateLockedSurface(SDL_Surface* source, int angle);
 
    static constexpr int minSize4Image = 300000;
 
@@ -112,4 +116,10 @@ private:
    int m_secondRomID4Fantasy;
    eRomIDType m_secondRomIDType4Fantasy;
    bool m_secondRomInverted4Fantasy;
+
+   // Images are decoded in parallel (or loaded from the disk cache) before parsing the directb2s file, keyed on their base64 attribute
+   std::unordered_map<const char*, SDL_Surface*> m_preloadedImages;
+   std::unordered_map<string, SDL_Surface*> m_cachedSurfaces;
+   vector<std::pair<string, SDL_Surface*>> m_surfacesToCache;
+   bool m_saveSurfaceCache = false;
 };
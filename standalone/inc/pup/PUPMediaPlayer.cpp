@@ -17,6 +17,83 @@
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
 #endif
 
+#ifdef VIDEO_WINDOW_HAS_FFMPEG_LIBS
+PUPFrameQueue::PUPFrameQueue()
+{
+   memset(m_frames, 0, sizeof(m_frames));
+   m_read = 0;
+   m_write = 0;
+}
+
+PUPFrameQueue::~PUPFrameQueue()
+{
+   Clear();
+}
+
+bool PUPFrameQueue::Push(AVFrame* pFrame)
+{
+   const unsigned int write = m_write.load(std::memory_order_relaxed);
+   if (write - m_read.load(std::memory_order_acquire) >= CAPACITY)
+      return false;
+
+   m_frames[write % CAPACITY] = pFrame;
+   m_write.store(write + 1, std::memory_order_release);
+   return true;
+}
+
+AVFrame* PUPFrameQueue::Pop()
+{
+   unsigned int read = m_read.load(std::memory_order_relaxed);
+   while (read != m_write.load(std::memory_order_acquire)) {
+      AVFrame* pFrame = m_frames[read % CAPACITY];
+      if (m_read.compare_exchange_weak(read, read + 1, std::memory_order_acq_rel, std::memory_order_relaxed))
+         return pFrame;
+   }
+   return NULL;
+}
+
+AVFrame* PUPFrameQueue::PopLatest()
+{
+   // only the most recent frame is worth uploading, older ones would be overdrawn before the next display refresh
+   AVFrame* pLatest = NULL;
+   while (AVFrame* pFrame = Pop()) {
+      if (pLatest)
+         av_frame_free(&pLatest);
+      pLatest = pFrame;
+   }
+   return pLatest;
+}
+
+void PUPFrameQueue::Clear()
+{
+   while (AVFrame* pFrame = Pop())
+      av_frame_free(&pFrame);
+}
+
+#ifdef VIDEO_WINDOW_HAS_VAAPI
+// One hardware device is shared by the decoders of all PUP screens
+static std::mutex s_hwDeviceMutex;
+static AVBufferRef* s_pHWDeviceContext = NULL;
+static bool s_hwDeviceUnavailable = false;
+
+static AVBufferRef* AcquireHardwareDevice()
+{
+   std::lock_guard<std::mutex> lock(s_hwDeviceMutex);
+   if (!s_pHWDeviceContext && !s_hwDeviceUnavailable) {
+      if (av_hwdevice_ctx_create(&s_pHWDeviceContext, AV_HWDEVICE_TYPE_VAAPI, NULL, NULL, 0) < 0) {
+         PLOGI.printf("VAAPI device not available, using software decoding");
+         s_pHWDeviceContext = NULL;
+         s_hwDeviceUnavailable = true;
+      }
+      else {
+         PLOGI.printf("VAAPI device created");
+      }
+   }
+   return s_pHWDeviceContext ? av_buffer_ref(s_pHWDeviceContext) : NULL;
+}
+#endif
+#endif
+
 PUPMediaPlayer::PUPMediaPlayer()
 {
    m_loop = false;
@@ -30,12 +107,14 @@ PUPMediaPlayer::PUPMediaPlayer()
    m_pVideoContext = NULL;
    m_pVideoConversionContext = NULL;
    m_videoFormat = SDL_PIXELFORMAT_UNKNOWN;
+   m_videoColorspace = SDL_COLORSPACE_UNKNOWN;
    m_videoWidth = 0;
    m_videoHeight = 0;
    m_audioStream = -1;
    m_pAudioContext = NULL;
    m_pAudioConversionContext = NULL;
    m_audioFormat = AV_SAMPLE_FMT_NONE;
+   m_hardwareDecoding = false;
 #endif
    m_pAudioPlayer = new AudioPlayer();
    m_pAudioPlayer->StreamInit(44100, 2, 0.0f);
@@ -93,6 +172,7 @@ void PUPMediaPlayer::Play(const string& szFilename)
       avcodec_free_context(&m_pVideoContext);
 
    m_videoFormat = SDL_PIXELFORMAT_UNKNOWN;
+   m_videoColorspace = SDL_COLORSPACE_UNKNOWN;
    m_videoWidth = 0;
    m_videoHeight = 0;
 
@@ -103,6 +183,8 @@ void PUPMediaPlayer::Play(const string& szFilename)
 
    m_audioFormat = AV_SAMPLE_FMT_NONE;
 
+   m_hardwareDecoding = g_pplayer->m_ptable->m_settings.LoadValueWithDefault(Settings::Standalone, "PUPHardwareDecoding"s, true);
+
    // Open file
 
    if (avformat_open_input(&m_pFormatContext, szFilename.c_str(), NULL, NULL) != 0) {
@@ -208,14 +290,7 @@ void PUPMediaPlayer::Stop()
       m_thread.join();
 
 #ifdef VIDEO_WINDOW_HAS_FFMPEG_LIBS
-   {
-      std::lock_guard<std::mutex> lock(m_mutex);
-      while (!m_queue.empty()) {
-         AVFrame* pFrame = m_queue.front();
-         av_frame_free(&pFrame);
-         m_queue.pop();
-      }
-   }
+   m_frameQueue.Clear();
 #endif
 }
 
@@ -311,11 +386,21 @@ void PUPMediaPlayer::Run()
             pts -= videoFirstPTS;
 
             if (pRenderer) {
-               AVFrame* pClonedFrame = av_frame_clone(pFrame);
-               if (pClonedFrame) {
-                  std::lock_guard<std::mutex> lock(m_mutex);
-                  m_queue.push(pClonedFrame);
+               AVFrame* pQueuedFrame = NULL;
+               if (pFrame->hw_frames_ctx) {
+                  // download the decoded surface once (usually as NV12), the planes are then uploaded as is
+                  pQueuedFrame = av_frame_alloc();
+                  if (pQueuedFrame && (av_hwframe_transfer_data(pQueuedFrame, pFrame, 0) < 0 || av_frame_copy_props(pQueuedFrame, pFrame) < 0)) {
+                     PLOGE.printf("Unable to transfer hardware frame");
+                     av_frame_free(&pQueuedFrame);
+                  }
                }
+               else
+                  pQueuedFrame = av_frame_clone(pFrame);
+
+               // drop the frame if the renderer does not keep up (hidden window, stalled display)
+               if (pQueuedFrame && !m_frameQueue.Push(pQueuedFrame))
+                  av_frame_free(&pQueuedFrame);
             }
 
             if (!videoStart)
@@ -389,28 +474,27 @@ void PUPMediaPlayer::SetVolume(float volume)
 void PUPMediaPlayer::Render(const SDL_Rect& destRect)
 {
 #ifdef VIDEO_WINDOW_HAS_FFMPEG_LIBS
-   AVFrame* pFrame = NULL;
-
-   {
-      std::lock_guard<std::mutex> lock(m_mutex);
-      if (!m_queue.empty()) {
-         pFrame = m_queue.front();
-         m_queue.pop();
-      }
-   }
+   AVFrame* pFrame = m_frameQueue.PopLatest();
 
    if (pFrame) {
       SDL_PixelFormat format = GetVideoFormat((enum AVPixelFormat)pFrame->format);
-      if (!m_pTexture || format != m_videoFormat || pFrame->width != m_videoWidth || pFrame->height != m_videoHeight) {
+      SDL_Colorspace colorspace = GetFrameColorspace(pFrame);
+      if (!m_pTexture || format != m_videoFormat || colorspace != m_videoColorspace || pFrame->width != m_videoWidth || pFrame->height != m_videoHeight) {
          if (m_pTexture)
              SDL_DestroyTexture(m_pTexture);
 
-         if (format == SDL_PIXELFORMAT_UNKNOWN)
-            m_pTexture = SDL_CreateTexture(m_pRenderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, pFrame->width,pFrame->height);
-         else
-            m_pTexture = SDL_CreateTexture(m_pRenderer, format, SDL_TEXTUREACCESS_STREAMING, pFrame->width, pFrame->height);
+         // YUV formats are uploaded plane by plane and converted by the renderer using the frame colorspace
+         SDL_PropertiesID props = SDL_CreateProperties();
+         SDL_SetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_FORMAT_NUMBER, format == SDL_PIXELFORMAT_UNKNOWN ? SDL_PIXELFORMAT_ARGB8888 : format);
+         SDL_SetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_COLORSPACE_NUMBER, format == SDL_PIXELFORMAT_UNKNOWN ? SDL_COLORSPACE_SRGB : colorspace);
+         SDL_SetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_ACCESS_NUMBER, SDL_TEXTUREACCESS_STREAMING);
+         SDL_SetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_WIDTH_NUMBER, pFrame->width);
+         SDL_SetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_HEIGHT_NUMBER, pFrame->height);
+         m_pTexture = SDL_CreateTextureWithProperties(m_pRenderer, props);
+         SDL_DestroyProperties(props);
 
          m_videoFormat = format;
+         m_videoColorspace = colorspace;
          m_videoWidth = pFrame->width;
          m_videoHeight = pFrame->height;
       }
@@ -442,7 +526,17 @@ void PUPMediaPlayer::Render(const SDL_Rect& destRect)
                   pFrame->data[2] + pFrame->linesize[2] * (AV_CEIL_RSHIFT(pFrame->height, 1) - 1), -pFrame->linesize[2]);
                flip = SDL_FLIP_VERTICAL;
             }
-            SetYUVConversionMode(pFrame);
+            break;
+         case SDL_PIXELFORMAT_NV12:
+         case SDL_PIXELFORMAT_NV21:
+            if (pFrame->linesize[0] > 0 && pFrame->linesize[1] > 0) {
+               SDL_UpdateNVTexture(m_pTexture, NULL, pFrame->data[0], pFrame->linesize[0], pFrame->data[1], pFrame->linesize[1]);
+            }
+            else if (pFrame->linesize[0] < 0 && pFrame->linesize[1] < 0) {
+               SDL_UpdateNVTexture(m_pTexture, NULL, pFrame->data[0] + pFrame->linesize[0] * (pFrame->height - 1), -pFrame->linesize[0],
+                  pFrame->data[1] + pFrame->linesize[1] * (AV_CEIL_RSHIFT(pFrame->height, 1) - 1), -pFrame->linesize[1]);
+               flip = SDL_FLIP_VERTICAL;
+            }
             break;
          default:
             if (pFrame->linesize[0] < 0) {
@@ -488,6 +582,26 @@ AVCodecContext* PUPMediaPlayer::OpenStream(AVFormatContext* pInputFormatContext,
    }
 
    pContext->codec_id = pCodec->id;
+
+#ifdef VIDEO_WINDOW_HAS_VAAPI
+   if (m_hardwareDecoding && pContext->codec_type == AVMEDIA_TYPE_VIDEO) {
+      for (int i = 0;; i++) {
+         const AVCodecHWConfig* pConfig = avcodec_get_hw_config(pCodec, i);
+         if (!pConfig)
+            break;
+
+         if ((pConfig->methods & AV_CODEC_HW_CONFIG_METHOD_HW_DEVICE_CTX) && pConfig->device_type == AV_HWDEVICE_TYPE_VAAPI) {
+            pContext->hw_device_ctx = AcquireHardwareDevice();
+            if (pContext->hw_device_ctx) {
+               pContext->get_format = &PUPMediaPlayer::GetHardwareFormat;
+               PLOGD.printf("Using VAAPI for %s", avcodec_get_name(pContext->codec_id));
+            }
+            break;
+         }
+      }
+   }
+#endif
+
    if (avcodec_open2(pContext, pCodec, NULL) != 0) {
       PLOGE.printf("Couldn't open codec %s", avcodec_get_name(pContext->codec_id));
       avcodec_free_context(&pContext);
@@ -582,27 +696,44 @@ SDL_PixelFormat PUPMediaPlayer::GetVideoFormat(enum AVPixelFormat format)
       case AV_PIX_FMT_BGR32: return SDL_PIXELFORMAT_ABGR8888;
       case AV_PIX_FMT_BGR32_1: return SDL_PIXELFORMAT_BGRA8888;
       case AV_PIX_FMT_YUV420P: return SDL_PIXELFORMAT_IYUV;
+      case AV_PIX_FMT_YUVJ420P: return SDL_PIXELFORMAT_IYUV;
+      case AV_PIX_FMT_NV12: return SDL_PIXELFORMAT_NV12;
+      case AV_PIX_FMT_NV21: return SDL_PIXELFORMAT_NV21;
       case AV_PIX_FMT_YUYV422: return SDL_PIXELFORMAT_YUY2;
       case AV_PIX_FMT_UYVY422: return SDL_PIXELFORMAT_UYVY;
       default: return SDL_PIXELFORMAT_UNKNOWN;
    }
 }
 
-void PUPMediaPlayer::SetYUVConversionMode(AVFrame *frame)
+SDL_Colorspace PUPMediaPlayer::GetFrameColorspace(AVFrame* pFrame)
+{
+   // https://github.com/libsdl-org/SDL/blob/main/test/testffmpeg.c
+   if (pFrame->colorspace == AVCOL_SPC_RGB)
+      return SDL_COLORSPACE_SRGB;
+
+   return SDL_DEFINE_COLORSPACE(SDL_COLOR_TYPE_YCBCR,
+      pFrame->color_range,
+      pFrame->color_primaries,
+      pFrame->color_trc,
+      pFrame->colorspace,
+      pFrame->chroma_location);
+}
+
+enum AVPixelFormat PUPMediaPlayer::GetHardwareFormat(AVCodecContext* pContext, const enum AVPixelFormat* pFormats)
 {
-   // JSM174 - Switch to Colorspace - https://github.com/libsdl-org/SDL/blob/main/test/testffmpeg.c
-   /*
-   SDL_YUV_CONVERSION_MODE mode = SDL_YUV_CONVERSION_AUTOMATIC;
-   if (frame && (frame->format == AV_PIX_FMT_YUV420P || frame->format == AV_PIX_FMT_YUYV422 || frame->format == AV_PIX_FMT_UYVY422)) {
-      if (frame->color_range == AVCOL_RANGE_JPEG)
-         mode = SDL_YUV_CONVERSION_JPEG;
-      else if (frame->colorspace == AVCOL_SPC_BT709)
-         mode = SDL_YUV_CONVERSION_BT709;
-      else if (frame->colorspace == AVCOL_SPC_BT470BG || frame->colorspace == AVCOL_SPC_SMPTE170M)
-         mode = SDL_YUV_CONVERSION_BT601;
-   }
-   SDL_SetYUVConversionMode(mode);
-   */
+   for (const enum AVPixelFormat* pFormat = pFormats; *pFormat != AV_PIX_FMT_NONE; pFormat++) {
+      if (*pFormat == AV_PIX_FMT_VAAPI)
+         return *pFormat;
+   }
+
+   // software fallback, the first format which is not a hardware one
+   for (const enum AVPixelFormat* pFormat = pFormats; *pFormat != AV_PIX_FMT_NONE; pFormat++) {
+      const AVPixFmtDescriptor* pDesc = av_pix_fmt_desc_get(*pFormat);
+      if (pDesc && !(pDesc->flags & AV_PIX_FMT_FLAG_HWACCEL))
+         return *pFormat;
+   }
+
+   return AV_PIX_FMT_NONE;
 }
 #endif
 
@@ -2,12 +2,17 @@
 
 #if !((defined(__APPLE__) && ((defined(TARGET_OS_TV) && TARGET_OS_TV))) || defined(__ANDROID__))
 #define VIDEO_WINDOW_HAS_FFMPEG_LIBS 1
+#if defined(__linux__)
+#define VIDEO_WINDOW_HAS_VAAPI 1
+#endif
 #endif
 
 #include "PUPManager.h"
 
 #include "../common/Window.h"
 
+#include <atomic>
+
 #ifdef VIDEO_WINDOW_HAS_FFMPEG_LIBS
 extern "C" {
    #include "libavutil/imgutils.h"
@@ -16,7 +21,30 @@ extern "C" {
    #include "libswscale/swscale.h"
    #include "libswresample/swresample.h"
    #include "libavcodec/avcodec.h"
+   #include "libavutil/hwcontext.h"
+   #include "libavutil/pixdesc.h"
 }
+
+// Lock free queue of decoded frames between the decoder thread (single producer) and the render thread.
+// Consumers claim frames with a CAS on the read index, so Stop() can drain the queue while Render() runs.
+class PUPFrameQueue
+{
+public:
+   PUPFrameQueue();
+   ~PUPFrameQueue();
+
+   bool Push(AVFrame* pFrame);
+   AVFrame* Pop();
+   AVFrame* PopLatest();
+   void Clear();
+
+private:
+   static constexpr unsigned int CAPACITY = 8;
+
+   AVFrame* m_frames[CAPACITY];
+   std::atomic<unsigned int> m_read;
+   std::atomic<unsigned int> m_write;
+};
 #endif
 
 class PUPMediaPlayer
@@ -41,7 +69,8 @@ private:
 #ifdef VIDEO_WINDOW_HAS_FFMPEG_LIBS
    AVCodecContext* OpenStream(AVFormatContext* pInputFormatContext, int stream);
    SDL_PixelFormat GetVideoFormat(enum AVPixelFormat format);
-   void SetYUVConversionMode(AVFrame* pFrame);
+   SDL_Colorspace GetFrameColorspace(AVFrame* pFrame);
+   static enum AVPixelFormat GetHardwareFormat(AVCodecContext* pContext, const enum AVPixelFormat* pFormats);
    void HandleAudioFrame(AVFrame* pFrame);
 #endif
 
@@ -57,16 +86,18 @@ private:
    AVCodecContext* m_pVideoContext;
    struct SwsContext* m_pVideoConversionContext;
    SDL_PixelFormat m_videoFormat;
+   SDL_Colorspace m_videoColorspace;
    int m_videoWidth;
    int m_videoHeight;
    int m_audioStream;
    AVCodecContext* m_pAudioContext;
    struct SwrContext* m_pAudioConversionContext;
    AVSampleFormat m_audioFormat;
+   bool m_hardwareDecoding;
 #endif
    AudioPlayer* m_pAudioPlayer;
 #ifdef VIDEO_WINDOW_HAS_FFMPEG_LIBS
-   std::queue<AVFrame*> m_queue;
+   PUPFrameQueue m_frameQueue;
 #endif
    std::mutex m_mutex;
    std::thread m_thread;
@@ -13,6 +13,75 @@
 #define PINMAME_SETTINGS_WINDOW_HEIGHT 75
 #define PINMAME_ZORDER                 350
 
+VPinMAMEController::ChangeJournals VPinMAMEController::m_changeJournals;
+
+// Build a 2D SAFEARRAY of VT_I4 with one row of nColumns values per change since the given cursor, or VT_EMPTY if there is none.
+// The journal is read twice (count, then fill) to write the changes directly into the array. Must be called with the journals mutex held.
+template <typename T, auto Id, typename Filter, typename Columns>
+static void ReadChangesToVariant(const ChangeJournal<T, Id>& journal, uint64_t& cursor, const LONG nColumns, const Filter& filter, const Columns& columns, VARIANT* pVal)
+{
+   uint64_t countCursor = cursor;
+   ULONG uCount = 0;
+   journal.Read(countCursor, [&uCount, &filter](const T& state) { if (filter(state)) uCount++; });
+   if (uCount == 0) {
+      cursor = countCursor;
+      V_VT(pVal) = VT_EMPTY;
+      return;
+   }
+
+   SAFEARRAYBOUND Bounds[] = { { uCount, 0 }, { (ULONG)nColumns, 0 } };
+   SAFEARRAY* psa = SafeArrayCreate(VT_VARIANT, 2, Bounds);
+   LONG ix[2] = { 0, 0 };
+   VARIANT varValue;
+   V_VT(&varValue) = VT_I4;
+
+   journal.Read(cursor, [&](const T& state) {
+      if (!filter(state))
+         return;
+      int values[3];
+      columns(state, values);
+      for (ix[1] = 0; ix[1] < nColumns; ix[1]++) {
+         V_I4(&varValue) = values[ix[1]];
+         SafeArrayPutElement(psa, ix, &varValue);
+      }
+      ix[0]++;
+   });
+
+   V_VT(pVal) = VT_ARRAY | VT_VARIANT;
+   V_ARRAY(pVal) = psa;
+}
+
+// Copy the changes since the given cursor into buf, with nColumns ints per change and at most capacity ints. Changes that do not fit
+// are left in the journal for the next call. Returns the number of changes. Must be called with the journals mutex held.
+template <typename T, auto Id, typename Filter, typename Columns>
+static int ReadChangesToBuffer(const ChangeJournal<T, Id>& journal, uint64_t& cursor, const int nColumns, const Filter& filter, const Columns& columns, int* buf, const int capacity)
+{
+   int count = 0;
+   journal.Read(cursor, [&](const T& state) {
+      if (!filter(state))
+         return true;
+      if ((count + 1) * nColumns > capacity)
+         return false;
+      columns(state, buf + count * nColumns);
+      count++;
+      return true;
+   });
+   return count;
+}
+
+static const auto PollLamps = [](PinmameLampState* states) { return PinmameGetChangedLamps(states); };
+// Poll all LEDs since the controller instances may use different masks, then only report the ones requested by each instance
+static const auto PollLEDs = [](PinmameLEDState* states) { return PinmameGetChangedLEDs(~0ull, ~0ull, states); };
+static const auto PollNVRAM = [](PinmameNVRAMState* states) { return PinmameGetChangedNVRAM(states); };
+static const auto PollSoundCommands = [](PinmameSoundCommand* commands) { return PinmameGetNewSoundCommands(commands); };
+static const auto PollGIs = [](PinmameGIState* states) { return PinmameGetChangedGIs(states); };
+static const auto PollSolenoids = [](PinmameSolenoidState* states) { return PinmameGetChangedSolenoids(states); };
+
+static bool IsLEDInMask(const int ledNo, const uint64_t mask, const uint64_t mask2)
+{
+   return ledNo < 64 ? ((mask >> ledNo) & 1) != 0 : ledNo < 128 && ((mask2 >> (ledNo - 64)) & 1) != 0;
+}
+
 void PINMAMECALLBACK VPinMAMEController::GetGameCallback(PinmameGame* pPinmameGame, void* const pUserData)
 {
    VPinMAMEController* pController = (VPinMAMEController*)pUserData;
@@ -91,6 +160,14 @@ void PINMAMECALLBACK VPinMAMEController::OnDisplayUpdated(int index, void* p_dis
       VPinMAMEController* pController = (VPinMAMEController*)pUserData;
       pDisplay->pDMD->UpdateData((const UINT8*)p_displayData, pDisplay->layout.depth, pDisplay->layout.width, pDisplay->layout.height, pDisplay->r, pDisplay->g, pDisplay->b);
    }
+
+   // libpinmame has no lamp, GI or LED callbacks, so use the first display update of each emulated frame as the hint to look for changes
+   if (index == 0) {
+      VPinMAMEController* pController = (VPinMAMEController*)pUserData;
+      std::lock_guard<std::mutex> lock(pController->m_stateChangedListenerMutex);
+      if (pController->m_stateChangedListener)
+         pController->m_stateChangedListener();
+   }
 }
 
 int PINMAMECALLBACK VPinMAMEController::OnAudioAvailable(PinmameAudioInfo* p_audioInfo, void* const pUserData)
@@ -140,6 +217,20 @@ void PINMAMECALLBACK VPinMAMEController::OnSoundCommand(int boardNo, int cmd, vo
    AltsoundProcessCommand(cmd, 0);
 }
 
+void PINMAMECALLBACK VPinMAMEController::OnSolenoidUpdated(PinmameSolenoidState* p_solenoidState, void* const pUserData)
+{
+   VPinMAMEController* pController = (VPinMAMEController*)pUserData;
+   std::lock_guard<std::mutex> lock(pController->m_stateChangedListenerMutex);
+   if (pController->m_stateChangedListener)
+      pController->m_stateChangedListener();
+}
+
+void VPinMAMEController::SetStateChangedListener(StateChangedListener listener)
+{
+   std::lock_guard<std::mutex> lock(m_stateChangedListenerMutex);
+   m_stateChangedListener = listener;
+}
+
 VPinMAMEController::VPinMAMEController()
 {
    PinmameConfig config = { 
@@ -153,7 +244,7 @@ VPinMAMEController::VPinMAMEController()
       &VPinMAMEController::OnAudioUpdated,
       NULL,
       NULL,
-      NULL,
+      &VPinMAMEController::OnSolenoidUpdated,
       NULL,
       NULL,
       &VPinMAMEController::OnLogMessage,
@@ -199,11 +290,6 @@ VPinMAMEController::VPinMAMEController()
    PinmameSetHandleKeyboard(0);
    PinmameSetHandleMechanics(0xFF);
 
-   m_pSolenoidBuffer = new PinmameSolenoidState[PinmameGetMaxSolenoids()];
-   m_pLampBuffer = new PinmameLampState[PinmameGetMaxLamps()];
-   m_pGIBuffer = new PinmameGIState[PinmameGetMaxGIs()];
-   m_pLEDBuffer = new PinmameLEDState[PinmameGetMaxLEDs()];
-   m_pSoundCommandBuffer = new PinmameSoundCommand[PinmameGetMaxSoundCommands()];
    m_pNVRAMBuffer = new PinmameNVRAMState[PinmameGetMaxNVRAM()];
 
    m_pGames = new VPinMAMEGames(this);
@@ -266,12 +352,7 @@ VPinMAMEController::~VPinMAMEController()
 
    m_displays.clear();
 
-   delete m_pSolenoidBuffer;
-   delete m_pLampBuffer;
-   delete m_pGIBuffer;
-   delete m_pLEDBuffer;
-   delete m_pSoundCommandBuffer;
-   delete m_pNVRAMBuffer;
+   delete[] m_pNVRAMBuffer;
    delete m_pPinmameGame;
    delete m_pPinmameMechConfig;
    delete m_pAudioPlayer;
@@ -313,6 +394,16 @@ STDMETHODIMP VPinMAMEController::Run(/*[in]*/ LONG_PTR hParentWnd, /*[in,default
 
       PinmameSetCheat(cheat);
 
+      {
+         std::lock_guard<std::mutex> lock(m_changeJournals.mutex);
+         m_changeJournals.lamps.Reset();
+         m_changeJournals.leds.Reset();
+         m_changeJournals.nvram.Reset();
+         m_changeJournals.soundCommands.Reset();
+         m_changeJournals.giStrings.Reset();
+         m_changeJournals.solenoids.Reset();
+      }
+
       PINMAME_STATUS status = PinmameRun(m_pPinmameGame->name);
 
       if (status == PINMAME_STATUS_OK) {
@@ -494,36 +585,10 @@ STDMETHODIMP VPinMAMEController::get_NVRAM(VARIANT* pVal)
 
 STDMETHODIMP VPinMAMEController::get_ChangedNVRAM(VARIANT* pVal)
 {
-   int uCount = PinmameGetChangedNVRAM(m_pNVRAMBuffer);
-   if (uCount <= 0) {
-      if (uCount == 0) {
-         V_VT(pVal) = VT_EMPTY;
-         return S_OK;
-      }
-
-      return S_FALSE;
-   }
-
-   SAFEARRAYBOUND Bounds[] = { { (ULONG)uCount, 0 }, { 3, 0 } };
-   SAFEARRAY* psa = SafeArrayCreate(VT_VARIANT, 2, Bounds);
-   LONG ix[3];
-   VARIANT varValue;
-   V_VT(&varValue) = VT_I4;
-
-   for (ix[0] = 0; ix[0] < uCount; ix[0]++) {
-      ix[1] = 0;
-      V_I4(&varValue) = m_pNVRAMBuffer[ix[0]].nvramNo;
-      SafeArrayPutElement(psa, ix, &varValue);
-      ix[1] = 1;
-      V_I4(&varValue) = m_pNVRAMBuffer[ix[0]].currStat;
-      SafeArrayPutElement(psa, ix, &varValue);
-      ix[1] = 2;
-      V_I4(&varValue) = m_pNVRAMBuffer[ix[0]].oldStat;
-      SafeArrayPutElement(psa, ix, &varValue);
-   }
-
-   V_VT(pVal) = VT_ARRAY | VT_VARIANT;
-   V_ARRAY(pVal) = psa;
+   std::lock_guard<std::mutex> lock(m_changeJournals.mutex);
+   m_changeJournals.nvram.Poll(PinmameGetMaxNVRAM(), PollNVRAM);
+   ReadChangesToVariant(m_changeJournals.nvram, m_nvramCursor, 3, [](const PinmameNVRAMState&) { return true; },
+      [](const PinmameNVRAMState& state, int* values) { values[0] = state.nvramNo; values[1] = state.currStat; values[2] = state.oldStat; }, pVal);
 
    return S_OK;
 }
@@ -634,11 +699,20 @@ STDMETHODIMP VPinMAMEController::get_updateDmdPixels(int **buf, int width, int h
 
 STDMETHODIMP VPinMAMEController::get_ChangedLampsState(int **buf, int *pVal)
 {
-   PLOGW << "Not implemented";
+   // COM callers provide a buffer for a PinMAME change list
+   *pVal = GetChangedLampsState(reinterpret_cast<int*>(buf), 2 * PinmameGetMaxLamps());
 
    return S_OK;
 }
 
+int VPinMAMEController::GetChangedLampsState(int* buf, int capacity)
+{
+   std::lock_guard<std::mutex> lock(m_changeJournals.mutex);
+   m_changeJournals.lamps.Poll(PinmameGetMaxLamps(), PollLamps);
+   return ReadChangesToBuffer(m_changeJournals.lamps, m_lampCursor, 2, [](const PinmameLampState&) { return true; },
+      [](const PinmameLampState& state, int* values) { values[0] = state.lampNo; values[1] = state.state; }, buf, capacity);
+}
+
 STDMETHODIMP VPinMAMEController::get_LampsState(int **buf, int *pVal)
 {
    PLOGW << "Not implemented";
@@ -648,11 +722,19 @@ STDMETHODIMP VPinMAMEController::get_LampsState(int **buf, int *pVal)
 
 STDMETHODIMP VPinMAMEController::get_ChangedSolenoidsState(int **buf, int *pVal)
 {
-   PLOGW << "Not implemented";
+   *pVal = GetChangedSolenoidsState(reinterpret_cast<int*>(buf), 2 * PinmameGetMaxSolenoids());
 
    return S_OK;
 }
 
+int VPinMAMEController::GetChangedSolenoidsState(int* buf, int capacity)
+{
+   std::lock_guard<std::mutex> lock(m_changeJournals.mutex);
+   m_changeJournals.solenoids.Poll(PinmameGetMaxSolenoids(), PollSolenoids);
+   return ReadChangesToBuffer(m_changeJournals.solenoids, m_solenoidCursor, 2, [](const PinmameSolenoidState&) { return true; },
+      [](const PinmameSolenoidState& state, int* values) { values[0] = state.solNo; values[1] = state.state; }, buf, capacity);
+}
+
 STDMETHODIMP VPinMAMEController::get_SolenoidsState(int **buf, int *pVal)
 {
    PLOGW << "Not implemented";
@@ -662,11 +744,19 @@ STDMETHODIMP VPinMAMEController::get_SolenoidsState(int **buf, int *pVal)
 
 STDMETHODIMP VPinMAMEController::get_ChangedGIsState(int **buf, int *pVal)
 {
-   PLOGW << "Not implemented";
+   *pVal = GetChangedGIsState(reinterpret_cast<int*>(buf), 2 * PinmameGetMaxGIs());
 
    return S_OK;
 }
 
+int VPinMAMEController::GetChangedGIsState(int* buf, int capacity)
+{
+   std::lock_guard<std::mutex> lock(m_changeJournals.mutex);
+   m_changeJournals.giStrings.Poll(PinmameGetMaxGIs(), PollGIs);
+   return ReadChangesToBuffer(m_changeJournals.giStrings, m_giCursor, 2, [](const PinmameGIState&) { return true; },
+      [](const PinmameGIState& state, int* values) { values[0] = state.giNo; values[1] = state.state; }, buf, capacity);
+}
+
 STDMETHODIMP VPinMAMEController::get_Switches(VARIANT* pVal)
 {
    PLOGW << "Not implemented";
@@ -751,29 +841,10 @@ STDMETHODIMP VPinMAMEController::get_Running(VARIANT_BOOL *pVal) {
 
 STDMETHODIMP VPinMAMEController::get_ChangedLamps(VARIANT* pVal)
 {
-   int uCount = PinmameGetChangedLamps(m_pLampBuffer);
-   if (uCount <= 0) {
-      V_VT(pVal) = VT_EMPTY;
-      return S_OK;
-   }
-
-   SAFEARRAYBOUND Bounds[] = { { (ULONG)uCount, 0 }, { 2, 0 } };
-   SAFEARRAY* psa = SafeArrayCreate(VT_VARIANT, 2, Bounds);
-   LONG ix[2];
-   VARIANT varValue;
-   V_VT(&varValue) = VT_I4;
-
-   for (ix[0] = 0; ix[0] < uCount; ix[0]++) {
-      ix[1] = 0;
-      V_I4(&varValue) = m_pLampBuffer[ix[0]].lampNo;
-      SafeArrayPutElement(psa, ix, &varValue);
-      ix[1] = 1;
-      V_I4(&varValue) = m_pLampBuffer[ix[0]].state;
-      SafeArrayPutElement(psa, ix, &varValue);
-   }
-
-   V_VT(pVal) = VT_ARRAY | VT_VARIANT;
-   V_ARRAY(pVal) = psa;
+   std::lock_guard<std::mutex> lock(m_changeJournals.mutex);
+   m_changeJournals.lamps.Poll(PinmameGetMaxLamps(), PollLamps);
+   ReadChangesToVariant(m_changeJournals.lamps, m_lampCursor, 2, [](const PinmameLampState&) { return true; },
+      [](const PinmameLampState& state, int* values) { values[0] = state.lampNo; values[1] = state.state; }, pVal);
 
    return S_OK;
 }
@@ -783,43 +854,32 @@ STDMETHODIMP VPinMAMEController::get_ChangedLEDs(int nHigh, int nLow, int nnHigh
    uint64_t mask = ((uint64_t)nHigh << 32) | (uint64_t)nLow;
    uint64_t mask2 = ((uint64_t)nnHigh << 32) | (uint64_t)nnLow;
     
-   int uCount = PinmameGetChangedLEDs(mask, mask2, m_pLEDBuffer);
-   if (uCount <= 0) {
-      V_VT(pVal) = VT_EMPTY;
-      return S_OK;
-   }
-
-   SAFEARRAYBOUND Bounds[] = { { (ULONG)uCount, 0 }, { 3, 0 } };
-   SAFEARRAY* psa = SafeArrayCreate(VT_VARIANT, 2, Bounds);
-   LONG ix[3];
-   VARIANT varValue;
-   V_VT(&varValue) = VT_I4;
-
-   for (ix[0] = 0; ix[0] < uCount; ix[0]++) {
-      ix[1] = 0;
-      V_I4(&varValue) = m_pLEDBuffer[ix[0]].ledNo;
-      SafeArrayPutElement(psa, ix, &varValue);
-      ix[1] = 1;
-      V_I4(&varValue) = m_pLEDBuffer[ix[0]].chgSeg;
-      SafeArrayPutElement(psa, ix, &varValue);
-      ix[1] = 2;
-      V_I4(&varValue) = m_pLEDBuffer[ix[0]].state;
-      SafeArrayPutElement(psa, ix, &varValue);
-   }
-
-   V_VT(pVal) = VT_ARRAY | VT_VARIANT;
-   V_ARRAY(pVal) = psa;
+   std::lock_guard<std::mutex> lock(m_changeJournals.mutex);
+   m_changeJournals.leds.Poll(PinmameGetMaxLEDs(), PollLEDs);
+   ReadChangesToVariant(m_changeJournals.leds, m_ledCursor, 3, [mask, mask2](const PinmameLEDState& state) { return IsLEDInMask(state.ledNo, mask, mask2); },
+      [](const PinmameLEDState& state, int* values) { values[0] = state.ledNo; values[1] = state.chgSeg; values[2] = state.state; }, pVal);
 
    return S_OK;
 }
 
 STDMETHODIMP VPinMAMEController::get_ChangedLEDsState(int nHigh, int nLow, int nnHigh, int nnLow, int **buf, int *pVal)
 {
-   PLOGW << "Not implemented";
+   uint64_t mask = ((uint64_t)nHigh << 32) | (uint64_t)nLow;
+   uint64_t mask2 = ((uint64_t)nnHigh << 32) | (uint64_t)nnLow;
+
+   *pVal = GetChangedLEDsState(mask, mask2, reinterpret_cast<int*>(buf), 3 * PinmameGetMaxLEDs());
 
    return S_OK;
 }
 
+int VPinMAMEController::GetChangedLEDsState(uint64_t mask, uint64_t mask2, int* buf, int capacity)
+{
+   std::lock_guard<std::mutex> lock(m_changeJournals.mutex);
+   m_changeJournals.leds.Poll(PinmameGetMaxLEDs(), PollLEDs);
+   return ReadChangesToBuffer(m_changeJournals.leds, m_ledCursor, 3, [mask, mask2](const PinmameLEDState& state) { return IsLEDInMask(state.ledNo, mask, mask2); },
+      [](const PinmameLEDState& state, int* values) { values[0] = state.ledNo; values[1] = state.chgSeg; values[2] = state.state; }, buf, capacity);
+}
+
 STDMETHODIMP VPinMAMEController::ShowAboutDialog(LONG_PTR hParentWnd)
 {
    PLOGW << "Not implemented";
@@ -908,59 +968,20 @@ STDMETHODIMP VPinMAMEController::get_GIString(int nString, int *pVal)
 
 STDMETHODIMP VPinMAMEController::get_ChangedGIStrings(VARIANT* pVal)
 {
-   int uCount = PinmameGetChangedGIs(m_pGIBuffer);
-   if (uCount <= 0) {
-      V_VT(pVal) = VT_EMPTY;
-      return S_OK;
-   }
-
-   SAFEARRAYBOUND Bounds[] = { { (ULONG)uCount, 0 }, { 2, 0 } };
-   SAFEARRAY* psa = SafeArrayCreate(VT_VARIANT, 2, Bounds);
-   LONG ix[2];
-   VARIANT varValue;
-   V_VT(&varValue) = VT_I4;
-
-   for (ix[0] = 0; ix[0] < uCount; ix[0]++) {
-      ix[1] = 0;
-      V_I4(&varValue) = m_pGIBuffer[ix[0]].giNo;
-      SafeArrayPutElement(psa, ix, &varValue);
-      ix[1] = 1;
-      V_I4(&varValue) = m_pGIBuffer[ix[0]].state;
-      SafeArrayPutElement(psa, ix, &varValue);
-   }
-
-   V_VT(pVal) = VT_ARRAY | VT_VARIANT;
-   V_ARRAY(pVal) = psa;
+   std::lock_guard<std::mutex> lock(m_changeJournals.mutex);
+   m_changeJournals.giStrings.Poll(PinmameGetMaxGIs(), PollGIs);
+   ReadChangesToVariant(m_changeJournals.giStrings, m_giCursor, 2, [](const PinmameGIState&) { return true; },
+      [](const PinmameGIState& state, int* values) { values[0] = state.giNo; values[1] = state.state; }, pVal);
 
    return S_OK;
 }
 
 STDMETHODIMP VPinMAMEController::get_ChangedSolenoids(VARIANT* pVal)
 {
-   int uCount = PinmameGetChangedSolenoids(m_pSolenoidBuffer);
-   if (uCount <= 0)
-   {
-      V_VT(pVal) = VT_EMPTY;
-      return S_OK;
-   }
-
-   SAFEARRAYBOUND Bounds[] = { { (ULONG)uCount, 0 }, { 2, 0 } };
-   SAFEARRAY* psa = SafeArrayCreate(VT_VARIANT, 2, Bounds);
-   LONG ix[2];
-   VARIANT varValue;
-   V_VT(&varValue) = VT_I4;
-
-   for (ix[0] = 0; ix[0] < uCount; ix[0]++) {
-      ix[1] = 0;
-      V_I4(&varValue) = m_pSolenoidBuffer[ix[0]].solNo;
-      SafeArrayPutElement(psa, ix, &varValue);
-      ix[1] = 1;
-      V_I4(&varValue) = m_pSolenoidBuffer[ix[0]].state;
-      SafeArrayPutElement(psa, ix, &varValue);
-   }
-
-   V_VT(pVal) = VT_ARRAY | VT_VARIANT;
-   V_ARRAY(pVal) = psa;
+   std::lock_guard<std::mutex> lock(m_changeJournals.mutex);
+   m_changeJournals.solenoids.Poll(PinmameGetMaxSolenoids(), PollSolenoids);
+   ReadChangesToVariant(m_changeJournals.solenoids, m_solenoidCursor, 2, [](const PinmameSolenoidState&) { return true; },
+      [](const PinmameSolenoidState& state, int* values) { values[0] = state.solNo; values[1] = state.state; }, pVal);
 
    return S_OK;
 }
@@ -1117,30 +1138,10 @@ STDMETHODIMP VPinMAMEController::get_Settings(IControllerSettings **pVal)
 
 STDMETHODIMP VPinMAMEController::get_NewSoundCommands(VARIANT* pVal)
 {
-   int uCount = PinmameGetNewSoundCommands(m_pSoundCommandBuffer);
-   if (uCount <= 0)
-   {
-      V_VT(pVal) = VT_EMPTY;
-      return S_OK;
-   }
-
-   SAFEARRAYBOUND Bounds[] = { { (ULONG)uCount, 0 }, { 2, 0 } };
-   SAFEARRAY* psa = SafeArrayCreate(VT_VARIANT, 2, Bounds);
-   LONG ix[2];
-   VARIANT varValue;
-   V_VT(&varValue) = VT_I4;
-
-   for (ix[0] = 0; ix[0] < uCount; ix[0]++) {
-      ix[1] = 0;
-      V_I4(&varValue) = m_pSoundCommandBuffer[ix[0]].sndNo;
-      SafeArrayPutElement(psa, ix, &varValue);
-      ix[1] = 1;
-      V_I4(&varValue) = 0;
-      SafeArrayPutElement(psa, ix, &varValue);
-   }
-
-   V_VT(pVal) = VT_ARRAY | VT_VARIANT;
-   V_ARRAY(pVal) = psa;
+   std::lock_guard<std::mutex> lock(m_changeJournals.mutex);
+   m_changeJournals.soundCommands.Poll(PinmameGetMaxSoundCommands(), PollSoundCommands);
+   ReadChangesToVariant(m_changeJournals.soundCommands, m_soundCommandCursor, 2, [](const PinmameSoundCommand&) { return true; },
+      [](const PinmameSoundCommand& command, int* values) { values[0] = command.sndNo; values[1] = 0; }, pVal);
 
    return S_OK;
 }
@@ -7,7 +7,11 @@
 #include "vpinmame_i.h"
 #include "../common/DMDWindow.h"
 
+#include "plugins/pinmame/ChangeJournal.h"
+
 #include <map>
+#include <mutex>
+#include <functional>
 
 class VPinMAMEGames;
 
@@ -179,19 +183,26 @@ public:
    static int PINMAMECALLBACK OnAudioUpdated(void* p_buffer, int samples, void* const pUserData);
    static void PINMAMECALLBACK OnLogMessage(PINMAME_LOG_LEVEL logLevel, const char* format, va_list args, void* const pUserData);
    static void PINMAMECALLBACK OnSoundCommand(int boardNo, int cmd, void* const pUserData);
+   static void PINMAMECALLBACK OnSolenoidUpdated(PinmameSolenoidState* p_solenoidState, void* const pUserData);
    string GetIniPath() { return m_szIniPath; }
 
+   // Called from the emulation thread when outputs may have changed (solenoid change or emulated frame)
+   using StateChangedListener = std::function<void()>;
+   void SetStateChangedListener(StateChangedListener listener);
+
+   // Copy the changes since the previous call of this instance into buf (2 ints per lamp, solenoid or GI change, 3 per LED change), writing
+   // at most capacity ints. Changes that do not fit are returned by the next call. Returns the number of changes.
+   int GetChangedLampsState(int* buf, int capacity);
+   int GetChangedSolenoidsState(int* buf, int capacity);
+   int GetChangedGIsState(int* buf, int capacity);
+   int GetChangedLEDsState(uint64_t mask, uint64_t mask2, int* buf, int capacity);
+
 private:
    string m_szPath;
    string m_szIniPath;
    string m_szSplashInfoLine;
    PinmameGame* m_pPinmameGame;
    PinmameMechConfig* m_pPinmameMechConfig;
-   PinmameSolenoidState* m_pSolenoidBuffer;
-   PinmameLampState* m_pLampBuffer;
-   PinmameGIState* m_pGIBuffer;
-   PinmameLEDState* m_pLEDBuffer;
-   PinmameSoundCommand* m_pSoundCommandBuffer;
    PinmameNVRAMState* m_pNVRAMBuffer;
    VPinMAMEGames* m_pGames;
    vector<VPinMAMEDisplay*> m_displays;
@@ -206,6 +217,26 @@ private:
    DMDUtil::LevelDMD* m_pLevelDMD;
    std::thread* m_pThread;
    bool m_running;
+   StateChangedListener m_stateChangedListener;
+   std::mutex m_stateChangedListenerMutex;
+
+   // PinMAME change lists are process wide and destructive while each controller instance (script, B2S,...)
+   // expects to receive all the changes since its previous call. Changes are therefore polled into journals
+   // shared by all instances, guarded by a mutex since B2S reads them from its own update thread, and each
+   // instance reads them through its own cursors.
+   struct ChangeJournals
+   {
+      std::mutex mutex;
+      ChangeJournal<PinmameLampState, &PinmameLampState::lampNo> lamps;
+      ChangeJournal<PinmameLEDState, &PinmameLEDState::ledNo> leds;
+      ChangeJournal<PinmameNVRAMState, &PinmameNVRAMState::nvramNo> nvram;
+      ChangeJournal<PinmameSoundCommand> soundCommands;
+      ChangeJournal<PinmameGIState, &PinmameGIState::giNo> giStrings;
+      ChangeJournal<PinmameSolenoidState, &PinmameSolenoidState::solNo> solenoids;
+   };
+   static ChangeJournals m_changeJournals;
+   typedef uint64_t ChangeCursor;
+   ChangeCursor m_lampCursor = 0, m_ledCursor = 0, m_nvramCursor = 0, m_soundCommandCursor = 0, m_giCursor = 0, m_solenoidCursor = 0;
 
    ULONG m_dwRef = 0;
 };
@@ -32,6 +32,8 @@ void WebServer::EventHandler(struct mg_connection *c, int ev, void *ev_data, voi
          webServer->Activate(c, hm);
       else if (mg_http_match_uri(hm, "/command"))
          webServer->Command(c, hm);
+      else if (mg_http_match_uri(hm, "/telemetry"))
+         webServer->Telemetry(c, hm);
       else {
          string path = g_pvp->m_szMyPath + "assets" + PATH_SEPARATOR_CHAR + "vpx.html";
 
@@ -45,6 +47,7 @@ WebServer::WebServer()
 {
    m_run = false;
    m_pThread = nullptr;
+   m_hasTelemetryClients = false;
 }
 
 WebServer::~WebServer() 
@@ -317,6 +320,119 @@ void WebServer::Command(struct mg_connection *c, struct mg_http_message* hm)
       mg_http_reply(c, 400, "", "Bad request");
 }
 
+void WebServer::Telemetry(struct mg_connection *c, struct mg_http_message* hm)
+{
+   PLOGI.printf("Telemetry client connected");
+
+   // Server-Sent Events stream, kept open and fed by the telemetry timer
+   mg_printf(c, "HTTP/1.1 200 OK\r\nContent-Type: text/event-stream\r\nCache-Control: no-cache\r\nConnection: keep-alive\r\n\r\n");
+   c->data[0] = 'T';
+}
+
+void WebServer::TelemetryTimer(void *arg)
+{
+   ((WebServer*)arg)->PublishTelemetry();
+}
+
+void WebServer::PublishTelemetry()
+{
+   bool hasClients = false;
+   for (struct mg_connection* c = m_mgr.conns; c != nullptr && !hasClients; c = c->next)
+      hasClients = (c->data[0] == 'T');
+
+   m_hasTelemetryClients = hasClients;
+   if (!hasClients)
+      return;
+
+   const string telemetry = GetTelemetry();
+
+   for (struct mg_connection* c = m_mgr.conns; c != nullptr; c = c->next) {
+      if (c->data[0] == 'T')
+         mg_printf(c, "data: %s\n\n", telemetry.c_str());
+   }
+}
+
+static constexpr std::pair<FrameProfiler::ProfileSection, const char*> logicSections[] = {
+   { FrameProfiler::PROFILE_MISC, "misc" }, { FrameProfiler::PROFILE_SCRIPT, "script" }, { FrameProfiler::PROFILE_PHYSICS, "physics" },
+   { FrameProfiler::PROFILE_SLEEP, "sleep" }, { FrameProfiler::PROFILE_PREPARE_FRAME, "prepare_frame" } };
+static constexpr std::pair<FrameProfiler::ProfileSection, const char*> renderSections[] = {
+   { FrameProfiler::PROFILE_RENDER_WAIT, "wait" }, { FrameProfiler::PROFILE_RENDER_SUBMIT, "submit" },
+   { FrameProfiler::PROFILE_RENDER_FLIP, "flip" }, { FrameProfiler::PROFILE_RENDER_SLEEP, "sleep" } };
+
+string WebServer::GetTelemetry()
+{
+   std::ostringstream json;
+   json << std::fixed << std::setprecision(3);
+   json << "{\"time\":" << msec() << ",\"memory\":{\"resident\":" << MemoryAccounting::GetProcessMemory();
+   static constexpr const char* memoryTags[MemoryAccounting::TAG_COUNT] = { "texture_cpu", "texture_gpu", "mesh", "collider", "sound", "script", "plugin" };
+   for (int i = 0; i < MemoryAccounting::TAG_COUNT; i++)
+      json << ",\"" << memoryTags[i] << "\":" << MemoryAccounting::GetCurrent((MemoryAccounting::Tag)i);
+   json << '}';
+
+   PlayerTelemetry player;
+   {
+      std::lock_guard lock(m_telemetryMutex);
+      player = m_playerTelemetry;
+      m_playerTelemetry.scriptEvents.clear();
+   }
+   if (player.valid) {
+      // Timings are 1 second sliding averages, in milliseconds
+      json << ",\"player\":{\"fps\":" << (player.frameLength > 0. ? 1e6 / player.frameLength : 0.) << ",\"frame\":" << player.frameLength * 1e-3;
+      json << ",\"logic\":{";
+      for (size_t i = 0; i < std::size(logicSections); i++)
+         json << (i ? "," : "") << '"' << logicSections[i].second << "\":" << player.logic[i] * 1e-3;
+      json << "},\"render\":{";
+      for (size_t i = 0; i < std::size(renderSections); i++)
+         json << (i ? "," : "") << '"' << renderSections[i].second << "\":" << player.render[i] * 1e-3;
+      json << "},\"input_lag\":" << player.inputLag * 1e-3;
+      if (player.physicsIterations >= 0)
+         json << ",\"physics\":{\"iterations\":" << player.physicsIterations << '}';
+
+      // Script time per event, accumulated since the previous report
+      json << ",\"script\":{";
+      bool first = true;
+      for (const auto& [id, tick] : player.scriptEvents) {
+         json << (first ? "" : ",") << '"' << FrameProfiler::GetScriptEventName(id) << "\":{\"calls\":" << tick.callCount << ",\"time\":" << tick.totalLength * 1e-3 << '}';
+         first = false;
+      }
+      json << "}}";
+   }
+
+   json << '}';
+   return json.str();
+}
+
+void WebServer::PublishPlayerTelemetry(Player* pPlayer)
+{
+   static_assert(std::size(logicSections) == std::extent_v<decltype(PlayerTelemetry::logic)> && std::size(renderSections) == std::extent_v<decltype(PlayerTelemetry::render)>);
+   if (!m_hasTelemetryClients)
+      return;
+
+   const FrameProfiler& logic = pPlayer->m_logicProfiler;
+   const FrameProfiler* const render = pPlayer->m_renderProfiler;
+   auto scriptEvents = pPlayer->m_logicProfiler.TakeScriptEventTotals();
+   std::lock_guard lock(m_telemetryMutex);
+   m_playerTelemetry.valid = true;
+   m_playerTelemetry.frameLength = logic.GetSlidingAvg(FrameProfiler::PROFILE_FRAME);
+   for (size_t i = 0; i < std::size(logicSections); i++)
+      m_playerTelemetry.logic[i] = logic.GetSlidingAvg(logicSections[i].first);
+   for (size_t i = 0; i < std::size(renderSections); i++)
+      m_playerTelemetry.render[i] = render ? render->GetSlidingAvg(renderSections[i].first) : 0.;
+   m_playerTelemetry.inputLag = logic.GetSlidingInputLag(false);
+   m_playerTelemetry.physicsIterations = pPlayer->m_physics ? pPlayer->m_physics->GetPerfNIterations() : -1;
+   for (const auto& [id, tick] : scriptEvents) {
+      FrameProfiler::EventTick& total = m_playerTelemetry.scriptEvents[id];
+      total.callCount += tick.callCount;
+      total.totalLength += tick.totalLength;
+   }
+}
+
+void WebServer::ClearPlayerTelemetry()
+{
+   std::lock_guard lock(m_telemetryMutex);
+   m_playerTelemetry = PlayerTelemetry();
+}
+
 string WebServer::GetUrl()
 {
    return m_run ? m_url : string();
@@ -346,6 +462,9 @@ void WebServer::Start()
    if (mg_http_listen(&m_mgr, bindUrl.c_str(), &WebServer::EventHandler, this)) {
       m_run = true;
 
+      const int telemetryRate = max(g_pvp->m_settings.LoadValueWithDefault(Settings::Standalone, "WebServerTelemetryRate"s, 1000), 50);
+      mg_timer_add(&m_mgr, telemetryRate, MG_TIMER_REPEAT, &WebServer::TelemetryTimer, this);
+
       PLOGI.printf("Web server started");
 
       string ip = GetIPAddress();
@@ -363,9 +482,9 @@ void WebServer::Start()
       VPinballLib::VPinball::SendEvent(VPinballLib::Event::WebServer, &webServerData);
 #endif
 
-      m_pThread = new std::thread([this]() {
+      m_pThread = new std::thread([this, telemetryRate]() {
          while (m_run)
-            mg_mgr_poll(&m_mgr, 1000);
+            mg_mgr_poll(&m_mgr, min(telemetryRate, 1000));
 
          mg_mgr_free(&m_mgr);
          m_url.clear();
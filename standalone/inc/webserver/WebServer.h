@@ -1,19 +1,26 @@
 #pragma once
 
 #include <thread>
+#include <mutex>
+#include <atomic>
 #include "mongoose.h"
 
+class Player;
+
 class WebServer {
 public:
     WebServer();
     ~WebServer();
 
     static void EventHandler(struct mg_connection *c, int ev, void *ev_data, void *fn_data);
+    static void TelemetryTimer(void *arg);
 
     void Start();
     void Stop();
     bool IsRunning();
     string GetUrl();
+    void PublishPlayerTelemetry(Player* pPlayer);
+    void ClearPlayerTelemetry();
 
 private:
     bool Unzip(const char* pSource);
@@ -25,6 +32,9 @@ private:
     void Extract(struct mg_connection *c, struct mg_http_message* hm);
     void Activate(struct mg_connection *c, struct mg_http_message* hm);
     void Command(struct mg_connection *c, struct mg_http_message* hm);
+    void Telemetry(struct mg_connection *c, struct mg_http_message* hm);
+    void PublishTelemetry();
+    string GetTelemetry();
     string GetIPAddress();
 
     struct mg_mgr m_mgr;
@@ -32,4 +42,19 @@ private:
     bool m_run;
     std::thread* m_pThread;
     string m_url;
+
+    // Player telemetry is published by the game thread once per frame while telemetry clients are connected, so that the
+    // server thread never accesses the player itself (its profilers and physics may be replaced or deleted at any time)
+    struct PlayerTelemetry {
+       bool valid = false;
+       double frameLength = 0.;
+       double logic[5] = {};
+       double render[4] = {};
+       double inputLag = 0.;
+       int physicsIterations = -1;
+       robin_hood::unordered_map<DISPID, FrameProfiler::EventTick> scriptEvents; // Accumulated until read by the server
+    };
+    std::atomic<bool> m_hasTelemetryClients;
+    std::mutex m_telemetryMutex;
+    PlayerTelemetry m_playerTelemetry;
 };
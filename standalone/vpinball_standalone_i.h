@@ -3325,6 +3325,21 @@ ITableGlobal : public IDispatch
         BSTR SettingName,
         BSTR *pVal) = 0;
 
+    virtual HRESULT STDMETHODCALLTYPE GetSoundHandle(
+        BSTR Sound,
+        LONG *pVal) = 0;
+
+    virtual HRESULT STDMETHODCALLTYPE PlaySoundHandle(
+        LONG Handle,
+        LONG LoopCount = 1,
+        float Volume = 1,
+        float pan = 0,
+        float randompitch = 0,
+        LONG pitch = 0,
+        VARIANT_BOOL usesame = 0,
+        VARIANT_BOOL restart = 1,
+        float front_rear_fade = 0) = 0;
+
     virtual HRESULT STDMETHODCALLTYPE GetTextFile(
         BSTR FileName,
         BSTR *pContents) = 0;
@@ -3750,6 +3765,23 @@ typedef struct ITableGlobalVtbl {
         BSTR SettingName,
         BSTR *pVal);
 
+    HRESULT (STDMETHODCALLTYPE *GetSoundHandle)(
+        ITableGlobal *This,
+        BSTR Sound,
+        LONG *pVal);
+
+    HRESULT (STDMETHODCALLTYPE *PlaySoundHandle)(
+        ITableGlobal *This,
+        LONG Handle,
+        LONG LoopCount,
+        float Volume,
+        float pan,
+        float randompitch,
+        LONG pitch,
+        VARIANT_BOOL usesame,
+        VARIANT_BOOL restart,
+        float front_rear_fade);
+
     HRESULT (STDMETHODCALLTYPE *GetTextFile)(
         ITableGlobal *This,
         BSTR FileName,
@@ -4073,6 +4105,8 @@ interface ITableGlobal {
 #define ITableGlobal_get_SystemTime(This,pVal) (This)->lpVtbl->get_SystemTime(This,pVal)
 #define ITableGlobal_GetCustomParam(This,index,param) (This)->lpVtbl->GetCustomParam(This,index,param)
 #define ITableGlobal_get_Setting(This,Section,SettingName,pVal) (This)->lpVtbl->get_Setting(This,Section,SettingName,pVal)
+#define ITableGlobal_GetSoundHandle(This,Sound,pVal) (This)->lpVtbl->GetSoundHandle(This,Sound,pVal)
+#define ITableGlobal_PlaySoundHandle(This,Handle,LoopCount,Volume,pan,randompitch,pitch,usesame,restart,front_rear_fade) (This)->lpVtbl->PlaySoundHandle(This,Handle,LoopCount,Volume,pan,randompitch,pitch,usesame,restart,front_rear_fade)
 #define ITableGlobal_GetTextFile(This,FileName,pContents) (This)->lpVtbl->GetTextFile(This,FileName,pContents)
 #define ITableGlobal_BeginModal(This) (This)->lpVtbl->BeginModal(This)
 #define ITableGlobal_EndModal(This) (This)->lpVtbl->EndModal(This)
@@ -4252,6 +4286,12 @@ static inline HRESULT ITableGlobal_GetCustomParam(ITableGlobal* This,LONG index,
 static inline HRESULT ITableGlobal_get_Setting(ITableGlobal* This,BSTR Section,BSTR SettingName,BSTR *pVal) {
     return This->lpVtbl->get_Setting(This,Section,SettingName,pVal);
 }
+static inline HRESULT ITableGlobal_GetSoundHandle(ITableGlobal* This,BSTR Sound,LONG *pVal) {
+    return This->lpVtbl->GetSoundHandle(This,Sound,pVal);
+}
+static inline HRESULT ITableGlobal_PlaySoundHandle(ITableGlobal* This,LONG Handle,LONG LoopCount,float Volume,float pan,float randompitch,LONG pitch,VARIANT_BOOL usesame,VARIANT_BOOL restart,float front_rear_fade) {
+    return This->lpVtbl->PlaySoundHandle(This,Handle,LoopCount,Volume,pan,randompitch,pitch,usesame,restart,front_rear_fade);
+}
 static inline HRESULT ITableGlobal_GetTextFile(ITableGlobal* This,BSTR FileName,BSTR *pContents) {
     return This->lpVtbl->GetTextFile(This,FileName,pContents);
 }
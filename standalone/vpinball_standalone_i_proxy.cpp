@@ -1766,6 +1766,7 @@ STDMETHODIMP ScriptGlobalTable::GetIDsOfNames(REFIID /*riid*/, LPOLESTR* rgszNam
 			{ L"GetMaterialPhysics", 248 },
 			{ L"GetPlayerHWnd", 14 },
 			{ L"GetSerialDevices", 249 },
+			{ L"GetSoundHandle", 827 },
 			{ L"GetTextFile", 23 },
 			{ L"HitFatTargetRectangle", 2029 },
 			{ L"HitFatTargetSlim", 2032 },
@@ -1813,6 +1814,7 @@ STDMETHODIMP ScriptGlobalTable::GetIDsOfNames(REFIID /*riid*/, LPOLESTR* rgszNam
 			{ L"PlatformOS", 259 },
 			{ L"PlayMusic", 10 },
 			{ L"PlaySound", 3 },
+			{ L"PlaySoundHandle", 828 },
 			{ L"PlungerKey", 9 },
 			{ L"PlungerTypeCustom", 2024 },
 			{ L"PlungerTypeFlat", 2023 },
@@ -2356,9 +2358,72 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 			}
 			break;
 		}
+		case 827: {
+			if (wFlags & DISPATCH_METHOD) {
+				// line 740: [id(827), helpstring("method GetSoundHandle")] HRESULT GetSoundHandle(BSTR Sound, [out, retval] long *pVal);
+				VARIANT var0;
+				V_VT(&var0) = VT_EMPTY;
+				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
+				V_VT(&res) = VT_I4;
+				hres = GetSoundHandle(V_BSTR(&var0), (LONG*)&V_I4(&res));
+				VariantClear(&var0);
+			}
+			break;
+		}
+		case 828: {
+			if (wFlags & DISPATCH_METHOD) {
+				// line 741: [id(828), helpstring("method PlaySoundHandle")] HRESULT PlaySoundHandle(long Handle, [defaultvalue(1)] long LoopCount, [defaultvalue(1)] float Volume, [defaultvalue(0)] float pan, [defaultvalue(0)] float randompitch, [defaultvalue(0)] long pitch, [defaultvalue(0)] VARIANT_BOOL usesame, [defaultvalue(1)] VARIANT_BOOL restart, [defaultvalue(0)] float front_rear_fade);
+				VARIANT var0;
+				V_VT(&var0) = VT_EMPTY;
+				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
+				VARIANT var1;
+				V_VT(&var1) = VT_I4;
+				V_I4(&var1) = 1;
+				VariantChangeType(&var1, (index > 0) ? &pDispParams->rgvarg[--index] : &var1, 0, VT_I4);
+				VARIANT var2;
+				V_VT(&var2) = VT_R4;
+				V_R4(&var2) = 1;
+				VariantChangeType(&var2, (index > 0) ? &pDispParams->rgvarg[--index] : &var2, 0, VT_R4);
+				VARIANT var3;
+				V_VT(&var3) = VT_R4;
+				V_R4(&var3) = 0;
+				VariantChangeType(&var3, (index > 0) ? &pDispParams->rgvarg[--index] : &var3, 0, VT_R4);
+				VARIANT var4;
+				V_VT(&var4) = VT_R4;
+				V_R4(&var4) = 0;
+				VariantChangeType(&var4, (index > 0) ? &pDispParams->rgvarg[--index] : &var4, 0, VT_R4);
+				VARIANT var5;
+				V_VT(&var5) = VT_I4;
+				V_I4(&var5) = 0;
+				VariantChangeType(&var5, (index > 0) ? &pDispParams->rgvarg[--index] : &var5, 0, VT_I4);
+				VARIANT var6;
+				V_VT(&var6) = VT_BOOL;
+				V_BOOL(&var6) = 0;
+				VariantChangeType(&var6, (index > 0) ? &pDispParams->rgvarg[--index] : &var6, 0, VT_BOOL);
+				VARIANT var7;
+				V_VT(&var7) = VT_BOOL;
+				V_BOOL(&var7) = 1;
+				VariantChangeType(&var7, (index > 0) ? &pDispParams->rgvarg[--index] : &var7, 0, VT_BOOL);
+				VARIANT var8;
+				V_VT(&var8) = VT_R4;
+				V_R4(&var8) = 0;
+				VariantChangeType(&var8, (index > 0) ? &pDispParams->rgvarg[--index] : &var8, 0, VT_R4);
+				hres = PlaySoundHandle(V_I4(&var0), V_I4(&var1), V_R4(&var2), V_R4(&var3), V_R4(&var4), V_I4(&var5), V_BOOL(&var6), V_BOOL(&var7), V_R4(&var8));
+				VariantClear(&var0);
+				VariantClear(&var1);
+				VariantClear(&var2);
+				VariantClear(&var3);
+				VariantClear(&var4);
+				VariantClear(&var5);
+				VariantClear(&var6);
+				VariantClear(&var7);
+				VariantClear(&var8);
+			}
+			break;
+		}
 		case 23: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 740: [id(23), helpstring("method GetTextFile")] HRESULT GetTextFile(BSTR FileName, [out, retval] BSTR *pContents);
+				// line 742: [id(23), helpstring("method GetTextFile")] HRESULT GetTextFile(BSTR FileName, [out, retval] BSTR *pContents);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -2370,21 +2435,21 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 25: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 741: [id(25), helpstring("method BeginModal")] HRESULT BeginModal();
+				// line 743: [id(25), helpstring("method BeginModal")] HRESULT BeginModal();
 				hres = BeginModal();
 			}
 			break;
 		}
 		case 26: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 742: [id(26), helpstring("method EndModal")] HRESULT EndModal();
+				// line 744: [id(26), helpstring("method EndModal")] HRESULT EndModal();
 				hres = EndModal();
 			}
 			break;
 		}
 		case DISPID_Table_Nudge: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 743: [id(DISPID_Table_Nudge), helpstring("method Nudge")] HRESULT Nudge([in] float Angle, [in] float Force);
+				// line 745: [id(DISPID_Table_Nudge), helpstring("method Nudge")] HRESULT Nudge([in] float Angle, [in] float Force);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -2399,7 +2464,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 804: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 744: [id(804), helpstring("method NudgeGetCalibration")] HRESULT NudgeGetCalibration([out] VARIANT *XMax, [out] VARIANT *YMax, [out] VARIANT *XGain, [out] VARIANT *YGain, [out] VARIANT *DeadZone, [out] VARIANT *TiltSensitivty);
+				// line 746: [id(804), helpstring("method NudgeGetCalibration")] HRESULT NudgeGetCalibration([out] VARIANT *XMax, [out] VARIANT *YMax, [out] VARIANT *XGain, [out] VARIANT *YGain, [out] VARIANT *DeadZone, [out] VARIANT *TiltSensitivty);
 				VARIANT* var0 = &pDispParams->rgvarg[--index];
 				VARIANT* var1 = &pDispParams->rgvarg[--index];
 				VARIANT* var2 = &pDispParams->rgvarg[--index];
@@ -2412,7 +2477,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 805: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 745: [id(805), helpstring("method NudgeSetCalibration")] HRESULT NudgeSetCalibration([in] int XMax, [in] int YMax, [in] int XGain, [in] int YGain, [in] int DeadZone, [in] int TiltSensitivty);
+				// line 747: [id(805), helpstring("method NudgeSetCalibration")] HRESULT NudgeSetCalibration([in] int XMax, [in] int YMax, [in] int XGain, [in] int YGain, [in] int DeadZone, [in] int TiltSensitivty);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -2443,7 +2508,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 806: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 746: [id(806), helpstring("method NudgeSensorStatus")] HRESULT NudgeSensorStatus([out] VARIANT *XNudge, [out] VARIANT *YNudge);
+				// line 748: [id(806), helpstring("method NudgeSensorStatus")] HRESULT NudgeSensorStatus([out] VARIANT *XNudge, [out] VARIANT *YNudge);
 				VARIANT* var0 = &pDispParams->rgvarg[--index];
 				VARIANT* var1 = &pDispParams->rgvarg[--index];
 				hres = NudgeSensorStatus(V_VARIANTREF(var0), V_VARIANTREF(var1));
@@ -2452,7 +2517,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 807: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 747: [id(807), helpstring("method NudgeTiltStatus")] HRESULT NudgeTiltStatus([out] VARIANT *XPlumb, [out] VARIANT *YPlumb, [out] VARIANT *TiltPercent);
+				// line 749: [id(807), helpstring("method NudgeTiltStatus")] HRESULT NudgeTiltStatus([out] VARIANT *XPlumb, [out] VARIANT *YPlumb, [out] VARIANT *TiltPercent);
 				VARIANT* var0 = &pDispParams->rgvarg[--index];
 				VARIANT* var1 = &pDispParams->rgvarg[--index];
 				VARIANT* var2 = &pDispParams->rgvarg[--index];
@@ -2462,7 +2527,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 30: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 749: [propget, id(30), helpstring("property MechanicalTilt")] HRESULT MechanicalTilt([out, retval] long *pVal);
+				// line 751: [propget, id(30), helpstring("property MechanicalTilt")] HRESULT MechanicalTilt([out, retval] long *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_MechanicalTilt((LONG*)&V_I4(&res));
 			}
@@ -2470,7 +2535,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 31: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 750: [propget, id(31), helpstring("property LeftMagnaSave")] HRESULT LeftMagnaSave([out, retval] long *pVal);
+				// line 752: [propget, id(31), helpstring("property LeftMagnaSave")] HRESULT LeftMagnaSave([out, retval] long *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_LeftMagnaSave((LONG*)&V_I4(&res));
 			}
@@ -2478,7 +2543,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 32: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 751: [propget, id(32), helpstring("property RightMagnaSave")] HRESULT RightMagnaSave([out, retval] long *pVal);
+				// line 753: [propget, id(32), helpstring("property RightMagnaSave")] HRESULT RightMagnaSave([out, retval] long *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_RightMagnaSave((LONG*)&V_I4(&res));
 			}
@@ -2486,7 +2551,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 34: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 752: [propget, id(34), helpstring("property ExitGame")] HRESULT ExitGame([out, retval] long *pVal);
+				// line 754: [propget, id(34), helpstring("property ExitGame")] HRESULT ExitGame([out, retval] long *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_ExitGame((LONG*)&V_I4(&res));
 			}
@@ -2494,7 +2559,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 803: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 753: [propget, id(803), helpstring("property LockbarKey")] HRESULT LockbarKey([out, retval] long *pVal);
+				// line 755: [propget, id(803), helpstring("property LockbarKey")] HRESULT LockbarKey([out, retval] long *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_LockbarKey((LONG*)&V_I4(&res));
 			}
@@ -2502,7 +2567,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 808: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 754: [propget, id(808), helpstring("property JoyCustomKey")] HRESULT JoyCustomKey([in] long index, [out, retval] long *pVal);
+				// line 756: [propget, id(808), helpstring("property JoyCustomKey")] HRESULT JoyCustomKey([in] long index, [out, retval] long *pVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -2514,7 +2579,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 33: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 755: [id(33), helpstring("method FireKnocker")] HRESULT FireKnocker([defaultvalue(1)] int Count);
+				// line 757: [id(33), helpstring("method FireKnocker")] HRESULT FireKnocker([defaultvalue(1)] int Count);
 				VARIANT var0;
 				V_VT(&var0) = VT_I4;
 				V_I4(&var0) = 1;
@@ -2526,7 +2591,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 37: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 756: [id(37), helpstring("method QuitPlayer")] HRESULT QuitPlayer([defaultvalue(0)] int CloseType);
+				// line 758: [id(37), helpstring("method QuitPlayer")] HRESULT QuitPlayer([defaultvalue(0)] int CloseType);
 				VARIANT var0;
 				V_VT(&var0) = VT_I4;
 				V_I4(&var0) = 0;
@@ -2538,7 +2603,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 13434: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 758: [propget, id(13434), helpstring("property ShowDT")] HRESULT ShowDT([out, retval] VARIANT_BOOL *pVal);
+				// line 760: [propget, id(13434), helpstring("property ShowDT")] HRESULT ShowDT([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_ShowDT(&V_BOOL(&res));
 			}
@@ -2546,7 +2611,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 625: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 759: [propget, id(625), helpstring("property ShowFSS")] HRESULT ShowFSS([out, retval] VARIANT_BOOL *pVal);
+				// line 761: [propget, id(625), helpstring("property ShowFSS")] HRESULT ShowFSS([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_ShowFSS(&V_BOOL(&res));
 			}
@@ -2554,7 +2619,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 436: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 761: [propget, id(436), helpstring("property NightDay")] HRESULT NightDay([out, retval] int *pVal);
+				// line 763: [propget, id(436), helpstring("property NightDay")] HRESULT NightDay([out, retval] int *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_NightDay((int*)&V_I4(&res));
 			}
@@ -2562,7 +2627,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 41: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 763: [id(41), helpstring("method GetBalls")] HRESULT GetBalls([out, retval] SAFEARRAY(VARIANT) *pVal);
+				// line 765: [id(41), helpstring("method GetBalls")] HRESULT GetBalls([out, retval] SAFEARRAY(VARIANT) *pVal);
 				V_VT(&res) = VT_VARIANT|VT_ARRAY;
 				hres = GetBalls((SAFEARRAY**)&V_ARRAY(&res));
 			}
@@ -2570,7 +2635,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 42: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 764: [id(42), helpstring("method GetElements")] HRESULT GetElements([out, retval] SAFEARRAY(VARIANT) *pVal);
+				// line 766: [id(42), helpstring("method GetElements")] HRESULT GetElements([out, retval] SAFEARRAY(VARIANT) *pVal);
 				V_VT(&res) = VT_VARIANT|VT_ARRAY;
 				hres = GetElements((SAFEARRAY**)&V_ARRAY(&res));
 			}
@@ -2578,7 +2643,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 43: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 765: [id(43), helpstring("method GetElementByName")] HRESULT GetElementByName([in] BSTR name, [out, retval] IDispatch* *pVal);
+				// line 767: [id(43), helpstring("method GetElementByName")] HRESULT GetElementByName([in] BSTR name, [out, retval] IDispatch* *pVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -2590,7 +2655,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 48: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 766: [propget, id(48), helpstring("property ActiveTable")] HRESULT ActiveTable([out, retval] ITable **pVal);
+				// line 768: [propget, id(48), helpstring("property ActiveTable")] HRESULT ActiveTable([out, retval] ITable **pVal);
 				V_VT(&res) = VT_DISPATCH;
 				hres = get_ActiveTable((ITable**)&V_DISPATCH(&res));
 			}
@@ -2598,7 +2663,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 44: {
 			if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 768: [propput, id(44), helpstring("property DMDWidth")] HRESULT DMDWidth([in] int pVal);
+				// line 770: [propput, id(44), helpstring("property DMDWidth")] HRESULT DMDWidth([in] int pVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -2609,7 +2674,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 45: {
 			if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 769: [propput, id(45), helpstring("property DMDHeight")] HRESULT DMDHeight([in] int pVal);
+				// line 771: [propput, id(45), helpstring("property DMDHeight")] HRESULT DMDHeight([in] int pVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -2620,7 +2685,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 46: {
 			if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 770: [propput, id(46), helpstring("property DMDPixels")] HRESULT DMDPixels([in] VARIANT pVal);
+				// line 772: [propput, id(46), helpstring("property DMDPixels")] HRESULT DMDPixels([in] VARIANT pVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantCopyInd(&var0, &pDispParams->rgvarg[--index]);
@@ -2631,7 +2696,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 47: {
 			if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 771: [propput, id(47), helpstring("property DMDColoredPixels")] HRESULT DMDColoredPixels([in] VARIANT pVal);
+				// line 773: [propput, id(47), helpstring("property DMDColoredPixels")] HRESULT DMDColoredPixels([in] VARIANT pVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantCopyInd(&var0, &pDispParams->rgvarg[--index]);
@@ -2642,7 +2707,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 219: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 773: [propget, id(219), helpstring("property Version")] HRESULT Version([out, retval] int *pVal);
+				// line 775: [propget, id(219), helpstring("property Version")] HRESULT Version([out, retval] int *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_Version((int*)&V_I4(&res));
 			}
@@ -2650,7 +2715,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 38: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 774: [propget, id(38), helpstring("property VersionMajor")] HRESULT VersionMajor([out, retval] int *pVal);
+				// line 776: [propget, id(38), helpstring("property VersionMajor")] HRESULT VersionMajor([out, retval] int *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_VersionMajor((int*)&V_I4(&res));
 			}
@@ -2658,7 +2723,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 39: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 775: [propget, id(39), helpstring("property VersionMinor")] HRESULT VersionMinor([out, retval] int *pVal);
+				// line 777: [propget, id(39), helpstring("property VersionMinor")] HRESULT VersionMinor([out, retval] int *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_VersionMinor((int*)&V_I4(&res));
 			}
@@ -2666,7 +2731,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 40: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 776: [propget, id(40), helpstring("property VersionRevision")] HRESULT VersionRevision([out, retval] int *pVal);
+				// line 778: [propget, id(40), helpstring("property VersionRevision")] HRESULT VersionRevision([out, retval] int *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_VersionRevision((int*)&V_I4(&res));
 			}
@@ -2674,7 +2739,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 24: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 777: [propget, id(24), helpstring("property VPBuildVersion")] HRESULT VPBuildVersion([out, retval] double *pVal);
+				// line 779: [propget, id(24), helpstring("property VPBuildVersion")] HRESULT VPBuildVersion([out, retval] double *pVal);
 				V_VT(&res) = VT_R8;
 				hres = get_VPBuildVersion((double*)&V_R8(&res));
 			}
@@ -2682,14 +2747,14 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 249: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 779: [id(249), helpstring("method GetSerialDevices")] HRESULT GetSerialDevices([out, retval] VARIANT *pVal);
+				// line 781: [id(249), helpstring("method GetSerialDevices")] HRESULT GetSerialDevices([out, retval] VARIANT *pVal);
 				hres = GetSerialDevices(&res);
 			}
 			break;
 		}
 		case 250: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 780: [id(250), helpstring("method OpenSerial")] HRESULT OpenSerial([in] BSTR device);
+				// line 782: [id(250), helpstring("method OpenSerial")] HRESULT OpenSerial([in] BSTR device);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -2700,21 +2765,21 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 251: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 781: [id(251), helpstring("method CloseSerial")] HRESULT CloseSerial();
+				// line 783: [id(251), helpstring("method CloseSerial")] HRESULT CloseSerial();
 				hres = CloseSerial();
 			}
 			break;
 		}
 		case 252: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 782: [id(252), helpstring("method FlushSerial")] HRESULT FlushSerial();
+				// line 784: [id(252), helpstring("method FlushSerial")] HRESULT FlushSerial();
 				hres = FlushSerial();
 			}
 			break;
 		}
 		case 253: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 783: [id(253), helpstring("method SetupSerial")] HRESULT SetupSerial([in] int baud, [in] int bits, [in] int parity, [in] int stopbit, [in] VARIANT_BOOL rts, [in] VARIANT_BOOL dtr);
+				// line 785: [id(253), helpstring("method SetupSerial")] HRESULT SetupSerial([in] int baud, [in] int bits, [in] int parity, [in] int stopbit, [in] VARIANT_BOOL rts, [in] VARIANT_BOOL dtr);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -2745,7 +2810,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 254: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 784: [id(254), helpstring("method ReadSerial")] HRESULT ReadSerial([in] int size, [out] VARIANT *pVal);
+				// line 786: [id(254), helpstring("method ReadSerial")] HRESULT ReadSerial([in] int size, [out] VARIANT *pVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -2757,7 +2822,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 255: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 785: [id(255), helpstring("method WriteSerial")] HRESULT WriteSerial([in] VARIANT pVal);
+				// line 787: [id(255), helpstring("method WriteSerial")] HRESULT WriteSerial([in] VARIANT pVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantCopyInd(&var0, &pDispParams->rgvarg[--index]);
@@ -2768,7 +2833,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 218: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 787: [propget, id(218), helpstring("property RenderingMode")] HRESULT RenderingMode([out, retval] int *pVal);
+				// line 789: [propget, id(218), helpstring("property RenderingMode")] HRESULT RenderingMode([out, retval] int *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_RenderingMode((int*)&V_I4(&res));
 			}
@@ -2776,7 +2841,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 230: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 789: [id(230), helpstring("method UpdateMaterial")] HRESULT UpdateMaterial([in] BSTR pVal, [in] float wrapLighting, [in] float roughness, [in] float glossyImageLerp, [in] float thickness, [in] float edge, [in] float edgeAlpha, [in] float opacity,[in] OLE_COLOR base, [in] OLE_COLOR glossy, [in] OLE_COLOR clearcoat, [in] VARIANT_BOOL isMetal, [in] VARIANT_BOOL opacityActive,[in] float elasticity, [in] float elasticityFalloff, [in] float friction, [in] float scatterAngle);
+				// line 791: [id(230), helpstring("method UpdateMaterial")] HRESULT UpdateMaterial([in] BSTR pVal, [in] float wrapLighting, [in] float roughness, [in] float glossyImageLerp, [in] float thickness, [in] float edge, [in] float edgeAlpha, [in] float opacity,[in] OLE_COLOR base, [in] OLE_COLOR glossy, [in] OLE_COLOR clearcoat, [in] VARIANT_BOOL isMetal, [in] VARIANT_BOOL opacityActive,[in] float elasticity, [in] float elasticityFalloff, [in] float friction, [in] float scatterAngle);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -2851,7 +2916,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 231: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 792: [id(231), helpstring("method GetMaterial")] HRESULT GetMaterial([in] BSTR pVal, [out] VARIANT *wrapLighting, [out] VARIANT *roughness, [out] VARIANT *glossyImageLerp, [out] VARIANT *thickness, [out] VARIANT *edge, [out] VARIANT *edgeAlpha, [out] VARIANT *opacity,[out] VARIANT *base, [out] VARIANT *glossy, [out] VARIANT *clearcoat, [out] VARIANT *isMetal, [out] VARIANT *opacityActive,[out] VARIANT *elasticity, [out] VARIANT *elasticityFalloff, [out] VARIANT *friction, [out] VARIANT *scatterAngle);
+				// line 794: [id(231), helpstring("method GetMaterial")] HRESULT GetMaterial([in] BSTR pVal, [out] VARIANT *wrapLighting, [out] VARIANT *roughness, [out] VARIANT *glossyImageLerp, [out] VARIANT *thickness, [out] VARIANT *edge, [out] VARIANT *edgeAlpha, [out] VARIANT *opacity,[out] VARIANT *base, [out] VARIANT *glossy, [out] VARIANT *clearcoat, [out] VARIANT *isMetal, [out] VARIANT *opacityActive,[out] VARIANT *elasticity, [out] VARIANT *elasticityFalloff, [out] VARIANT *friction, [out] VARIANT *scatterAngle);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -2878,7 +2943,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 247: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 795: [id(247), helpstring("method UpdateMaterialPhysics")] HRESULT UpdateMaterialPhysics([in] BSTR pVal,[in] float elasticity, [in] float elasticityFalloff, [in] float friction, [in] float scatterAngle);
+				// line 797: [id(247), helpstring("method UpdateMaterialPhysics")] HRESULT UpdateMaterialPhysics([in] BSTR pVal,[in] float elasticity, [in] float elasticityFalloff, [in] float friction, [in] float scatterAngle);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -2905,7 +2970,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 248: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 797: [id(248), helpstring("method GetMaterialPhysics")] HRESULT GetMaterialPhysics([in] BSTR pVal,[out] VARIANT *elasticity, [out] VARIANT *elasticityFalloff, [out] VARIANT *friction, [out] VARIANT *scatterAngle);
+				// line 799: [id(248), helpstring("method GetMaterialPhysics")] HRESULT GetMaterialPhysics([in] BSTR pVal,[out] VARIANT *elasticity, [out] VARIANT *elasticityFalloff, [out] VARIANT *friction, [out] VARIANT *scatterAngle);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -2920,7 +2985,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 224: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 799: [id(224), helpstring("method MaterialColor")] HRESULT MaterialColor([in] BSTR name, [in] OLE_COLOR newVal);
+				// line 801: [id(224), helpstring("method MaterialColor")] HRESULT MaterialColor([in] BSTR name, [in] OLE_COLOR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -2935,7 +3000,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 226: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 801: [propget, id(226), helpstring("property WindowWidth")] HRESULT WindowWidth([out, retval] int *pVal);
+				// line 803: [propget, id(226), helpstring("property WindowWidth")] HRESULT WindowWidth([out, retval] int *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_WindowWidth((int*)&V_I4(&res));
 			}
@@ -2943,7 +3008,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 227: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 802: [propget, id(227), helpstring("property WindowHeight")] HRESULT WindowHeight([out, retval] int *pVal);
+				// line 804: [propget, id(227), helpstring("property WindowHeight")] HRESULT WindowHeight([out, retval] int *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_WindowHeight((int*)&V_I4(&res));
 			}
@@ -2951,12 +3016,12 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 228: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 804: [propget, id(228), helpstring("property DisableStaticPrerendering")] HRESULT DisableStaticPrerendering([out, retval] VARIANT_BOOL *pVal);
+				// line 806: [propget, id(228), helpstring("property DisableStaticPrerendering")] HRESULT DisableStaticPrerendering([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_DisableStaticPrerendering(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 805: [propput, id(228), helpstring("property DisableStaticPrerendering")] HRESULT DisableStaticPrerendering([in] VARIANT_BOOL newVal);
+				// line 807: [propput, id(228), helpstring("property DisableStaticPrerendering")] HRESULT DisableStaticPrerendering([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -2967,7 +3032,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 229: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 807: [id(229), helpstring("method LoadTexture")] HRESULT LoadTexture([in] BSTR imageName, [in] BSTR fileName);
+				// line 809: [id(229), helpstring("method LoadTexture")] HRESULT LoadTexture([in] BSTR imageName, [in] BSTR fileName);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -2982,7 +3047,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 265: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 809: [id(265), helpstring("method CreatePluginObject") ] HRESULT CreatePluginObject([in] BSTR classId, [out, retval] IDispatch* *pVal);
+				// line 811: [id(265), helpstring("method CreatePluginObject") ] HRESULT CreatePluginObject([in] BSTR classId, [out, retval] IDispatch* *pVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -2994,7 +3059,7 @@ STDMETHODIMP ScriptGlobalTable::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCI
 		}
 		case 264: {
 			if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 812: [ propput, id(264), helpstring("property PinMameStateBlock") ] HRESULT PinMameStateBlock([in] BSTR sharedMemName);
+				// line 814: [ propput, id(264), helpstring("property PinMameStateBlock") ] HRESULT PinMameStateBlock([in] BSTR sharedMemName);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -4266,7 +4331,7 @@ STDMETHODIMP DebuggerModule::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID l
 		}
 		case 10: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 842: [id(10), helpstring("method Print")] HRESULT Print([in, optional] VARIANT* pvar);
+				// line 844: [id(10), helpstring("method Print")] HRESULT Print([in, optional] VARIANT* pvar);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantCopyInd(&var0, &pDispParams->rgvarg[--index]);
@@ -4378,12 +4443,12 @@ STDMETHODIMP Surface::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Name: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 857: [propget, id(DISPID_Name), helpstring("property Name")] HRESULT Name([out, retval] BSTR *pVal);
+				// line 859: [propget, id(DISPID_Name), helpstring("property Name")] HRESULT Name([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Name(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 858: [propput, id(DISPID_Name), helpstring("property Name")] HRESULT Name([in] BSTR newVal);
+				// line 860: [propput, id(DISPID_Name), helpstring("property Name")] HRESULT Name([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -4394,12 +4459,12 @@ STDMETHODIMP Surface::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Timer_Enabled: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 859: [propget, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([out, retval] VARIANT_BOOL *pVal);
+				// line 861: [propget, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_TimerEnabled(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 860: [propput, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([in] VARIANT_BOOL newVal);
+				// line 862: [propput, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -4410,12 +4475,12 @@ STDMETHODIMP Surface::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Timer_Interval: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 861: [propget, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([out, retval] long *pVal);
+				// line 863: [propget, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([out, retval] long *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_TimerInterval((LONG*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 862: [propput, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([in] long newVal);
+				// line 864: [propput, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([in] long newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -4426,12 +4491,12 @@ STDMETHODIMP Surface::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 34: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 863: [propget, id(34), helpstring("property HasHitEvent")] HRESULT HasHitEvent([out, retval] VARIANT_BOOL *pVal);
+				// line 865: [propget, id(34), helpstring("property HasHitEvent")] HRESULT HasHitEvent([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_HasHitEvent(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 864: [propput, id(34), helpstring("property HasHitEvent")] HRESULT HasHitEvent([in] VARIANT_BOOL newVal);
+				// line 866: [propput, id(34), helpstring("property HasHitEvent")] HRESULT HasHitEvent([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -4442,12 +4507,12 @@ STDMETHODIMP Surface::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 33: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 865: [propget, id(33), helpstring("property Threshold")] HRESULT Threshold([out, retval] float *pVal);
+				// line 867: [propget, id(33), helpstring("property Threshold")] HRESULT Threshold([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Threshold(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 866: [propput, id(33), helpstring("property Threshold")] HRESULT Threshold([in] float newVal);
+				// line 868: [propput, id(33), helpstring("property Threshold")] HRESULT Threshold([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -4458,12 +4523,12 @@ STDMETHODIMP Surface::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Image: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 867: [propget, id(DISPID_Image), helpstring("property Image")] HRESULT Image([out, retval] BSTR *pVal);
+				// line 869: [propget, id(DISPID_Image), helpstring("property Image")] HRESULT Image([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Image(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 868: [propput, id(DISPID_Image), helpstring("property Image")] HRESULT Image([in] BSTR newVal);
+				// line 870: [propput, id(DISPID_Image), helpstring("property Image")] HRESULT Image([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -4474,12 +4539,12 @@ STDMETHODIMP Surface::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 341: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 869: [propget, id(341), helpstring("property SideMaterial")] HRESULT SideMaterial([out, retval] BSTR *pVal);
+				// line 871: [propget, id(341), helpstring("property SideMaterial")] HRESULT SideMaterial([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_SideMaterial(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 870: [propput, id(341), helpstring("property SideMaterial")] HRESULT SideMaterial([in] BSTR newVal);
+				// line 872: [propput, id(341), helpstring("property SideMaterial")] HRESULT SideMaterial([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -4490,12 +4555,12 @@ STDMETHODIMP Surface::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 7: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 871: [propget, id(7), helpstring("property ImageAlignment")] HRESULT ImageAlignment([out, retval] ImageAlignment *pVal);
+				// line 873: [propget, id(7), helpstring("property ImageAlignment")] HRESULT ImageAlignment([out, retval] ImageAlignment *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_ImageAlignment((ImageAlignment*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 872: [propput, id(7), helpstring("property ImageAlignment")] HRESULT ImageAlignment([in] ImageAlignment newVal);
+				// line 874: [propput, id(7), helpstring("property ImageAlignment")] HRESULT ImageAlignment([in] ImageAlignment newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -4506,12 +4571,12 @@ STDMETHODIMP Surface::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 8: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 873: [propget, id(8), helpstring("property HeightBottom")] HRESULT HeightBottom([out, retval] float *pVal);
+				// line 875: [propget, id(8), helpstring("property HeightBottom")] HRESULT HeightBottom([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_HeightBottom(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 874: [propput, id(8), helpstring("property HeightBottom")] HRESULT HeightBottom([in] float newVal);
+				// line 876: [propput, id(8), helpstring("property HeightBottom")] HRESULT HeightBottom([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -4522,12 +4587,12 @@ STDMETHODIMP Surface::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 9: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 875: [propget, id(9), helpstring("property HeightTop")] HRESULT HeightTop([out, retval] float *pVal);
+				// line 877: [propget, id(9), helpstring("property HeightTop")] HRESULT HeightTop([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_HeightTop(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 876: [propput, id(9), helpstring("property HeightTop")] HRESULT HeightTop([in] float newVal);
+				// line 878: [propput, id(9), helpstring("property HeightTop")] HRESULT HeightTop([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -4538,12 +4603,12 @@ STDMETHODIMP Surface::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 340: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 877: [propget, id(340), helpstring("property TopMaterial")] HRESULT TopMaterial([out, retval] BSTR *pVal);
+				// line 879: [propget, id(340), helpstring("property TopMaterial")] HRESULT TopMaterial([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_TopMaterial(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 878: [propput, id(340), helpstring("property TopMaterial")] HRESULT TopMaterial([in] BSTR newVal);
+				// line 880: [propput, id(340), helpstring("property TopMaterial")] HRESULT TopMaterial([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -4554,12 +4619,12 @@ STDMETHODIMP Surface::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 11: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 879: [propget, id(11), helpstring("property CanDrop")] HRESULT CanDrop([out, retval] VARIANT_BOOL *pVal);
+				// line 881: [propget, id(11), helpstring("property CanDrop")] HRESULT CanDrop([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_CanDrop(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 880: [propput, id(11), helpstring("property CanDrop")] HRESULT CanDrop([in] VARIANT_BOOL newVal);
+				// line 882: [propput, id(11), helpstring("property CanDrop")] HRESULT CanDrop([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -4570,12 +4635,12 @@ STDMETHODIMP Surface::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 111: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 882: [propget, id(111), helpstring("property Collidable")] HRESULT Collidable([out, retval] VARIANT_BOOL *pVal);
+				// line 884: [propget, id(111), helpstring("property Collidable")] HRESULT Collidable([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_Collidable(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 883: [propput, id(111), helpstring("property Collidable")] HRESULT Collidable([in] VARIANT_BOOL newVal);
+				// line 885: [propput, id(111), helpstring("property Collidable")] HRESULT Collidable([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -4586,12 +4651,12 @@ STDMETHODIMP Surface::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 12: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 885: [propget, id(12), helpstring("property IsDropped")] HRESULT IsDropped([out, retval] VARIANT_BOOL *pVal);
+				// line 887: [propget, id(12), helpstring("property IsDropped")] HRESULT IsDropped([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_IsDropped(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 886: [propput, id(12), helpstring("property IsDropped")] HRESULT IsDropped([in] VARIANT_BOOL newVal);
+				// line 888: [propput, id(12), helpstring("property IsDropped")] HRESULT IsDropped([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -4602,12 +4667,12 @@ STDMETHODIMP Surface::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 13: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 887: [propget, id(13), helpstring("property DisplayTexture")] HRESULT DisplayTexture([out, retval] VARIANT_BOOL *pVal);
+				// line 889: [propget, id(13), helpstring("property DisplayTexture")] HRESULT DisplayTexture([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_DisplayTexture(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 888: [propput, id(13), helpstring("property DisplayTexture")] HRESULT DisplayTexture([in] VARIANT_BOOL newVal);
+				// line 890: [propput, id(13), helpstring("property DisplayTexture")] HRESULT DisplayTexture([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -4618,12 +4683,12 @@ STDMETHODIMP Surface::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 14: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 889: [propget, id(14), helpstring("property SlingshotStrength")] HRESULT SlingshotStrength([out, retval] float *pVal);
+				// line 891: [propget, id(14), helpstring("property SlingshotStrength")] HRESULT SlingshotStrength([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_SlingshotStrength(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 890: [propput, id(14), helpstring("property SlingshotStrength")] HRESULT SlingshotStrength([in] float newVal);
+				// line 892: [propput, id(14), helpstring("property SlingshotStrength")] HRESULT SlingshotStrength([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -4634,12 +4699,12 @@ STDMETHODIMP Surface::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 110: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 891: [propget, id(110), helpstring("property Elasticity")] HRESULT Elasticity([out, retval] float *pVal);
+				// line 893: [propget, id(110), helpstring("property Elasticity")] HRESULT Elasticity([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Elasticity(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 892: [propput, id(110), helpstring("property Elasticity")] HRESULT Elasticity([in] float newVal);
+				// line 894: [propput, id(110), helpstring("property Elasticity")] HRESULT Elasticity([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -4650,12 +4715,12 @@ STDMETHODIMP Surface::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 120: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 893: [propget, id(120), helpstring("property ElasticityFalloff")] HRESULT ElasticityFalloff([out, retval] float *pVal);
+				// line 895: [propget, id(120), helpstring("property ElasticityFalloff")] HRESULT ElasticityFalloff([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_ElasticityFalloff(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 894: [propput, id(120), helpstring("property ElasticityFalloff")] HRESULT ElasticityFalloff([in] float newVal);
+				// line 896: [propput, id(120), helpstring("property ElasticityFalloff")] HRESULT ElasticityFalloff([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -4666,12 +4731,12 @@ STDMETHODIMP Surface::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Image2: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 895: [propget, id(DISPID_Image2), helpstring("property SideImage")] HRESULT SideImage([out, retval] BSTR *pVal);
+				// line 897: [propget, id(DISPID_Image2), helpstring("property SideImage")] HRESULT SideImage([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_SideImage(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 896: [propput, id(DISPID_Image2), helpstring("property SideImage")] HRESULT SideImage([in] BSTR newVal);
+				// line 898: [propput, id(DISPID_Image2), helpstring("property SideImage")] HRESULT SideImage([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -4682,12 +4747,12 @@ STDMETHODIMP Surface::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 16: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 897: [propget, id(16), helpstring("property Visible")] HRESULT Visible([out, retval] VARIANT_BOOL *pVal);
+				// line 899: [propget, id(16), helpstring("property Visible")] HRESULT Visible([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_Visible(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 898: [propput, id(16), helpstring("property Visible")] HRESULT Visible([in] VARIANT_BOOL newVal);
+				// line 900: [propput, id(16), helpstring("property Visible")] HRESULT Visible([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -4698,12 +4763,12 @@ STDMETHODIMP Surface::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 108: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 899: [propget, id(108), helpstring("property Disabled")] HRESULT Disabled([out, retval] VARIANT_BOOL *pVal);
+				// line 901: [propget, id(108), helpstring("property Disabled")] HRESULT Disabled([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_Disabled(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 900: [propput, id(108), helpstring("property Disabled")] HRESULT Disabled([in] VARIANT_BOOL newVal);
+				// line 902: [propput, id(108), helpstring("property Disabled")] HRESULT Disabled([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -4714,12 +4779,12 @@ STDMETHODIMP Surface::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 109: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 901: [propget, id(109), helpstring("property SideVisible")] HRESULT SideVisible([out, retval] VARIANT_BOOL *pVal);
+				// line 903: [propget, id(109), helpstring("property SideVisible")] HRESULT SideVisible([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_SideVisible(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 902: [propput, id(109), helpstring("property SideVisible")] HRESULT SideVisible([in] VARIANT_BOOL newVal);
+				// line 904: [propput, id(109), helpstring("property SideVisible")] HRESULT SideVisible([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -4730,11 +4795,11 @@ STDMETHODIMP Surface::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_UserValue: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 903: [propget, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([out, retval] VARIANT* pVal);
+				// line 905: [propget, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([out, retval] VARIANT* pVal);
 				hres = get_UserValue(&res);
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 904: [propput, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([in] VARIANT* newVal);
+				// line 906: [propput, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([in] VARIANT* newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantCopyInd(&var0, &pDispParams->rgvarg[--index]);
@@ -4745,12 +4810,12 @@ STDMETHODIMP Surface::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 426: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 905: [propget, id(426), helpstring("property SlingshotMaterial")] HRESULT SlingshotMaterial([out, retval] BSTR *pVal);
+				// line 907: [propget, id(426), helpstring("property SlingshotMaterial")] HRESULT SlingshotMaterial([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_SlingshotMaterial(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 906: [propput, id(426), helpstring("property SlingshotMaterial")] HRESULT SlingshotMaterial([in] BSTR newVal);
+				// line 908: [propput, id(426), helpstring("property SlingshotMaterial")] HRESULT SlingshotMaterial([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -4761,12 +4826,12 @@ STDMETHODIMP Surface::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 427: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 907: [propget, id(427), helpstring("property SlingshotThreshold")] HRESULT SlingshotThreshold([out, retval] float *pVal);
+				// line 909: [propget, id(427), helpstring("property SlingshotThreshold")] HRESULT SlingshotThreshold([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_SlingshotThreshold(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 908: [propput, id(427), helpstring("property SlingshotThreshold")] HRESULT SlingshotThreshold([in] float newVal);
+				// line 910: [propput, id(427), helpstring("property SlingshotThreshold")] HRESULT SlingshotThreshold([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -4777,12 +4842,12 @@ STDMETHODIMP Surface::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 112: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 909: [propget, id(112), helpstring("property SlingshotAnimation")] HRESULT SlingshotAnimation([out, retval] VARIANT_BOOL *pVal);
+				// line 911: [propget, id(112), helpstring("property SlingshotAnimation")] HRESULT SlingshotAnimation([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_SlingshotAnimation(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 910: [propput, id(112), helpstring("property SlingshotAnimation")] HRESULT SlingshotAnimation([in] VARIANT_BOOL newVal);
+				// line 912: [propput, id(112), helpstring("property SlingshotAnimation")] HRESULT SlingshotAnimation([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -4793,12 +4858,12 @@ STDMETHODIMP Surface::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 113: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 911: [propget, id(113), helpstring("property FlipbookAnimation")] HRESULT FlipbookAnimation([out, retval] VARIANT_BOOL *pVal);
+				// line 913: [propget, id(113), helpstring("property FlipbookAnimation")] HRESULT FlipbookAnimation([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_FlipbookAnimation(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 912: [propput, id(113), helpstring("property FlipbookAnimation")] HRESULT FlipbookAnimation([in] VARIANT_BOOL newVal);
+				// line 914: [propput, id(113), helpstring("property FlipbookAnimation")] HRESULT FlipbookAnimation([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -4809,12 +4874,12 @@ STDMETHODIMP Surface::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 116: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 913: [propget, id(116), helpstring("property IsBottomSolid")] HRESULT IsBottomSolid([out, retval] VARIANT_BOOL *pVal);
+				// line 915: [propget, id(116), helpstring("property IsBottomSolid")] HRESULT IsBottomSolid([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_IsBottomSolid(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 914: [propput, id(116), helpstring("property IsBottomSolid")] HRESULT IsBottomSolid([in] VARIANT_BOOL newVal);
+				// line 916: [propput, id(116), helpstring("property IsBottomSolid")] HRESULT IsBottomSolid([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -4825,12 +4890,12 @@ STDMETHODIMP Surface::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 484: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 915: [propget, id(484), helpstring("property DisableLighting")] HRESULT DisableLighting([out, retval] VARIANT_BOOL *pVal);
+				// line 917: [propget, id(484), helpstring("property DisableLighting")] HRESULT DisableLighting([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_DisableLighting(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 916: [propput, id(484), helpstring("property DisableLighting")] HRESULT DisableLighting([in] VARIANT_BOOL newVal);
+				// line 918: [propput, id(484), helpstring("property DisableLighting")] HRESULT DisableLighting([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -4841,12 +4906,12 @@ STDMETHODIMP Surface::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 494: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 917: [propget, id(494), helpstring("property BlendDisableLighting")] HRESULT BlendDisableLighting([out, retval] float *pVal);
+				// line 919: [propget, id(494), helpstring("property BlendDisableLighting")] HRESULT BlendDisableLighting([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_BlendDisableLighting(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 918: [propput, id(494), helpstring("property BlendDisableLighting")] HRESULT BlendDisableLighting([in] float newVal);
+				// line 920: [propput, id(494), helpstring("property BlendDisableLighting")] HRESULT BlendDisableLighting([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -4857,12 +4922,12 @@ STDMETHODIMP Surface::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 496: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 919: [propget, id(496), helpstring("property BlendDisableLightingFromBelow")] HRESULT BlendDisableLightingFromBelow([out, retval] float *pVal);
+				// line 921: [propget, id(496), helpstring("property BlendDisableLightingFromBelow")] HRESULT BlendDisableLightingFromBelow([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_BlendDisableLightingFromBelow(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 920: [propput, id(496), helpstring("property BlendDisableLightingFromBelow")] HRESULT BlendDisableLightingFromBelow([in] float newVal);
+				// line 922: [propput, id(496), helpstring("property BlendDisableLightingFromBelow")] HRESULT BlendDisableLightingFromBelow([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -4873,12 +4938,12 @@ STDMETHODIMP Surface::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 114: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 921: [propget, id(114), helpstring("property Friction")] HRESULT Friction([out, retval] float *pVal);
+				// line 923: [propget, id(114), helpstring("property Friction")] HRESULT Friction([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Friction(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 922: [propput, id(114), helpstring("property Friction")] HRESULT Friction([in] float newVal);
+				// line 924: [propput, id(114), helpstring("property Friction")] HRESULT Friction([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -4889,12 +4954,12 @@ STDMETHODIMP Surface::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 115: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 923: [propget, id(115), helpstring("property Scatter")] HRESULT Scatter([out, retval] float *pVal);
+				// line 925: [propget, id(115), helpstring("property Scatter")] HRESULT Scatter([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Scatter(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 924: [propput, id(115), helpstring("property Scatter")] HRESULT Scatter([in] float newVal);
+				// line 926: [propput, id(115), helpstring("property Scatter")] HRESULT Scatter([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -4905,12 +4970,12 @@ STDMETHODIMP Surface::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 431: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 925: [propget, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([out, retval] VARIANT_BOOL *pVal);
+				// line 927: [propget, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_ReflectionEnabled(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 926: [propput, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([in] VARIANT_BOOL newVal);
+				// line 928: [propput, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -4921,19 +4986,19 @@ STDMETHODIMP Surface::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 999: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 927: [id(999), helpstring("method PlaySlingshotHit")] HRESULT PlaySlingshotHit();
+				// line 929: [id(999), helpstring("method PlaySlingshotHit")] HRESULT PlaySlingshotHit();
 				hres = PlaySlingshotHit();
 			}
 			break;
 		}
 		case 734: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 928: [propget, id(734), helpstring("property PhysicsMaterial")] HRESULT PhysicsMaterial([out, retval] BSTR *pVal);
+				// line 930: [propget, id(734), helpstring("property PhysicsMaterial")] HRESULT PhysicsMaterial([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_PhysicsMaterial(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 929: [propput, id(734), helpstring("property PhysicsMaterial")] HRESULT PhysicsMaterial([in] BSTR newVal);
+				// line 931: [propput, id(734), helpstring("property PhysicsMaterial")] HRESULT PhysicsMaterial([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -4944,12 +5009,12 @@ STDMETHODIMP Surface::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 432: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 930: [propget, id(432), helpstring("property OverwritePhysics")] HRESULT OverwritePhysics([out, retval] VARIANT_BOOL *pVal);
+				// line 932: [propget, id(432), helpstring("property OverwritePhysics")] HRESULT OverwritePhysics([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_OverwritePhysics(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 931: [propput, id(432), helpstring("property OverwritePhysics")] HRESULT OverwritePhysics([in] VARIANT_BOOL newVal);
+				// line 933: [propput, id(432), helpstring("property OverwritePhysics")] HRESULT OverwritePhysics([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -5071,12 +5136,12 @@ STDMETHODIMP DragPoint::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 1: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 956: [propget, id(1), helpstring("property X")] HRESULT X([out, retval] float *pVal);
+				// line 958: [propget, id(1), helpstring("property X")] HRESULT X([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_X(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 957: [propput, id(1), helpstring("property X")] HRESULT X([in] float newVal);
+				// line 959: [propput, id(1), helpstring("property X")] HRESULT X([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -5087,12 +5152,12 @@ STDMETHODIMP DragPoint::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 2: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 958: [propget, id(2), helpstring("property Y")] HRESULT Y([out, retval] float *pVal);
+				// line 960: [propget, id(2), helpstring("property Y")] HRESULT Y([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Y(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 959: [propput, id(2), helpstring("property Y")] HRESULT Y([in] float newVal);
+				// line 961: [propput, id(2), helpstring("property Y")] HRESULT Y([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -5103,12 +5168,12 @@ STDMETHODIMP DragPoint::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 6: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 960: [propget, id(6), helpstring("property Z")] HRESULT Z([out, retval] float *pVal);
+				// line 962: [propget, id(6), helpstring("property Z")] HRESULT Z([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Z(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 961: [propput, id(6), helpstring("property Z")] HRESULT Z([in] float newVal);
+				// line 963: [propput, id(6), helpstring("property Z")] HRESULT Z([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -5119,7 +5184,7 @@ STDMETHODIMP DragPoint::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 377: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 962: [propget, id(377), helpstring("property calcHeight")] HRESULT CalcHeight([out, retval] float *pVal);
+				// line 964: [propget, id(377), helpstring("property calcHeight")] HRESULT CalcHeight([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_CalcHeight(&V_R4(&res));
 			}
@@ -5127,12 +5192,12 @@ STDMETHODIMP DragPoint::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 3: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 963: [propget, id(3), helpstring("property Smooth")] HRESULT Smooth([out, retval] VARIANT_BOOL *pVal);
+				// line 965: [propget, id(3), helpstring("property Smooth")] HRESULT Smooth([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_Smooth(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 964: [propput, id(3), helpstring("property Smooth")] HRESULT Smooth([in] VARIANT_BOOL newVal);
+				// line 966: [propput, id(3), helpstring("property Smooth")] HRESULT Smooth([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -5143,12 +5208,12 @@ STDMETHODIMP DragPoint::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 4: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 965: [propget, id(4), helpstring("property IsAutoTextureCoordinate")] HRESULT IsAutoTextureCoordinate([out, retval] VARIANT_BOOL *pVal);
+				// line 967: [propget, id(4), helpstring("property IsAutoTextureCoordinate")] HRESULT IsAutoTextureCoordinate([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_IsAutoTextureCoordinate(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 966: [propput, id(4), helpstring("property IsAutoTextureCoordinate")] HRESULT IsAutoTextureCoordinate([in] VARIANT_BOOL newVal);
+				// line 968: [propput, id(4), helpstring("property IsAutoTextureCoordinate")] HRESULT IsAutoTextureCoordinate([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -5159,12 +5224,12 @@ STDMETHODIMP DragPoint::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 5: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 967: [propget, id(5), helpstring("property TextureCoordinateU")] HRESULT TextureCoordinateU([out, retval] float *pVal);
+				// line 969: [propget, id(5), helpstring("property TextureCoordinateU")] HRESULT TextureCoordinateU([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_TextureCoordinateU(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 968: [propput, id(5), helpstring("property TextureCoordinateU")] HRESULT TextureCoordinateU([in] float newVal);
+				// line 970: [propput, id(5), helpstring("property TextureCoordinateU")] HRESULT TextureCoordinateU([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -5276,12 +5341,12 @@ STDMETHODIMP Flipper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 1: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 986: [propget, id(1), helpstring("property BaseRadius")] HRESULT BaseRadius([out, retval] float *pVal);
+				// line 988: [propget, id(1), helpstring("property BaseRadius")] HRESULT BaseRadius([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_BaseRadius(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 987: [propput, id(1), helpstring("property BaseRadius")] HRESULT BaseRadius([in] float newVal);
+				// line 989: [propput, id(1), helpstring("property BaseRadius")] HRESULT BaseRadius([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -5292,12 +5357,12 @@ STDMETHODIMP Flipper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 2: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 988: [propget, id(2), helpstring("property EndRadius")] HRESULT EndRadius([out, retval] float *pVal);
+				// line 990: [propget, id(2), helpstring("property EndRadius")] HRESULT EndRadius([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_EndRadius(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 989: [propput, id(2), helpstring("property EndRadius")] HRESULT EndRadius([in] float newVal);
+				// line 991: [propput, id(2), helpstring("property EndRadius")] HRESULT EndRadius([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -5308,12 +5373,12 @@ STDMETHODIMP Flipper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 3: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 990: [propget, id(3), helpstring("property Length")] HRESULT Length([out, retval] float *pVal);
+				// line 992: [propget, id(3), helpstring("property Length")] HRESULT Length([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Length(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 991: [propput, id(3), helpstring("property Length")] HRESULT Length([in] float newVal);
+				// line 993: [propput, id(3), helpstring("property Length")] HRESULT Length([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -5324,12 +5389,12 @@ STDMETHODIMP Flipper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 4: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 992: [propget, id(4), helpstring("property StartAngle")] HRESULT StartAngle([out, retval] float *pVal);
+				// line 994: [propget, id(4), helpstring("property StartAngle")] HRESULT StartAngle([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_StartAngle(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 993: [propput, id(4), helpstring("property StartAngle")] HRESULT StartAngle([in] float newVal);
+				// line 995: [propput, id(4), helpstring("property StartAngle")] HRESULT StartAngle([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -5340,26 +5405,26 @@ STDMETHODIMP Flipper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 5: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 994: [id(5), helpstring("method RotateToEnd")] HRESULT RotateToEnd();
+				// line 996: [id(5), helpstring("method RotateToEnd")] HRESULT RotateToEnd();
 				hres = RotateToEnd();
 			}
 			break;
 		}
 		case 6: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 995: [id(6), helpstring("method RotateToStart")] HRESULT RotateToStart();
+				// line 997: [id(6), helpstring("method RotateToStart")] HRESULT RotateToStart();
 				hres = RotateToStart();
 			}
 			break;
 		}
 		case 7: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 996: [propget, id(7), helpstring("property EndAngle")] HRESULT EndAngle([out, retval] float *pVal);
+				// line 998: [propget, id(7), helpstring("property EndAngle")] HRESULT EndAngle([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_EndAngle(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 997: [propput, id(7), helpstring("property EndAngle")] HRESULT EndAngle([in] float newVal);
+				// line 999: [propput, id(7), helpstring("property EndAngle")] HRESULT EndAngle([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -5370,12 +5435,12 @@ STDMETHODIMP Flipper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Timer_Enabled: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1002: [propget, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([out, retval] VARIANT_BOOL *pVal);
+				// line 1004: [propget, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_TimerEnabled(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1003: [propput, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([in] VARIANT_BOOL newVal);
+				// line 1005: [propput, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -5386,12 +5451,12 @@ STDMETHODIMP Flipper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Timer_Interval: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1004: [propget, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([out, retval] long *pVal);
+				// line 1006: [propget, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([out, retval] long *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_TimerInterval((LONG*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1005: [propput, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([in] long newVal);
+				// line 1007: [propput, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([in] long newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -5402,7 +5467,7 @@ STDMETHODIMP Flipper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 12: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1006: [propget, id(12), nonbrowsable, helpstring("property CurrentAngle")] HRESULT CurrentAngle([out, retval] float *pVal);
+				// line 1008: [propget, id(12), nonbrowsable, helpstring("property CurrentAngle")] HRESULT CurrentAngle([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_CurrentAngle(&V_R4(&res));
 			}
@@ -5410,12 +5475,12 @@ STDMETHODIMP Flipper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 13: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1007: [propget, id(13), helpstring("property X")] HRESULT X([out, retval] float *pVal);
+				// line 1009: [propget, id(13), helpstring("property X")] HRESULT X([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_X(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1008: [propput, id(13), helpstring("property X")] HRESULT X([in] float newVal);
+				// line 1010: [propput, id(13), helpstring("property X")] HRESULT X([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -5426,12 +5491,12 @@ STDMETHODIMP Flipper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 14: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1009: [propget, id(14), helpstring("property Y")] HRESULT Y([out, retval] float *pVal);
+				// line 1011: [propget, id(14), helpstring("property Y")] HRESULT Y([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Y(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1010: [propput, id(14), helpstring("property Y")] HRESULT Y([in] float newVal);
+				// line 1012: [propput, id(14), helpstring("property Y")] HRESULT Y([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -5442,12 +5507,12 @@ STDMETHODIMP Flipper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 340: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1011: [propget, id(340), helpstring("property Material")] HRESULT Material([out, retval] BSTR *pVal);
+				// line 1013: [propget, id(340), helpstring("property Material")] HRESULT Material([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Material(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1012: [propput, id(340), helpstring("property Material")] HRESULT Material([in] BSTR newVal);
+				// line 1014: [propput, id(340), helpstring("property Material")] HRESULT Material([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -5458,12 +5523,12 @@ STDMETHODIMP Flipper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Flipper_Speed: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1013: [propget, id(DISPID_Flipper_Speed), helpstring("property Mass")] HRESULT Mass([out, retval] float *pVal);
+				// line 1015: [propget, id(DISPID_Flipper_Speed), helpstring("property Mass")] HRESULT Mass([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Mass(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1014: [propput, id(DISPID_Flipper_Speed), helpstring("property Mass")] HRESULT Mass([in] float newVal);
+				// line 1016: [propput, id(DISPID_Flipper_Speed), helpstring("property Mass")] HRESULT Mass([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -5474,12 +5539,12 @@ STDMETHODIMP Flipper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Flipper_OverridePhysics: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1015: [propget, id(DISPID_Flipper_OverridePhysics), helpstring("property OverridePhysics")] HRESULT OverridePhysics([out, retval] PhysicsSet *pVal);
+				// line 1017: [propget, id(DISPID_Flipper_OverridePhysics), helpstring("property OverridePhysics")] HRESULT OverridePhysics([out, retval] PhysicsSet *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_OverridePhysics((PhysicsSet*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1016: [propput, id(DISPID_Flipper_OverridePhysics), helpstring("property OverridePhysics")] HRESULT OverridePhysics([in] PhysicsSet newVal);
+				// line 1018: [propput, id(DISPID_Flipper_OverridePhysics), helpstring("property OverridePhysics")] HRESULT OverridePhysics([in] PhysicsSet newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -5490,12 +5555,12 @@ STDMETHODIMP Flipper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 341: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1017: [propget, id(341), helpstring("property RubberMaterial")] HRESULT RubberMaterial([out, retval] BSTR *pVal);
+				// line 1019: [propget, id(341), helpstring("property RubberMaterial")] HRESULT RubberMaterial([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_RubberMaterial(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1018: [propput, id(341), helpstring("property RubberMaterial")] HRESULT RubberMaterial([in] BSTR newVal);
+				// line 1020: [propput, id(341), helpstring("property RubberMaterial")] HRESULT RubberMaterial([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -5506,12 +5571,12 @@ STDMETHODIMP Flipper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 18: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1019: [propget, id(18), helpstring("property RubberThickness")] HRESULT RubberThickness([out, retval] float *pVal);
+				// line 1021: [propget, id(18), helpstring("property RubberThickness")] HRESULT RubberThickness([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_RubberThickness(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1020: [propput, id(18), helpstring("property RubberThickness")] HRESULT RubberThickness([in] float newVal);
+				// line 1022: [propput, id(18), helpstring("property RubberThickness")] HRESULT RubberThickness([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -5522,12 +5587,12 @@ STDMETHODIMP Flipper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 19: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1021: [propget, id(19), helpstring("property Strength")] HRESULT Strength([out, retval] float *pVal);
+				// line 1023: [propget, id(19), helpstring("property Strength")] HRESULT Strength([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Strength(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1022: [propput, id(19), helpstring("property Strength")] HRESULT Strength([in] float newVal);
+				// line 1024: [propput, id(19), helpstring("property Strength")] HRESULT Strength([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -5538,12 +5603,12 @@ STDMETHODIMP Flipper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 458: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1023: [propget, id(458), helpstring("property Visible")] HRESULT Visible([out, retval] VARIANT_BOOL *pVal);
+				// line 1025: [propget, id(458), helpstring("property Visible")] HRESULT Visible([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_Visible(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1024: [propput, id(458), helpstring("property Visible")] HRESULT Visible([in] VARIANT_BOOL newVal);
+				// line 1026: [propput, id(458), helpstring("property Visible")] HRESULT Visible([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -5554,12 +5619,12 @@ STDMETHODIMP Flipper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 394: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1025: [propget, id(394), helpstring("property Enabled")] HRESULT Enabled([out, retval] VARIANT_BOOL *pVal);
+				// line 1027: [propget, id(394), helpstring("property Enabled")] HRESULT Enabled([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_Enabled(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1026: [propput, id(394), helpstring("property Enabled")] HRESULT Enabled([in] VARIANT_BOOL newVal);
+				// line 1028: [propput, id(394), helpstring("property Enabled")] HRESULT Enabled([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -5570,12 +5635,12 @@ STDMETHODIMP Flipper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 110: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1027: [propget, id(110), helpstring("property Elasticity")] HRESULT Elasticity([out, retval] float *pVal);
+				// line 1029: [propget, id(110), helpstring("property Elasticity")] HRESULT Elasticity([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Elasticity(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1028: [propput, id(110), helpstring("property Elasticity")] HRESULT Elasticity([in] float newVal);
+				// line 1030: [propput, id(110), helpstring("property Elasticity")] HRESULT Elasticity([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -5586,12 +5651,12 @@ STDMETHODIMP Flipper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 115: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1029: [propget, id(115), helpstring("property Scatter")] HRESULT Scatter([out, retval] float *pVal);
+				// line 1031: [propget, id(115), helpstring("property Scatter")] HRESULT Scatter([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Scatter(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1030: [propput, id(115), helpstring("property Scatter")] HRESULT Scatter([in] float newVal);
+				// line 1032: [propput, id(115), helpstring("property Scatter")] HRESULT Scatter([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -5602,12 +5667,12 @@ STDMETHODIMP Flipper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 23: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1031: [propget, id(23), helpstring("property Return")] HRESULT Return([out, retval] float *pVal);
+				// line 1033: [propget, id(23), helpstring("property Return")] HRESULT Return([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Return(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1032: [propput, id(23), helpstring("property Return")] HRESULT Return([in] float newVal);
+				// line 1034: [propput, id(23), helpstring("property Return")] HRESULT Return([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -5618,12 +5683,12 @@ STDMETHODIMP Flipper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 24: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1033: [propget, id(24), helpstring("property RubberHeight")] HRESULT RubberHeight([out, retval] float *pVal);
+				// line 1035: [propget, id(24), helpstring("property RubberHeight")] HRESULT RubberHeight([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_RubberHeight(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1034: [propput, id(24), helpstring("property RubberHeight")] HRESULT RubberHeight([in] float newVal);
+				// line 1036: [propput, id(24), helpstring("property RubberHeight")] HRESULT RubberHeight([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -5634,12 +5699,12 @@ STDMETHODIMP Flipper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 25: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1035: [propget, id(25), helpstring("property RubberWidth")] HRESULT RubberWidth([out, retval] float *pVal);
+				// line 1037: [propget, id(25), helpstring("property RubberWidth")] HRESULT RubberWidth([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_RubberWidth(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1036: [propput, id(25), helpstring("property RubberWidth")] HRESULT RubberWidth([in] float newVal);
+				// line 1038: [propput, id(25), helpstring("property RubberWidth")] HRESULT RubberWidth([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -5650,12 +5715,12 @@ STDMETHODIMP Flipper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 114: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1037: [propget, id(114), helpstring("property Friction")] HRESULT Friction([out, retval] float *pVal);
+				// line 1039: [propget, id(114), helpstring("property Friction")] HRESULT Friction([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Friction(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1038: [propput, id(114), helpstring("property Friction")] HRESULT Friction([in] float newVal);
+				// line 1040: [propput, id(114), helpstring("property Friction")] HRESULT Friction([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -5666,12 +5731,12 @@ STDMETHODIMP Flipper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 27: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1039: [propget, id(27), helpstring("property RampUp")] HRESULT RampUp([out, retval] float *pVal);
+				// line 1041: [propget, id(27), helpstring("property RampUp")] HRESULT RampUp([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_RampUp(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1040: [propput, id(27), helpstring("property RampUp")] HRESULT RampUp([in] float newVal);
+				// line 1042: [propput, id(27), helpstring("property RampUp")] HRESULT RampUp([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -5682,12 +5747,12 @@ STDMETHODIMP Flipper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 28: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1041: [propget, id(28), helpstring("property ElasticityFalloff")] HRESULT ElasticityFalloff([out, retval] float *pVal);
+				// line 1043: [propget, id(28), helpstring("property ElasticityFalloff")] HRESULT ElasticityFalloff([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_ElasticityFalloff(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1042: [propput, id(28), helpstring("property ElasticityFalloff")] HRESULT ElasticityFalloff([in] float newVal);
+				// line 1044: [propput, id(28), helpstring("property ElasticityFalloff")] HRESULT ElasticityFalloff([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -5698,12 +5763,12 @@ STDMETHODIMP Flipper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Surface: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1043: [propget, id(DISPID_Surface), helpstring("property Surface")] HRESULT Surface([out, retval] BSTR *pVal);
+				// line 1045: [propget, id(DISPID_Surface), helpstring("property Surface")] HRESULT Surface([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Surface(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1044: [propput, id(DISPID_Surface), helpstring("property Surface")] HRESULT Surface([in] BSTR newVal);
+				// line 1046: [propput, id(DISPID_Surface), helpstring("property Surface")] HRESULT Surface([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -5714,12 +5779,12 @@ STDMETHODIMP Flipper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Name: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1045: [propget, id(DISPID_Name), helpstring("property Name")] HRESULT Name([out, retval] BSTR *pVal);
+				// line 1047: [propget, id(DISPID_Name), helpstring("property Name")] HRESULT Name([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Name(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1046: [propput, id(DISPID_Name), helpstring("property Name")] HRESULT Name([in] BSTR newVal);
+				// line 1048: [propput, id(DISPID_Name), helpstring("property Name")] HRESULT Name([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -5730,11 +5795,11 @@ STDMETHODIMP Flipper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_UserValue: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1047: [propget, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([out, retval] VARIANT* pVal);
+				// line 1049: [propget, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([out, retval] VARIANT* pVal);
 				hres = get_UserValue(&res);
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1048: [propput, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([in] VARIANT* newVal);
+				// line 1050: [propput, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([in] VARIANT* newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantCopyInd(&var0, &pDispParams->rgvarg[--index]);
@@ -5745,12 +5810,12 @@ STDMETHODIMP Flipper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 107: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1049: [propget, id(107), helpstring("property Height")] HRESULT Height([out, retval] float *pVal);
+				// line 1051: [propget, id(107), helpstring("property Height")] HRESULT Height([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Height(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1050: [propput, id(107), helpstring("property Height")] HRESULT Height([in] float newVal);
+				// line 1052: [propput, id(107), helpstring("property Height")] HRESULT Height([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -5761,12 +5826,12 @@ STDMETHODIMP Flipper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 113: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1051: [propget, id(113), helpstring("property EOSTorque")] HRESULT EOSTorque([out, retval] float *pVal);
+				// line 1053: [propget, id(113), helpstring("property EOSTorque")] HRESULT EOSTorque([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_EOSTorque(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1052: [propput, id(113), helpstring("property EOSTorque")] HRESULT EOSTorque([in] float newVal);
+				// line 1054: [propput, id(113), helpstring("property EOSTorque")] HRESULT EOSTorque([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -5777,12 +5842,12 @@ STDMETHODIMP Flipper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 189: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1053: [propget, id(189), helpstring("property EOSTorqueAngle")] HRESULT EOSTorqueAngle([out, retval] float *pVal);
+				// line 1055: [propget, id(189), helpstring("property EOSTorqueAngle")] HRESULT EOSTorqueAngle([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_EOSTorqueAngle(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1054: [propput, id(189), helpstring("property EOSTorqueAngle")] HRESULT EOSTorqueAngle([in] float newVal);
+				// line 1056: [propput, id(189), helpstring("property EOSTorqueAngle")] HRESULT EOSTorqueAngle([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -5793,12 +5858,12 @@ STDMETHODIMP Flipper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 111: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1056: [propget, id(111), helpstring("property FlipperRadiusMin")] HRESULT FlipperRadiusMin([out, retval] float *pVal);
+				// line 1058: [propget, id(111), helpstring("property FlipperRadiusMin")] HRESULT FlipperRadiusMin([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_FlipperRadiusMin(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1057: [propput, id(111), helpstring("property FlipperRadiusMin")] HRESULT FlipperRadiusMin([in] float newVal);
+				// line 1059: [propput, id(111), helpstring("property FlipperRadiusMin")] HRESULT FlipperRadiusMin([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -5809,12 +5874,12 @@ STDMETHODIMP Flipper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Image: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1059: [propget, id(DISPID_Image), helpstring("property Image")] HRESULT Image([out, retval] BSTR *pVal);
+				// line 1061: [propget, id(DISPID_Image), helpstring("property Image")] HRESULT Image([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Image(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1060: [propput, id(DISPID_Image), helpstring("property Image")] HRESULT Image([in] BSTR newVal);
+				// line 1062: [propput, id(DISPID_Image), helpstring("property Image")] HRESULT Image([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -5825,12 +5890,12 @@ STDMETHODIMP Flipper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 431: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1061: [propget, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([out, retval] VARIANT_BOOL *pVal);
+				// line 1063: [propget, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_ReflectionEnabled(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1062: [propput, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([in] VARIANT_BOOL newVal);
+				// line 1064: [propput, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -5952,12 +6017,12 @@ STDMETHODIMP Timer::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case DISPID_Timer_Enabled: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1094: [propget, id(DISPID_Timer_Enabled), helpstring("property Enabled")] HRESULT Enabled([out, retval] VARIANT_BOOL *pVal);
+				// line 1096: [propget, id(DISPID_Timer_Enabled), helpstring("property Enabled")] HRESULT Enabled([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_Enabled(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1095: [propput, id(DISPID_Timer_Enabled), helpstring("property Enabled")] HRESULT Enabled([in] VARIANT_BOOL newVal);
+				// line 1097: [propput, id(DISPID_Timer_Enabled), helpstring("property Enabled")] HRESULT Enabled([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -5968,12 +6033,12 @@ STDMETHODIMP Timer::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case DISPID_Timer_Interval: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1096: [propget, id(DISPID_Timer_Interval), helpstring("property Interval")] HRESULT Interval([out, retval] long *pVal);
+				// line 1098: [propget, id(DISPID_Timer_Interval), helpstring("property Interval")] HRESULT Interval([out, retval] long *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_Interval((LONG*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1097: [propput, id(DISPID_Timer_Interval), helpstring("property Interval")] HRESULT Interval([in] long newVal);
+				// line 1099: [propput, id(DISPID_Timer_Interval), helpstring("property Interval")] HRESULT Interval([in] long newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -5984,12 +6049,12 @@ STDMETHODIMP Timer::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case DISPID_Name: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1098: [propget, id(DISPID_Name), helpstring("property Name")] HRESULT Name([out, retval] BSTR *pVal);
+				// line 1100: [propget, id(DISPID_Name), helpstring("property Name")] HRESULT Name([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Name(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1099: [propput, id(DISPID_Name), helpstring("property Name")] HRESULT Name([in] BSTR newVal);
+				// line 1101: [propput, id(DISPID_Name), helpstring("property Name")] HRESULT Name([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -6000,11 +6065,11 @@ STDMETHODIMP Timer::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case DISPID_UserValue: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1100: [propget, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([out, retval] VARIANT* pVal);
+				// line 1102: [propget, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([out, retval] VARIANT* pVal);
 				hres = get_UserValue(&res);
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1101: [propput, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([in] VARIANT* newVal);
+				// line 1103: [propput, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([in] VARIANT* newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantCopyInd(&var0, &pDispParams->rgvarg[--index]);
@@ -6156,26 +6221,26 @@ STDMETHODIMP Plunger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 1: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 1128: [id(1), helpstring("method PullBack")] HRESULT PullBack();
+				// line 1130: [id(1), helpstring("method PullBack")] HRESULT PullBack();
 				hres = PullBack();
 			}
 			break;
 		}
 		case 2: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 1129: [id(2), helpstring("method Fire")] HRESULT Fire();
+				// line 1131: [id(2), helpstring("method Fire")] HRESULT Fire();
 				hres = Fire();
 			}
 			break;
 		}
 		case 3: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1130: [propget, id(3), helpstring("property PullSpeed")] HRESULT PullSpeed([out, retval] float *pVal);
+				// line 1132: [propget, id(3), helpstring("property PullSpeed")] HRESULT PullSpeed([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_PullSpeed(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1131: [propput, id(3), helpstring("property PullSpeed")] HRESULT PullSpeed([in] float newVal);
+				// line 1133: [propput, id(3), helpstring("property PullSpeed")] HRESULT PullSpeed([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -6186,12 +6251,12 @@ STDMETHODIMP Plunger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 4: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1132: [propget, id(4), helpstring("property FireSpeed")] HRESULT FireSpeed([out, retval] float *pVal);
+				// line 1134: [propget, id(4), helpstring("property FireSpeed")] HRESULT FireSpeed([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_FireSpeed(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1133: [propput, id(4), helpstring("property FireSpeed")] HRESULT FireSpeed([in] float newVal);
+				// line 1135: [propput, id(4), helpstring("property FireSpeed")] HRESULT FireSpeed([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -6202,7 +6267,7 @@ STDMETHODIMP Plunger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 5: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 1134: [id(5), helpstring("method CreateBall")] HRESULT CreateBall([out, retval] IBall **Ball);
+				// line 1136: [id(5), helpstring("method CreateBall")] HRESULT CreateBall([out, retval] IBall **Ball);
 				V_VT(&res) = VT_DISPATCH;
 				hres = CreateBall((IBall**)&V_DISPATCH(&res));
 			}
@@ -6210,7 +6275,7 @@ STDMETHODIMP Plunger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 6: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 1135: [id(6), helpstring("method Position")] HRESULT Position([out, retval] float *pVal); //added for mechanical plunger position, also supports normal/digital one by now
+				// line 1137: [id(6), helpstring("method Position")] HRESULT Position([out, retval] float *pVal); //added for mechanical plunger position, also supports normal/digital one by now
 				V_VT(&res) = VT_R4;
 				hres = Position(&V_R4(&res));
 			}
@@ -6218,14 +6283,14 @@ STDMETHODIMP Plunger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 7: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 1136: [id(7), helpstring("method PullBackandRetract")] HRESULT PullBackandRetract(); //added for manual non-mech plunger
+				// line 1138: [id(7), helpstring("method PullBackandRetract")] HRESULT PullBackandRetract(); //added for manual non-mech plunger
 				hres = PullBackandRetract();
 			}
 			break;
 		}
 		case 216: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 1137: [id(216), helpstring("method MotionDevice")] HRESULT MotionDevice([out, retval] int *pVal); //added for uShockType
+				// line 1139: [id(216), helpstring("method MotionDevice")] HRESULT MotionDevice([out, retval] int *pVal); //added for uShockType
 				V_VT(&res) = VT_I4;
 				hres = MotionDevice((int*)&V_I4(&res));
 			}
@@ -6233,12 +6298,12 @@ STDMETHODIMP Plunger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Timer_Enabled: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1138: [propget, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([out, retval] VARIANT_BOOL *pVal);
+				// line 1140: [propget, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_TimerEnabled(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1139: [propput, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([in] VARIANT_BOOL newVal);
+				// line 1141: [propput, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -6249,12 +6314,12 @@ STDMETHODIMP Plunger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Timer_Interval: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1140: [propget, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([out, retval] long *pVal);
+				// line 1142: [propget, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([out, retval] long *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_TimerInterval((LONG*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1141: [propput, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([in] long newVal);
+				// line 1143: [propput, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([in] long newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -6265,12 +6330,12 @@ STDMETHODIMP Plunger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_X: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1142: [propget, id(DISPID_X), helpstring("property X")] HRESULT X([out, retval] float *pVal);
+				// line 1144: [propget, id(DISPID_X), helpstring("property X")] HRESULT X([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_X(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1143: [propput, id(DISPID_X), helpstring("property X")] HRESULT X([in] float newVal);
+				// line 1145: [propput, id(DISPID_X), helpstring("property X")] HRESULT X([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -6281,12 +6346,12 @@ STDMETHODIMP Plunger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Y: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1144: [propget, id(DISPID_Y), helpstring("property Y")] HRESULT Y([out, retval] float *pVal);
+				// line 1146: [propget, id(DISPID_Y), helpstring("property Y")] HRESULT Y([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Y(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1145: [propput, id(DISPID_Y), helpstring("property Y")] HRESULT Y([in] float newVal);
+				// line 1147: [propput, id(DISPID_Y), helpstring("property Y")] HRESULT Y([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -6297,12 +6362,12 @@ STDMETHODIMP Plunger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Width: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1146: [propget, id(DISPID_Width), helpstring("property Width")] HRESULT Width([out, retval] float *pVal);
+				// line 1148: [propget, id(DISPID_Width), helpstring("property Width")] HRESULT Width([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Width(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1147: [propput, id(DISPID_Width), helpstring("property Width")] HRESULT Width([in] float newVal);
+				// line 1149: [propput, id(DISPID_Width), helpstring("property Width")] HRESULT Width([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -6313,12 +6378,12 @@ STDMETHODIMP Plunger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_ZAdjust: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1148: [propget, id(DISPID_ZAdjust), helpstring("property ZAdjust")] HRESULT ZAdjust([out, retval] float *pVal);
+				// line 1150: [propget, id(DISPID_ZAdjust), helpstring("property ZAdjust")] HRESULT ZAdjust([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_ZAdjust(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1149: [propput, id(DISPID_ZAdjust), helpstring("property ZAdjust")] HRESULT ZAdjust([in] float newVal);
+				// line 1151: [propput, id(DISPID_ZAdjust), helpstring("property ZAdjust")] HRESULT ZAdjust([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -6329,12 +6394,12 @@ STDMETHODIMP Plunger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Surface: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1150: [propget, id(DISPID_Surface), helpstring("property Surface")] HRESULT Surface([out, retval] BSTR *pVal);
+				// line 1152: [propget, id(DISPID_Surface), helpstring("property Surface")] HRESULT Surface([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Surface(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1151: [propput, id(DISPID_Surface), helpstring("property Surface")] HRESULT Surface([in] BSTR newVal);
+				// line 1153: [propput, id(DISPID_Surface), helpstring("property Surface")] HRESULT Surface([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -6345,12 +6410,12 @@ STDMETHODIMP Plunger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Name: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1152: [propget, id(DISPID_Name), helpstring("property Name")] HRESULT Name([out, retval] BSTR *pVal);
+				// line 1154: [propget, id(DISPID_Name), helpstring("property Name")] HRESULT Name([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Name(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1153: [propput, id(DISPID_Name), helpstring("property Name")] HRESULT Name([in] BSTR newVal);
+				// line 1155: [propput, id(DISPID_Name), helpstring("property Name")] HRESULT Name([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -6361,11 +6426,11 @@ STDMETHODIMP Plunger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_UserValue: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1154: [propget, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([out, retval] VARIANT* pVal);
+				// line 1156: [propget, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([out, retval] VARIANT* pVal);
 				hres = get_UserValue(&res);
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1155: [propput, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([in] VARIANT* newVal);
+				// line 1157: [propput, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([in] VARIANT* newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantCopyInd(&var0, &pDispParams->rgvarg[--index]);
@@ -6376,12 +6441,12 @@ STDMETHODIMP Plunger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 390: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1156: [propget, id(390), helpstring("property Type")] HRESULT Type([out, retval] PlungerType *pVal);
+				// line 1158: [propget, id(390), helpstring("property Type")] HRESULT Type([out, retval] PlungerType *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_Type((PlungerType*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1157: [propput, id(390), helpstring("property Type")] HRESULT Type([in] PlungerType newVal);
+				// line 1159: [propput, id(390), helpstring("property Type")] HRESULT Type([in] PlungerType newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -6392,12 +6457,12 @@ STDMETHODIMP Plunger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 340: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1158: [propget, id(340), helpstring("property Material")] HRESULT Material([out, retval] BSTR *pVal);
+				// line 1160: [propget, id(340), helpstring("property Material")] HRESULT Material([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Material(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1159: [propput, id(340), helpstring("property Material")] HRESULT Material([in] BSTR newVal);
+				// line 1161: [propput, id(340), helpstring("property Material")] HRESULT Material([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -6408,12 +6473,12 @@ STDMETHODIMP Plunger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Image: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1160: [propget, id(DISPID_Image), helpstring("property Image")] HRESULT Image([out, retval] BSTR *pVal);
+				// line 1162: [propget, id(DISPID_Image), helpstring("property Image")] HRESULT Image([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Image(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1161: [propput, id(DISPID_Image), helpstring("property Image")] HRESULT Image([in] BSTR newVal);
+				// line 1163: [propput, id(DISPID_Image), helpstring("property Image")] HRESULT Image([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -6424,12 +6489,12 @@ STDMETHODIMP Plunger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_PluFrames: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1162: [propget, id(DISPID_PluFrames), helpstring("property AnimFrames")] HRESULT AnimFrames([out, retval] int *pVal);
+				// line 1164: [propget, id(DISPID_PluFrames), helpstring("property AnimFrames")] HRESULT AnimFrames([out, retval] int *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_AnimFrames((int*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1163: [propput, id(DISPID_PluFrames), helpstring("property AnimFrames")] HRESULT AnimFrames([in] int newVal);
+				// line 1165: [propput, id(DISPID_PluFrames), helpstring("property AnimFrames")] HRESULT AnimFrames([in] int newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -6440,12 +6505,12 @@ STDMETHODIMP Plunger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_TipShape: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1164: [propget, id(DISPID_TipShape), helpstring("property Shape")] HRESULT TipShape([out, retval] BSTR *pVal);
+				// line 1166: [propget, id(DISPID_TipShape), helpstring("property Shape")] HRESULT TipShape([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_TipShape(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1165: [propput, id(DISPID_TipShape), helpstring("property Shape")] HRESULT TipShape([in] BSTR newVal);
+				// line 1167: [propput, id(DISPID_TipShape), helpstring("property Shape")] HRESULT TipShape([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -6456,12 +6521,12 @@ STDMETHODIMP Plunger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_RodDiam: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1166: [propget, id(DISPID_RodDiam), helpstring("property RodDiam")] HRESULT RodDiam([out, retval] float *pVal);
+				// line 1168: [propget, id(DISPID_RodDiam), helpstring("property RodDiam")] HRESULT RodDiam([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_RodDiam(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1167: [propput, id(DISPID_RodDiam), helpstring("property RodDiam")] HRESULT RodDiam([in] float newVal);
+				// line 1169: [propput, id(DISPID_RodDiam), helpstring("property RodDiam")] HRESULT RodDiam([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -6472,12 +6537,12 @@ STDMETHODIMP Plunger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_RingGap: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1168: [propget, id(DISPID_RingGap), helpstring("property RingGap")] HRESULT RingGap([out, retval] float *pVal);
+				// line 1170: [propget, id(DISPID_RingGap), helpstring("property RingGap")] HRESULT RingGap([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_RingGap(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1169: [propput, id(DISPID_RingGap), helpstring("property RingGap")] HRESULT RingGap([in] float newVal);
+				// line 1171: [propput, id(DISPID_RingGap), helpstring("property RingGap")] HRESULT RingGap([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -6488,12 +6553,12 @@ STDMETHODIMP Plunger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_RingDiam: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1170: [propget, id(DISPID_RingDiam), helpstring("property RingDiam")] HRESULT RingDiam([out, retval] float *pVal);
+				// line 1172: [propget, id(DISPID_RingDiam), helpstring("property RingDiam")] HRESULT RingDiam([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_RingDiam(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1171: [propput, id(DISPID_RingDiam), helpstring("property RingDiam")] HRESULT RingDiam([in] float newVal);
+				// line 1173: [propput, id(DISPID_RingDiam), helpstring("property RingDiam")] HRESULT RingDiam([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -6504,12 +6569,12 @@ STDMETHODIMP Plunger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_RingThickness: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1172: [propget, id(DISPID_RingThickness), helpstring("property RingWidth")] HRESULT RingWidth([out, retval] float *pVal);
+				// line 1174: [propget, id(DISPID_RingThickness), helpstring("property RingWidth")] HRESULT RingWidth([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_RingWidth(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1173: [propput, id(DISPID_RingThickness), helpstring("property RingWidth")] HRESULT RingWidth([in] float newVal);
+				// line 1175: [propput, id(DISPID_RingThickness), helpstring("property RingWidth")] HRESULT RingWidth([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -6520,12 +6585,12 @@ STDMETHODIMP Plunger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_SpringDiam: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1174: [propget, id(DISPID_SpringDiam), helpstring("property SpringDiam")] HRESULT SpringDiam([out, retval] float *pVal);
+				// line 1176: [propget, id(DISPID_SpringDiam), helpstring("property SpringDiam")] HRESULT SpringDiam([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_SpringDiam(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1175: [propput, id(DISPID_SpringDiam), helpstring("property SpringDiam")] HRESULT SpringDiam([in] float newVal);
+				// line 1177: [propput, id(DISPID_SpringDiam), helpstring("property SpringDiam")] HRESULT SpringDiam([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -6536,12 +6601,12 @@ STDMETHODIMP Plunger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_SpringGauge: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1176: [propget, id(DISPID_SpringGauge), helpstring("property SpringGauge")] HRESULT SpringGauge([out, retval] float *pVal);
+				// line 1178: [propget, id(DISPID_SpringGauge), helpstring("property SpringGauge")] HRESULT SpringGauge([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_SpringGauge(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1177: [propput, id(DISPID_SpringGauge), helpstring("property SpringGauge")] HRESULT SpringGauge([in] float newVal);
+				// line 1179: [propput, id(DISPID_SpringGauge), helpstring("property SpringGauge")] HRESULT SpringGauge([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -6552,12 +6617,12 @@ STDMETHODIMP Plunger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_SpringLoops: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1178: [propget, id(DISPID_SpringLoops), helpstring("property SpringLoops")] HRESULT SpringLoops([out, retval] float *pVal);
+				// line 1180: [propget, id(DISPID_SpringLoops), helpstring("property SpringLoops")] HRESULT SpringLoops([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_SpringLoops(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1179: [propput, id(DISPID_SpringLoops), helpstring("property SpringLoops")] HRESULT SpringLoops([in] float newVal);
+				// line 1181: [propput, id(DISPID_SpringLoops), helpstring("property SpringLoops")] HRESULT SpringLoops([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -6568,12 +6633,12 @@ STDMETHODIMP Plunger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_SpringEndLoops: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1180: [propget, id(DISPID_SpringEndLoops), helpstring("property SpringEndLoops")] HRESULT SpringEndLoops([out, retval] float *pVal);
+				// line 1182: [propget, id(DISPID_SpringEndLoops), helpstring("property SpringEndLoops")] HRESULT SpringEndLoops([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_SpringEndLoops(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1181: [propput, id(DISPID_SpringEndLoops), helpstring("property SpringEndLoops")] HRESULT SpringEndLoops([in] float newVal);
+				// line 1183: [propput, id(DISPID_SpringEndLoops), helpstring("property SpringEndLoops")] HRESULT SpringEndLoops([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -6584,12 +6649,12 @@ STDMETHODIMP Plunger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 110: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1183: [propget, id(110), helpstring("property MechPlunger")] HRESULT MechPlunger([out, retval] VARIANT_BOOL *pVal);
+				// line 1185: [propget, id(110), helpstring("property MechPlunger")] HRESULT MechPlunger([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_MechPlunger(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1184: [propput, id(110), helpstring("property MechPlunger")] HRESULT MechPlunger([in] VARIANT_BOOL newVal);
+				// line 1186: [propput, id(110), helpstring("property MechPlunger")] HRESULT MechPlunger([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -6600,12 +6665,12 @@ STDMETHODIMP Plunger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 116: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1185: [propget, id(116), helpstring("property AutoPlunger")] HRESULT AutoPlunger([out, retval] VARIANT_BOOL *pVal);
+				// line 1187: [propget, id(116), helpstring("property AutoPlunger")] HRESULT AutoPlunger([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_AutoPlunger(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1186: [propput, id(116), helpstring("property AutoPlunger")] HRESULT AutoPlunger([in] VARIANT_BOOL newVal);
+				// line 1188: [propput, id(116), helpstring("property AutoPlunger")] HRESULT AutoPlunger([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -6616,12 +6681,12 @@ STDMETHODIMP Plunger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 117: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1187: [propget, id(117), helpstring("property Visible")] HRESULT Visible([out, retval] VARIANT_BOOL *pVal);
+				// line 1189: [propget, id(117), helpstring("property Visible")] HRESULT Visible([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_Visible(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1188: [propput, id(117), helpstring("property Visible")] HRESULT Visible([in] VARIANT_BOOL newVal);
+				// line 1190: [propput, id(117), helpstring("property Visible")] HRESULT Visible([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -6632,12 +6697,12 @@ STDMETHODIMP Plunger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 111: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1189: [propget, id(111), helpstring("property MechStrength")] HRESULT MechStrength([out, retval] float *pVal);
+				// line 1191: [propget, id(111), helpstring("property MechStrength")] HRESULT MechStrength([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_MechStrength(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1190: [propput, id(111), helpstring("property MechStrength")] HRESULT MechStrength([in] float newVal);
+				// line 1192: [propput, id(111), helpstring("property MechStrength")] HRESULT MechStrength([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -6648,12 +6713,12 @@ STDMETHODIMP Plunger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 112: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1191: [propget, id(112), helpstring("property ParkPosition")] HRESULT ParkPosition([out, retval] float *pVal);
+				// line 1193: [propget, id(112), helpstring("property ParkPosition")] HRESULT ParkPosition([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_ParkPosition(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1192: [propput, id(112), helpstring("property ParkPosition")] HRESULT ParkPosition([in] float newVal);
+				// line 1194: [propput, id(112), helpstring("property ParkPosition")] HRESULT ParkPosition([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -6664,12 +6729,12 @@ STDMETHODIMP Plunger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 113: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1193: [propget, id(113), helpstring("property Stroke")] HRESULT Stroke([out, retval] float *pVal);
+				// line 1195: [propget, id(113), helpstring("property Stroke")] HRESULT Stroke([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Stroke(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1194: [propput, id(113), helpstring("property Stroke")] HRESULT Stroke([in] float newVal);
+				// line 1196: [propput, id(113), helpstring("property Stroke")] HRESULT Stroke([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -6680,12 +6745,12 @@ STDMETHODIMP Plunger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 114: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1195: [propget, id(114), helpstring("property ScatterVelocity")] HRESULT ScatterVelocity([out, retval] float *pVal);
+				// line 1197: [propget, id(114), helpstring("property ScatterVelocity")] HRESULT ScatterVelocity([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_ScatterVelocity(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1196: [propput, id(114), helpstring("property ScatterVelocity")] HRESULT ScatterVelocity([in] float newVal);
+				// line 1198: [propput, id(114), helpstring("property ScatterVelocity")] HRESULT ScatterVelocity([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -6696,12 +6761,12 @@ STDMETHODIMP Plunger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 118: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1197: [propget, id(118), helpstring("property MomentumXfer")] HRESULT MomentumXfer([out, retval] float *pVal);
+				// line 1199: [propget, id(118), helpstring("property MomentumXfer")] HRESULT MomentumXfer([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_MomentumXfer(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1198: [propput, id(118), helpstring("property MomentumXfer")] HRESULT MomentumXfer([in] float newVal);
+				// line 1200: [propput, id(118), helpstring("property MomentumXfer")] HRESULT MomentumXfer([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -6712,12 +6777,12 @@ STDMETHODIMP Plunger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 431: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1199: [propget, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([out, retval] VARIANT_BOOL *pVal);
+				// line 1201: [propget, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_ReflectionEnabled(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1200: [propput, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([in] VARIANT_BOOL newVal);
+				// line 1202: [propput, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -6849,12 +6914,12 @@ STDMETHODIMP Textbox::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Textbox_BackColor: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1229: [propget, id(DISPID_Textbox_BackColor), helpstring("property BackColor")] HRESULT BackColor([out, retval] OLE_COLOR *pVal);
+				// line 1231: [propget, id(DISPID_Textbox_BackColor), helpstring("property BackColor")] HRESULT BackColor([out, retval] OLE_COLOR *pVal);
 				V_VT(&res) = VT_UI4;
 				hres = get_BackColor(&V_UI4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1230: [propput, id(DISPID_Textbox_BackColor), helpstring("property BackColor")] HRESULT BackColor([in] OLE_COLOR newVal);
+				// line 1232: [propput, id(DISPID_Textbox_BackColor), helpstring("property BackColor")] HRESULT BackColor([in] OLE_COLOR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_UI4);
@@ -6865,12 +6930,12 @@ STDMETHODIMP Textbox::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Textbox_FontColor: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1231: [propget, id(DISPID_Textbox_FontColor), helpstring("property FontColor")] HRESULT FontColor([out, retval] OLE_COLOR *pVal);
+				// line 1233: [propget, id(DISPID_Textbox_FontColor), helpstring("property FontColor")] HRESULT FontColor([out, retval] OLE_COLOR *pVal);
 				V_VT(&res) = VT_UI4;
 				hres = get_FontColor(&V_UI4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1232: [propput, id(DISPID_Textbox_FontColor), helpstring("property FontColor")] HRESULT FontColor([in] OLE_COLOR newVal);
+				// line 1234: [propput, id(DISPID_Textbox_FontColor), helpstring("property FontColor")] HRESULT FontColor([in] OLE_COLOR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_UI4);
@@ -6881,12 +6946,12 @@ STDMETHODIMP Textbox::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 3: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1233: [propget, id(3), helpstring("property Text")] HRESULT Text([out, retval] BSTR *pVal);
+				// line 1235: [propget, id(3), helpstring("property Text")] HRESULT Text([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Text(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1234: [propput, id(3), helpstring("property Text")] HRESULT Text([in] BSTR newVal);
+				// line 1236: [propput, id(3), helpstring("property Text")] HRESULT Text([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -6897,12 +6962,12 @@ STDMETHODIMP Textbox::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Textbox_Font: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1235: [propget, id(DISPID_Textbox_Font), helpstring("property Font")] HRESULT Font([out, retval] IFontDisp **pVal);
+				// line 1237: [propget, id(DISPID_Textbox_Font), helpstring("property Font")] HRESULT Font([out, retval] IFontDisp **pVal);
 				V_VT(&res) = VT_DISPATCH;
 				hres = get_Font((IFontDisp**)&V_DISPATCH(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUTREF) {
-				// line 1236: [propputref, id(DISPID_Textbox_Font), helpstring("property Font")] HRESULT Font([in] IFontDisp *newVal);
+				// line 1238: [propputref, id(DISPID_Textbox_Font), helpstring("property Font")] HRESULT Font([in] IFontDisp *newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantCopyInd(&var0, &pDispParams->rgvarg[--index]);
@@ -6913,12 +6978,12 @@ STDMETHODIMP Textbox::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 60002: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1237: [propget, id(60002), helpstring("property Width")] HRESULT Width([out, retval] float *pVal);
+				// line 1239: [propget, id(60002), helpstring("property Width")] HRESULT Width([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Width(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1238: [propput, id(60002), helpstring("property Width")] HRESULT Width([in] float newVal);
+				// line 1240: [propput, id(60002), helpstring("property Width")] HRESULT Width([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -6929,12 +6994,12 @@ STDMETHODIMP Textbox::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 60003: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1239: [propget, id(60003), helpstring("property Height")] HRESULT Height([out, retval] float *pVal);
+				// line 1241: [propget, id(60003), helpstring("property Height")] HRESULT Height([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Height(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1240: [propput, id(60003), helpstring("property Height")] HRESULT Height([in] float newVal);
+				// line 1242: [propput, id(60003), helpstring("property Height")] HRESULT Height([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -6945,12 +7010,12 @@ STDMETHODIMP Textbox::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 11: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1241: [propget, id(11), helpstring("property Alignment")] HRESULT Alignment([out, retval] TextAlignment *pVal);
+				// line 1243: [propget, id(11), helpstring("property Alignment")] HRESULT Alignment([out, retval] TextAlignment *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_Alignment((TextAlignment*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1242: [propput, id(11), helpstring("property Alignment")] HRESULT Alignment([in] TextAlignment newVal);
+				// line 1244: [propput, id(11), helpstring("property Alignment")] HRESULT Alignment([in] TextAlignment newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -6961,12 +7026,12 @@ STDMETHODIMP Textbox::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 12: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1243: [propget, id(12), helpstring("property IsTransparent")] HRESULT IsTransparent([out, retval] VARIANT_BOOL *pVal);
+				// line 1245: [propget, id(12), helpstring("property IsTransparent")] HRESULT IsTransparent([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_IsTransparent(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1244: [propput, id(12), helpstring("property IsTransparent")] HRESULT IsTransparent([in] VARIANT_BOOL newVal);
+				// line 1246: [propput, id(12), helpstring("property IsTransparent")] HRESULT IsTransparent([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -6977,12 +7042,12 @@ STDMETHODIMP Textbox::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 555: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1245: [propget, id(555), helpstring("property DMD")] HRESULT DMD([out, retval] VARIANT_BOOL *pVal);
+				// line 1247: [propget, id(555), helpstring("property DMD")] HRESULT DMD([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_DMD(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1246: [propput, id(555), helpstring("property DMD")] HRESULT DMD([in] VARIANT_BOOL newVal);
+				// line 1248: [propput, id(555), helpstring("property DMD")] HRESULT DMD([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -6993,12 +7058,12 @@ STDMETHODIMP Textbox::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Timer_Enabled: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1247: [propget, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([out, retval] VARIANT_BOOL *pVal);
+				// line 1249: [propget, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_TimerEnabled(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1248: [propput, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([in] VARIANT_BOOL newVal);
+				// line 1250: [propput, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -7009,12 +7074,12 @@ STDMETHODIMP Textbox::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Timer_Interval: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1249: [propget, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([out, retval] long *pVal);
+				// line 1251: [propget, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([out, retval] long *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_TimerInterval((LONG*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1250: [propput, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([in] long newVal);
+				// line 1252: [propput, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([in] long newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -7025,12 +7090,12 @@ STDMETHODIMP Textbox::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 60000: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1251: [propget, id(60000), helpstring("property X")] HRESULT X([out, retval] float *pVal);
+				// line 1253: [propget, id(60000), helpstring("property X")] HRESULT X([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_X(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1252: [propput, id(60000), helpstring("property X")] HRESULT X([in] float newVal);
+				// line 1254: [propput, id(60000), helpstring("property X")] HRESULT X([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -7041,12 +7106,12 @@ STDMETHODIMP Textbox::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 60001: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1253: [propget, id(60001), helpstring("property Y")] HRESULT Y([out, retval] float *pVal);
+				// line 1255: [propget, id(60001), helpstring("property Y")] HRESULT Y([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Y(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1254: [propput, id(60001), helpstring("property Y")] HRESULT Y([in] float newVal);
+				// line 1256: [propput, id(60001), helpstring("property Y")] HRESULT Y([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -7057,12 +7122,12 @@ STDMETHODIMP Textbox::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 587: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1255: [propget, id(587), helpstring("property IntensityScale")] HRESULT IntensityScale([out, retval] float *pVal);
+				// line 1257: [propget, id(587), helpstring("property IntensityScale")] HRESULT IntensityScale([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_IntensityScale(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1256: [propput, id(587), helpstring("property IntensityScale")] HRESULT IntensityScale([in] float newVal);
+				// line 1258: [propput, id(587), helpstring("property IntensityScale")] HRESULT IntensityScale([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -7073,12 +7138,12 @@ STDMETHODIMP Textbox::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Name: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1257: [propget, id(DISPID_Name), helpstring("property Name")] HRESULT Name([out, retval] BSTR *pVal);
+				// line 1259: [propget, id(DISPID_Name), helpstring("property Name")] HRESULT Name([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Name(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1258: [propput, id(DISPID_Name), helpstring("property Name")] HRESULT Name([in] BSTR newVal);
+				// line 1260: [propput, id(DISPID_Name), helpstring("property Name")] HRESULT Name([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -7089,11 +7154,11 @@ STDMETHODIMP Textbox::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_UserValue: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1259: [propget, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([out, retval] VARIANT* pVal);
+				// line 1261: [propget, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([out, retval] VARIANT* pVal);
 				hres = get_UserValue(&res);
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1260: [propput, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([in] VARIANT* newVal);
+				// line 1262: [propput, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([in] VARIANT* newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantCopyInd(&var0, &pDispParams->rgvarg[--index]);
@@ -7104,12 +7169,12 @@ STDMETHODIMP Textbox::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 616: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1261: [propget, id(616), helpstring("property Visible")] HRESULT Visible([out, retval] VARIANT_BOOL *pVal);
+				// line 1263: [propget, id(616), helpstring("property Visible")] HRESULT Visible([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_Visible(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1262: [propput, id(616), helpstring("property Visible")] HRESULT Visible([in] VARIANT_BOOL newVal);
+				// line 1264: [propput, id(616), helpstring("property Visible")] HRESULT Visible([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -7253,12 +7318,12 @@ STDMETHODIMP Bumper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 8: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1289: [propget, id(8), helpstring("property Radius")] HRESULT Radius([out, retval] float *pVal);
+				// line 1291: [propget, id(8), helpstring("property Radius")] HRESULT Radius([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Radius(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1290: [propput, id(8), helpstring("property Radius")] HRESULT Radius([in] float newVal);
+				// line 1292: [propput, id(8), helpstring("property Radius")] HRESULT Radius([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -7269,12 +7334,12 @@ STDMETHODIMP Bumper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case DISPID_X: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1291: [propget, id(DISPID_X), helpstring("property X")] HRESULT X([out, retval] float *pVal);
+				// line 1293: [propget, id(DISPID_X), helpstring("property X")] HRESULT X([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_X(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1292: [propput, id(DISPID_X), helpstring("property X")] HRESULT X([in] float newVal);
+				// line 1294: [propput, id(DISPID_X), helpstring("property X")] HRESULT X([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -7285,12 +7350,12 @@ STDMETHODIMP Bumper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case DISPID_Y: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1293: [propget, id(DISPID_Y), helpstring("property Y")] HRESULT Y([out, retval] float *pVal);
+				// line 1295: [propget, id(DISPID_Y), helpstring("property Y")] HRESULT Y([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Y(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1294: [propput, id(DISPID_Y), helpstring("property Y")] HRESULT Y([in] float newVal);
+				// line 1296: [propput, id(DISPID_Y), helpstring("property Y")] HRESULT Y([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -7301,12 +7366,12 @@ STDMETHODIMP Bumper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 341: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1295: [propget, id(341), helpstring("property BaseMaterial")] HRESULT BaseMaterial([out, retval] BSTR *pVal);
+				// line 1297: [propget, id(341), helpstring("property BaseMaterial")] HRESULT BaseMaterial([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_BaseMaterial(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1296: [propput, id(341), helpstring("property BaseMaterial")] HRESULT BaseMaterial([in] BSTR newVal);
+				// line 1298: [propput, id(341), helpstring("property BaseMaterial")] HRESULT BaseMaterial([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -7317,12 +7382,12 @@ STDMETHODIMP Bumper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 426: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1297: [propget, id(426), helpstring("property SkirtMaterial")] HRESULT SkirtMaterial([out, retval] BSTR *pVal);
+				// line 1299: [propget, id(426), helpstring("property SkirtMaterial")] HRESULT SkirtMaterial([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_SkirtMaterial(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1298: [propput, id(426), helpstring("property SkirtMaterial")] HRESULT SkirtMaterial([in] BSTR newVal);
+				// line 1300: [propput, id(426), helpstring("property SkirtMaterial")] HRESULT SkirtMaterial([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -7333,11 +7398,11 @@ STDMETHODIMP Bumper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case DISPID_UserValue: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1299: [propget, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([out, retval] VARIANT* pVal);
+				// line 1301: [propget, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([out, retval] VARIANT* pVal);
 				hres = get_UserValue(&res);
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1300: [propput, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([in] VARIANT* newVal);
+				// line 1302: [propput, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([in] VARIANT* newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantCopyInd(&var0, &pDispParams->rgvarg[--index]);
@@ -7348,12 +7413,12 @@ STDMETHODIMP Bumper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case DISPID_Surface: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1301: [propget, id(DISPID_Surface), helpstring("property Surface")] HRESULT Surface([out, retval] BSTR *pVal);
+				// line 1303: [propget, id(DISPID_Surface), helpstring("property Surface")] HRESULT Surface([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Surface(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1302: [propput, id(DISPID_Surface), helpstring("property Surface")] HRESULT Surface([in] BSTR newVal);
+				// line 1304: [propput, id(DISPID_Surface), helpstring("property Surface")] HRESULT Surface([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -7364,12 +7429,12 @@ STDMETHODIMP Bumper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 2: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1303: [propget, id(2), helpstring("property Force")] HRESULT Force([out, retval] float *pVal);
+				// line 1305: [propget, id(2), helpstring("property Force")] HRESULT Force([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Force(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1304: [propput, id(2), helpstring("property Force")] HRESULT Force([in] float newVal);
+				// line 1306: [propput, id(2), helpstring("property Force")] HRESULT Force([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -7380,12 +7445,12 @@ STDMETHODIMP Bumper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 33: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1305: [propget, id(33), helpstring("property Threshold")] HRESULT Threshold([out, retval] float *pVal);
+				// line 1307: [propget, id(33), helpstring("property Threshold")] HRESULT Threshold([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Threshold(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1306: [propput, id(33), helpstring("property Threshold")] HRESULT Threshold([in] float newVal);
+				// line 1308: [propput, id(33), helpstring("property Threshold")] HRESULT Threshold([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -7396,12 +7461,12 @@ STDMETHODIMP Bumper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case DISPID_Timer_Enabled: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1307: [propget, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([out, retval] VARIANT_BOOL *pVal);
+				// line 1309: [propget, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_TimerEnabled(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1308: [propput, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([in] VARIANT_BOOL newVal);
+				// line 1310: [propput, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -7412,12 +7477,12 @@ STDMETHODIMP Bumper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case DISPID_Timer_Interval: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1309: [propget, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([out, retval] long *pVal);
+				// line 1311: [propget, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([out, retval] long *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_TimerInterval((LONG*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1310: [propput, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([in] long newVal);
+				// line 1312: [propput, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([in] long newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -7428,12 +7493,12 @@ STDMETHODIMP Bumper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 340: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1311: [propget, id(340), helpstring("property CapMaterial")] HRESULT CapMaterial([out, retval] BSTR *pVal);
+				// line 1313: [propget, id(340), helpstring("property CapMaterial")] HRESULT CapMaterial([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_CapMaterial(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1312: [propput, id(340), helpstring("property CapMaterial")] HRESULT CapMaterial([in] BSTR newVal);
+				// line 1314: [propput, id(340), helpstring("property CapMaterial")] HRESULT CapMaterial([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -7444,12 +7509,12 @@ STDMETHODIMP Bumper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 734: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1313: [propget, id(734), helpstring("property RingMaterial")] HRESULT RingMaterial([out, retval] BSTR *pVal);
+				// line 1315: [propget, id(734), helpstring("property RingMaterial")] HRESULT RingMaterial([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_RingMaterial(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1314: [propput, id(734), helpstring("property RingMaterial")] HRESULT RingMaterial([in] BSTR newVal);
+				// line 1316: [propput, id(734), helpstring("property RingMaterial")] HRESULT RingMaterial([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -7460,12 +7525,12 @@ STDMETHODIMP Bumper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 24: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1315: [propget, id(24), helpstring("property HeightScale")] HRESULT HeightScale([out, retval] float *pVal);
+				// line 1317: [propget, id(24), helpstring("property HeightScale")] HRESULT HeightScale([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_HeightScale(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1316: [propput, id(24), helpstring("property HeightScale")] HRESULT HeightScale([in] float newVal);
+				// line 1318: [propput, id(24), helpstring("property HeightScale")] HRESULT HeightScale([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -7476,12 +7541,12 @@ STDMETHODIMP Bumper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 25: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1317: [propget, id(25), helpstring("property Orientation")] HRESULT Orientation([out, retval] float *pVal);
+				// line 1319: [propget, id(25), helpstring("property Orientation")] HRESULT Orientation([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Orientation(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1318: [propput, id(25), helpstring("property Orientation")] HRESULT Orientation([in] float newVal);
+				// line 1320: [propput, id(25), helpstring("property Orientation")] HRESULT Orientation([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -7492,12 +7557,12 @@ STDMETHODIMP Bumper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 26: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1319: [propget, id(26), helpstring("property RingSpeed")] HRESULT RingSpeed([out, retval] float *pVal);
+				// line 1321: [propget, id(26), helpstring("property RingSpeed")] HRESULT RingSpeed([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_RingSpeed(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1320: [propput, id(26), helpstring("property RingSpeed")] HRESULT RingSpeed([in] float newVal);
+				// line 1322: [propput, id(26), helpstring("property RingSpeed")] HRESULT RingSpeed([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -7508,12 +7573,12 @@ STDMETHODIMP Bumper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 27: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1321: [propget, id(27), helpstring("property RingDropOffset")] HRESULT RingDropOffset([out, retval] float *pVal);
+				// line 1323: [propget, id(27), helpstring("property RingDropOffset")] HRESULT RingDropOffset([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_RingDropOffset(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1322: [propput, id(27), helpstring("property RingDropOffset")] HRESULT RingDropOffset([in] float newVal);
+				// line 1324: [propput, id(27), helpstring("property RingDropOffset")] HRESULT RingDropOffset([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -7524,7 +7589,7 @@ STDMETHODIMP Bumper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 28: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1323: [propget, id(28), helpstring("property CurrentRingOffset")] HRESULT CurrentRingOffset([out, retval] float *pVal);
+				// line 1325: [propget, id(28), helpstring("property CurrentRingOffset")] HRESULT CurrentRingOffset([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_CurrentRingOffset(&V_R4(&res));
 			}
@@ -7532,12 +7597,12 @@ STDMETHODIMP Bumper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case DISPID_Name: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1324: [propget, id(DISPID_Name), helpstring("property Name")] HRESULT Name([out, retval] BSTR *pVal);
+				// line 1326: [propget, id(DISPID_Name), helpstring("property Name")] HRESULT Name([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Name(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1325: [propput, id(DISPID_Name), helpstring("property Name")] HRESULT Name([in] BSTR newVal);
+				// line 1327: [propput, id(DISPID_Name), helpstring("property Name")] HRESULT Name([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -7548,12 +7613,12 @@ STDMETHODIMP Bumper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 34: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1326: [propget, id(34), helpstring("property HitEvent")] HRESULT HasHitEvent([out, retval] VARIANT_BOOL *pVal);
+				// line 1328: [propget, id(34), helpstring("property HitEvent")] HRESULT HasHitEvent([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_HasHitEvent(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1327: [propput, id(34), helpstring("property HitEvent")] HRESULT HasHitEvent([in] VARIANT_BOOL newVal);
+				// line 1329: [propput, id(34), helpstring("property HitEvent")] HRESULT HasHitEvent([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -7564,12 +7629,12 @@ STDMETHODIMP Bumper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 109: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1328: [propget, id(109), helpstring("property CapVisible")] HRESULT CapVisible([out, retval] VARIANT_BOOL *pVal);
+				// line 1330: [propget, id(109), helpstring("property CapVisible")] HRESULT CapVisible([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_CapVisible(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1329: [propput, id(109), helpstring("property CapVisible")] HRESULT CapVisible([in] VARIANT_BOOL newVal);
+				// line 1331: [propput, id(109), helpstring("property CapVisible")] HRESULT CapVisible([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -7580,12 +7645,12 @@ STDMETHODIMP Bumper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 110: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1330: [propget, id(110), helpstring("property BaseVisible")] HRESULT BaseVisible([out, retval] VARIANT_BOOL *pVal);
+				// line 1332: [propget, id(110), helpstring("property BaseVisible")] HRESULT BaseVisible([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_BaseVisible(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1331: [propput, id(110), helpstring("property BaseVisible")] HRESULT BaseVisible([in] VARIANT_BOOL newVal);
+				// line 1333: [propput, id(110), helpstring("property BaseVisible")] HRESULT BaseVisible([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -7596,12 +7661,12 @@ STDMETHODIMP Bumper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 735: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1332: [propget, id(735), helpstring("property RingVisible")] HRESULT RingVisible([out, retval] VARIANT_BOOL *pVal);
+				// line 1334: [propget, id(735), helpstring("property RingVisible")] HRESULT RingVisible([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_RingVisible(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1333: [propput, id(735), helpstring("property RingVisible")] HRESULT RingVisible([in] VARIANT_BOOL newVal);
+				// line 1335: [propput, id(735), helpstring("property RingVisible")] HRESULT RingVisible([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -7612,12 +7677,12 @@ STDMETHODIMP Bumper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 736: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1334: [propget, id(736), helpstring("property SkirtVisible")] HRESULT SkirtVisible([out, retval] VARIANT_BOOL *pVal);
+				// line 1336: [propget, id(736), helpstring("property SkirtVisible")] HRESULT SkirtVisible([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_SkirtVisible(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1335: [propput, id(736), helpstring("property SkirtVisible")] HRESULT SkirtVisible([in] VARIANT_BOOL newVal);
+				// line 1337: [propput, id(736), helpstring("property SkirtVisible")] HRESULT SkirtVisible([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -7628,12 +7693,12 @@ STDMETHODIMP Bumper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 111: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1336: [propget, id(111), helpstring("property Collidable")] HRESULT Collidable([out, retval] VARIANT_BOOL *pVal);
+				// line 1338: [propget, id(111), helpstring("property Collidable")] HRESULT Collidable([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_Collidable(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1337: [propput, id(111), helpstring("property Collidable")] HRESULT Collidable([in] VARIANT_BOOL newVal);
+				// line 1339: [propput, id(111), helpstring("property Collidable")] HRESULT Collidable([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -7644,12 +7709,12 @@ STDMETHODIMP Bumper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 431: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1338: [propget, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([out, retval] VARIANT_BOOL *pVal);
+				// line 1340: [propget, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_ReflectionEnabled(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1339: [propput, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([in] VARIANT_BOOL newVal);
+				// line 1341: [propput, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -7660,12 +7725,12 @@ STDMETHODIMP Bumper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 115: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1340: [propget, id(115), helpstring("property Scatter")] HRESULT Scatter([out, retval] float *pVal);
+				// line 1342: [propget, id(115), helpstring("property Scatter")] HRESULT Scatter([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Scatter(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1341: [propput, id(115), helpstring("property Scatter")] HRESULT Scatter([in] float newVal);
+				// line 1343: [propput, id(115), helpstring("property Scatter")] HRESULT Scatter([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -7676,12 +7741,12 @@ STDMETHODIMP Bumper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 822: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1342: [propget, id(822), helpstring("property EnableSkirtAnimation")] HRESULT EnableSkirtAnimation([out, retval] VARIANT_BOOL *pVal);
+				// line 1344: [propget, id(822), helpstring("property EnableSkirtAnimation")] HRESULT EnableSkirtAnimation([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_EnableSkirtAnimation(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1343: [propput, id(822), helpstring("property EnableSkirtAnimation")] HRESULT EnableSkirtAnimation([in] VARIANT_BOOL newVal);
+				// line 1345: [propput, id(822), helpstring("property EnableSkirtAnimation")] HRESULT EnableSkirtAnimation([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -7692,7 +7757,7 @@ STDMETHODIMP Bumper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 827: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1344: [propget, id(827), helpstring("property RotX")] HRESULT RotX([out, retval] float *pVal);
+				// line 1346: [propget, id(827), helpstring("property RotX")] HRESULT RotX([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_RotX(&V_R4(&res));
 			}
@@ -7700,7 +7765,7 @@ STDMETHODIMP Bumper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 828: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1345: [propget, id(828), helpstring("property RotY")] HRESULT RotY([out, retval] float *pVal);
+				// line 1347: [propget, id(828), helpstring("property RotY")] HRESULT RotY([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_RotY(&V_R4(&res));
 			}
@@ -7708,7 +7773,7 @@ STDMETHODIMP Bumper::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 999: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 1346: [id(999), helpstring("method PlayHit")] HRESULT PlayHit();
+				// line 1348: [id(999), helpstring("method PlayHit")] HRESULT PlayHit();
 				hres = PlayHit();
 			}
 			break;
@@ -7839,12 +7904,12 @@ STDMETHODIMP Trigger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 346: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1375: [propget, id(346), helpstring("property Radius")] HRESULT Radius([out, retval] float *pVal);
+				// line 1377: [propget, id(346), helpstring("property Radius")] HRESULT Radius([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Radius(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1376: [propput, id(346), helpstring("property Radius")] HRESULT Radius([in] float newVal);
+				// line 1378: [propput, id(346), helpstring("property Radius")] HRESULT Radius([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -7855,12 +7920,12 @@ STDMETHODIMP Trigger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Timer_Enabled: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1377: [propget, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([out, retval] VARIANT_BOOL *pVal);
+				// line 1379: [propget, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_TimerEnabled(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1378: [propput, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([in] VARIANT_BOOL newVal);
+				// line 1380: [propput, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -7871,12 +7936,12 @@ STDMETHODIMP Trigger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Timer_Interval: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1379: [propget, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([out, retval] long *pVal);
+				// line 1381: [propget, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([out, retval] long *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_TimerInterval((LONG*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1380: [propput, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([in] long newVal);
+				// line 1382: [propput, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([in] long newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -7887,12 +7952,12 @@ STDMETHODIMP Trigger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_X: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1381: [propget, id(DISPID_X), helpstring("property X")] HRESULT X([out, retval] float *pVal);
+				// line 1383: [propget, id(DISPID_X), helpstring("property X")] HRESULT X([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_X(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1382: [propput, id(DISPID_X), helpstring("property X")] HRESULT X([in] float newVal);
+				// line 1384: [propput, id(DISPID_X), helpstring("property X")] HRESULT X([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -7903,12 +7968,12 @@ STDMETHODIMP Trigger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Y: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1383: [propget, id(DISPID_Y), helpstring("property Y")] HRESULT Y([out, retval] float *pVal);
+				// line 1385: [propget, id(DISPID_Y), helpstring("property Y")] HRESULT Y([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Y(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1384: [propput, id(DISPID_Y), helpstring("property Y")] HRESULT Y([in] float newVal);
+				// line 1386: [propput, id(DISPID_Y), helpstring("property Y")] HRESULT Y([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -7919,12 +7984,12 @@ STDMETHODIMP Trigger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Enabled: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1385: [propget, id(DISPID_Enabled), helpstring("property Enabled")] HRESULT Enabled([out, retval] VARIANT_BOOL *pVal);
+				// line 1387: [propget, id(DISPID_Enabled), helpstring("property Enabled")] HRESULT Enabled([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_Enabled(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1386: [propput, id(DISPID_Enabled), helpstring("property Enabled")] HRESULT Enabled([in] VARIANT_BOOL newVal);
+				// line 1388: [propput, id(DISPID_Enabled), helpstring("property Enabled")] HRESULT Enabled([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -7935,12 +8000,12 @@ STDMETHODIMP Trigger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 458: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1387: [propget, id(458), helpstring("property Visible")] HRESULT Visible([out, retval] VARIANT_BOOL *pVal);
+				// line 1389: [propget, id(458), helpstring("property Visible")] HRESULT Visible([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_Visible(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1388: [propput, id(458), helpstring("property Visible")] HRESULT Visible([in] VARIANT_BOOL newVal);
+				// line 1390: [propput, id(458), helpstring("property Visible")] HRESULT Visible([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -7951,12 +8016,12 @@ STDMETHODIMP Trigger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Shape: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1389: [propget, id(DISPID_Shape), helpstring("property TriggerShape")] HRESULT TriggerShape([out, retval] TriggerShape *pVal);
+				// line 1391: [propget, id(DISPID_Shape), helpstring("property TriggerShape")] HRESULT TriggerShape([out, retval] TriggerShape *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_TriggerShape((TriggerShape*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1390: [propput, id(DISPID_Shape), helpstring("property TriggerShape")] HRESULT TriggerShape([in] TriggerShape newVal);
+				// line 1392: [propput, id(DISPID_Shape), helpstring("property TriggerShape")] HRESULT TriggerShape([in] TriggerShape newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -7967,12 +8032,12 @@ STDMETHODIMP Trigger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Surface: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1391: [propget, id(DISPID_Surface), helpstring("property Surface")] HRESULT Surface([out, retval] BSTR *pVal);
+				// line 1393: [propget, id(DISPID_Surface), helpstring("property Surface")] HRESULT Surface([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Surface(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1392: [propput, id(DISPID_Surface), helpstring("property Surface")] HRESULT Surface([in] BSTR newVal);
+				// line 1394: [propput, id(DISPID_Surface), helpstring("property Surface")] HRESULT Surface([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -7983,12 +8048,12 @@ STDMETHODIMP Trigger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Name: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1393: [propget, id(DISPID_Name), helpstring("property Name")] HRESULT Name([out, retval] BSTR *pVal);
+				// line 1395: [propget, id(DISPID_Name), helpstring("property Name")] HRESULT Name([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Name(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1394: [propput, id(DISPID_Name), helpstring("property Name")] HRESULT Name([in] BSTR newVal);
+				// line 1396: [propput, id(DISPID_Name), helpstring("property Name")] HRESULT Name([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -7999,11 +8064,11 @@ STDMETHODIMP Trigger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_UserValue: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1395: [propget, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([out, retval] VARIANT* pVal);
+				// line 1397: [propget, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([out, retval] VARIANT* pVal);
 				hres = get_UserValue(&res);
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1396: [propput, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([in] VARIANT* newVal);
+				// line 1398: [propput, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([in] VARIANT* newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantCopyInd(&var0, &pDispParams->rgvarg[--index]);
@@ -8014,7 +8079,7 @@ STDMETHODIMP Trigger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 312: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 1397: [id(312), helpstring("method BallCntOver")] HRESULT BallCntOver([out, retval] int *pVal);
+				// line 1399: [id(312), helpstring("method BallCntOver")] HRESULT BallCntOver([out, retval] int *pVal);
 				V_VT(&res) = VT_I4;
 				hres = BallCntOver((int*)&V_I4(&res));
 			}
@@ -8022,7 +8087,7 @@ STDMETHODIMP Trigger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 313: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 1398: [id(313), helpstring("method DestroyBall")] HRESULT DestroyBall([out, retval] int *pVal);
+				// line 1400: [id(313), helpstring("method DestroyBall")] HRESULT DestroyBall([out, retval] int *pVal);
 				V_VT(&res) = VT_I4;
 				hres = DestroyBall((int*)&V_I4(&res));
 			}
@@ -8030,12 +8095,12 @@ STDMETHODIMP Trigger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 314: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1399: [propget, id(314), helpstring("property HitHeight")] HRESULT HitHeight([out, retval] float *pVal);
+				// line 1401: [propget, id(314), helpstring("property HitHeight")] HRESULT HitHeight([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_HitHeight(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1400: [propput, id(314), helpstring("property HitHeight")] HRESULT HitHeight([in] float newVal);
+				// line 1402: [propput, id(314), helpstring("property HitHeight")] HRESULT HitHeight([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -8046,12 +8111,12 @@ STDMETHODIMP Trigger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 340: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1401: [propget, id(340), helpstring("property Material")] HRESULT Material([out, retval] BSTR *pVal);
+				// line 1403: [propget, id(340), helpstring("property Material")] HRESULT Material([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Material(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1402: [propput, id(340), helpstring("property Material")] HRESULT Material([in] BSTR newVal);
+				// line 1404: [propput, id(340), helpstring("property Material")] HRESULT Material([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -8062,12 +8127,12 @@ STDMETHODIMP Trigger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 345: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1403: [propget, id(345), helpstring("property Rotation")] HRESULT Rotation([out, retval] float *pVal);
+				// line 1405: [propget, id(345), helpstring("property Rotation")] HRESULT Rotation([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Rotation(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1404: [propput, id(345), helpstring("property Rotation")] HRESULT Rotation([in] float newVal);
+				// line 1406: [propput, id(345), helpstring("property Rotation")] HRESULT Rotation([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -8078,12 +8143,12 @@ STDMETHODIMP Trigger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 347: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1405: [propget, id(347), helpstring("property WireThickness")] HRESULT WireThickness([out, retval] float *pVal);
+				// line 1407: [propget, id(347), helpstring("property WireThickness")] HRESULT WireThickness([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_WireThickness(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1406: [propput, id(347), helpstring("property WireThickness")] HRESULT WireThickness([in] float newVal);
+				// line 1408: [propput, id(347), helpstring("property WireThickness")] HRESULT WireThickness([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -8094,12 +8159,12 @@ STDMETHODIMP Trigger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 26: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1407: [propget, id(26), helpstring("property AnimSpeed")] HRESULT AnimSpeed([out, retval] float *pVal);
+				// line 1409: [propget, id(26), helpstring("property AnimSpeed")] HRESULT AnimSpeed([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_AnimSpeed(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1408: [propput, id(26), helpstring("property AnimSpeed")] HRESULT AnimSpeed([in] float newVal);
+				// line 1410: [propput, id(26), helpstring("property AnimSpeed")] HRESULT AnimSpeed([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -8110,7 +8175,7 @@ STDMETHODIMP Trigger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 27: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1409: [propget, id(27), helpstring("property CurrentAnimOffset")] HRESULT CurrentAnimOffset([out, retval] float *pVal);
+				// line 1411: [propget, id(27), helpstring("property CurrentAnimOffset")] HRESULT CurrentAnimOffset([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_CurrentAnimOffset(&V_R4(&res));
 			}
@@ -8118,12 +8183,12 @@ STDMETHODIMP Trigger::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 431: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1410: [propget, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([out, retval] VARIANT_BOOL *pVal);
+				// line 1412: [propget, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_ReflectionEnabled(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1411: [propput, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([in] VARIANT_BOOL newVal);
+				// line 1413: [propput, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -8276,12 +8341,12 @@ STDMETHODIMP Light::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 1: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1441: [propget, id(1), helpstring("property Falloff")] HRESULT Falloff([out, retval] float *pVal);
+				// line 1443: [propget, id(1), helpstring("property Falloff")] HRESULT Falloff([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Falloff(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1442: [propput, id(1), helpstring("property Falloff")] HRESULT Falloff([in] float newVal);
+				// line 1444: [propput, id(1), helpstring("property Falloff")] HRESULT Falloff([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -8292,12 +8357,12 @@ STDMETHODIMP Light::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 432: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1443: [propget, id(432), helpstring("property FalloffPower")] HRESULT FalloffPower([out, retval] float *pVal);
+				// line 1445: [propget, id(432), helpstring("property FalloffPower")] HRESULT FalloffPower([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_FalloffPower(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1444: [propput, id(432), helpstring("property FalloffPower")] HRESULT FalloffPower([in] float newVal);
+				// line 1446: [propput, id(432), helpstring("property FalloffPower")] HRESULT FalloffPower([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -8308,12 +8373,12 @@ STDMETHODIMP Light::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case DISPID_Light_State: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1445: [propget, id(DISPID_Light_State), helpstring("property State")] HRESULT State([out, retval] float *pVal);
+				// line 1447: [propget, id(DISPID_Light_State), helpstring("property State")] HRESULT State([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_State(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1446: [propput, id(DISPID_Light_State), helpstring("property State")] HRESULT State([in] float newVal);
+				// line 1448: [propput, id(DISPID_Light_State), helpstring("property State")] HRESULT State([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -8324,7 +8389,7 @@ STDMETHODIMP Light::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 595: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 1447: [id(595), helpstring("method GetInPlayState")] HRESULT GetInPlayState([out, retval] float* pVal);
+				// line 1449: [id(595), helpstring("method GetInPlayState")] HRESULT GetInPlayState([out, retval] float* pVal);
 				V_VT(&res) = VT_R4;
 				hres = GetInPlayState(&V_R4(&res));
 			}
@@ -8332,7 +8397,7 @@ STDMETHODIMP Light::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 596: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 1448: [id(596), helpstring("method GetInPlayStateBool")] HRESULT GetInPlayStateBool([out, retval] VARIANT_BOOL* pVal);
+				// line 1450: [id(596), helpstring("method GetInPlayStateBool")] HRESULT GetInPlayStateBool([out, retval] VARIANT_BOOL* pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = GetInPlayStateBool(&V_BOOL(&res));
 			}
@@ -8340,7 +8405,7 @@ STDMETHODIMP Light::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 597: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 1449: [id(597), helpstring("method GetInPlayIntensity")] HRESULT GetInPlayIntensity([out, retval] float* pVal);
+				// line 1451: [id(597), helpstring("method GetInPlayIntensity")] HRESULT GetInPlayIntensity([out, retval] float* pVal);
 				V_VT(&res) = VT_R4;
 				hres = GetInPlayIntensity(&V_R4(&res));
 			}
@@ -8348,12 +8413,12 @@ STDMETHODIMP Light::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 3: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1450: [propget, id(3), helpstring("property Color")] HRESULT Color([out, retval] OLE_COLOR *pVal);
+				// line 1452: [propget, id(3), helpstring("property Color")] HRESULT Color([out, retval] OLE_COLOR *pVal);
 				V_VT(&res) = VT_UI4;
 				hres = get_Color(&V_UI4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1451: [propput, id(3), helpstring("property Color")] HRESULT Color([in] OLE_COLOR newVal);
+				// line 1453: [propput, id(3), helpstring("property Color")] HRESULT Color([in] OLE_COLOR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_UI4);
@@ -8364,12 +8429,12 @@ STDMETHODIMP Light::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 457: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1452: [propget, id(457), helpstring("property ColorFull")] HRESULT ColorFull([out, retval] OLE_COLOR *pVal);
+				// line 1454: [propget, id(457), helpstring("property ColorFull")] HRESULT ColorFull([out, retval] OLE_COLOR *pVal);
 				V_VT(&res) = VT_UI4;
 				hres = get_ColorFull(&V_UI4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1453: [propput, id(457), helpstring("property ColorFull")] HRESULT ColorFull([in] OLE_COLOR newVal);
+				// line 1455: [propput, id(457), helpstring("property ColorFull")] HRESULT ColorFull([in] OLE_COLOR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_UI4);
@@ -8380,12 +8445,12 @@ STDMETHODIMP Light::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case DISPID_Timer_Enabled: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1454: [propget, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([out, retval] VARIANT_BOOL *pVal);
+				// line 1456: [propget, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_TimerEnabled(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1455: [propput, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([in] VARIANT_BOOL newVal);
+				// line 1457: [propput, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -8396,12 +8461,12 @@ STDMETHODIMP Light::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case DISPID_Timer_Interval: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1456: [propget, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([out, retval] long *pVal);
+				// line 1458: [propget, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([out, retval] long *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_TimerInterval((LONG*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1457: [propput, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([in] long newVal);
+				// line 1459: [propput, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([in] long newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -8412,12 +8477,12 @@ STDMETHODIMP Light::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case DISPID_X: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1458: [propget, id(DISPID_X), helpstring("property X")] HRESULT X([out, retval] float *pVal);
+				// line 1460: [propget, id(DISPID_X), helpstring("property X")] HRESULT X([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_X(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1459: [propput, id(DISPID_X), helpstring("property X")] HRESULT X([in] float newVal);
+				// line 1461: [propput, id(DISPID_X), helpstring("property X")] HRESULT X([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -8428,12 +8493,12 @@ STDMETHODIMP Light::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case DISPID_Y: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1460: [propget, id(DISPID_Y), helpstring("property Y")] HRESULT Y([out, retval] float *pVal);
+				// line 1462: [propget, id(DISPID_Y), helpstring("property Y")] HRESULT Y([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Y(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1461: [propput, id(DISPID_Y), helpstring("property Y")] HRESULT Y([in] float newVal);
+				// line 1463: [propput, id(DISPID_Y), helpstring("property Y")] HRESULT Y([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -8444,12 +8509,12 @@ STDMETHODIMP Light::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 9: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1462: [propget, id(9), helpstring("property BlinkPattern")] HRESULT BlinkPattern([out, retval] BSTR *pVal);
+				// line 1464: [propget, id(9), helpstring("property BlinkPattern")] HRESULT BlinkPattern([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_BlinkPattern(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1463: [propput, id(9), helpstring("property BlinkPattern")] HRESULT BlinkPattern([in] BSTR newVal);
+				// line 1465: [propput, id(9), helpstring("property BlinkPattern")] HRESULT BlinkPattern([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -8460,12 +8525,12 @@ STDMETHODIMP Light::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case DISPID_Light_BlinkInterval: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1464: [propget, id(DISPID_Light_BlinkInterval), helpstring("property BlinkInterval")] HRESULT BlinkInterval([out, retval] long *pVal);
+				// line 1466: [propget, id(DISPID_Light_BlinkInterval), helpstring("property BlinkInterval")] HRESULT BlinkInterval([out, retval] long *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_BlinkInterval((LONG*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1465: [propput, id(DISPID_Light_BlinkInterval), helpstring("property BlinkInterval")] HRESULT BlinkInterval([in] long newVal);
+				// line 1467: [propput, id(DISPID_Light_BlinkInterval), helpstring("property BlinkInterval")] HRESULT BlinkInterval([in] long newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -8476,7 +8541,7 @@ STDMETHODIMP Light::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 38: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 1466: [id(38), helpstring("method Duration")] HRESULT Duration([in] float startState,[in] long newVal, [in] float endState);
+				// line 1468: [id(38), helpstring("method Duration")] HRESULT Duration([in] float startState,[in] long newVal, [in] float endState);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -8495,12 +8560,12 @@ STDMETHODIMP Light::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 12: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1467: [propget, id(12), helpstring("property Intensity")] HRESULT Intensity([out, retval] float *pVal);
+				// line 1469: [propget, id(12), helpstring("property Intensity")] HRESULT Intensity([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Intensity(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1468: [propput, id(12), helpstring("property Intensity")] HRESULT Intensity([in] float newVal);
+				// line 1470: [propput, id(12), helpstring("property Intensity")] HRESULT Intensity([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -8511,12 +8576,12 @@ STDMETHODIMP Light::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 617: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1469: [propget, id(617), helpstring("property TransmissionScale")] HRESULT TransmissionScale([out, retval] float *pVal);
+				// line 1471: [propget, id(617), helpstring("property TransmissionScale")] HRESULT TransmissionScale([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_TransmissionScale(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1470: [propput, id(617), helpstring("property TransmissionScale")] HRESULT TransmissionScale([in] float newVal);
+				// line 1472: [propput, id(617), helpstring("property TransmissionScale")] HRESULT TransmissionScale([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -8527,12 +8592,12 @@ STDMETHODIMP Light::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 434: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1471: [propget, id(434), helpstring("property IntensityScale")] HRESULT IntensityScale([out, retval] float *pVal);
+				// line 1473: [propget, id(434), helpstring("property IntensityScale")] HRESULT IntensityScale([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_IntensityScale(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1472: [propput, id(434), helpstring("property IntensityScale")] HRESULT IntensityScale([in] float newVal);
+				// line 1474: [propput, id(434), helpstring("property IntensityScale")] HRESULT IntensityScale([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -8543,12 +8608,12 @@ STDMETHODIMP Light::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case DISPID_Surface: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1473: [propget, id(DISPID_Surface), helpstring("property Surface")] HRESULT Surface([out, retval] BSTR *pVal);
+				// line 1475: [propget, id(DISPID_Surface), helpstring("property Surface")] HRESULT Surface([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Surface(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1474: [propput, id(DISPID_Surface), helpstring("property Surface")] HRESULT Surface([in] BSTR newVal);
+				// line 1476: [propput, id(DISPID_Surface), helpstring("property Surface")] HRESULT Surface([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -8559,12 +8624,12 @@ STDMETHODIMP Light::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case DISPID_Name: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1475: [propget, id(DISPID_Name), helpstring("property Name")] HRESULT Name([out, retval] BSTR *pVal);
+				// line 1477: [propget, id(DISPID_Name), helpstring("property Name")] HRESULT Name([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Name(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1476: [propput, id(DISPID_Name), helpstring("property Name")] HRESULT Name([in] BSTR newVal);
+				// line 1478: [propput, id(DISPID_Name), helpstring("property Name")] HRESULT Name([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -8575,11 +8640,11 @@ STDMETHODIMP Light::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case DISPID_UserValue: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1477: [propget, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([out, retval] VARIANT* pVal);
+				// line 1479: [propget, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([out, retval] VARIANT* pVal);
 				hres = get_UserValue(&res);
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1478: [propput, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([in] VARIANT* newVal);
+				// line 1480: [propput, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([in] VARIANT* newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantCopyInd(&var0, &pDispParams->rgvarg[--index]);
@@ -8590,12 +8655,12 @@ STDMETHODIMP Light::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case DISPID_Image: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1479: [propget, id(DISPID_Image), helpstring("property Image")] HRESULT Image([out, retval] BSTR *pVal);
+				// line 1481: [propget, id(DISPID_Image), helpstring("property Image")] HRESULT Image([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Image(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1480: [propput, id(DISPID_Image), helpstring("property Image")] HRESULT Image([in] BSTR newVal);
+				// line 1482: [propput, id(DISPID_Image), helpstring("property Image")] HRESULT Image([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -8606,12 +8671,12 @@ STDMETHODIMP Light::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 453: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1481: [propget, id(453), helpstring("property ImageMode")] HRESULT ImageMode([out, retval] VARIANT_BOOL *pVal);
+				// line 1483: [propget, id(453), helpstring("property ImageMode")] HRESULT ImageMode([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_ImageMode(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1482: [propput, id(453), helpstring("property ImageMode")] HRESULT ImageMode([in] VARIANT_BOOL newVal);
+				// line 1484: [propput, id(453), helpstring("property ImageMode")] HRESULT ImageMode([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -8622,12 +8687,12 @@ STDMETHODIMP Light::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 397: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1483: [propget, id(397), helpstring("property DepthBias")] HRESULT DepthBias([out, retval] float *pVal);
+				// line 1485: [propget, id(397), helpstring("property DepthBias")] HRESULT DepthBias([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_DepthBias(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1484: [propput, id(397), helpstring("property DepthBias")] HRESULT DepthBias([in] float newVal);
+				// line 1486: [propput, id(397), helpstring("property DepthBias")] HRESULT DepthBias([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -8638,12 +8703,12 @@ STDMETHODIMP Light::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 377: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1485: [propget, id(377), helpstring("property FadeSpeedUp")] HRESULT FadeSpeedUp([out, retval] float *pVal);
+				// line 1487: [propget, id(377), helpstring("property FadeSpeedUp")] HRESULT FadeSpeedUp([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_FadeSpeedUp(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1486: [propput, id(377), helpstring("property FadeSpeedUp")] HRESULT FadeSpeedUp([in] float newVal);
+				// line 1488: [propput, id(377), helpstring("property FadeSpeedUp")] HRESULT FadeSpeedUp([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -8654,12 +8719,12 @@ STDMETHODIMP Light::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 437: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1487: [propget, id(437), helpstring("property FadeSpeedDown")] HRESULT FadeSpeedDown([out, retval] float *pVal);
+				// line 1489: [propget, id(437), helpstring("property FadeSpeedDown")] HRESULT FadeSpeedDown([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_FadeSpeedDown(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1488: [propput, id(437), helpstring("property FadeSpeedDown")] HRESULT FadeSpeedDown([in] float newVal);
+				// line 1490: [propput, id(437), helpstring("property FadeSpeedDown")] HRESULT FadeSpeedDown([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -8670,12 +8735,12 @@ STDMETHODIMP Light::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 340: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1489: [propget, id(340), helpstring("property Bulb")] HRESULT Bulb([out, retval] VARIANT_BOOL *pVal);
+				// line 1491: [propget, id(340), helpstring("property Bulb")] HRESULT Bulb([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_Bulb(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1490: [propput, id(340), helpstring("property Bulb")] HRESULT Bulb([in] VARIANT_BOOL newVal);
+				// line 1492: [propput, id(340), helpstring("property Bulb")] HRESULT Bulb([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -8686,12 +8751,12 @@ STDMETHODIMP Light::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 394: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1491: [propget, id(394), helpstring("property ShowBulbMesh")] HRESULT ShowBulbMesh([out, retval] VARIANT_BOOL *pVal);
+				// line 1493: [propget, id(394), helpstring("property ShowBulbMesh")] HRESULT ShowBulbMesh([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_ShowBulbMesh(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1492: [propput, id(394), helpstring("property ShowBulbMesh")] HRESULT ShowBulbMesh([in] VARIANT_BOOL newVal);
+				// line 1494: [propput, id(394), helpstring("property ShowBulbMesh")] HRESULT ShowBulbMesh([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -8702,12 +8767,12 @@ STDMETHODIMP Light::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 727: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1493: [propget, id(727), helpstring("property StaticBulbMesh")] HRESULT StaticBulbMesh([out, retval] VARIANT_BOOL *pVal);
+				// line 1495: [propget, id(727), helpstring("property StaticBulbMesh")] HRESULT StaticBulbMesh([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_StaticBulbMesh(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1494: [propput, id(727), helpstring("property StaticBulbMesh")] HRESULT StaticBulbMesh([in] VARIANT_BOOL newVal);
+				// line 1496: [propput, id(727), helpstring("property StaticBulbMesh")] HRESULT StaticBulbMesh([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -8718,12 +8783,12 @@ STDMETHODIMP Light::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 455: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1495: [propget, id(455), helpstring("property ShowReflectionOnBall")] HRESULT ShowReflectionOnBall([out, retval] VARIANT_BOOL *pVal);
+				// line 1497: [propget, id(455), helpstring("property ShowReflectionOnBall")] HRESULT ShowReflectionOnBall([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_ShowReflectionOnBall(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1496: [propput, id(455), helpstring("property ShowReflectionOnBall")] HRESULT ShowReflectionOnBall([in] VARIANT_BOOL newVal);
+				// line 1498: [propput, id(455), helpstring("property ShowReflectionOnBall")] HRESULT ShowReflectionOnBall([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -8734,12 +8799,12 @@ STDMETHODIMP Light::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 425: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1497: [propget, id(425), helpstring("property ScaleBulbMesh")] HRESULT ScaleBulbMesh([out, retval] float *pVal);
+				// line 1499: [propget, id(425), helpstring("property ScaleBulbMesh")] HRESULT ScaleBulbMesh([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_ScaleBulbMesh(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1498: [propput, id(425), helpstring("property ScaleBulbMesh")] HRESULT ScaleBulbMesh([in] float newVal);
+				// line 1500: [propput, id(425), helpstring("property ScaleBulbMesh")] HRESULT ScaleBulbMesh([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -8750,12 +8815,12 @@ STDMETHODIMP Light::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 431: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1499: [propget, id(431), helpstring("property BulbModulateVsAdd")] HRESULT BulbModulateVsAdd([out, retval] float *pVal);
+				// line 1501: [propget, id(431), helpstring("property BulbModulateVsAdd")] HRESULT BulbModulateVsAdd([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_BulbModulateVsAdd(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1500: [propput, id(431), helpstring("property BulbModulateVsAdd")] HRESULT BulbModulateVsAdd([in] float newVal);
+				// line 1502: [propput, id(431), helpstring("property BulbModulateVsAdd")] HRESULT BulbModulateVsAdd([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -8766,12 +8831,12 @@ STDMETHODIMP Light::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 429: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1501: [propget, id(429), helpstring("property BulbHaloHeight")] HRESULT BulbHaloHeight([out, retval] float *pVal);
+				// line 1503: [propget, id(429), helpstring("property BulbHaloHeight")] HRESULT BulbHaloHeight([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_BulbHaloHeight(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1502: [propput, id(429), helpstring("property BulbHaloHeight")] HRESULT BulbHaloHeight([in] float newVal);
+				// line 1504: [propput, id(429), helpstring("property BulbHaloHeight")] HRESULT BulbHaloHeight([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -8782,12 +8847,12 @@ STDMETHODIMP Light::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 615: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1503: [propget, id(615), helpstring("property Visible")] HRESULT Visible([out, retval] VARIANT_BOOL *pVal);
+				// line 1505: [propget, id(615), helpstring("property Visible")] HRESULT Visible([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_Visible(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1504: [propput, id(615), helpstring("property Visible")] HRESULT Visible([in] VARIANT_BOOL newVal);
+				// line 1506: [propput, id(615), helpstring("property Visible")] HRESULT Visible([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -8798,12 +8863,12 @@ STDMETHODIMP Light::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 456: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1505: [propget, id(456), helpstring("property Shadows")] HRESULT Shadows([out, retval] long *pVal);
+				// line 1507: [propget, id(456), helpstring("property Shadows")] HRESULT Shadows([out, retval] long *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_Shadows((LONG*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1506: [propput, id(456), helpstring("property Shadows")] HRESULT Shadows([in] long newVal);
+				// line 1508: [propput, id(456), helpstring("property Shadows")] HRESULT Shadows([in] long newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -8814,12 +8879,12 @@ STDMETHODIMP Light::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 458: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1507: [propget, id(458), helpstring("property Fader")] HRESULT Fader([out, retval] long *pVal);
+				// line 1509: [propget, id(458), helpstring("property Fader")] HRESULT Fader([out, retval] long *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_Fader((LONG*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1508: [propput, id(458), helpstring("property Fader")] HRESULT Fader([in] long newVal);
+				// line 1510: [propput, id(458), helpstring("property Fader")] HRESULT Fader([in] long newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -8830,7 +8895,7 @@ STDMETHODIMP Light::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 459: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1509: [propget, id(459), helpstring("property FilamentTemperature")] HRESULT FilamentTemperature([out, retval] float *pVal);
+				// line 1511: [propget, id(459), helpstring("property FilamentTemperature")] HRESULT FilamentTemperature([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_FilamentTemperature(&V_R4(&res));
 			}
@@ -8967,12 +9032,12 @@ STDMETHODIMP Kicker::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case DISPID_Name: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1538: [propget, id(DISPID_Name), helpstring("property Name")] HRESULT Name([out, retval] BSTR *pVal);
+				// line 1540: [propget, id(DISPID_Name), helpstring("property Name")] HRESULT Name([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Name(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1539: [propput, id(DISPID_Name), helpstring("property Name")] HRESULT Name([in] BSTR newVal);
+				// line 1541: [propput, id(DISPID_Name), helpstring("property Name")] HRESULT Name([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -8983,7 +9048,7 @@ STDMETHODIMP Kicker::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 1: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 1540: [id(1), helpstring("method CreateBall")] HRESULT CreateBall([out, retval] IBall **Ball);
+				// line 1542: [id(1), helpstring("method CreateBall")] HRESULT CreateBall([out, retval] IBall **Ball);
 				V_VT(&res) = VT_DISPATCH;
 				hres = CreateBall((IBall**)&V_DISPATCH(&res));
 			}
@@ -8991,7 +9056,7 @@ STDMETHODIMP Kicker::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 11: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 1541: [id(11), helpstring("method CreateSizedBall")] HRESULT CreateSizedBall([in] float radius, [out, retval] IBall **Ball);
+				// line 1543: [id(11), helpstring("method CreateSizedBall")] HRESULT CreateSizedBall([in] float radius, [out, retval] IBall **Ball);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -9003,7 +9068,7 @@ STDMETHODIMP Kicker::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 444: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 1542: [id(444), helpstring("method CreateSizedBallWithMass")] HRESULT CreateSizedBallWithMass([in] float radius, [in] float mass, [out, retval] IBall **Ball);
+				// line 1544: [id(444), helpstring("method CreateSizedBallWithMass")] HRESULT CreateSizedBallWithMass([in] float radius, [in] float mass, [out, retval] IBall **Ball);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -9019,7 +9084,7 @@ STDMETHODIMP Kicker::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 2: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 1543: [id(2), helpstring("method DestroyBall")] HRESULT DestroyBall([out, retval] int *pVal);
+				// line 1545: [id(2), helpstring("method DestroyBall")] HRESULT DestroyBall([out, retval] int *pVal);
 				V_VT(&res) = VT_I4;
 				hres = DestroyBall((int*)&V_I4(&res));
 			}
@@ -9027,12 +9092,12 @@ STDMETHODIMP Kicker::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case DISPID_Timer_Enabled: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1544: [propget, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([out, retval] VARIANT_BOOL *pVal);
+				// line 1546: [propget, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_TimerEnabled(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1545: [propput, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([in] VARIANT_BOOL newVal);
+				// line 1547: [propput, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -9043,12 +9108,12 @@ STDMETHODIMP Kicker::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case DISPID_Timer_Interval: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1546: [propget, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([out, retval] long *pVal);
+				// line 1548: [propget, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([out, retval] long *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_TimerInterval((LONG*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1547: [propput, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([in] long newVal);
+				// line 1549: [propput, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([in] long newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -9059,7 +9124,7 @@ STDMETHODIMP Kicker::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 5: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 1548: [id(5), helpstring("method Kick")] HRESULT Kick(float angle, float speed, [defaultvalue(0)] float inclination);
+				// line 1550: [id(5), helpstring("method Kick")] HRESULT Kick(float angle, float speed, [defaultvalue(0)] float inclination);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -9079,7 +9144,7 @@ STDMETHODIMP Kicker::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 310: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 1549: [id(310), helpstring("method KickXYZ")] HRESULT KickXYZ(float angle, float speed, float inclination, float x, float y, float z);
+				// line 1551: [id(310), helpstring("method KickXYZ")] HRESULT KickXYZ(float angle, float speed, float inclination, float x, float y, float z);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -9110,7 +9175,7 @@ STDMETHODIMP Kicker::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 311: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 1550: [id(311), helpstring("method KickZ")] HRESULT KickZ(float angle, float speed, float inclination, float heightz);
+				// line 1552: [id(311), helpstring("method KickZ")] HRESULT KickZ(float angle, float speed, float inclination, float heightz);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -9133,12 +9198,12 @@ STDMETHODIMP Kicker::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case DISPID_X: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1551: [propget, id(DISPID_X), helpstring("property X")] HRESULT X([out, retval] float *pVal);
+				// line 1553: [propget, id(DISPID_X), helpstring("property X")] HRESULT X([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_X(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1552: [propput, id(DISPID_X), helpstring("property X")] HRESULT X([in] float newVal);
+				// line 1554: [propput, id(DISPID_X), helpstring("property X")] HRESULT X([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -9149,12 +9214,12 @@ STDMETHODIMP Kicker::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case DISPID_Y: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1553: [propget, id(DISPID_Y), helpstring("property Y")] HRESULT Y([out, retval] float *pVal);
+				// line 1555: [propget, id(DISPID_Y), helpstring("property Y")] HRESULT Y([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Y(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1554: [propput, id(DISPID_Y), helpstring("property Y")] HRESULT Y([in] float newVal);
+				// line 1556: [propput, id(DISPID_Y), helpstring("property Y")] HRESULT Y([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -9165,12 +9230,12 @@ STDMETHODIMP Kicker::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case DISPID_Enabled: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1555: [propget, id(DISPID_Enabled), helpstring("property Enabled")] HRESULT Enabled([out, retval] VARIANT_BOOL *pVal);
+				// line 1557: [propget, id(DISPID_Enabled), helpstring("property Enabled")] HRESULT Enabled([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_Enabled(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1556: [propput, id(DISPID_Enabled), helpstring("property Enabled")] HRESULT Enabled([in] VARIANT_BOOL newVal);
+				// line 1558: [propput, id(DISPID_Enabled), helpstring("property Enabled")] HRESULT Enabled([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -9181,12 +9246,12 @@ STDMETHODIMP Kicker::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 9: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1557: [propget, id(9), helpstring("property DrawStyle")] HRESULT DrawStyle([out, retval] KickerType *pVal);
+				// line 1559: [propget, id(9), helpstring("property DrawStyle")] HRESULT DrawStyle([out, retval] KickerType *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_DrawStyle((KickerType*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1558: [propput, id(9), helpstring("property DrawStyle")] HRESULT DrawStyle([in] KickerType newVal);
+				// line 1560: [propput, id(9), helpstring("property DrawStyle")] HRESULT DrawStyle([in] KickerType newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -9197,12 +9262,12 @@ STDMETHODIMP Kicker::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 340: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1559: [propget, id(340), helpstring("property Material")] HRESULT Material([out, retval] BSTR *pVal);
+				// line 1561: [propget, id(340), helpstring("property Material")] HRESULT Material([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Material(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1560: [propput, id(340), helpstring("property Material")] HRESULT Material([in] BSTR newVal);
+				// line 1562: [propput, id(340), helpstring("property Material")] HRESULT Material([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -9213,12 +9278,12 @@ STDMETHODIMP Kicker::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case DISPID_Surface: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1561: [propget, id(DISPID_Surface), helpstring("property Surface")] HRESULT Surface([out, retval] BSTR *pVal);
+				// line 1563: [propget, id(DISPID_Surface), helpstring("property Surface")] HRESULT Surface([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Surface(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1562: [propput, id(DISPID_Surface), helpstring("property Surface")] HRESULT Surface([in] BSTR newVal);
+				// line 1564: [propput, id(DISPID_Surface), helpstring("property Surface")] HRESULT Surface([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -9229,11 +9294,11 @@ STDMETHODIMP Kicker::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case DISPID_UserValue: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1563: [propget, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([out, retval] VARIANT* pVal);
+				// line 1565: [propget, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([out, retval] VARIANT* pVal);
 				hres = get_UserValue(&res);
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1564: [propput, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([in] VARIANT* newVal);
+				// line 1566: [propput, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([in] VARIANT* newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantCopyInd(&var0, &pDispParams->rgvarg[--index]);
@@ -9244,7 +9309,7 @@ STDMETHODIMP Kicker::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 312: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 1565: [id(312), helpstring("method BallCntOver")] HRESULT BallCntOver([out, retval] int *pVal);
+				// line 1567: [id(312), helpstring("method BallCntOver")] HRESULT BallCntOver([out, retval] int *pVal);
 				V_VT(&res) = VT_I4;
 				hres = BallCntOver((int*)&V_I4(&res));
 			}
@@ -9252,12 +9317,12 @@ STDMETHODIMP Kicker::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 115: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1566: [propget, id(115), helpstring("property Scatter")] HRESULT Scatter([out, retval] float *pVal);
+				// line 1568: [propget, id(115), helpstring("property Scatter")] HRESULT Scatter([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Scatter(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1567: [propput, id(115), helpstring("property Scatter")] HRESULT Scatter([in] float newVal);
+				// line 1569: [propput, id(115), helpstring("property Scatter")] HRESULT Scatter([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -9268,12 +9333,12 @@ STDMETHODIMP Kicker::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 314: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1568: [propget, id(314), helpstring("property HitAccuracy")] HRESULT HitAccuracy([out, retval] float *pVal);
+				// line 1570: [propget, id(314), helpstring("property HitAccuracy")] HRESULT HitAccuracy([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_HitAccuracy(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1569: [propput, id(314), helpstring("property HitAccuracy")] HRESULT HitAccuracy([in] float newVal);
+				// line 1571: [propput, id(314), helpstring("property HitAccuracy")] HRESULT HitAccuracy([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -9284,12 +9349,12 @@ STDMETHODIMP Kicker::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 315: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1570: [propget, id(315), helpstring("property HitHeight")] HRESULT HitHeight([out, retval] float *pVal);
+				// line 1572: [propget, id(315), helpstring("property HitHeight")] HRESULT HitHeight([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_HitHeight(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1571: [propput, id(315), helpstring("property HitHeight")] HRESULT HitHeight([in] float newVal);
+				// line 1573: [propput, id(315), helpstring("property HitHeight")] HRESULT HitHeight([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -9300,12 +9365,12 @@ STDMETHODIMP Kicker::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 107: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1572: [propget, id(107), helpstring("property Orientation")] HRESULT Orientation([out, retval] float *pVal);
+				// line 1574: [propget, id(107), helpstring("property Orientation")] HRESULT Orientation([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Orientation(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1573: [propput, id(107), helpstring("property Orientation")] HRESULT Orientation([in] float newVal);
+				// line 1575: [propput, id(107), helpstring("property Orientation")] HRESULT Orientation([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -9316,12 +9381,12 @@ STDMETHODIMP Kicker::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 111: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1574: [propget, id(111), helpstring("property Radius")] HRESULT Radius([out, retval] float *pVal);
+				// line 1576: [propget, id(111), helpstring("property Radius")] HRESULT Radius([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Radius(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1575: [propput, id(111), helpstring("property Radius")] HRESULT Radius([in] float newVal);
+				// line 1577: [propput, id(111), helpstring("property Radius")] HRESULT Radius([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -9332,12 +9397,12 @@ STDMETHODIMP Kicker::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 394: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1576: [propget, id(394), helpstring("property FallThrough")] HRESULT FallThrough([out, retval] VARIANT_BOOL *pVal);
+				// line 1578: [propget, id(394), helpstring("property FallThrough")] HRESULT FallThrough([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_FallThrough(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1577: [propput, id(394), helpstring("property FallThrough")] HRESULT FallThrough([in] VARIANT_BOOL newVal);
+				// line 1579: [propput, id(394), helpstring("property FallThrough")] HRESULT FallThrough([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -9348,12 +9413,12 @@ STDMETHODIMP Kicker::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 431: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1578: [propget, id(431), helpstring("property Legacy")] HRESULT Legacy([out, retval] VARIANT_BOOL *pVal);
+				// line 1580: [propget, id(431), helpstring("property Legacy")] HRESULT Legacy([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_Legacy(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1579: [propput, id(431), helpstring("property Legacy")] HRESULT Legacy([in] VARIANT_BOOL newVal);
+				// line 1581: [propput, id(431), helpstring("property Legacy")] HRESULT Legacy([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -9364,7 +9429,7 @@ STDMETHODIMP Kicker::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 19: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1580: [propget, id(19), helpstring("property LastCapturedBall")] HRESULT LastCapturedBall([out, retval] IBall **pVal);
+				// line 1582: [propget, id(19), helpstring("property LastCapturedBall")] HRESULT LastCapturedBall([out, retval] IBall **pVal);
 				V_VT(&res) = VT_DISPATCH;
 				hres = get_LastCapturedBall((IBall**)&V_DISPATCH(&res));
 			}
@@ -9490,12 +9555,12 @@ STDMETHODIMP Decal::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 1: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1612: [propget, id(1), helpstring("property Rotation")] HRESULT Rotation([out, retval] float *pVal);
+				// line 1614: [propget, id(1), helpstring("property Rotation")] HRESULT Rotation([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Rotation(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1613: [propput, id(1), helpstring("property Rotation")] HRESULT Rotation([in] float newVal);
+				// line 1615: [propput, id(1), helpstring("property Rotation")] HRESULT Rotation([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -9506,12 +9571,12 @@ STDMETHODIMP Decal::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case DISPID_Image: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1614: [propget, id(DISPID_Image), helpstring("property Image")] HRESULT Image([out, retval] BSTR *pVal);
+				// line 1616: [propget, id(DISPID_Image), helpstring("property Image")] HRESULT Image([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Image(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1615: [propput, id(DISPID_Image), helpstring("property Image")] HRESULT Image([in] BSTR newVal);
+				// line 1617: [propput, id(DISPID_Image), helpstring("property Image")] HRESULT Image([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -9522,12 +9587,12 @@ STDMETHODIMP Decal::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 3: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1616: [propget, id(3), helpstring("property Width")] HRESULT Width([out, retval] float *pVal);
+				// line 1618: [propget, id(3), helpstring("property Width")] HRESULT Width([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Width(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1617: [propput, id(3), helpstring("property Width")] HRESULT Width([in] float newVal);
+				// line 1619: [propput, id(3), helpstring("property Width")] HRESULT Width([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -9538,12 +9603,12 @@ STDMETHODIMP Decal::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 4: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1618: [propget, id(4), helpstring("property Height")] HRESULT Height([out, retval] float *pVal);
+				// line 1620: [propget, id(4), helpstring("property Height")] HRESULT Height([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Height(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1619: [propput, id(4), helpstring("property Height")] HRESULT Height([in] float newVal);
+				// line 1621: [propput, id(4), helpstring("property Height")] HRESULT Height([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -9554,12 +9619,12 @@ STDMETHODIMP Decal::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 5: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1620: [propget, id(5), helpstring("property X")] HRESULT X([out, retval] float *pVal);
+				// line 1622: [propget, id(5), helpstring("property X")] HRESULT X([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_X(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1621: [propput, id(5), helpstring("property X")] HRESULT X([in] float newVal);
+				// line 1623: [propput, id(5), helpstring("property X")] HRESULT X([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -9570,12 +9635,12 @@ STDMETHODIMP Decal::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 6: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1622: [propget, id(6), helpstring("property Y")] HRESULT Y([out, retval] float *pVal);
+				// line 1624: [propget, id(6), helpstring("property Y")] HRESULT Y([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Y(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1623: [propput, id(6), helpstring("property Y")] HRESULT Y([in] float newVal);
+				// line 1625: [propput, id(6), helpstring("property Y")] HRESULT Y([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -9586,12 +9651,12 @@ STDMETHODIMP Decal::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 7: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1624: [propget, id(7), helpstring("property Type")] HRESULT Type([out, retval] DecalType *pVal);
+				// line 1626: [propget, id(7), helpstring("property Type")] HRESULT Type([out, retval] DecalType *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_Type((DecalType*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1625: [propput, id(7), helpstring("property Type")] HRESULT Type([in] DecalType newVal);
+				// line 1627: [propput, id(7), helpstring("property Type")] HRESULT Type([in] DecalType newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -9602,12 +9667,12 @@ STDMETHODIMP Decal::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 8: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1626: [propget, id(8), helpstring("property Text")] HRESULT Text([out, retval] BSTR *pVal);
+				// line 1628: [propget, id(8), helpstring("property Text")] HRESULT Text([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Text(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1627: [propput, id(8), helpstring("property Text")] HRESULT Text([in] BSTR newVal);
+				// line 1629: [propput, id(8), helpstring("property Text")] HRESULT Text([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -9618,12 +9683,12 @@ STDMETHODIMP Decal::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case DISPID_Decal_SizingType: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1628: [propget, id(DISPID_Decal_SizingType), helpstring("property SizingType")] HRESULT SizingType([out, retval] SizingType *pVal);
+				// line 1630: [propget, id(DISPID_Decal_SizingType), helpstring("property SizingType")] HRESULT SizingType([out, retval] SizingType *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_SizingType((SizingType*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1629: [propput, id(DISPID_Decal_SizingType), helpstring("property SizingType")] HRESULT SizingType([in] SizingType newVal);
+				// line 1631: [propput, id(DISPID_Decal_SizingType), helpstring("property SizingType")] HRESULT SizingType([in] SizingType newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -9634,12 +9699,12 @@ STDMETHODIMP Decal::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 11: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1630: [propget, id(11), helpstring("property FontColor")] HRESULT FontColor([out, retval] OLE_COLOR *pVal);
+				// line 1632: [propget, id(11), helpstring("property FontColor")] HRESULT FontColor([out, retval] OLE_COLOR *pVal);
 				V_VT(&res) = VT_UI4;
 				hres = get_FontColor(&V_UI4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1631: [propput, id(11), helpstring("property FontColor")] HRESULT FontColor([in] OLE_COLOR newVal);
+				// line 1633: [propput, id(11), helpstring("property FontColor")] HRESULT FontColor([in] OLE_COLOR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_UI4);
@@ -9650,12 +9715,12 @@ STDMETHODIMP Decal::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 340: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1632: [propget, id(340), helpstring("property Material")] HRESULT Material([out, retval] BSTR *pVal);
+				// line 1634: [propget, id(340), helpstring("property Material")] HRESULT Material([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Material(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1633: [propput, id(340), helpstring("property Material")] HRESULT Material([in] BSTR newVal);
+				// line 1635: [propput, id(340), helpstring("property Material")] HRESULT Material([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -9666,12 +9731,12 @@ STDMETHODIMP Decal::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case DISPID_Decal_Font: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1634: [propget, id(DISPID_Decal_Font), helpstring("property Font")] HRESULT Font([out, retval] IFontDisp **pVal);
+				// line 1636: [propget, id(DISPID_Decal_Font), helpstring("property Font")] HRESULT Font([out, retval] IFontDisp **pVal);
 				V_VT(&res) = VT_DISPATCH;
 				hres = get_Font((IFontDisp**)&V_DISPATCH(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUTREF) {
-				// line 1635: [propputref, id(DISPID_Decal_Font), helpstring("property Font")] HRESULT Font([in] IFontDisp *newVal);
+				// line 1637: [propputref, id(DISPID_Decal_Font), helpstring("property Font")] HRESULT Font([in] IFontDisp *newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantCopyInd(&var0, &pDispParams->rgvarg[--index]);
@@ -9682,12 +9747,12 @@ STDMETHODIMP Decal::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 13: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1636: [propget, id(13), helpstring("property HasVerticalText")] HRESULT HasVerticalText([out, retval] VARIANT_BOOL *pVal);
+				// line 1638: [propget, id(13), helpstring("property HasVerticalText")] HRESULT HasVerticalText([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_HasVerticalText(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1637: [propput, id(13), helpstring("property HasVerticalText")] HRESULT HasVerticalText([in] VARIANT_BOOL newVal);
+				// line 1639: [propput, id(13), helpstring("property HasVerticalText")] HRESULT HasVerticalText([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -9698,12 +9763,12 @@ STDMETHODIMP Decal::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case DISPID_Surface: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1638: [propget, id(DISPID_Surface), helpstring("property Surface")] HRESULT Surface([out, retval] BSTR *pVal);
+				// line 1640: [propget, id(DISPID_Surface), helpstring("property Surface")] HRESULT Surface([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Surface(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1639: [propput, id(DISPID_Surface), helpstring("property Surface")] HRESULT Surface([in] BSTR newVal);
+				// line 1641: [propput, id(DISPID_Surface), helpstring("property Surface")] HRESULT Surface([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -9844,7 +9909,7 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 1: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 1657: [id(1), helpstring("method PlayAnim")] HRESULT PlayAnim([in]float startFrame, [in]float speed);
+				// line 1659: [id(1), helpstring("method PlayAnim")] HRESULT PlayAnim([in]float startFrame, [in]float speed);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -9859,7 +9924,7 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 2: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 1658: [id(2), helpstring("method PlayAnimEndless")] HRESULT PlayAnimEndless([in]float speed);
+				// line 1660: [id(2), helpstring("method PlayAnimEndless")] HRESULT PlayAnimEndless([in]float speed);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -9870,14 +9935,14 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 18: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 1659: [id(18), helpstring("method StopAnim")] HRESULT StopAnim();
+				// line 1661: [id(18), helpstring("method StopAnim")] HRESULT StopAnim();
 				hres = StopAnim();
 			}
 			break;
 		}
 		case 19: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 1660: [id(19), helpstring("method ShowFrame")] HRESULT ShowFrame([in]float frame);
+				// line 1662: [id(19), helpstring("method ShowFrame")] HRESULT ShowFrame([in]float frame);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -9888,7 +9953,7 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 35: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 1661: [id(35), helpstring("method ContinueAnim")] HRESULT ContinueAnim([in]float speed);
+				// line 1663: [id(35), helpstring("method ContinueAnim")] HRESULT ContinueAnim([in]float speed);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -9899,12 +9964,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 38: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1662: [propget, id(38), helpstring("property DisplayTexture")] HRESULT DisplayTexture([out, retval] VARIANT_BOOL *pVal);
+				// line 1664: [propget, id(38), helpstring("property DisplayTexture")] HRESULT DisplayTexture([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_DisplayTexture(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1663: [propput, id(38), helpstring("property DisplayTexture")] HRESULT DisplayTexture([in] VARIANT_BOOL newVal);
+				// line 1665: [propput, id(38), helpstring("property DisplayTexture")] HRESULT DisplayTexture([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -9915,12 +9980,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 101: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1665: [propget, id(101), helpstring("property Sides")] HRESULT Sides([out, retval] int *pVal);
+				// line 1667: [propget, id(101), helpstring("property Sides")] HRESULT Sides([out, retval] int *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_Sides((int*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1666: [propput, id(101), helpstring("property Sides")] HRESULT Sides([in] int newVal);
+				// line 1668: [propput, id(101), helpstring("property Sides")] HRESULT Sides([in] int newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -9931,12 +9996,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 458: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1667: [propget, id(458), helpstring("property Top Visible")] HRESULT Visible([out, retval] VARIANT_BOOL *pVal);
+				// line 1669: [propget, id(458), helpstring("property Top Visible")] HRESULT Visible([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_Visible(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1668: [propput, id(458), helpstring("property Top Visible")] HRESULT Visible([in] VARIANT_BOOL newVal);
+				// line 1670: [propput, id(458), helpstring("property Top Visible")] HRESULT Visible([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -9947,12 +10012,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 340: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1669: [propget, id(340), helpstring("property Material")] HRESULT Material([out, retval] BSTR *pVal);
+				// line 1671: [propget, id(340), helpstring("property Material")] HRESULT Material([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Material(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1670: [propput, id(340), helpstring("property Material")] HRESULT Material([in] BSTR newVal);
+				// line 1672: [propput, id(340), helpstring("property Material")] HRESULT Material([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -9963,12 +10028,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 104: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1671: [propget, id(104), helpstring("property Side Color")] HRESULT SideColor([out, retval] OLE_COLOR *pVal);
+				// line 1673: [propget, id(104), helpstring("property Side Color")] HRESULT SideColor([out, retval] OLE_COLOR *pVal);
 				V_VT(&res) = VT_UI4;
 				hres = get_SideColor(&V_UI4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1672: [propput, id(104), helpstring("property Side Color")] HRESULT SideColor([in] OLE_COLOR newVal);
+				// line 1674: [propput, id(104), helpstring("property Side Color")] HRESULT SideColor([in] OLE_COLOR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_UI4);
@@ -9979,12 +10044,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 106: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1673: [propget, id(106), helpstring("property Draw Textures Inside")] HRESULT DrawTexturesInside([out, retval] VARIANT_BOOL *pVal);
+				// line 1675: [propget, id(106), helpstring("property Draw Textures Inside")] HRESULT DrawTexturesInside([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_DrawTexturesInside(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1674: [propput, id(106), helpstring("property Draw Textures Inside")] HRESULT DrawTexturesInside([in] VARIANT_BOOL newVal);
+				// line 1676: [propput, id(106), helpstring("property Draw Textures Inside")] HRESULT DrawTexturesInside([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -9995,11 +10060,11 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_UserValue: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1676: [propget, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([out, retval] VARIANT* pVal);
+				// line 1678: [propget, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([out, retval] VARIANT* pVal);
 				hres = get_UserValue(&res);
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1677: [propput, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([in] VARIANT* newVal);
+				// line 1679: [propput, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([in] VARIANT* newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantCopyInd(&var0, &pDispParams->rgvarg[--index]);
@@ -10010,12 +10075,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_Image: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1679: [propget, id(DISPID_Image), helpstring("property Image")] HRESULT Image([out, retval] BSTR *pVal);
+				// line 1681: [propget, id(DISPID_Image), helpstring("property Image")] HRESULT Image([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Image(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1680: [propput, id(DISPID_Image), helpstring("property Image")] HRESULT Image([in] BSTR newVal);
+				// line 1682: [propput, id(DISPID_Image), helpstring("property Image")] HRESULT Image([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -10026,12 +10091,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_Image2: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1681: [propget, id(DISPID_Image2), helpstring("property NormalMap")] HRESULT NormalMap([out, retval] BSTR *pVal);
+				// line 1683: [propget, id(DISPID_Image2), helpstring("property NormalMap")] HRESULT NormalMap([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_NormalMap(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1682: [propput, id(DISPID_Image2), helpstring("property NormalMap")] HRESULT NormalMap([in] BSTR newVal);
+				// line 1684: [propput, id(DISPID_Image2), helpstring("property NormalMap")] HRESULT NormalMap([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -10042,12 +10107,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_POSITION_X: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1684: [propget, id(DISPID_POSITION_X), helpstring("property X")] HRESULT X([out, retval] float *pVal);
+				// line 1686: [propget, id(DISPID_POSITION_X), helpstring("property X")] HRESULT X([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_X(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1685: [propput, id(DISPID_POSITION_X), helpstring("property X")] HRESULT X([in] float newVal);
+				// line 1687: [propput, id(DISPID_POSITION_X), helpstring("property X")] HRESULT X([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -10058,12 +10123,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_POSITION_Y: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1686: [propget, id(DISPID_POSITION_Y), helpstring("property Y")] HRESULT Y([out, retval] float *pVal);
+				// line 1688: [propget, id(DISPID_POSITION_Y), helpstring("property Y")] HRESULT Y([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Y(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1687: [propput, id(DISPID_POSITION_Y), helpstring("property Y")] HRESULT Y([in] float newVal);
+				// line 1689: [propput, id(DISPID_POSITION_Y), helpstring("property Y")] HRESULT Y([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -10074,12 +10139,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_POSITION_Z: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1688: [propget, id(DISPID_POSITION_Z), helpstring("property Z")] HRESULT Z([out, retval] float *pVal);
+				// line 1690: [propget, id(DISPID_POSITION_Z), helpstring("property Z")] HRESULT Z([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Z(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1689: [propput, id(DISPID_POSITION_Z), helpstring("property Z")] HRESULT Z([in] float newVal);
+				// line 1691: [propput, id(DISPID_POSITION_Z), helpstring("property Z")] HRESULT Z([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -10090,12 +10155,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_SIZE_X: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1690: [propget, id(DISPID_SIZE_X), helpstring("property Size X")] HRESULT Size_X([out, retval] float *pVal);
+				// line 1692: [propget, id(DISPID_SIZE_X), helpstring("property Size X")] HRESULT Size_X([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Size_X(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1691: [propput, id(DISPID_SIZE_X), helpstring("property Size X")] HRESULT Size_X([in] float newVal);
+				// line 1693: [propput, id(DISPID_SIZE_X), helpstring("property Size X")] HRESULT Size_X([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -10106,12 +10171,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_SIZE_Y: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1692: [propget, id(DISPID_SIZE_Y), helpstring("property Size Y")] HRESULT Size_Y([out, retval] float *pVal);
+				// line 1694: [propget, id(DISPID_SIZE_Y), helpstring("property Size Y")] HRESULT Size_Y([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Size_Y(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1693: [propput, id(DISPID_SIZE_Y), helpstring("property Size Y")] HRESULT Size_Y([in] float newVal);
+				// line 1695: [propput, id(DISPID_SIZE_Y), helpstring("property Size Y")] HRESULT Size_Y([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -10122,12 +10187,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_SIZE_Z: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1694: [propget, id(DISPID_SIZE_Z), helpstring("property Size Z")] HRESULT Size_Z([out, retval] float *pVal);
+				// line 1696: [propget, id(DISPID_SIZE_Z), helpstring("property Size Z")] HRESULT Size_Z([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Size_Z(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1695: [propput, id(DISPID_SIZE_Z), helpstring("property Size Z")] HRESULT Size_Z([in] float newVal);
+				// line 1697: [propput, id(DISPID_SIZE_Z), helpstring("property Size Z")] HRESULT Size_Z([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -10138,12 +10203,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_ROTRA1: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1697: [propget, id(DISPID_ROTRA1), helpstring("property Rot and Tra 1")] HRESULT RotAndTra0([out, retval] float *pVal);
+				// line 1699: [propget, id(DISPID_ROTRA1), helpstring("property Rot and Tra 1")] HRESULT RotAndTra0([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_RotAndTra0(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1698: [propput, id(DISPID_ROTRA1), helpstring("property Rot and Tra 1")] HRESULT RotAndTra0([in] float newVal);
+				// line 1700: [propput, id(DISPID_ROTRA1), helpstring("property Rot and Tra 1")] HRESULT RotAndTra0([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -10154,12 +10219,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_ROT_X: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1699: [propget, id(DISPID_ROT_X), helpstring("property RotX")] HRESULT RotX([out, retval] float *pVal);
+				// line 1701: [propget, id(DISPID_ROT_X), helpstring("property RotX")] HRESULT RotX([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_RotX(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1700: [propput, id(DISPID_ROT_X), helpstring("property RotX")] HRESULT RotX([in] float newVal);
+				// line 1702: [propput, id(DISPID_ROT_X), helpstring("property RotX")] HRESULT RotX([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -10170,12 +10235,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_ROTRA2: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1702: [propget, id(DISPID_ROTRA2), helpstring("property Rot and Tra 2")] HRESULT RotAndTra1([out, retval] float *pVal);
+				// line 1704: [propget, id(DISPID_ROTRA2), helpstring("property Rot and Tra 2")] HRESULT RotAndTra1([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_RotAndTra1(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1703: [propput, id(DISPID_ROTRA2), helpstring("property Rot and Tra 2")] HRESULT RotAndTra1([in] float newVal);
+				// line 1705: [propput, id(DISPID_ROTRA2), helpstring("property Rot and Tra 2")] HRESULT RotAndTra1([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -10186,12 +10251,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_ROT_Y: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1704: [propget, id(DISPID_ROT_Y), helpstring("property RotY")] HRESULT RotY([out, retval] float *pVal);
+				// line 1706: [propget, id(DISPID_ROT_Y), helpstring("property RotY")] HRESULT RotY([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_RotY(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1705: [propput, id(DISPID_ROT_Y), helpstring("property RotY")] HRESULT RotY([in] float newVal);
+				// line 1707: [propput, id(DISPID_ROT_Y), helpstring("property RotY")] HRESULT RotY([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -10202,12 +10267,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_ROTRA3: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1707: [propget, id(DISPID_ROTRA3), helpstring("property Rot and Tra 3")] HRESULT RotAndTra2([out, retval] float *pVal);
+				// line 1709: [propget, id(DISPID_ROTRA3), helpstring("property Rot and Tra 3")] HRESULT RotAndTra2([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_RotAndTra2(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1708: [propput, id(DISPID_ROTRA3), helpstring("property Rot and Tra 3")] HRESULT RotAndTra2([in] float newVal);
+				// line 1710: [propput, id(DISPID_ROTRA3), helpstring("property Rot and Tra 3")] HRESULT RotAndTra2([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -10218,12 +10283,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_ROT_Z: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1709: [propget, id(DISPID_ROT_Z), helpstring("property RotZ")] HRESULT RotZ([out, retval] float *pVal);
+				// line 1711: [propget, id(DISPID_ROT_Z), helpstring("property RotZ")] HRESULT RotZ([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_RotZ(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1710: [propput, id(DISPID_ROT_Z), helpstring("property RotZ")] HRESULT RotZ([in] float newVal);
+				// line 1712: [propput, id(DISPID_ROT_Z), helpstring("property RotZ")] HRESULT RotZ([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -10234,12 +10299,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_ROTRA4: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1712: [propget, id(DISPID_ROTRA4), helpstring("property Rot and Tra 4")] HRESULT RotAndTra3([out, retval] float *pVal);
+				// line 1714: [propget, id(DISPID_ROTRA4), helpstring("property Rot and Tra 4")] HRESULT RotAndTra3([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_RotAndTra3(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1713: [propput, id(DISPID_ROTRA4), helpstring("property Rot and Tra 4")] HRESULT RotAndTra3([in] float newVal);
+				// line 1715: [propput, id(DISPID_ROTRA4), helpstring("property Rot and Tra 4")] HRESULT RotAndTra3([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -10250,12 +10315,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_TRANS_X: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1714: [propget, id(DISPID_TRANS_X), helpstring("property TransX")] HRESULT TransX([out, retval] float *pVal);
+				// line 1716: [propget, id(DISPID_TRANS_X), helpstring("property TransX")] HRESULT TransX([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_TransX(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1715: [propput, id(DISPID_TRANS_X), helpstring("property TransX")] HRESULT TransX([in] float newVal);
+				// line 1717: [propput, id(DISPID_TRANS_X), helpstring("property TransX")] HRESULT TransX([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -10266,12 +10331,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_ROTRA5: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1717: [propget, id(DISPID_ROTRA5), helpstring("property Rot and Tra 5")] HRESULT RotAndTra4([out, retval] float *pVal);
+				// line 1719: [propget, id(DISPID_ROTRA5), helpstring("property Rot and Tra 5")] HRESULT RotAndTra4([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_RotAndTra4(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1718: [propput, id(DISPID_ROTRA5), helpstring("property Rot and Tra 5")] HRESULT RotAndTra4([in] float newVal);
+				// line 1720: [propput, id(DISPID_ROTRA5), helpstring("property Rot and Tra 5")] HRESULT RotAndTra4([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -10282,12 +10347,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_TRANS_Y: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1719: [propget, id(DISPID_TRANS_Y), helpstring("property TransY")] HRESULT TransY([out, retval] float *pVal);
+				// line 1721: [propget, id(DISPID_TRANS_Y), helpstring("property TransY")] HRESULT TransY([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_TransY(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1720: [propput, id(DISPID_TRANS_Y), helpstring("property TransY")] HRESULT TransY([in] float newVal);
+				// line 1722: [propput, id(DISPID_TRANS_Y), helpstring("property TransY")] HRESULT TransY([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -10298,12 +10363,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_ROTRA6: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1722: [propget, id(DISPID_ROTRA6), helpstring("property Rot and Tra 6")] HRESULT RotAndTra5([out, retval] float *pVal);
+				// line 1724: [propget, id(DISPID_ROTRA6), helpstring("property Rot and Tra 6")] HRESULT RotAndTra5([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_RotAndTra5(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1723: [propput, id(DISPID_ROTRA6), helpstring("property Rot and Tra 6")] HRESULT RotAndTra5([in] float newVal);
+				// line 1725: [propput, id(DISPID_ROTRA6), helpstring("property Rot and Tra 6")] HRESULT RotAndTra5([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -10314,12 +10379,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_TRANS_Z: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1724: [propget, id(DISPID_TRANS_Z), helpstring("property TransZ")] HRESULT TransZ([out, retval] float *pVal);
+				// line 1726: [propget, id(DISPID_TRANS_Z), helpstring("property TransZ")] HRESULT TransZ([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_TransZ(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1725: [propput, id(DISPID_TRANS_Z), helpstring("property TransZ")] HRESULT TransZ([in] float newVal);
+				// line 1727: [propput, id(DISPID_TRANS_Z), helpstring("property TransZ")] HRESULT TransZ([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -10330,12 +10395,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_ROTRA7: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1727: [propget, id(DISPID_ROTRA7), helpstring("property Rot and Tra 7")] HRESULT RotAndTra6([out, retval] float *pVal);
+				// line 1729: [propget, id(DISPID_ROTRA7), helpstring("property Rot and Tra 7")] HRESULT RotAndTra6([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_RotAndTra6(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1728: [propput, id(DISPID_ROTRA7), helpstring("property Rot and Tra 7")] HRESULT RotAndTra6([in] float newVal);
+				// line 1730: [propput, id(DISPID_ROTRA7), helpstring("property Rot and Tra 7")] HRESULT RotAndTra6([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -10346,12 +10411,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_OBJROT_X: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1729: [propget, id(DISPID_OBJROT_X), helpstring("property ObjRotX")] HRESULT ObjRotX([out, retval] float *pVal);
+				// line 1731: [propget, id(DISPID_OBJROT_X), helpstring("property ObjRotX")] HRESULT ObjRotX([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_ObjRotX(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1730: [propput, id(DISPID_OBJROT_X), helpstring("property ObjRotX")] HRESULT ObjRotX([in] float newVal);
+				// line 1732: [propput, id(DISPID_OBJROT_X), helpstring("property ObjRotX")] HRESULT ObjRotX([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -10362,12 +10427,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_ROTRA8: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1732: [propget, id(DISPID_ROTRA8), helpstring("property Rot and Tra 8")] HRESULT RotAndTra7([out, retval] float *pVal);
+				// line 1734: [propget, id(DISPID_ROTRA8), helpstring("property Rot and Tra 8")] HRESULT RotAndTra7([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_RotAndTra7(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1733: [propput, id(DISPID_ROTRA8), helpstring("property Rot and Tra 8")] HRESULT RotAndTra7([in] float newVal);
+				// line 1735: [propput, id(DISPID_ROTRA8), helpstring("property Rot and Tra 8")] HRESULT RotAndTra7([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -10378,12 +10443,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_OBJROT_Y: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1734: [propget, id(DISPID_OBJROT_Y), helpstring("property ObjRotY")] HRESULT ObjRotY([out, retval] float *pVal);
+				// line 1736: [propget, id(DISPID_OBJROT_Y), helpstring("property ObjRotY")] HRESULT ObjRotY([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_ObjRotY(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1735: [propput, id(DISPID_OBJROT_Y), helpstring("property ObjRotY")] HRESULT ObjRotY([in] float newVal);
+				// line 1737: [propput, id(DISPID_OBJROT_Y), helpstring("property ObjRotY")] HRESULT ObjRotY([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -10394,12 +10459,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_ROTRA9: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1737: [propget, id(DISPID_ROTRA9), helpstring("property Rot and Tra 9")] HRESULT RotAndTra8([out, retval] float *pVal);
+				// line 1739: [propget, id(DISPID_ROTRA9), helpstring("property Rot and Tra 9")] HRESULT RotAndTra8([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_RotAndTra8(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1738: [propput, id(DISPID_ROTRA9), helpstring("property Rot and Tra 9")] HRESULT RotAndTra8([in] float newVal);
+				// line 1740: [propput, id(DISPID_ROTRA9), helpstring("property Rot and Tra 9")] HRESULT RotAndTra8([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -10410,12 +10475,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_OBJROT_Z: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1739: [propget, id(DISPID_OBJROT_Z), helpstring("property ObjRotZ")] HRESULT ObjRotZ([out, retval] float *pVal);
+				// line 1741: [propget, id(DISPID_OBJROT_Z), helpstring("property ObjRotZ")] HRESULT ObjRotZ([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_ObjRotZ(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1740: [propput, id(DISPID_OBJROT_Z), helpstring("property ObjRotZ")] HRESULT ObjRotZ([in] float newVal);
+				// line 1742: [propput, id(DISPID_OBJROT_Z), helpstring("property ObjRotZ")] HRESULT ObjRotZ([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -10426,12 +10491,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 454: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1742: [propget, id(454), helpstring("property EdgeFactorUI")] HRESULT EdgeFactorUI([out, retval] float *pVal);
+				// line 1744: [propget, id(454), helpstring("property EdgeFactorUI")] HRESULT EdgeFactorUI([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_EdgeFactorUI(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1743: [propput, id(454), helpstring("property EdgeFactorUI")] HRESULT EdgeFactorUI([in] float newVal);
+				// line 1745: [propput, id(454), helpstring("property EdgeFactorUI")] HRESULT EdgeFactorUI([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -10442,12 +10507,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 481: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1744: [propget, id(481), helpstring("property CollisionReductionFactor")] HRESULT CollisionReductionFactor([out, retval] float *pVal);
+				// line 1746: [propget, id(481), helpstring("property CollisionReductionFactor")] HRESULT CollisionReductionFactor([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_CollisionReductionFactor(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1745: [propput, id(481), helpstring("property CollisionReductionFactor")] HRESULT CollisionReductionFactor([in] float newVal);
+				// line 1747: [propput, id(481), helpstring("property CollisionReductionFactor")] HRESULT CollisionReductionFactor([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -10458,12 +10523,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_Name: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1747: [propget, id(DISPID_Name), helpstring("property Name")] HRESULT Name([out, retval] BSTR *pVal);
+				// line 1749: [propget, id(DISPID_Name), helpstring("property Name")] HRESULT Name([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Name(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1748: [propput, id(DISPID_Name), helpstring("property Name")] HRESULT Name([in] BSTR newVal);
+				// line 1750: [propput, id(DISPID_Name), helpstring("property Name")] HRESULT Name([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -10474,12 +10539,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 398: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1749: [propget, id(398), helpstring("property static rendering")] HRESULT EnableStaticRendering([out, retval] VARIANT_BOOL *pVal);
+				// line 1751: [propget, id(398), helpstring("property static rendering")] HRESULT EnableStaticRendering([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_EnableStaticRendering(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1750: [propput, id(398), helpstring("property static rendering")] HRESULT EnableStaticRendering([in] VARIANT_BOOL newVal);
+				// line 1752: [propput, id(398), helpstring("property static rendering")] HRESULT EnableStaticRendering([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -10490,12 +10555,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 110: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1752: [propget, id(110), helpstring("property Elasticity")] HRESULT Elasticity([out, retval] float *pVal);
+				// line 1754: [propget, id(110), helpstring("property Elasticity")] HRESULT Elasticity([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Elasticity(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1753: [propput, id(110), helpstring("property Elasticity")] HRESULT Elasticity([in] float newVal);
+				// line 1755: [propput, id(110), helpstring("property Elasticity")] HRESULT Elasticity([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -10506,12 +10571,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 112: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1754: [propget, id(112), helpstring("property ElasticityFalloff")] HRESULT ElasticityFalloff([out, retval] float *pVal);
+				// line 1756: [propget, id(112), helpstring("property ElasticityFalloff")] HRESULT ElasticityFalloff([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_ElasticityFalloff(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1755: [propput, id(112), helpstring("property ElasticityFalloff")] HRESULT ElasticityFalloff([in] float newVal);
+				// line 1757: [propput, id(112), helpstring("property ElasticityFalloff")] HRESULT ElasticityFalloff([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -10522,12 +10587,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 111: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1757: [propget, id(111), helpstring("property Collidable")] HRESULT Collidable([out, retval] VARIANT_BOOL *pVal);
+				// line 1759: [propget, id(111), helpstring("property Collidable")] HRESULT Collidable([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_Collidable(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1758: [propput, id(111), helpstring("property Collidable")] HRESULT Collidable([in] VARIANT_BOOL newVal);
+				// line 1760: [propput, id(111), helpstring("property Collidable")] HRESULT Collidable([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -10538,12 +10603,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 395: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1759: [propget, id(395), helpstring("property IsToy")] HRESULT IsToy([out, retval] VARIANT_BOOL *pVal);
+				// line 1761: [propget, id(395), helpstring("property IsToy")] HRESULT IsToy([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_IsToy(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1760: [propput, id(395), helpstring("property IsToy")] HRESULT IsToy([in] VARIANT_BOOL newVal);
+				// line 1762: [propput, id(395), helpstring("property IsToy")] HRESULT IsToy([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -10554,12 +10619,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 792: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1761: [propget, id(792), helpstring("property BackfacesEnabled")] HRESULT BackfacesEnabled([out, retval] VARIANT_BOOL *pVal);
+				// line 1763: [propget, id(792), helpstring("property BackfacesEnabled")] HRESULT BackfacesEnabled([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_BackfacesEnabled(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1762: [propput, id(792), helpstring("property BackfacesEnabled")] HRESULT BackfacesEnabled([in] VARIANT_BOOL newVal);
+				// line 1764: [propput, id(792), helpstring("property BackfacesEnabled")] HRESULT BackfacesEnabled([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -10570,12 +10635,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 34: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1763: [propget, id(34), helpstring("property HasHitEvent")] HRESULT HasHitEvent([out, retval] VARIANT_BOOL *pVal);
+				// line 1765: [propget, id(34), helpstring("property HasHitEvent")] HRESULT HasHitEvent([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_HasHitEvent(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1764: [propput, id(34), helpstring("property HasHitEvent")] HRESULT HasHitEvent([in] VARIANT_BOOL newVal);
+				// line 1766: [propput, id(34), helpstring("property HasHitEvent")] HRESULT HasHitEvent([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -10586,12 +10651,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 33: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1765: [propget, id(33), helpstring("property Threshold")] HRESULT Threshold([out, retval] float *pVal);
+				// line 1767: [propget, id(33), helpstring("property Threshold")] HRESULT Threshold([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Threshold(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1766: [propput, id(33), helpstring("property Threshold")] HRESULT Threshold([in] float newVal);
+				// line 1768: [propput, id(33), helpstring("property Threshold")] HRESULT Threshold([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -10602,12 +10667,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 114: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1767: [propget, id(114), helpstring("property Friction")] HRESULT Friction([out, retval] float *pVal);
+				// line 1769: [propget, id(114), helpstring("property Friction")] HRESULT Friction([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Friction(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1768: [propput, id(114), helpstring("property Friction")] HRESULT Friction([in] float newVal);
+				// line 1770: [propput, id(114), helpstring("property Friction")] HRESULT Friction([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -10618,12 +10683,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 115: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1769: [propget, id(115), helpstring("property Scatter")] HRESULT Scatter([out, retval] float *pVal);
+				// line 1771: [propget, id(115), helpstring("property Scatter")] HRESULT Scatter([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Scatter(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1770: [propput, id(115), helpstring("property Scatter")] HRESULT Scatter([in] float newVal);
+				// line 1772: [propput, id(115), helpstring("property Scatter")] HRESULT Scatter([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -10634,12 +10699,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 441: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1771: [propget, id(441), helpstring("property DisableLighting")] HRESULT DisableLighting([out, retval] VARIANT_BOOL *pVal);
+				// line 1773: [propget, id(441), helpstring("property DisableLighting")] HRESULT DisableLighting([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_DisableLighting(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1772: [propput, id(441), helpstring("property DisableLighting")] HRESULT DisableLighting([in] VARIANT_BOOL newVal);
+				// line 1774: [propput, id(441), helpstring("property DisableLighting")] HRESULT DisableLighting([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -10650,12 +10715,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 494: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1773: [propget, id(494), helpstring("property BlendDisableLighting")] HRESULT BlendDisableLighting([out, retval] float *pVal);
+				// line 1775: [propget, id(494), helpstring("property BlendDisableLighting")] HRESULT BlendDisableLighting([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_BlendDisableLighting(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1774: [propput, id(494), helpstring("property BlendDisableLighting")] HRESULT BlendDisableLighting([in] float newVal);
+				// line 1776: [propput, id(494), helpstring("property BlendDisableLighting")] HRESULT BlendDisableLighting([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -10666,12 +10731,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 496: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1775: [propget, id(496), helpstring("property BlendDisableLightingFromBelow")] HRESULT BlendDisableLightingFromBelow([out, retval] float *pVal);
+				// line 1777: [propget, id(496), helpstring("property BlendDisableLightingFromBelow")] HRESULT BlendDisableLightingFromBelow([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_BlendDisableLightingFromBelow(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1776: [propput, id(496), helpstring("property BlendDisableLightingFromBelow")] HRESULT BlendDisableLightingFromBelow([in] float newVal);
+				// line 1778: [propput, id(496), helpstring("property BlendDisableLightingFromBelow")] HRESULT BlendDisableLightingFromBelow([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -10682,12 +10747,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 431: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1777: [propget, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([out, retval] VARIANT_BOOL *pVal);
+				// line 1779: [propget, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_ReflectionEnabled(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1778: [propput, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([in] VARIANT_BOOL newVal);
+				// line 1780: [propput, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -10698,12 +10763,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 377: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1780: [propget, id(377), helpstring("property Opacity")] HRESULT Opacity([out, retval] float *pVal);
+				// line 1782: [propget, id(377), helpstring("property Opacity")] HRESULT Opacity([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Opacity(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1781: [propput, id(377), helpstring("property Opacity")] HRESULT Opacity([in] float newVal);
+				// line 1783: [propput, id(377), helpstring("property Opacity")] HRESULT Opacity([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -10714,12 +10779,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 556: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1782: [propget, id(556), helpstring("property AddBlend")] HRESULT AddBlend([out, retval] VARIANT_BOOL *pVal);
+				// line 1784: [propget, id(556), helpstring("property AddBlend")] HRESULT AddBlend([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_AddBlend(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1783: [propput, id(556), helpstring("property AddBlend")] HRESULT AddBlend([in] VARIANT_BOOL newVal);
+				// line 1785: [propput, id(556), helpstring("property AddBlend")] HRESULT AddBlend([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -10730,12 +10795,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 557: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1784: [propget, id(557), helpstring("property Color")] HRESULT Color([out, retval] OLE_COLOR *pVal);
+				// line 1786: [propget, id(557), helpstring("property Color")] HRESULT Color([out, retval] OLE_COLOR *pVal);
 				V_VT(&res) = VT_UI4;
 				hres = get_Color(&V_UI4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1785: [propput, id(557), helpstring("property Color")] HRESULT Color([in] OLE_COLOR newVal);
+				// line 1787: [propput, id(557), helpstring("property Color")] HRESULT Color([in] OLE_COLOR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_UI4);
@@ -10746,12 +10811,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 558: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1787: [propget, id(558), helpstring("property EnableDepthMask")] HRESULT EnableDepthMask([out, retval] VARIANT_BOOL *pVal);
+				// line 1789: [propget, id(558), helpstring("property EnableDepthMask")] HRESULT EnableDepthMask([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_EnableDepthMask(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1788: [propput, id(558), helpstring("property EnableDepthMask")] HRESULT EnableDepthMask([in] VARIANT_BOOL newVal);
+				// line 1790: [propput, id(558), helpstring("property EnableDepthMask")] HRESULT EnableDepthMask([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -10762,12 +10827,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 559: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1790: [propget, id(559), helpstring("property ReflectionProbe")] HRESULT ReflectionProbe([out, retval] BSTR *pVal);
+				// line 1792: [propget, id(559), helpstring("property ReflectionProbe")] HRESULT ReflectionProbe([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_ReflectionProbe(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1791: [propput, id(559), helpstring("property ReflectionProbe")] HRESULT ReflectionProbe([in] BSTR newVal);
+				// line 1793: [propput, id(559), helpstring("property ReflectionProbe")] HRESULT ReflectionProbe([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -10778,12 +10843,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 560: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1792: [propget, id(560), helpstring("property RefractionProbe")] HRESULT RefractionProbe([out, retval] BSTR *pVal);
+				// line 1794: [propget, id(560), helpstring("property RefractionProbe")] HRESULT RefractionProbe([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_RefractionProbe(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1793: [propput, id(560), helpstring("property RefractionProbe")] HRESULT RefractionProbe([in] BSTR newVal);
+				// line 1795: [propput, id(560), helpstring("property RefractionProbe")] HRESULT RefractionProbe([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -10794,12 +10859,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 397: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1795: [propget, id(397), helpstring("property DepthBias")] HRESULT DepthBias([out, retval] float *pVal);
+				// line 1797: [propget, id(397), helpstring("property DepthBias")] HRESULT DepthBias([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_DepthBias(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1796: [propput, id(397), helpstring("property DepthBias")] HRESULT DepthBias([in] float newVal);
+				// line 1798: [propput, id(397), helpstring("property DepthBias")] HRESULT DepthBias([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -10810,12 +10875,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 734: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1798: [propget, id(734), helpstring("property PhysicsMaterial")] HRESULT PhysicsMaterial([out, retval] BSTR *pVal);
+				// line 1800: [propget, id(734), helpstring("property PhysicsMaterial")] HRESULT PhysicsMaterial([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_PhysicsMaterial(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1799: [propput, id(734), helpstring("property PhysicsMaterial")] HRESULT PhysicsMaterial([in] BSTR newVal);
+				// line 1801: [propput, id(734), helpstring("property PhysicsMaterial")] HRESULT PhysicsMaterial([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -10826,12 +10891,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 432: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1800: [propget, id(432), helpstring("property OverwritePhysics")] HRESULT OverwritePhysics([out, retval] VARIANT_BOOL *pVal);
+				// line 1802: [propget, id(432), helpstring("property OverwritePhysics")] HRESULT OverwritePhysics([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_OverwritePhysics(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1801: [propput, id(432), helpstring("property OverwritePhysics")] HRESULT OverwritePhysics([in] VARIANT_BOOL newVal);
+				// line 1803: [propput, id(432), helpstring("property OverwritePhysics")] HRESULT OverwritePhysics([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -10842,7 +10907,7 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 735: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1802: [propget, id(735), helpstring("property HitThreshold")] HRESULT HitThreshold([out, retval] float *pVal);
+				// line 1804: [propget, id(735), helpstring("property HitThreshold")] HRESULT HitThreshold([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_HitThreshold(&V_R4(&res));
 			}
@@ -10850,12 +10915,12 @@ STDMETHODIMP Primitive::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 824: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1803: [propget, id(824), helpstring("property ObjectSpaceNormalMap")] HRESULT ObjectSpaceNormalMap([out, retval] VARIANT_BOOL *pVal);
+				// line 1805: [propget, id(824), helpstring("property ObjectSpaceNormalMap")] HRESULT ObjectSpaceNormalMap([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_ObjectSpaceNormalMap(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1804: [propput, id(824), helpstring("property ObjectSpaceNormalMap")] HRESULT ObjectSpaceNormalMap([in] VARIANT_BOOL newVal);
+				// line 1806: [propput, id(824), helpstring("property ObjectSpaceNormalMap")] HRESULT ObjectSpaceNormalMap([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -11003,12 +11068,12 @@ STDMETHODIMP HitTarget::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_Timer_Enabled: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1834: [propget, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([out, retval] VARIANT_BOOL *pVal);
+				// line 1836: [propget, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_TimerEnabled(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1835: [propput, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([in] VARIANT_BOOL newVal);
+				// line 1837: [propput, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -11019,12 +11084,12 @@ STDMETHODIMP HitTarget::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_Timer_Interval: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1836: [propget, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([out, retval] long *pVal);
+				// line 1838: [propget, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([out, retval] long *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_TimerInterval((LONG*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1837: [propput, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([in] long newVal);
+				// line 1839: [propput, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([in] long newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -11035,12 +11100,12 @@ STDMETHODIMP HitTarget::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 458: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1838: [propget, id(458), helpstring("property Top Visible")] HRESULT Visible([out, retval] VARIANT_BOOL *pVal);
+				// line 1840: [propget, id(458), helpstring("property Top Visible")] HRESULT Visible([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_Visible(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1839: [propput, id(458), helpstring("property Top Visible")] HRESULT Visible([in] VARIANT_BOOL newVal);
+				// line 1841: [propput, id(458), helpstring("property Top Visible")] HRESULT Visible([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -11051,12 +11116,12 @@ STDMETHODIMP HitTarget::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 340: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1840: [propget, id(340), helpstring("property Material")] HRESULT Material([out, retval] BSTR *pVal);
+				// line 1842: [propget, id(340), helpstring("property Material")] HRESULT Material([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Material(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1841: [propput, id(340), helpstring("property Material")] HRESULT Material([in] BSTR newVal);
+				// line 1843: [propput, id(340), helpstring("property Material")] HRESULT Material([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -11067,11 +11132,11 @@ STDMETHODIMP HitTarget::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_UserValue: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1842: [propget, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([out, retval] VARIANT* pVal);
+				// line 1844: [propget, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([out, retval] VARIANT* pVal);
 				hres = get_UserValue(&res);
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1843: [propput, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([in] VARIANT* newVal);
+				// line 1845: [propput, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([in] VARIANT* newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantCopyInd(&var0, &pDispParams->rgvarg[--index]);
@@ -11082,12 +11147,12 @@ STDMETHODIMP HitTarget::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_Image: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1845: [propget, id(DISPID_Image), helpstring("property Image")] HRESULT Image([out, retval] BSTR *pVal);
+				// line 1847: [propget, id(DISPID_Image), helpstring("property Image")] HRESULT Image([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Image(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1846: [propput, id(DISPID_Image), helpstring("property Image")] HRESULT Image([in] BSTR newVal);
+				// line 1848: [propput, id(DISPID_Image), helpstring("property Image")] HRESULT Image([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -11098,12 +11163,12 @@ STDMETHODIMP HitTarget::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_POSITION_X: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1848: [propget, id(DISPID_POSITION_X), helpstring("property X")] HRESULT X([out, retval] float *pVal);
+				// line 1850: [propget, id(DISPID_POSITION_X), helpstring("property X")] HRESULT X([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_X(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1849: [propput, id(DISPID_POSITION_X), helpstring("property X")] HRESULT X([in] float newVal);
+				// line 1851: [propput, id(DISPID_POSITION_X), helpstring("property X")] HRESULT X([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -11114,12 +11179,12 @@ STDMETHODIMP HitTarget::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_POSITION_Y: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1850: [propget, id(DISPID_POSITION_Y), helpstring("property Y")] HRESULT Y([out, retval] float *pVal);
+				// line 1852: [propget, id(DISPID_POSITION_Y), helpstring("property Y")] HRESULT Y([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Y(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1851: [propput, id(DISPID_POSITION_Y), helpstring("property Y")] HRESULT Y([in] float newVal);
+				// line 1853: [propput, id(DISPID_POSITION_Y), helpstring("property Y")] HRESULT Y([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -11130,12 +11195,12 @@ STDMETHODIMP HitTarget::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_POSITION_Z: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1852: [propget, id(DISPID_POSITION_Z), helpstring("property Z")] HRESULT Z([out, retval] float *pVal);
+				// line 1854: [propget, id(DISPID_POSITION_Z), helpstring("property Z")] HRESULT Z([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Z(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1853: [propput, id(DISPID_POSITION_Z), helpstring("property Z")] HRESULT Z([in] float newVal);
+				// line 1855: [propput, id(DISPID_POSITION_Z), helpstring("property Z")] HRESULT Z([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -11146,12 +11211,12 @@ STDMETHODIMP HitTarget::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_SIZE_X: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1854: [propget, id(DISPID_SIZE_X), helpstring("property ScaleX")] HRESULT ScaleX([out, retval] float *pVal);
+				// line 1856: [propget, id(DISPID_SIZE_X), helpstring("property ScaleX")] HRESULT ScaleX([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_ScaleX(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1855: [propput, id(DISPID_SIZE_X), helpstring("property ScaleX")] HRESULT ScaleX([in] float newVal);
+				// line 1857: [propput, id(DISPID_SIZE_X), helpstring("property ScaleX")] HRESULT ScaleX([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -11162,12 +11227,12 @@ STDMETHODIMP HitTarget::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_SIZE_Y: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1856: [propget, id(DISPID_SIZE_Y), helpstring("property ScaleY")] HRESULT ScaleY([out, retval] float *pVal);
+				// line 1858: [propget, id(DISPID_SIZE_Y), helpstring("property ScaleY")] HRESULT ScaleY([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_ScaleY(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1857: [propput, id(DISPID_SIZE_Y), helpstring("property ScaleY")] HRESULT ScaleY([in] float newVal);
+				// line 1859: [propput, id(DISPID_SIZE_Y), helpstring("property ScaleY")] HRESULT ScaleY([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -11178,12 +11243,12 @@ STDMETHODIMP HitTarget::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_SIZE_Z: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1858: [propget, id(DISPID_SIZE_Z), helpstring("property ScaleZ")] HRESULT ScaleZ([out, retval] float *pVal);
+				// line 1860: [propget, id(DISPID_SIZE_Z), helpstring("property ScaleZ")] HRESULT ScaleZ([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_ScaleZ(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1859: [propput, id(DISPID_SIZE_Z), helpstring("property ScaleZ")] HRESULT ScaleZ([in] float newVal);
+				// line 1861: [propput, id(DISPID_SIZE_Z), helpstring("property ScaleZ")] HRESULT ScaleZ([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -11194,12 +11259,12 @@ STDMETHODIMP HitTarget::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_ROT_Z: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1861: [propget, id(DISPID_ROT_Z), helpstring("property Orientation")] HRESULT Orientation([out, retval] float *pVal);
+				// line 1863: [propget, id(DISPID_ROT_Z), helpstring("property Orientation")] HRESULT Orientation([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Orientation(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1862: [propput, id(DISPID_ROT_Z), helpstring("property Orientation")] HRESULT Orientation([in] float newVal);
+				// line 1864: [propput, id(DISPID_ROT_Z), helpstring("property Orientation")] HRESULT Orientation([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -11210,12 +11275,12 @@ STDMETHODIMP HitTarget::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case DISPID_Name: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1864: [propget, id(DISPID_Name), helpstring("property Name")] HRESULT Name([out, retval] BSTR *pVal);
+				// line 1866: [propget, id(DISPID_Name), helpstring("property Name")] HRESULT Name([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Name(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1865: [propput, id(DISPID_Name), helpstring("property Name")] HRESULT Name([in] BSTR newVal);
+				// line 1867: [propput, id(DISPID_Name), helpstring("property Name")] HRESULT Name([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -11226,12 +11291,12 @@ STDMETHODIMP HitTarget::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 110: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1867: [propget, id(110), helpstring("property Elasticity")] HRESULT Elasticity([out, retval] float *pVal);
+				// line 1869: [propget, id(110), helpstring("property Elasticity")] HRESULT Elasticity([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Elasticity(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1868: [propput, id(110), helpstring("property Elasticity")] HRESULT Elasticity([in] float newVal);
+				// line 1870: [propput, id(110), helpstring("property Elasticity")] HRESULT Elasticity([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -11242,12 +11307,12 @@ STDMETHODIMP HitTarget::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 112: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1869: [propget, id(112), helpstring("property ElasticityFalloff")] HRESULT ElasticityFalloff([out, retval] float *pVal);
+				// line 1871: [propget, id(112), helpstring("property ElasticityFalloff")] HRESULT ElasticityFalloff([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_ElasticityFalloff(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1870: [propput, id(112), helpstring("property ElasticityFalloff")] HRESULT ElasticityFalloff([in] float newVal);
+				// line 1872: [propput, id(112), helpstring("property ElasticityFalloff")] HRESULT ElasticityFalloff([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -11258,12 +11323,12 @@ STDMETHODIMP HitTarget::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 111: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1872: [propget, id(111), helpstring("property Collidable")] HRESULT Collidable([out, retval] VARIANT_BOOL *pVal);
+				// line 1874: [propget, id(111), helpstring("property Collidable")] HRESULT Collidable([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_Collidable(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1873: [propput, id(111), helpstring("property Collidable")] HRESULT Collidable([in] VARIANT_BOOL newVal);
+				// line 1875: [propput, id(111), helpstring("property Collidable")] HRESULT Collidable([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -11274,12 +11339,12 @@ STDMETHODIMP HitTarget::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 34: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1874: [propget, id(34), helpstring("property HasHitEvent")] HRESULT HasHitEvent([out, retval] VARIANT_BOOL *pVal);
+				// line 1876: [propget, id(34), helpstring("property HasHitEvent")] HRESULT HasHitEvent([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_HasHitEvent(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1875: [propput, id(34), helpstring("property HasHitEvent")] HRESULT HasHitEvent([in] VARIANT_BOOL newVal);
+				// line 1877: [propput, id(34), helpstring("property HasHitEvent")] HRESULT HasHitEvent([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -11290,12 +11355,12 @@ STDMETHODIMP HitTarget::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 33: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1876: [propget, id(33), helpstring("property Threshold")] HRESULT Threshold([out, retval] float *pVal);
+				// line 1878: [propget, id(33), helpstring("property Threshold")] HRESULT Threshold([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Threshold(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1877: [propput, id(33), helpstring("property Threshold")] HRESULT Threshold([in] float newVal);
+				// line 1879: [propput, id(33), helpstring("property Threshold")] HRESULT Threshold([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -11306,12 +11371,12 @@ STDMETHODIMP HitTarget::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 114: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1878: [propget, id(114), helpstring("property Friction")] HRESULT Friction([out, retval] float *pVal);
+				// line 1880: [propget, id(114), helpstring("property Friction")] HRESULT Friction([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Friction(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1879: [propput, id(114), helpstring("property Friction")] HRESULT Friction([in] float newVal);
+				// line 1881: [propput, id(114), helpstring("property Friction")] HRESULT Friction([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -11322,12 +11387,12 @@ STDMETHODIMP HitTarget::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 115: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1880: [propget, id(115), helpstring("property Scatter")] HRESULT Scatter([out, retval] float *pVal);
+				// line 1882: [propget, id(115), helpstring("property Scatter")] HRESULT Scatter([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Scatter(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1881: [propput, id(115), helpstring("property Scatter")] HRESULT Scatter([in] float newVal);
+				// line 1883: [propput, id(115), helpstring("property Scatter")] HRESULT Scatter([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -11338,12 +11403,12 @@ STDMETHODIMP HitTarget::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 483: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1882: [propget, id(483), helpstring("property DisableLighting")] HRESULT DisableLighting([out, retval] VARIANT_BOOL *pVal);
+				// line 1884: [propget, id(483), helpstring("property DisableLighting")] HRESULT DisableLighting([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_DisableLighting(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1883: [propput, id(483), helpstring("property DisableLighting")] HRESULT DisableLighting([in] VARIANT_BOOL newVal);
+				// line 1885: [propput, id(483), helpstring("property DisableLighting")] HRESULT DisableLighting([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -11354,12 +11419,12 @@ STDMETHODIMP HitTarget::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 494: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1884: [propget, id(494), helpstring("property BlendDisableLighting")] HRESULT BlendDisableLighting([out, retval] float *pVal);
+				// line 1886: [propget, id(494), helpstring("property BlendDisableLighting")] HRESULT BlendDisableLighting([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_BlendDisableLighting(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1885: [propput, id(494), helpstring("property BlendDisableLighting")] HRESULT BlendDisableLighting([in] float newVal);
+				// line 1887: [propput, id(494), helpstring("property BlendDisableLighting")] HRESULT BlendDisableLighting([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -11370,12 +11435,12 @@ STDMETHODIMP HitTarget::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 496: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1886: [propget, id(496), helpstring("property BlendDisableLightingFromBelow")] HRESULT BlendDisableLightingFromBelow([out, retval] float *pVal);
+				// line 1888: [propget, id(496), helpstring("property BlendDisableLightingFromBelow")] HRESULT BlendDisableLightingFromBelow([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_BlendDisableLightingFromBelow(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1887: [propput, id(496), helpstring("property BlendDisableLightingFromBelow")] HRESULT BlendDisableLightingFromBelow([in] float newVal);
+				// line 1889: [propput, id(496), helpstring("property BlendDisableLightingFromBelow")] HRESULT BlendDisableLightingFromBelow([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -11386,12 +11451,12 @@ STDMETHODIMP HitTarget::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 431: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1888: [propget, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([out, retval] VARIANT_BOOL *pVal);
+				// line 1890: [propget, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_ReflectionEnabled(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1889: [propput, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([in] VARIANT_BOOL newVal);
+				// line 1891: [propput, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -11402,12 +11467,12 @@ STDMETHODIMP HitTarget::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 397: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1891: [propget, id(397), helpstring("property DepthBias")] HRESULT DepthBias([out, retval] float *pVal);
+				// line 1893: [propget, id(397), helpstring("property DepthBias")] HRESULT DepthBias([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_DepthBias(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1892: [propput, id(397), helpstring("property DepthBias")] HRESULT DepthBias([in] float newVal);
+				// line 1894: [propput, id(397), helpstring("property DepthBias")] HRESULT DepthBias([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -11418,12 +11483,12 @@ STDMETHODIMP HitTarget::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 377: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1894: [propget, id(377), helpstring("property DropSpeed")] HRESULT DropSpeed([out, retval] float *pVal);
+				// line 1896: [propget, id(377), helpstring("property DropSpeed")] HRESULT DropSpeed([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_DropSpeed(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1895: [propput, id(377), helpstring("property DropSpeed")] HRESULT DropSpeed([in] float newVal);
+				// line 1897: [propput, id(377), helpstring("property DropSpeed")] HRESULT DropSpeed([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -11434,7 +11499,7 @@ STDMETHODIMP HitTarget::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 27: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1896: [propget, id(27), helpstring("property CurrentAnimOffset")] HRESULT CurrentAnimOffset([out, retval] float *pVal);
+				// line 1898: [propget, id(27), helpstring("property CurrentAnimOffset")] HRESULT CurrentAnimOffset([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_CurrentAnimOffset(&V_R4(&res));
 			}
@@ -11442,12 +11507,12 @@ STDMETHODIMP HitTarget::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 435: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1897: [propget, id(435), helpstring("property IsDropped")] HRESULT IsDropped([out, retval] VARIANT_BOOL *pVal);
+				// line 1899: [propget, id(435), helpstring("property IsDropped")] HRESULT IsDropped([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_IsDropped(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1898: [propput, id(435), helpstring("property IsDropped")] HRESULT IsDropped([in] VARIANT_BOOL newVal);
+				// line 1900: [propput, id(435), helpstring("property IsDropped")] HRESULT IsDropped([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -11458,12 +11523,12 @@ STDMETHODIMP HitTarget::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 9: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1899: [propget, id(9), helpstring("property DrawStyle")] HRESULT DrawStyle([out, retval] TargetType *pVal);
+				// line 1901: [propget, id(9), helpstring("property DrawStyle")] HRESULT DrawStyle([out, retval] TargetType *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_DrawStyle((TargetType*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1900: [propput, id(9), helpstring("property DrawStyle")] HRESULT DrawStyle([in] TargetType newVal);
+				// line 1902: [propput, id(9), helpstring("property DrawStyle")] HRESULT DrawStyle([in] TargetType newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -11474,12 +11539,12 @@ STDMETHODIMP HitTarget::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 433: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1901: [propget, id(433), helpstring("property LegacyMode")] HRESULT LegacyMode([out, retval] VARIANT_BOOL *pVal);
+				// line 1903: [propget, id(433), helpstring("property LegacyMode")] HRESULT LegacyMode([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_LegacyMode(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1902: [propput, id(433), helpstring("property LegacyMode")] HRESULT LegacyMode([in] VARIANT_BOOL newVal);
+				// line 1904: [propput, id(433), helpstring("property LegacyMode")] HRESULT LegacyMode([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -11490,12 +11555,12 @@ STDMETHODIMP HitTarget::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 726: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1903: [propget, id(726), helpstring("property RaiseDelay")] HRESULT RaiseDelay([out, retval] long *pVal);
+				// line 1905: [propget, id(726), helpstring("property RaiseDelay")] HRESULT RaiseDelay([out, retval] long *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_RaiseDelay((LONG*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1904: [propput, id(726), helpstring("property RaiseDelay")] HRESULT RaiseDelay([in] long newVal);
+				// line 1906: [propput, id(726), helpstring("property RaiseDelay")] HRESULT RaiseDelay([in] long newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -11506,12 +11571,12 @@ STDMETHODIMP HitTarget::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 734: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1905: [propget, id(734), helpstring("property PhysicsMaterial")] HRESULT PhysicsMaterial([out, retval] BSTR *pVal);
+				// line 1907: [propget, id(734), helpstring("property PhysicsMaterial")] HRESULT PhysicsMaterial([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_PhysicsMaterial(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1906: [propput, id(734), helpstring("property PhysicsMaterial")] HRESULT PhysicsMaterial([in] BSTR newVal);
+				// line 1908: [propput, id(734), helpstring("property PhysicsMaterial")] HRESULT PhysicsMaterial([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -11522,12 +11587,12 @@ STDMETHODIMP HitTarget::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 432: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1907: [propget, id(432), helpstring("property OverwritePhysics")] HRESULT OverwritePhysics([out, retval] VARIANT_BOOL *pVal);
+				// line 1909: [propget, id(432), helpstring("property OverwritePhysics")] HRESULT OverwritePhysics([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_OverwritePhysics(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1908: [propput, id(432), helpstring("property OverwritePhysics")] HRESULT OverwritePhysics([in] VARIANT_BOOL newVal);
+				// line 1910: [propput, id(432), helpstring("property OverwritePhysics")] HRESULT OverwritePhysics([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -11538,7 +11603,7 @@ STDMETHODIMP HitTarget::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid,
 		}
 		case 727: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1909: [propget, id(727), helpstring("property HitThreshold")] HRESULT HitThreshold([out, retval] float *pVal);
+				// line 1911: [propget, id(727), helpstring("property HitThreshold")] HRESULT HitThreshold([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_HitThreshold(&V_R4(&res));
 			}
@@ -11678,12 +11743,12 @@ STDMETHODIMP Gate::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case DISPID_Name: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1940: [propget, id(DISPID_Name), helpstring("property Name")] HRESULT Name([out, retval] BSTR *pVal);
+				// line 1942: [propget, id(DISPID_Name), helpstring("property Name")] HRESULT Name([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Name(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1941: [propput, id(DISPID_Name), helpstring("property Name")] HRESULT Name([in] BSTR newVal);
+				// line 1943: [propput, id(DISPID_Name), helpstring("property Name")] HRESULT Name([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -11694,12 +11759,12 @@ STDMETHODIMP Gate::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case DISPID_Timer_Enabled: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1942: [propget, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([out, retval] VARIANT_BOOL *pVal);
+				// line 1944: [propget, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_TimerEnabled(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1943: [propput, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([in] VARIANT_BOOL newVal);
+				// line 1945: [propput, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -11710,12 +11775,12 @@ STDMETHODIMP Gate::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case DISPID_Timer_Interval: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1944: [propget, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([out, retval] long *pVal);
+				// line 1946: [propget, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([out, retval] long *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_TimerInterval((LONG*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1945: [propput, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([in] long newVal);
+				// line 1947: [propput, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([in] long newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -11726,12 +11791,12 @@ STDMETHODIMP Gate::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case DISPID_Gate_Length: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1946: [propget, id(DISPID_Gate_Length), helpstring("property Length")] HRESULT Length([out, retval] float *pVal);
+				// line 1948: [propget, id(DISPID_Gate_Length), helpstring("property Length")] HRESULT Length([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Length(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1947: [propput, id(DISPID_Gate_Length), helpstring("property Length")] HRESULT Length([in] float newVal);
+				// line 1949: [propput, id(DISPID_Gate_Length), helpstring("property Length")] HRESULT Length([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -11742,12 +11807,12 @@ STDMETHODIMP Gate::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 1142: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1948: [propget, id(1142), helpstring("property Height")] HRESULT Height([out, retval] float *pVal);
+				// line 1950: [propget, id(1142), helpstring("property Height")] HRESULT Height([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Height(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1949: [propput, id(1142), helpstring("property Height")] HRESULT Height([in] float newVal);
+				// line 1951: [propput, id(1142), helpstring("property Height")] HRESULT Height([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -11758,12 +11823,12 @@ STDMETHODIMP Gate::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case DISPID_Gate_Rotation: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1950: [propget, id(DISPID_Gate_Rotation), helpstring("property Rotation")] HRESULT Rotation([out, retval] float *pVal);
+				// line 1952: [propget, id(DISPID_Gate_Rotation), helpstring("property Rotation")] HRESULT Rotation([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Rotation(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1951: [propput, id(DISPID_Gate_Rotation), helpstring("property Rotation")] HRESULT Rotation([in] float newVal);
+				// line 1953: [propput, id(DISPID_Gate_Rotation), helpstring("property Rotation")] HRESULT Rotation([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -11774,12 +11839,12 @@ STDMETHODIMP Gate::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 5: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1952: [propget, id(5), helpstring("property X")] HRESULT X([out, retval] float *pVal);
+				// line 1954: [propget, id(5), helpstring("property X")] HRESULT X([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_X(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1953: [propput, id(5), helpstring("property X")] HRESULT X([in] float newVal);
+				// line 1955: [propput, id(5), helpstring("property X")] HRESULT X([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -11790,12 +11855,12 @@ STDMETHODIMP Gate::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 6: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1954: [propget, id(6), helpstring("property Y")] HRESULT Y([out, retval] float *pVal);
+				// line 1956: [propget, id(6), helpstring("property Y")] HRESULT Y([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Y(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1955: [propput, id(6), helpstring("property Y")] HRESULT Y([in] float newVal);
+				// line 1957: [propput, id(6), helpstring("property Y")] HRESULT Y([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -11806,12 +11871,12 @@ STDMETHODIMP Gate::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 7: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1956: [propget, id(7), helpstring("property Open")] HRESULT Open([out, retval] VARIANT_BOOL *pVal);
+				// line 1958: [propget, id(7), helpstring("property Open")] HRESULT Open([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_Open(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1957: [propput, id(7), helpstring("property Open")] HRESULT Open([in] VARIANT_BOOL newVal);
+				// line 1959: [propput, id(7), helpstring("property Open")] HRESULT Open([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -11822,12 +11887,12 @@ STDMETHODIMP Gate::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 13: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1958: [propget, id(13), helpstring("property Damping")] HRESULT Damping([out, retval] float *pVal);
+				// line 1960: [propget, id(13), helpstring("property Damping")] HRESULT Damping([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Damping(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1959: [propput, id(13), helpstring("property Damping")] HRESULT Damping([in] float newVal);
+				// line 1961: [propput, id(13), helpstring("property Damping")] HRESULT Damping([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -11838,12 +11903,12 @@ STDMETHODIMP Gate::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 17: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1960: [propget, id(17), helpstring("property GravityFactor")] HRESULT GravityFactor([out, retval] float *pVal);
+				// line 1962: [propget, id(17), helpstring("property GravityFactor")] HRESULT GravityFactor([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_GravityFactor(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1961: [propput, id(17), helpstring("property GravityFactor")] HRESULT GravityFactor([in] float newVal);
+				// line 1963: [propput, id(17), helpstring("property GravityFactor")] HRESULT GravityFactor([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -11854,7 +11919,7 @@ STDMETHODIMP Gate::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 2147: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 1963: [id(2147), helpstring("method Move")] HRESULT Move(int dir, [defaultvalue(0)] float speed, [defaultvalue(0)] float angle);
+				// line 1965: [id(2147), helpstring("method Move")] HRESULT Move(int dir, [defaultvalue(0)] float speed, [defaultvalue(0)] float angle);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -11875,12 +11940,12 @@ STDMETHODIMP Gate::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 340: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1965: [propget, id(340), helpstring("property Material")] HRESULT Material([out, retval] BSTR *pVal);
+				// line 1967: [propget, id(340), helpstring("property Material")] HRESULT Material([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Material(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1966: [propput, id(340), helpstring("property Material")] HRESULT Material([in] BSTR newVal);
+				// line 1968: [propput, id(340), helpstring("property Material")] HRESULT Material([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -11891,12 +11956,12 @@ STDMETHODIMP Gate::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 110: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1967: [propget, id(110), helpstring("property Elasticity")] HRESULT Elasticity([out, retval] float *pVal);
+				// line 1969: [propget, id(110), helpstring("property Elasticity")] HRESULT Elasticity([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Elasticity(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1968: [propput, id(110), helpstring("property Elasticity")] HRESULT Elasticity([in] float newVal);
+				// line 1970: [propput, id(110), helpstring("property Elasticity")] HRESULT Elasticity([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -11907,12 +11972,12 @@ STDMETHODIMP Gate::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case DISPID_Surface: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1969: [propget, id(DISPID_Surface), helpstring("property Surface")] HRESULT Surface([out, retval] BSTR *pVal);
+				// line 1971: [propget, id(DISPID_Surface), helpstring("property Surface")] HRESULT Surface([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Surface(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1970: [propput, id(DISPID_Surface), helpstring("property Surface")] HRESULT Surface([in] BSTR newVal);
+				// line 1972: [propput, id(DISPID_Surface), helpstring("property Surface")] HRESULT Surface([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -11923,11 +11988,11 @@ STDMETHODIMP Gate::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case DISPID_UserValue: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1971: [propget, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([out, retval] VARIANT* pVal);
+				// line 1973: [propget, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([out, retval] VARIANT* pVal);
 				hres = get_UserValue(&res);
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1972: [propput, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([in] VARIANT* newVal);
+				// line 1974: [propput, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([in] VARIANT* newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantCopyInd(&var0, &pDispParams->rgvarg[--index]);
@@ -11938,12 +12003,12 @@ STDMETHODIMP Gate::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 2144: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1974: [propget, id(2144), helpstring("property CloseAngle")] HRESULT CloseAngle([out, retval] float *pVal);
+				// line 1976: [propget, id(2144), helpstring("property CloseAngle")] HRESULT CloseAngle([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_CloseAngle(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1975: [propput, id(2144), helpstring("property CloseAngle")] HRESULT CloseAngle([in] float newVal);
+				// line 1977: [propput, id(2144), helpstring("property CloseAngle")] HRESULT CloseAngle([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -11954,12 +12019,12 @@ STDMETHODIMP Gate::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 2145: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1976: [propget, id(2145), helpstring("property OpenAngle")] HRESULT OpenAngle([out, retval] float *pVal);
+				// line 1978: [propget, id(2145), helpstring("property OpenAngle")] HRESULT OpenAngle([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_OpenAngle(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1977: [propput, id(2145), helpstring("property OpenAngle")] HRESULT OpenAngle([in] float newVal);
+				// line 1979: [propput, id(2145), helpstring("property OpenAngle")] HRESULT OpenAngle([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -11970,12 +12035,12 @@ STDMETHODIMP Gate::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 111: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1978: [propget, id(111), helpstring("property Collidable")] HRESULT Collidable([out, retval] VARIANT_BOOL *pVal);
+				// line 1980: [propget, id(111), helpstring("property Collidable")] HRESULT Collidable([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_Collidable(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1979: [propput, id(111), helpstring("property Collidable")] HRESULT Collidable([in] VARIANT_BOOL newVal);
+				// line 1981: [propput, id(111), helpstring("property Collidable")] HRESULT Collidable([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -11986,12 +12051,12 @@ STDMETHODIMP Gate::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 114: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1980: [propget, id(114), helpstring("property Friction")] HRESULT Friction([out, retval] float *pVal);
+				// line 1982: [propget, id(114), helpstring("property Friction")] HRESULT Friction([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Friction(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1981: [propput, id(114), helpstring("property Friction")] HRESULT Friction([in] float newVal);
+				// line 1983: [propput, id(114), helpstring("property Friction")] HRESULT Friction([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -12002,12 +12067,12 @@ STDMETHODIMP Gate::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 458: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1982: [propget, id(458), helpstring("property Visible")] HRESULT Visible([out, retval] VARIANT_BOOL *pVal);
+				// line 1984: [propget, id(458), helpstring("property Visible")] HRESULT Visible([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_Visible(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1983: [propput, id(458), helpstring("property Visible")] HRESULT Visible([in] VARIANT_BOOL newVal);
+				// line 1985: [propput, id(458), helpstring("property Visible")] HRESULT Visible([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -12018,12 +12083,12 @@ STDMETHODIMP Gate::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 427: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1984: [propget, id(427), helpstring("property TwoWay")] HRESULT TwoWay([out, retval] VARIANT_BOOL *pVal);
+				// line 1986: [propget, id(427), helpstring("property TwoWay")] HRESULT TwoWay([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_TwoWay(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1985: [propput, id(427), helpstring("property TwoWay")] HRESULT TwoWay([in] VARIANT_BOOL newVal);
+				// line 1987: [propput, id(427), helpstring("property TwoWay")] HRESULT TwoWay([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -12034,12 +12099,12 @@ STDMETHODIMP Gate::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 15: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1986: [propget, id(15), helpstring("property ShowBracket")] HRESULT ShowBracket([out, retval] VARIANT_BOOL *pVal);
+				// line 1988: [propget, id(15), helpstring("property ShowBracket")] HRESULT ShowBracket([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_ShowBracket(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1987: [propput, id(15), helpstring("property ShowBracket")] HRESULT ShowBracket([in] VARIANT_BOOL newVal);
+				// line 1989: [propput, id(15), helpstring("property ShowBracket")] HRESULT ShowBracket([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -12050,7 +12115,7 @@ STDMETHODIMP Gate::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 16: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1988: [propget, id(16), nonbrowsable, helpstring("property CurrentAngle")] HRESULT CurrentAngle([out, retval] float *pVal);
+				// line 1990: [propget, id(16), nonbrowsable, helpstring("property CurrentAngle")] HRESULT CurrentAngle([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_CurrentAngle(&V_R4(&res));
 			}
@@ -12058,12 +12123,12 @@ STDMETHODIMP Gate::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 431: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1989: [propget, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([out, retval] VARIANT_BOOL *pVal);
+				// line 1991: [propget, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_ReflectionEnabled(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1990: [propput, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([in] VARIANT_BOOL newVal);
+				// line 1992: [propput, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -12074,12 +12139,12 @@ STDMETHODIMP Gate::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 9: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 1991: [propget, id(9), helpstring("property DrawStyle")] HRESULT DrawStyle([out, retval] GateType *pVal);
+				// line 1993: [propget, id(9), helpstring("property DrawStyle")] HRESULT DrawStyle([out, retval] GateType *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_DrawStyle((GateType*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 1992: [propput, id(9), helpstring("property DrawStyle")] HRESULT DrawStyle([in] GateType newVal);
+				// line 1994: [propput, id(9), helpstring("property DrawStyle")] HRESULT DrawStyle([in] GateType newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -12216,12 +12281,12 @@ STDMETHODIMP Spinner::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Name: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2023: [propget, id(DISPID_Name), helpstring("property Name")] HRESULT Name([out, retval] BSTR *pVal);
+				// line 2025: [propget, id(DISPID_Name), helpstring("property Name")] HRESULT Name([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Name(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2024: [propput, id(DISPID_Name), helpstring("property Name")] HRESULT Name([in] BSTR newVal);
+				// line 2026: [propput, id(DISPID_Name), helpstring("property Name")] HRESULT Name([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -12232,12 +12297,12 @@ STDMETHODIMP Spinner::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Timer_Enabled: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2025: [propget, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([out, retval] VARIANT_BOOL *pVal);
+				// line 2027: [propget, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_TimerEnabled(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2026: [propput, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([in] VARIANT_BOOL newVal);
+				// line 2028: [propput, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -12248,12 +12313,12 @@ STDMETHODIMP Spinner::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Timer_Interval: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2027: [propget, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([out, retval] long *pVal);
+				// line 2029: [propget, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([out, retval] long *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_TimerInterval((LONG*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2028: [propput, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([in] long newVal);
+				// line 2030: [propput, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([in] long newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -12264,12 +12329,12 @@ STDMETHODIMP Spinner::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Spinner_Length: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2029: [propget, id(DISPID_Spinner_Length), helpstring("property Length")] HRESULT Length([out, retval] float *pVal);
+				// line 2031: [propget, id(DISPID_Spinner_Length), helpstring("property Length")] HRESULT Length([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Length(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2030: [propput, id(DISPID_Spinner_Length), helpstring("property Length")] HRESULT Length([in] float newVal);
+				// line 2032: [propput, id(DISPID_Spinner_Length), helpstring("property Length")] HRESULT Length([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -12280,12 +12345,12 @@ STDMETHODIMP Spinner::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 4: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2031: [propget, id(4), helpstring("property Rotation")] HRESULT Rotation([out, retval] float *pVal);
+				// line 2033: [propget, id(4), helpstring("property Rotation")] HRESULT Rotation([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Rotation(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2032: [propput, id(4), helpstring("property Rotation")] HRESULT Rotation([in] float newVal);
+				// line 2034: [propput, id(4), helpstring("property Rotation")] HRESULT Rotation([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -12296,12 +12361,12 @@ STDMETHODIMP Spinner::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 5: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2033: [propget, id(5), helpstring("property Height")] HRESULT Height([out, retval] float *pVal);
+				// line 2035: [propget, id(5), helpstring("property Height")] HRESULT Height([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Height(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2034: [propput, id(5), helpstring("property Height")] HRESULT Height([in] float newVal);
+				// line 2036: [propput, id(5), helpstring("property Height")] HRESULT Height([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -12312,12 +12377,12 @@ STDMETHODIMP Spinner::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 7: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2035: [propget, id(7), helpstring("property Damping")] HRESULT Damping([out, retval] float *pVal);
+				// line 2037: [propget, id(7), helpstring("property Damping")] HRESULT Damping([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Damping(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2036: [propput, id(7), helpstring("property Damping")] HRESULT Damping([in] float newVal);
+				// line 2038: [propput, id(7), helpstring("property Damping")] HRESULT Damping([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -12328,12 +12393,12 @@ STDMETHODIMP Spinner::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Image: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2037: [propget, id(DISPID_Image), helpstring("property Image")] HRESULT Image([out, retval] BSTR *pVal);
+				// line 2039: [propget, id(DISPID_Image), helpstring("property Image")] HRESULT Image([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Image(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2038: [propput, id(DISPID_Image), helpstring("property Image")] HRESULT Image([in] BSTR newVal);
+				// line 2040: [propput, id(DISPID_Image), helpstring("property Image")] HRESULT Image([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -12344,12 +12409,12 @@ STDMETHODIMP Spinner::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 340: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2039: [propget, id(340), helpstring("property Material")] HRESULT Material([out, retval] BSTR *pVal);
+				// line 2041: [propget, id(340), helpstring("property Material")] HRESULT Material([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Material(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2040: [propput, id(340), helpstring("property Material")] HRESULT Material([in] BSTR newVal);
+				// line 2042: [propput, id(340), helpstring("property Material")] HRESULT Material([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -12360,12 +12425,12 @@ STDMETHODIMP Spinner::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 11: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2041: [propget, id(11), helpstring("property X")] HRESULT X([out, retval] float *pVal);
+				// line 2043: [propget, id(11), helpstring("property X")] HRESULT X([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_X(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2042: [propput, id(11), helpstring("property X")] HRESULT X([in] float newVal);
+				// line 2044: [propput, id(11), helpstring("property X")] HRESULT X([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -12376,12 +12441,12 @@ STDMETHODIMP Spinner::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 12: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2043: [propget, id(12), helpstring("property Y")] HRESULT Y([out, retval] float *pVal);
+				// line 2045: [propget, id(12), helpstring("property Y")] HRESULT Y([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Y(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2044: [propput, id(12), helpstring("property Y")] HRESULT Y([in] float newVal);
+				// line 2046: [propput, id(12), helpstring("property Y")] HRESULT Y([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -12392,12 +12457,12 @@ STDMETHODIMP Spinner::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Surface: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2045: [propget, id(DISPID_Surface), helpstring("property Surface")] HRESULT Surface([out, retval] BSTR *pVal);
+				// line 2047: [propget, id(DISPID_Surface), helpstring("property Surface")] HRESULT Surface([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Surface(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2046: [propput, id(DISPID_Surface), helpstring("property Surface")] HRESULT Surface([in] BSTR newVal);
+				// line 2048: [propput, id(DISPID_Surface), helpstring("property Surface")] HRESULT Surface([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -12408,11 +12473,11 @@ STDMETHODIMP Spinner::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_UserValue: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2047: [propget, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([out, retval] VARIANT* pVal);
+				// line 2049: [propget, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([out, retval] VARIANT* pVal);
 				hres = get_UserValue(&res);
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2048: [propput, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([in] VARIANT* newVal);
+				// line 2050: [propput, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([in] VARIANT* newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantCopyInd(&var0, &pDispParams->rgvarg[--index]);
@@ -12423,12 +12488,12 @@ STDMETHODIMP Spinner::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 108: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2049: [propget, id(108), helpstring("property ShowBracket")] HRESULT ShowBracket([out, retval] VARIANT_BOOL *pVal);
+				// line 2051: [propget, id(108), helpstring("property ShowBracket")] HRESULT ShowBracket([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_ShowBracket(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2050: [propput, id(108), helpstring("property ShowBracket")] HRESULT ShowBracket([in] VARIANT_BOOL newVal);
+				// line 2052: [propput, id(108), helpstring("property ShowBracket")] HRESULT ShowBracket([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -12439,12 +12504,12 @@ STDMETHODIMP Spinner::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 13: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2052: [propget, id(13), helpstring("property AngleMax")] HRESULT AngleMax([out, retval] float *pVal);
+				// line 2054: [propget, id(13), helpstring("property AngleMax")] HRESULT AngleMax([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_AngleMax(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2053: [propput, id(13), helpstring("property AngleMax")] HRESULT AngleMax([in] float newVal);
+				// line 2055: [propput, id(13), helpstring("property AngleMax")] HRESULT AngleMax([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -12455,12 +12520,12 @@ STDMETHODIMP Spinner::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 14: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2054: [propget, id(14), helpstring("property AngleMin")] HRESULT AngleMin([out, retval] float *pVal);
+				// line 2056: [propget, id(14), helpstring("property AngleMin")] HRESULT AngleMin([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_AngleMin(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2055: [propput, id(14), helpstring("property AngleMin")] HRESULT AngleMin([in] float newVal);
+				// line 2057: [propput, id(14), helpstring("property AngleMin")] HRESULT AngleMin([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -12471,12 +12536,12 @@ STDMETHODIMP Spinner::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 110: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2056: [propget, id(110), helpstring("property Elasticity")] HRESULT Elasticity([out, retval] float *pVal);
+				// line 2058: [propget, id(110), helpstring("property Elasticity")] HRESULT Elasticity([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Elasticity(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2057: [propput, id(110), helpstring("property Elasticity")] HRESULT Elasticity([in] float newVal);
+				// line 2059: [propput, id(110), helpstring("property Elasticity")] HRESULT Elasticity([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -12487,12 +12552,12 @@ STDMETHODIMP Spinner::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 458: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2058: [propget, id(458), helpstring("property Visible")] HRESULT Visible([out, retval] VARIANT_BOOL *pVal);
+				// line 2060: [propget, id(458), helpstring("property Visible")] HRESULT Visible([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_Visible(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2059: [propput, id(458), helpstring("property Visible")] HRESULT Visible([in] VARIANT_BOOL newVal);
+				// line 2061: [propput, id(458), helpstring("property Visible")] HRESULT Visible([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -12503,12 +12568,12 @@ STDMETHODIMP Spinner::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 431: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2060: [propget, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([out, retval] VARIANT_BOOL *pVal);
+				// line 2062: [propget, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_ReflectionEnabled(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2061: [propput, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([in] VARIANT_BOOL newVal);
+				// line 2063: [propput, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -12519,7 +12584,7 @@ STDMETHODIMP Spinner::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 18: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2062: [propget, id(18), nonbrowsable, helpstring("property CurrentAngle")] HRESULT CurrentAngle([out, retval] float *pVal);
+				// line 2064: [propget, id(18), nonbrowsable, helpstring("property CurrentAngle")] HRESULT CurrentAngle([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_CurrentAngle(&V_R4(&res));
 			}
@@ -12664,12 +12729,12 @@ STDMETHODIMP Ramp::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case DISPID_Name: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2093: [propget, id(DISPID_Name), helpstring("property Name")] HRESULT Name([out, retval] BSTR *pVal);
+				// line 2095: [propget, id(DISPID_Name), helpstring("property Name")] HRESULT Name([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Name(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2094: [propput, id(DISPID_Name), helpstring("property Name")] HRESULT Name([in] BSTR newVal);
+				// line 2096: [propput, id(DISPID_Name), helpstring("property Name")] HRESULT Name([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -12680,12 +12745,12 @@ STDMETHODIMP Ramp::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case DISPID_Timer_Enabled: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2095: [propget, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([out, retval] VARIANT_BOOL *pVal);
+				// line 2097: [propget, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_TimerEnabled(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2096: [propput, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([in] VARIANT_BOOL newVal);
+				// line 2098: [propput, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -12696,12 +12761,12 @@ STDMETHODIMP Ramp::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case DISPID_Timer_Interval: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2097: [propget, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([out, retval] long *pVal);
+				// line 2099: [propget, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([out, retval] long *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_TimerInterval((LONG*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2098: [propput, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([in] long newVal);
+				// line 2100: [propput, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([in] long newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -12712,12 +12777,12 @@ STDMETHODIMP Ramp::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 1: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2099: [propget, id(1), helpstring("property HeightBottom")] HRESULT HeightBottom([out, retval] float *pVal);
+				// line 2101: [propget, id(1), helpstring("property HeightBottom")] HRESULT HeightBottom([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_HeightBottom(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2100: [propput, id(1), helpstring("property HeightBottom")] HRESULT HeightBottom([in] float newVal);
+				// line 2102: [propput, id(1), helpstring("property HeightBottom")] HRESULT HeightBottom([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -12728,12 +12793,12 @@ STDMETHODIMP Ramp::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 2: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2101: [propget, id(2), helpstring("property HeightTop")] HRESULT HeightTop([out, retval] float *pVal);
+				// line 2103: [propget, id(2), helpstring("property HeightTop")] HRESULT HeightTop([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_HeightTop(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2102: [propput, id(2), helpstring("property HeightTop")] HRESULT HeightTop([in] float newVal);
+				// line 2104: [propput, id(2), helpstring("property HeightTop")] HRESULT HeightTop([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -12744,12 +12809,12 @@ STDMETHODIMP Ramp::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 3: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2103: [propget, id(3), helpstring("property WidthBottom")] HRESULT WidthBottom([out, retval] float *pVal);
+				// line 2105: [propget, id(3), helpstring("property WidthBottom")] HRESULT WidthBottom([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_WidthBottom(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2104: [propput, id(3), helpstring("property WidthBottom")] HRESULT WidthBottom([in] float newVal);
+				// line 2106: [propput, id(3), helpstring("property WidthBottom")] HRESULT WidthBottom([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -12760,12 +12825,12 @@ STDMETHODIMP Ramp::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 4: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2105: [propget, id(4), helpstring("property WidthTop")] HRESULT WidthTop([out, retval] float *pVal);
+				// line 2107: [propget, id(4), helpstring("property WidthTop")] HRESULT WidthTop([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_WidthTop(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2106: [propput, id(4), helpstring("property WidthTop")] HRESULT WidthTop([in] float newVal);
+				// line 2108: [propput, id(4), helpstring("property WidthTop")] HRESULT WidthTop([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -12776,12 +12841,12 @@ STDMETHODIMP Ramp::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 340: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2107: [propget, id(340), helpstring("property Material")] HRESULT Material([out, retval] BSTR *pVal);
+				// line 2109: [propget, id(340), helpstring("property Material")] HRESULT Material([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Material(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2108: [propput, id(340), helpstring("property Material")] HRESULT Material([in] BSTR newVal);
+				// line 2110: [propput, id(340), helpstring("property Material")] HRESULT Material([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -12792,12 +12857,12 @@ STDMETHODIMP Ramp::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 6: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2109: [propget, id(6), helpstring("property Type")] HRESULT Type([out, retval] RampType *pVal);
+				// line 2111: [propget, id(6), helpstring("property Type")] HRESULT Type([out, retval] RampType *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_Type((RampType*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2110: [propput, id(6), helpstring("property Type")] HRESULT Type([in] RampType newVal);
+				// line 2112: [propput, id(6), helpstring("property Type")] HRESULT Type([in] RampType newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -12808,12 +12873,12 @@ STDMETHODIMP Ramp::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case DISPID_Image: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2111: [propget, id(DISPID_Image), helpstring("property Image")] HRESULT Image([out, retval] BSTR *pVal);
+				// line 2113: [propget, id(DISPID_Image), helpstring("property Image")] HRESULT Image([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Image(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2112: [propput, id(DISPID_Image), helpstring("property Image")] HRESULT Image([in] BSTR newVal);
+				// line 2114: [propput, id(DISPID_Image), helpstring("property Image")] HRESULT Image([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -12824,12 +12889,12 @@ STDMETHODIMP Ramp::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 8: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2113: [propget, id(8), helpstring("property ImageAlignment")] HRESULT ImageAlignment([out, retval] RampImageAlignment *pVal);
+				// line 2115: [propget, id(8), helpstring("property ImageAlignment")] HRESULT ImageAlignment([out, retval] RampImageAlignment *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_ImageAlignment((RampImageAlignment*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2114: [propput, id(8), helpstring("property ImageAlignment")] HRESULT ImageAlignment([in] RampImageAlignment newVal);
+				// line 2116: [propput, id(8), helpstring("property ImageAlignment")] HRESULT ImageAlignment([in] RampImageAlignment newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -12840,12 +12905,12 @@ STDMETHODIMP Ramp::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 9: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2115: [propget, id(9), helpstring("property HasWallImage")] HRESULT HasWallImage([out, retval] VARIANT_BOOL *pVal);
+				// line 2117: [propget, id(9), helpstring("property HasWallImage")] HRESULT HasWallImage([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_HasWallImage(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2116: [propput, id(9), helpstring("property HasWallImage")] HRESULT HasWallImage([in] VARIANT_BOOL newVal);
+				// line 2118: [propput, id(9), helpstring("property HasWallImage")] HRESULT HasWallImage([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -12856,12 +12921,12 @@ STDMETHODIMP Ramp::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 10: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2117: [propget, id(10), helpstring("property LeftWallHeight")] HRESULT LeftWallHeight([out, retval] float *pVal);
+				// line 2119: [propget, id(10), helpstring("property LeftWallHeight")] HRESULT LeftWallHeight([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_LeftWallHeight(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2118: [propput, id(10), helpstring("property LeftWallHeight")] HRESULT LeftWallHeight([in] float newVal);
+				// line 2120: [propput, id(10), helpstring("property LeftWallHeight")] HRESULT LeftWallHeight([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -12872,12 +12937,12 @@ STDMETHODIMP Ramp::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 11: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2119: [propget, id(11), helpstring("property RightWallHeight")] HRESULT RightWallHeight([out, retval] float *pVal);
+				// line 2121: [propget, id(11), helpstring("property RightWallHeight")] HRESULT RightWallHeight([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_RightWallHeight(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2120: [propput, id(11), helpstring("property RightWallHeight")] HRESULT RightWallHeight([in] float newVal);
+				// line 2122: [propput, id(11), helpstring("property RightWallHeight")] HRESULT RightWallHeight([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -12888,11 +12953,11 @@ STDMETHODIMP Ramp::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case DISPID_UserValue: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2121: [propget, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([out, retval] VARIANT* pVal);
+				// line 2123: [propget, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([out, retval] VARIANT* pVal);
 				hres = get_UserValue(&res);
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2122: [propput, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([in] VARIANT* newVal);
+				// line 2124: [propput, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([in] VARIANT* newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantCopyInd(&var0, &pDispParams->rgvarg[--index]);
@@ -12903,12 +12968,12 @@ STDMETHODIMP Ramp::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 108: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2123: [propget, id(108), helpstring("property VisibleLeftWallHeight")] HRESULT VisibleLeftWallHeight([out, retval] float *pVal);
+				// line 2125: [propget, id(108), helpstring("property VisibleLeftWallHeight")] HRESULT VisibleLeftWallHeight([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_VisibleLeftWallHeight(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2124: [propput, id(108), helpstring("property VisibleLeftWallHeight")] HRESULT VisibleLeftWallHeight([in] float newVal);
+				// line 2126: [propput, id(108), helpstring("property VisibleLeftWallHeight")] HRESULT VisibleLeftWallHeight([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -12919,12 +12984,12 @@ STDMETHODIMP Ramp::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 109: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2125: [propget, id(109), helpstring("property VisibleRightWallHeight")] HRESULT VisibleRightWallHeight([out, retval] float *pVal);
+				// line 2127: [propget, id(109), helpstring("property VisibleRightWallHeight")] HRESULT VisibleRightWallHeight([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_VisibleRightWallHeight(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2126: [propput, id(109), helpstring("property VisibleRightWallHeight")] HRESULT VisibleRightWallHeight([in] float newVal);
+				// line 2128: [propput, id(109), helpstring("property VisibleRightWallHeight")] HRESULT VisibleRightWallHeight([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -12935,12 +13000,12 @@ STDMETHODIMP Ramp::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 110: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2127: [propget, id(110), helpstring("property Elasticity")] HRESULT Elasticity([out, retval] float *pVal);
+				// line 2129: [propget, id(110), helpstring("property Elasticity")] HRESULT Elasticity([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Elasticity(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2128: [propput, id(110), helpstring("property Elasticity")] HRESULT Elasticity([in] float newVal);
+				// line 2130: [propput, id(110), helpstring("property Elasticity")] HRESULT Elasticity([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -12951,12 +13016,12 @@ STDMETHODIMP Ramp::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 111: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2130: [propget, id(111), helpstring("property Collidable")] HRESULT Collidable([out, retval] VARIANT_BOOL *pVal);
+				// line 2132: [propget, id(111), helpstring("property Collidable")] HRESULT Collidable([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_Collidable(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2131: [propput, id(111), helpstring("property Collidable")] HRESULT Collidable([in] VARIANT_BOOL newVal);
+				// line 2133: [propput, id(111), helpstring("property Collidable")] HRESULT Collidable([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -12967,12 +13032,12 @@ STDMETHODIMP Ramp::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 34: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2132: [propget, id(34), helpstring("property HasHitEvent")] HRESULT HasHitEvent([out, retval] VARIANT_BOOL *pVal);
+				// line 2134: [propget, id(34), helpstring("property HasHitEvent")] HRESULT HasHitEvent([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_HasHitEvent(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2133: [propput, id(34), helpstring("property HasHitEvent")] HRESULT HasHitEvent([in] VARIANT_BOOL newVal);
+				// line 2135: [propput, id(34), helpstring("property HasHitEvent")] HRESULT HasHitEvent([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -12983,12 +13048,12 @@ STDMETHODIMP Ramp::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 33: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2134: [propget, id(33), helpstring("property Threshold")] HRESULT Threshold([out, retval] float *pVal);
+				// line 2136: [propget, id(33), helpstring("property Threshold")] HRESULT Threshold([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Threshold(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2135: [propput, id(33), helpstring("property Threshold")] HRESULT Threshold([in] float newVal);
+				// line 2137: [propput, id(33), helpstring("property Threshold")] HRESULT Threshold([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -12999,12 +13064,12 @@ STDMETHODIMP Ramp::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 458: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2137: [propget, id(458), helpstring("property Visible")] HRESULT Visible([out, retval] VARIANT_BOOL *pVal);
+				// line 2139: [propget, id(458), helpstring("property Visible")] HRESULT Visible([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_Visible(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2138: [propput, id(458), helpstring("property Visible")] HRESULT Visible([in] VARIANT_BOOL newVal);
+				// line 2140: [propput, id(458), helpstring("property Visible")] HRESULT Visible([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -13015,12 +13080,12 @@ STDMETHODIMP Ramp::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 114: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2140: [propget, id(114), helpstring("property Friction")] HRESULT Friction([out, retval] float *pVal);
+				// line 2142: [propget, id(114), helpstring("property Friction")] HRESULT Friction([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Friction(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2141: [propput, id(114), helpstring("property Friction")] HRESULT Friction([in] float newVal);
+				// line 2143: [propput, id(114), helpstring("property Friction")] HRESULT Friction([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -13031,12 +13096,12 @@ STDMETHODIMP Ramp::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 115: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2142: [propget, id(115), helpstring("property Scatter")] HRESULT Scatter([out, retval] float *pVal);
+				// line 2144: [propget, id(115), helpstring("property Scatter")] HRESULT Scatter([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Scatter(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2143: [propput, id(115), helpstring("property Scatter")] HRESULT Scatter([in] float newVal);
+				// line 2145: [propput, id(115), helpstring("property Scatter")] HRESULT Scatter([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -13047,12 +13112,12 @@ STDMETHODIMP Ramp::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 397: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2145: [propget, id(397), helpstring("property DepthBias")] HRESULT DepthBias([out, retval] float *pVal);
+				// line 2147: [propget, id(397), helpstring("property DepthBias")] HRESULT DepthBias([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_DepthBias(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2146: [propput, id(397), helpstring("property DepthBias")] HRESULT DepthBias([in] float newVal);
+				// line 2148: [propput, id(397), helpstring("property DepthBias")] HRESULT DepthBias([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -13063,12 +13128,12 @@ STDMETHODIMP Ramp::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 377: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2148: [propget, id(377), helpstring("property WireDiameter")] HRESULT WireDiameter([out, retval] float *pVal);
+				// line 2150: [propget, id(377), helpstring("property WireDiameter")] HRESULT WireDiameter([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_WireDiameter(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2149: [propput, id(377), helpstring("property WireDiameter")] HRESULT WireDiameter([in] float newVal);
+				// line 2151: [propput, id(377), helpstring("property WireDiameter")] HRESULT WireDiameter([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -13079,12 +13144,12 @@ STDMETHODIMP Ramp::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 398: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2151: [propget, id(398), helpstring("property WireDistanceX")] HRESULT WireDistanceX([out, retval] float *pVal);
+				// line 2153: [propget, id(398), helpstring("property WireDistanceX")] HRESULT WireDistanceX([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_WireDistanceX(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2152: [propput, id(398), helpstring("property WireDistanceX")] HRESULT WireDistanceX([in] float newVal);
+				// line 2154: [propput, id(398), helpstring("property WireDistanceX")] HRESULT WireDistanceX([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -13095,12 +13160,12 @@ STDMETHODIMP Ramp::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 425: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2154: [propget, id(425), helpstring("property WireDistanceY")] HRESULT WireDistanceY([out, retval] float *pVal);
+				// line 2156: [propget, id(425), helpstring("property WireDistanceY")] HRESULT WireDistanceY([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_WireDistanceY(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2155: [propput, id(425), helpstring("property WireDistanceY")] HRESULT WireDistanceY([in] float newVal);
+				// line 2157: [propput, id(425), helpstring("property WireDistanceY")] HRESULT WireDistanceY([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -13111,12 +13176,12 @@ STDMETHODIMP Ramp::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 431: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2157: [propget, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([out, retval] VARIANT_BOOL *pVal);
+				// line 2159: [propget, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_ReflectionEnabled(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2158: [propput, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([in] VARIANT_BOOL newVal);
+				// line 2160: [propput, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -13127,12 +13192,12 @@ STDMETHODIMP Ramp::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 734: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2160: [propget, id(734), helpstring("property PhysicsMaterial")] HRESULT PhysicsMaterial([out, retval] BSTR *pVal);
+				// line 2162: [propget, id(734), helpstring("property PhysicsMaterial")] HRESULT PhysicsMaterial([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_PhysicsMaterial(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2161: [propput, id(734), helpstring("property PhysicsMaterial")] HRESULT PhysicsMaterial([in] BSTR newVal);
+				// line 2163: [propput, id(734), helpstring("property PhysicsMaterial")] HRESULT PhysicsMaterial([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -13143,12 +13208,12 @@ STDMETHODIMP Ramp::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 432: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2162: [propget, id(432), helpstring("property OverwritePhysics")] HRESULT OverwritePhysics([out, retval] VARIANT_BOOL *pVal);
+				// line 2164: [propget, id(432), helpstring("property OverwritePhysics")] HRESULT OverwritePhysics([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_OverwritePhysics(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2163: [propput, id(432), helpstring("property OverwritePhysics")] HRESULT OverwritePhysics([in] VARIANT_BOOL newVal);
+				// line 2165: [propput, id(432), helpstring("property OverwritePhysics")] HRESULT OverwritePhysics([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -13254,12 +13319,12 @@ STDMETHODIMP Flasher::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Name: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2179: [propget, id(DISPID_Name), helpstring("property Name")] HRESULT Name([out, retval] BSTR *pVal);
+				// line 2181: [propget, id(DISPID_Name), helpstring("property Name")] HRESULT Name([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Name(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2180: [propput, id(DISPID_Name), helpstring("property Name")] HRESULT Name([in] BSTR newVal);
+				// line 2182: [propput, id(DISPID_Name), helpstring("property Name")] HRESULT Name([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -13270,12 +13335,12 @@ STDMETHODIMP Flasher::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 5: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2181: [propget, id(5), helpstring("property X")] HRESULT X([out, retval] float *pVal);
+				// line 2183: [propget, id(5), helpstring("property X")] HRESULT X([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_X(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2182: [propput, id(5), helpstring("property X")] HRESULT X([in] float newVal);
+				// line 2184: [propput, id(5), helpstring("property X")] HRESULT X([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -13286,12 +13351,12 @@ STDMETHODIMP Flasher::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 6: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2183: [propget, id(6), helpstring("property Y")] HRESULT Y([out, retval] float *pVal);
+				// line 2185: [propget, id(6), helpstring("property Y")] HRESULT Y([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Y(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2184: [propput, id(6), helpstring("property Y")] HRESULT Y([in] float newVal);
+				// line 2186: [propput, id(6), helpstring("property Y")] HRESULT Y([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -13302,12 +13367,12 @@ STDMETHODIMP Flasher::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 8: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2185: [propget, id(8), helpstring("property ImageAlignment")] HRESULT ImageAlignment([out, retval] RampImageAlignment *pVal);
+				// line 2187: [propget, id(8), helpstring("property ImageAlignment")] HRESULT ImageAlignment([out, retval] RampImageAlignment *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_ImageAlignment((RampImageAlignment*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2186: [propput, id(8), helpstring("property ImageAlignment")] HRESULT ImageAlignment([in] RampImageAlignment newVal);
+				// line 2188: [propput, id(8), helpstring("property ImageAlignment")] HRESULT ImageAlignment([in] RampImageAlignment newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -13318,12 +13383,12 @@ STDMETHODIMP Flasher::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 378: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2187: [propget, id(378), helpstring("property Height")] HRESULT Height([out, retval] float *pVal);
+				// line 2189: [propget, id(378), helpstring("property Height")] HRESULT Height([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Height(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2188: [propput, id(378), helpstring("property Height")] HRESULT Height([in] float newVal);
+				// line 2190: [propput, id(378), helpstring("property Height")] HRESULT Height([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -13334,12 +13399,12 @@ STDMETHODIMP Flasher::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 1: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2189: [propget, id(1), helpstring("property RotZ")] HRESULT RotZ([out, retval] float *pVal);
+				// line 2191: [propget, id(1), helpstring("property RotZ")] HRESULT RotZ([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_RotZ(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2190: [propput, id(1), helpstring("property RotZ")] HRESULT RotZ([in] float newVal);
+				// line 2192: [propput, id(1), helpstring("property RotZ")] HRESULT RotZ([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -13350,12 +13415,12 @@ STDMETHODIMP Flasher::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 2: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2191: [propget, id(2), helpstring("property RotY")] HRESULT RotY([out, retval] float *pVal);
+				// line 2193: [propget, id(2), helpstring("property RotY")] HRESULT RotY([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_RotY(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2192: [propput, id(2), helpstring("property RotY")] HRESULT RotY([in] float newVal);
+				// line 2194: [propput, id(2), helpstring("property RotY")] HRESULT RotY([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -13366,12 +13431,12 @@ STDMETHODIMP Flasher::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 9: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2193: [propget, id(9), helpstring("property RotX")] HRESULT RotX([out, retval] float *pVal);
+				// line 2195: [propget, id(9), helpstring("property RotX")] HRESULT RotX([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_RotX(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2194: [propput, id(9), helpstring("property RotX")] HRESULT RotX([in] float newVal);
+				// line 2196: [propput, id(9), helpstring("property RotX")] HRESULT RotX([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -13382,12 +13447,12 @@ STDMETHODIMP Flasher::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 11: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2195: [propget, id(11), helpstring("property Color")] HRESULT Color([out, retval] OLE_COLOR *pVal);
+				// line 2197: [propget, id(11), helpstring("property Color")] HRESULT Color([out, retval] OLE_COLOR *pVal);
 				V_VT(&res) = VT_UI4;
 				hres = get_Color(&V_UI4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2196: [propput, id(11), helpstring("property Color")] HRESULT Color([in] OLE_COLOR newVal);
+				// line 2198: [propput, id(11), helpstring("property Color")] HRESULT Color([in] OLE_COLOR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_UI4);
@@ -13398,12 +13463,12 @@ STDMETHODIMP Flasher::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Image: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2197: [propget, id(DISPID_Image), helpstring("property ImageA")] HRESULT ImageA([out, retval] BSTR *pVal);
+				// line 2199: [propget, id(DISPID_Image), helpstring("property ImageA")] HRESULT ImageA([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_ImageA(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2198: [propput, id(DISPID_Image), helpstring("property ImageA")] HRESULT ImageA([in] BSTR newVal);
+				// line 2200: [propput, id(DISPID_Image), helpstring("property ImageA")] HRESULT ImageA([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -13414,12 +13479,12 @@ STDMETHODIMP Flasher::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Image2: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2199: [propget, id(DISPID_Image2), helpstring("property ImageB")] HRESULT ImageB([out, retval] BSTR *pVal);
+				// line 2201: [propget, id(DISPID_Image2), helpstring("property ImageB")] HRESULT ImageB([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_ImageB(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2200: [propput, id(DISPID_Image2), helpstring("property ImageB")] HRESULT ImageB([in] BSTR newVal);
+				// line 2202: [propput, id(DISPID_Image2), helpstring("property ImageB")] HRESULT ImageB([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -13430,12 +13495,12 @@ STDMETHODIMP Flasher::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 13: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2201: [propget, id(13), helpstring("property DisplayTexture")] HRESULT DisplayTexture([out, retval] VARIANT_BOOL *pVal);
+				// line 2203: [propget, id(13), helpstring("property DisplayTexture")] HRESULT DisplayTexture([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_DisplayTexture(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2202: [propput, id(13), helpstring("property DisplayTexture")] HRESULT DisplayTexture([in] VARIANT_BOOL newVal);
+				// line 2204: [propput, id(13), helpstring("property DisplayTexture")] HRESULT DisplayTexture([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -13446,12 +13511,12 @@ STDMETHODIMP Flasher::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 377: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2203: [propget, id(377), helpstring("property Opacity")] HRESULT Opacity([out, retval] long *pVal);
+				// line 2205: [propget, id(377), helpstring("property Opacity")] HRESULT Opacity([out, retval] long *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_Opacity((LONG*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2204: [propput, id(377), helpstring("property Opacity")] HRESULT Opacity([in] long newVal);
+				// line 2206: [propput, id(377), helpstring("property Opacity")] HRESULT Opacity([in] long newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -13462,12 +13527,12 @@ STDMETHODIMP Flasher::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 435: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2205: [propget, id(435), helpstring("property IntensityScale")] HRESULT IntensityScale([out, retval] float *pVal);
+				// line 2207: [propget, id(435), helpstring("property IntensityScale")] HRESULT IntensityScale([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_IntensityScale(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2206: [propput, id(435), helpstring("property IntensityScale")] HRESULT IntensityScale([in] float newVal);
+				// line 2208: [propput, id(435), helpstring("property IntensityScale")] HRESULT IntensityScale([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -13478,12 +13543,12 @@ STDMETHODIMP Flasher::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 433: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2207: [propget, id(433), helpstring("property ModulateVsAdd")] HRESULT ModulateVsAdd([out, retval] float *pVal);
+				// line 2209: [propget, id(433), helpstring("property ModulateVsAdd")] HRESULT ModulateVsAdd([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_ModulateVsAdd(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2208: [propput, id(433), helpstring("property ModulateVsAdd")] HRESULT ModulateVsAdd([in] float newVal);
+				// line 2210: [propput, id(433), helpstring("property ModulateVsAdd")] HRESULT ModulateVsAdd([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -13494,11 +13559,11 @@ STDMETHODIMP Flasher::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_UserValue: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2209: [propget, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([out, retval] VARIANT* pVal);
+				// line 2211: [propget, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([out, retval] VARIANT* pVal);
 				hres = get_UserValue(&res);
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2210: [propput, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([in] VARIANT* newVal);
+				// line 2212: [propput, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([in] VARIANT* newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantCopyInd(&var0, &pDispParams->rgvarg[--index]);
@@ -13509,12 +13574,12 @@ STDMETHODIMP Flasher::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 458: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2212: [propget, id(458), helpstring("property Visible")] HRESULT Visible([out, retval] VARIANT_BOOL *pVal);
+				// line 2214: [propget, id(458), helpstring("property Visible")] HRESULT Visible([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_Visible(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2213: [propput, id(458), helpstring("property Visible")] HRESULT Visible([in] VARIANT_BOOL newVal);
+				// line 2215: [propput, id(458), helpstring("property Visible")] HRESULT Visible([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -13525,12 +13590,12 @@ STDMETHODIMP Flasher::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 556: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2214: [propget, id(556), helpstring("property AddBlend")] HRESULT AddBlend([out, retval] VARIANT_BOOL *pVal);
+				// line 2216: [propget, id(556), helpstring("property AddBlend")] HRESULT AddBlend([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_AddBlend(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2215: [propput, id(556), helpstring("property AddBlend")] HRESULT AddBlend([in] VARIANT_BOOL newVal);
+				// line 2217: [propput, id(556), helpstring("property AddBlend")] HRESULT AddBlend([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -13541,12 +13606,12 @@ STDMETHODIMP Flasher::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 557: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2217: [propget, id(557), helpstring("property DMD")] HRESULT DMD([out, retval] VARIANT_BOOL *pVal);
+				// line 2219: [propget, id(557), helpstring("property DMD")] HRESULT DMD([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_DMD(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2218: [propput, id(557), helpstring("property DMD")] HRESULT DMD([in] VARIANT_BOOL newVal);
+				// line 2220: [propput, id(557), helpstring("property DMD")] HRESULT DMD([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -13557,7 +13622,7 @@ STDMETHODIMP Flasher::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 44: {
 			if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2219: [propput, id(44), helpstring("property DMDWidth")] HRESULT DMDWidth([in] int pVal);
+				// line 2221: [propput, id(44), helpstring("property DMDWidth")] HRESULT DMDWidth([in] int pVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -13568,7 +13633,7 @@ STDMETHODIMP Flasher::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 45: {
 			if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2220: [propput, id(45), helpstring("property DMDHeight")] HRESULT DMDHeight([in] int pVal);
+				// line 2222: [propput, id(45), helpstring("property DMDHeight")] HRESULT DMDHeight([in] int pVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -13579,7 +13644,7 @@ STDMETHODIMP Flasher::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 46: {
 			if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2221: [propput, id(46), helpstring("property DMDPixels")] HRESULT DMDPixels([in] VARIANT pVal);
+				// line 2223: [propput, id(46), helpstring("property DMDPixels")] HRESULT DMDPixels([in] VARIANT pVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantCopyInd(&var0, &pDispParams->rgvarg[--index]);
@@ -13590,7 +13655,7 @@ STDMETHODIMP Flasher::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 47: {
 			if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2222: [propput, id(47), helpstring("property DMDColoredPixels")] HRESULT DMDColoredPixels([in] VARIANT pVal);
+				// line 2224: [propput, id(47), helpstring("property DMDColoredPixels")] HRESULT DMDColoredPixels([in] VARIANT pVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantCopyInd(&var0, &pDispParams->rgvarg[--index]);
@@ -13601,7 +13666,7 @@ STDMETHODIMP Flasher::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 560: {
 			if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2224: [propput, id(560), helpstring("property VideoCapWidth")] HRESULT VideoCapWidth([in] long cWidth);
+				// line 2226: [propput, id(560), helpstring("property VideoCapWidth")] HRESULT VideoCapWidth([in] long cWidth);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -13612,7 +13677,7 @@ STDMETHODIMP Flasher::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 561: {
 			if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2225: [propput, id(561), helpstring("property VideoCapHeight")] HRESULT VideoCapHeight([in] long cHeight);
+				// line 2227: [propput, id(561), helpstring("property VideoCapHeight")] HRESULT VideoCapHeight([in] long cHeight);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -13623,7 +13688,7 @@ STDMETHODIMP Flasher::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 562: {
 			if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2226: [propput, id(562), helpstring("property VideoCapUpdate")] HRESULT VideoCapUpdate([in] BSTR cWinTitle);
+				// line 2228: [propput, id(562), helpstring("property VideoCapUpdate")] HRESULT VideoCapUpdate([in] BSTR cWinTitle);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -13634,12 +13699,12 @@ STDMETHODIMP Flasher::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 397: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2228: [propget, id(397), helpstring("property DepthBias")] HRESULT DepthBias([out, retval] float *pVal);
+				// line 2230: [propget, id(397), helpstring("property DepthBias")] HRESULT DepthBias([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_DepthBias(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2229: [propput, id(397), helpstring("property DepthBias")] HRESULT DepthBias([in] float newVal);
+				// line 2231: [propput, id(397), helpstring("property DepthBias")] HRESULT DepthBias([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -13650,12 +13715,12 @@ STDMETHODIMP Flasher::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 32996: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2230: [propget, id(32996), helpstring("property Filter")] HRESULT Filter([out, retval] BSTR *pVal);
+				// line 2232: [propget, id(32996), helpstring("property Filter")] HRESULT Filter([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Filter(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2231: [propput, id(32996), helpstring("property Filter")] HRESULT Filter([in] BSTR newVal);
+				// line 2233: [propput, id(32996), helpstring("property Filter")] HRESULT Filter([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -13666,12 +13731,12 @@ STDMETHODIMP Flasher::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case 379: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2232: [propget, id(379), helpstring("property Amount")] HRESULT Amount([out, retval] long *pVal);
+				// line 2234: [propget, id(379), helpstring("property Amount")] HRESULT Amount([out, retval] long *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_Amount((LONG*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2233: [propput, id(379), helpstring("property Amount")] HRESULT Amount([in] long newVal);
+				// line 2235: [propput, id(379), helpstring("property Amount")] HRESULT Amount([in] long newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -13682,12 +13747,12 @@ STDMETHODIMP Flasher::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Timer_Enabled: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2234: [propget, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([out, retval] VARIANT_BOOL *pVal);
+				// line 2236: [propget, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_TimerEnabled(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2235: [propput, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([in] VARIANT_BOOL newVal);
+				// line 2237: [propput, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -13698,12 +13763,12 @@ STDMETHODIMP Flasher::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WO
 		}
 		case DISPID_Timer_Interval: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2236: [propget, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([out, retval] long *pVal);
+				// line 2238: [propget, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([out, retval] long *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_TimerInterval((LONG*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2237: [propput, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([in] long newVal);
+				// line 2239: [propput, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([in] long newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -13802,12 +13867,12 @@ STDMETHODIMP Rubber::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case DISPID_Name: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2253: [propget, id(DISPID_Name), helpstring("property Name")] HRESULT Name([out, retval] BSTR *pVal);
+				// line 2255: [propget, id(DISPID_Name), helpstring("property Name")] HRESULT Name([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Name(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2254: [propput, id(DISPID_Name), helpstring("property Name")] HRESULT Name([in] BSTR newVal);
+				// line 2256: [propput, id(DISPID_Name), helpstring("property Name")] HRESULT Name([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -13818,12 +13883,12 @@ STDMETHODIMP Rubber::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 2: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2255: [propget, id(2), helpstring("property Height")] HRESULT Height([out, retval] float *pVal);
+				// line 2257: [propget, id(2), helpstring("property Height")] HRESULT Height([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Height(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2256: [propput, id(2), helpstring("property Height")] HRESULT Height([in] float newVal);
+				// line 2258: [propput, id(2), helpstring("property Height")] HRESULT Height([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -13834,12 +13899,12 @@ STDMETHODIMP Rubber::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 116: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2257: [propget, id(116), helpstring("property HitHeight")] HRESULT HitHeight([out, retval] float *pVal);
+				// line 2259: [propget, id(116), helpstring("property HitHeight")] HRESULT HitHeight([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_HitHeight(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2258: [propput, id(116), helpstring("property HitHeight")] HRESULT HitHeight([in] float newVal);
+				// line 2260: [propput, id(116), helpstring("property HitHeight")] HRESULT HitHeight([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -13850,12 +13915,12 @@ STDMETHODIMP Rubber::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 34: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2259: [propget, id(34), helpstring("property HitEvent")] HRESULT HasHitEvent([out, retval] VARIANT_BOOL *pVal);
+				// line 2261: [propget, id(34), helpstring("property HitEvent")] HRESULT HasHitEvent([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_HasHitEvent(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2260: [propput, id(34), helpstring("property HitEvent")] HRESULT HasHitEvent([in] VARIANT_BOOL newVal);
+				// line 2262: [propput, id(34), helpstring("property HitEvent")] HRESULT HasHitEvent([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -13866,12 +13931,12 @@ STDMETHODIMP Rubber::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 4: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2261: [propget, id(4), helpstring("property Thickness")] HRESULT Thickness([out, retval] int *pVal);
+				// line 2263: [propget, id(4), helpstring("property Thickness")] HRESULT Thickness([out, retval] int *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_Thickness((int*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2262: [propput, id(4), helpstring("property Thickness")] HRESULT Thickness([in] int newVal);
+				// line 2264: [propput, id(4), helpstring("property Thickness")] HRESULT Thickness([in] int newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -13882,12 +13947,12 @@ STDMETHODIMP Rubber::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 18: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2263: [propget, id(18), helpstring("property RotX")] HRESULT RotX([out, retval] float *pVal);
+				// line 2265: [propget, id(18), helpstring("property RotX")] HRESULT RotX([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_RotX(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2264: [propput, id(18), helpstring("property RotX")] HRESULT RotX([in] float newVal);
+				// line 2266: [propput, id(18), helpstring("property RotX")] HRESULT RotX([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -13898,12 +13963,12 @@ STDMETHODIMP Rubber::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 25: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2265: [propget, id(25), helpstring("property RotZ")] HRESULT RotZ([out, retval] float *pVal);
+				// line 2267: [propget, id(25), helpstring("property RotZ")] HRESULT RotZ([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_RotZ(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2266: [propput, id(25), helpstring("property RotZ")] HRESULT RotZ([in] float newVal);
+				// line 2268: [propput, id(25), helpstring("property RotZ")] HRESULT RotZ([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -13914,12 +13979,12 @@ STDMETHODIMP Rubber::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 24: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2267: [propget, id(24), helpstring("property RotY")] HRESULT RotY([out, retval] float *pVal);
+				// line 2269: [propget, id(24), helpstring("property RotY")] HRESULT RotY([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_RotY(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2268: [propput, id(24), helpstring("property RotY")] HRESULT RotY([in] float newVal);
+				// line 2270: [propput, id(24), helpstring("property RotY")] HRESULT RotY([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -13930,12 +13995,12 @@ STDMETHODIMP Rubber::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 340: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2269: [propget, id(340), helpstring("property Material")] HRESULT Material([out, retval] BSTR *pVal);
+				// line 2271: [propget, id(340), helpstring("property Material")] HRESULT Material([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Material(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2270: [propput, id(340), helpstring("property Material")] HRESULT Material([in] BSTR newVal);
+				// line 2272: [propput, id(340), helpstring("property Material")] HRESULT Material([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -13946,12 +14011,12 @@ STDMETHODIMP Rubber::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case DISPID_Image: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2271: [propget, id(DISPID_Image), helpstring("property Image")] HRESULT Image([out, retval] BSTR *pVal);
+				// line 2273: [propget, id(DISPID_Image), helpstring("property Image")] HRESULT Image([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Image(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2272: [propput, id(DISPID_Image), helpstring("property Image")] HRESULT Image([in] BSTR newVal);
+				// line 2274: [propput, id(DISPID_Image), helpstring("property Image")] HRESULT Image([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -13962,12 +14027,12 @@ STDMETHODIMP Rubber::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 110: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2273: [propget, id(110), helpstring("property Elasticity")] HRESULT Elasticity([out, retval] float *pVal);
+				// line 2275: [propget, id(110), helpstring("property Elasticity")] HRESULT Elasticity([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Elasticity(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2274: [propput, id(110), helpstring("property Elasticity")] HRESULT Elasticity([in] float newVal);
+				// line 2276: [propput, id(110), helpstring("property Elasticity")] HRESULT Elasticity([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -13978,12 +14043,12 @@ STDMETHODIMP Rubber::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 120: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2275: [propget, id(120), helpstring("property ElasticityFalloff")] HRESULT ElasticityFalloff([out, retval] float *pVal);
+				// line 2277: [propget, id(120), helpstring("property ElasticityFalloff")] HRESULT ElasticityFalloff([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_ElasticityFalloff(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2276: [propput, id(120), helpstring("property ElasticityFalloff")] HRESULT ElasticityFalloff([in] float newVal);
+				// line 2278: [propput, id(120), helpstring("property ElasticityFalloff")] HRESULT ElasticityFalloff([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -13994,12 +14059,12 @@ STDMETHODIMP Rubber::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 111: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2278: [propget, id(111), helpstring("property Collidable")] HRESULT Collidable([out, retval] VARIANT_BOOL *pVal);
+				// line 2280: [propget, id(111), helpstring("property Collidable")] HRESULT Collidable([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_Collidable(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2279: [propput, id(111), helpstring("property Collidable")] HRESULT Collidable([in] VARIANT_BOOL newVal);
+				// line 2281: [propput, id(111), helpstring("property Collidable")] HRESULT Collidable([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -14010,12 +14075,12 @@ STDMETHODIMP Rubber::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 458: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2281: [propget, id(458), helpstring("property Visible")] HRESULT Visible([out, retval] VARIANT_BOOL *pVal);
+				// line 2283: [propget, id(458), helpstring("property Visible")] HRESULT Visible([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_Visible(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2282: [propput, id(458), helpstring("property Visible")] HRESULT Visible([in] VARIANT_BOOL newVal);
+				// line 2284: [propput, id(458), helpstring("property Visible")] HRESULT Visible([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -14026,12 +14091,12 @@ STDMETHODIMP Rubber::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 114: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2284: [propget, id(114), helpstring("property Friction")] HRESULT Friction([out, retval] float *pVal);
+				// line 2286: [propget, id(114), helpstring("property Friction")] HRESULT Friction([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Friction(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2285: [propput, id(114), helpstring("property Friction")] HRESULT Friction([in] float newVal);
+				// line 2287: [propput, id(114), helpstring("property Friction")] HRESULT Friction([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -14042,12 +14107,12 @@ STDMETHODIMP Rubber::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 115: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2286: [propget, id(115), helpstring("property Scatter")] HRESULT Scatter([out, retval] float *pVal);
+				// line 2288: [propget, id(115), helpstring("property Scatter")] HRESULT Scatter([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Scatter(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2287: [propput, id(115), helpstring("property Scatter")] HRESULT Scatter([in] float newVal);
+				// line 2289: [propput, id(115), helpstring("property Scatter")] HRESULT Scatter([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -14058,12 +14123,12 @@ STDMETHODIMP Rubber::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 398: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2289: [propget, id(398), helpstring("property static rendering")] HRESULT EnableStaticRendering([out, retval] VARIANT_BOOL *pVal);
+				// line 2291: [propget, id(398), helpstring("property static rendering")] HRESULT EnableStaticRendering([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_EnableStaticRendering(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2290: [propput, id(398), helpstring("property static rendering")] HRESULT EnableStaticRendering([in] VARIANT_BOOL newVal);
+				// line 2292: [propput, id(398), helpstring("property static rendering")] HRESULT EnableStaticRendering([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -14074,12 +14139,12 @@ STDMETHODIMP Rubber::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 479: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2292: [propget, id(479), helpstring("property show in editor")] HRESULT EnableShowInEditor([out, retval] VARIANT_BOOL *pVal);
+				// line 2294: [propget, id(479), helpstring("property show in editor")] HRESULT EnableShowInEditor([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_EnableShowInEditor(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2293: [propput, id(479), helpstring("property show in editor")] HRESULT EnableShowInEditor([in] VARIANT_BOOL newVal);
+				// line 2295: [propput, id(479), helpstring("property show in editor")] HRESULT EnableShowInEditor([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -14090,12 +14155,12 @@ STDMETHODIMP Rubber::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 431: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2295: [propget, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([out, retval] VARIANT_BOOL *pVal);
+				// line 2297: [propget, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_ReflectionEnabled(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2296: [propput, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([in] VARIANT_BOOL newVal);
+				// line 2298: [propput, id(431), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -14106,12 +14171,12 @@ STDMETHODIMP Rubber::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case DISPID_Timer_Enabled: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2298: [propget, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([out, retval] VARIANT_BOOL *pVal);
+				// line 2300: [propget, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_TimerEnabled(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2299: [propput, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([in] VARIANT_BOOL newVal);
+				// line 2301: [propput, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -14122,12 +14187,12 @@ STDMETHODIMP Rubber::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case DISPID_Timer_Interval: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2300: [propget, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([out, retval] long *pVal);
+				// line 2302: [propget, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([out, retval] long *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_TimerInterval((LONG*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2301: [propput, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([in] long newVal);
+				// line 2303: [propput, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([in] long newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -14138,11 +14203,11 @@ STDMETHODIMP Rubber::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case DISPID_UserValue: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2302: [propget, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([out, retval] VARIANT* pVal);
+				// line 2304: [propget, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([out, retval] VARIANT* pVal);
 				hres = get_UserValue(&res);
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2303: [propput, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([in] VARIANT* newVal);
+				// line 2305: [propput, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([in] VARIANT* newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantCopyInd(&var0, &pDispParams->rgvarg[--index]);
@@ -14153,12 +14218,12 @@ STDMETHODIMP Rubber::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 734: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2305: [propget, id(734), helpstring("property PhysicsMaterial")] HRESULT PhysicsMaterial([out, retval] BSTR *pVal);
+				// line 2307: [propget, id(734), helpstring("property PhysicsMaterial")] HRESULT PhysicsMaterial([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_PhysicsMaterial(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2306: [propput, id(734), helpstring("property PhysicsMaterial")] HRESULT PhysicsMaterial([in] BSTR newVal);
+				// line 2308: [propput, id(734), helpstring("property PhysicsMaterial")] HRESULT PhysicsMaterial([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -14169,12 +14234,12 @@ STDMETHODIMP Rubber::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WOR
 		}
 		case 432: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2307: [propget, id(432), helpstring("property OverwritePhysics")] HRESULT OverwritePhysics([out, retval] VARIANT_BOOL *pVal);
+				// line 2309: [propget, id(432), helpstring("property OverwritePhysics")] HRESULT OverwritePhysics([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_OverwritePhysics(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2308: [propput, id(432), helpstring("property OverwritePhysics")] HRESULT OverwritePhysics([in] VARIANT_BOOL newVal);
+				// line 2310: [propput, id(432), helpstring("property OverwritePhysics")] HRESULT OverwritePhysics([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -14276,12 +14341,12 @@ STDMETHODIMP Ball::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 1: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2324: [propget, id(1), helpstring("property X")] HRESULT X([out, retval] float *pVal);
+				// line 2326: [propget, id(1), helpstring("property X")] HRESULT X([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_X(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2325: [propput, id(1), helpstring("property X")] HRESULT X([in] float newVal);
+				// line 2327: [propput, id(1), helpstring("property X")] HRESULT X([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -14292,12 +14357,12 @@ STDMETHODIMP Ball::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 2: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2326: [propget, id(2), helpstring("property Y")] HRESULT Y([out, retval] float *pVal);
+				// line 2328: [propget, id(2), helpstring("property Y")] HRESULT Y([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Y(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2327: [propput, id(2), helpstring("property Y")] HRESULT Y([in] float newVal);
+				// line 2329: [propput, id(2), helpstring("property Y")] HRESULT Y([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -14308,12 +14373,12 @@ STDMETHODIMP Ball::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 3: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2328: [propget, id(3), helpstring("property VelX")] HRESULT VelX([out, retval] float *pVal);
+				// line 2330: [propget, id(3), helpstring("property VelX")] HRESULT VelX([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_VelX(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2329: [propput, id(3), helpstring("property VelX")] HRESULT VelX([in] float newVal);
+				// line 2331: [propput, id(3), helpstring("property VelX")] HRESULT VelX([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -14324,12 +14389,12 @@ STDMETHODIMP Ball::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 4: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2330: [propget, id(4), helpstring("property VelY")] HRESULT VelY([out, retval] float *pVal);
+				// line 2332: [propget, id(4), helpstring("property VelY")] HRESULT VelY([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_VelY(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2331: [propput, id(4), helpstring("property VelY")] HRESULT VelY([in] float newVal);
+				// line 2333: [propput, id(4), helpstring("property VelY")] HRESULT VelY([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -14340,12 +14405,12 @@ STDMETHODIMP Ball::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 5: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2332: [propget, id(5), helpstring("property Z")] HRESULT Z([out, retval] float *pVal);
+				// line 2334: [propget, id(5), helpstring("property Z")] HRESULT Z([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Z(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2333: [propput, id(5), helpstring("property Z")] HRESULT Z([in] float newVal);
+				// line 2335: [propput, id(5), helpstring("property Z")] HRESULT Z([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -14356,12 +14421,12 @@ STDMETHODIMP Ball::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 6: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2334: [propget, id(6), helpstring("property VelZ")] HRESULT VelZ([out, retval] float *pVal);
+				// line 2336: [propget, id(6), helpstring("property VelZ")] HRESULT VelZ([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_VelZ(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2335: [propput, id(6), helpstring("property VelZ")] HRESULT VelZ([in] float newVal);
+				// line 2337: [propput, id(6), helpstring("property VelZ")] HRESULT VelZ([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -14372,12 +14437,12 @@ STDMETHODIMP Ball::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 14: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2336: [propget, id(14), helpstring("property AngVelX")] HRESULT AngVelX([out, retval] float *pVal);
+				// line 2338: [propget, id(14), helpstring("property AngVelX")] HRESULT AngVelX([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_AngVelX(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2337: [propput, id(14), helpstring("property AngVelX")] HRESULT AngVelX([in] float newVal);
+				// line 2339: [propput, id(14), helpstring("property AngVelX")] HRESULT AngVelX([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -14388,12 +14453,12 @@ STDMETHODIMP Ball::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 15: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2338: [propget, id(15), helpstring("property AngVelY")] HRESULT AngVelY([out, retval] float* pVal);
+				// line 2340: [propget, id(15), helpstring("property AngVelY")] HRESULT AngVelY([out, retval] float* pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_AngVelY(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2339: [propput, id(15), helpstring("property AngVelY")] HRESULT AngVelY([in] float newVal);
+				// line 2341: [propput, id(15), helpstring("property AngVelY")] HRESULT AngVelY([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -14404,12 +14469,12 @@ STDMETHODIMP Ball::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 16: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2340: [propget, id(16), helpstring("property AngVelZ")] HRESULT AngVelZ([out, retval] float* pVal);
+				// line 2342: [propget, id(16), helpstring("property AngVelZ")] HRESULT AngVelZ([out, retval] float* pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_AngVelZ(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2341: [propput, id(16), helpstring("property AngVelZ")] HRESULT AngVelZ([in] float newVal);
+				// line 2343: [propput, id(16), helpstring("property AngVelZ")] HRESULT AngVelZ([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -14420,12 +14485,12 @@ STDMETHODIMP Ball::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 17: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2342: [propget, id(17), helpstring("property AngMomX")] HRESULT AngMomX([out, retval] float* pVal);
+				// line 2344: [propget, id(17), helpstring("property AngMomX")] HRESULT AngMomX([out, retval] float* pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_AngMomX(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2343: [propput, id(17), helpstring("property AngMomX")] HRESULT AngMomX([in] float newVal);
+				// line 2345: [propput, id(17), helpstring("property AngMomX")] HRESULT AngMomX([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -14436,12 +14501,12 @@ STDMETHODIMP Ball::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 18: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2344: [propget, id(18), helpstring("property AngMomY")] HRESULT AngMomY([out, retval] float *pVal);
+				// line 2346: [propget, id(18), helpstring("property AngMomY")] HRESULT AngMomY([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_AngMomY(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2345: [propput, id(18), helpstring("property AngMomY")] HRESULT AngMomY([in] float newVal);
+				// line 2347: [propput, id(18), helpstring("property AngMomY")] HRESULT AngMomY([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -14452,12 +14517,12 @@ STDMETHODIMP Ball::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 19: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2346: [propget, id(19), helpstring("property AngMomZ")] HRESULT AngMomZ([out, retval] float *pVal);
+				// line 2348: [propget, id(19), helpstring("property AngMomZ")] HRESULT AngMomZ([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_AngMomZ(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2347: [propput, id(19), helpstring("property AngMomZ")] HRESULT AngMomZ([in] float newVal);
+				// line 2349: [propput, id(19), helpstring("property AngMomZ")] HRESULT AngMomZ([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -14468,12 +14533,12 @@ STDMETHODIMP Ball::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 7: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2349: [propget, id(7), helpstring("property Color")] HRESULT Color([out, retval] OLE_COLOR *pVal);
+				// line 2351: [propget, id(7), helpstring("property Color")] HRESULT Color([out, retval] OLE_COLOR *pVal);
 				V_VT(&res) = VT_UI4;
 				hres = get_Color(&V_UI4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2350: [propput, id(7), helpstring("property Color")] HRESULT Color([in] OLE_COLOR newVal);
+				// line 2352: [propput, id(7), helpstring("property Color")] HRESULT Color([in] OLE_COLOR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_UI4);
@@ -14484,12 +14549,12 @@ STDMETHODIMP Ball::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 8: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2351: [propget, id(8), helpstring("property Image")] HRESULT Image([out, retval] BSTR *pVal);
+				// line 2353: [propget, id(8), helpstring("property Image")] HRESULT Image([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Image(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2352: [propput, id(8), helpstring("property Image")] HRESULT Image([in] BSTR newVal);
+				// line 2354: [propput, id(8), helpstring("property Image")] HRESULT Image([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -14500,12 +14565,12 @@ STDMETHODIMP Ball::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 9: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2353: [propget, id(9), helpstring("property FrontDecal")] HRESULT FrontDecal([out, retval] BSTR *pVal);
+				// line 2355: [propget, id(9), helpstring("property FrontDecal")] HRESULT FrontDecal([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_FrontDecal(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2354: [propput, id(9), helpstring("property FrontDecal")] HRESULT FrontDecal([in] BSTR newVal);
+				// line 2356: [propput, id(9), helpstring("property FrontDecal")] HRESULT FrontDecal([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -14516,12 +14581,12 @@ STDMETHODIMP Ball::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 497: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2355: [propget, id(497), helpstring("property DecalMode")] HRESULT DecalMode([out, retval] VARIANT_BOOL *pVal);
+				// line 2357: [propget, id(497), helpstring("property DecalMode")] HRESULT DecalMode([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_DecalMode(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2356: [propput, id(497), helpstring("property DecalMode")] HRESULT DecalMode([in] VARIANT_BOOL newVal);
+				// line 2358: [propput, id(497), helpstring("property DecalMode")] HRESULT DecalMode([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -14532,11 +14597,11 @@ STDMETHODIMP Ball::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case DISPID_UserValue: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2357: [propget, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([out, retval] VARIANT* pVal);
+				// line 2359: [propget, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([out, retval] VARIANT* pVal);
 				hres = get_UserValue(&res);
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2358: [propput, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([in] VARIANT* newVal);
+				// line 2360: [propput, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([in] VARIANT* newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantCopyInd(&var0, &pDispParams->rgvarg[--index]);
@@ -14547,12 +14612,12 @@ STDMETHODIMP Ball::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 11: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2359: [propget, id(11), helpstring("property Mass")] HRESULT Mass([out, retval] float *pVal);
+				// line 2361: [propget, id(11), helpstring("property Mass")] HRESULT Mass([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Mass(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2360: [propput, id(11), helpstring("property Mass")] HRESULT Mass([in] float newVal);
+				// line 2362: [propput, id(11), helpstring("property Mass")] HRESULT Mass([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -14563,12 +14628,12 @@ STDMETHODIMP Ball::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 12: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2361: [propget, id(12), helpstring("property Radius")] HRESULT Radius([out, retval] float *pVal);
+				// line 2363: [propget, id(12), helpstring("property Radius")] HRESULT Radius([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Radius(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2362: [propput, id(12), helpstring("property Radius")] HRESULT Radius([in] float newVal);
+				// line 2364: [propput, id(12), helpstring("property Radius")] HRESULT Radius([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -14579,12 +14644,12 @@ STDMETHODIMP Ball::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 13: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2363: [propget, id(13), helpstring("property ID")] HRESULT ID([out, retval] int *pVal);
+				// line 2365: [propget, id(13), helpstring("property ID")] HRESULT ID([out, retval] int *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_ID((int*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2364: [propput, id(13), helpstring("property ID")] HRESULT ID([in] int newVal);
+				// line 2366: [propput, id(13), helpstring("property ID")] HRESULT ID([in] int newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -14595,12 +14660,12 @@ STDMETHODIMP Ball::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case DISPID_Name: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2365: [propget, id(DISPID_Name), helpstring("property Name")] HRESULT Name([out, retval] BSTR *pVal);
+				// line 2367: [propget, id(DISPID_Name), helpstring("property Name")] HRESULT Name([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Name(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2366: [propput, id(DISPID_Name), helpstring("property Name")] HRESULT Name([in] BSTR newVal);
+				// line 2368: [propput, id(DISPID_Name), helpstring("property Name")] HRESULT Name([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -14611,12 +14676,12 @@ STDMETHODIMP Ball::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 451: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2367: [propget, id(451), helpstring("property BulbIntensityScale")] HRESULT BulbIntensityScale([out, retval] float *pVal);
+				// line 2369: [propget, id(451), helpstring("property BulbIntensityScale")] HRESULT BulbIntensityScale([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_BulbIntensityScale(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2368: [propput, id(451), helpstring("property BulbIntensityScale")] HRESULT BulbIntensityScale([in] float newVal);
+				// line 2370: [propput, id(451), helpstring("property BulbIntensityScale")] HRESULT BulbIntensityScale([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -14627,12 +14692,12 @@ STDMETHODIMP Ball::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 484: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2369: [propget, id(484), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([out, retval] VARIANT_BOOL *pVal);
+				// line 2371: [propget, id(484), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_ReflectionEnabled(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2370: [propput, id(484), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([in] VARIANT_BOOL newVal);
+				// line 2372: [propput, id(484), helpstring("property ReflectionEnabled")] HRESULT ReflectionEnabled([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -14643,12 +14708,12 @@ STDMETHODIMP Ball::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 485: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2371: [propget, id(485), helpstring("property PlayfieldReflectionScale")] HRESULT PlayfieldReflectionScale([out, retval] float *pVal);
+				// line 2373: [propget, id(485), helpstring("property PlayfieldReflectionScale")] HRESULT PlayfieldReflectionScale([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_PlayfieldReflectionScale(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2372: [propput, id(485), helpstring("property PlayfieldReflectionScale")] HRESULT PlayfieldReflectionScale([in] float newVal);
+				// line 2374: [propput, id(485), helpstring("property PlayfieldReflectionScale")] HRESULT PlayfieldReflectionScale([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -14659,12 +14724,12 @@ STDMETHODIMP Ball::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 486: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2373: [propget, id(486), helpstring("property ForceReflection")] HRESULT ForceReflection([out, retval] VARIANT_BOOL *pVal);
+				// line 2375: [propget, id(486), helpstring("property ForceReflection")] HRESULT ForceReflection([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_ForceReflection(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2374: [propput, id(486), helpstring("property ForceReflection")] HRESULT ForceReflection([in] VARIANT_BOOL newVal);
+				// line 2376: [propput, id(486), helpstring("property ForceReflection")] HRESULT ForceReflection([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -14675,12 +14740,12 @@ STDMETHODIMP Ball::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 487: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2375: [propget, id(487), helpstring("property Visible")] HRESULT Visible([out, retval] VARIANT_BOOL *pVal);
+				// line 2377: [propget, id(487), helpstring("property Visible")] HRESULT Visible([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_Visible(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2376: [propput, id(487), helpstring("property Visible")] HRESULT Visible([in] VARIANT_BOOL newVal);
+				// line 2378: [propput, id(487), helpstring("property Visible")] HRESULT Visible([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -14691,7 +14756,7 @@ STDMETHODIMP Ball::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, WORD
 		}
 		case 100: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 2377: [id(100), helpstring("method DestroyBall")] HRESULT DestroyBall([out, retval] int *pVal);
+				// line 2379: [id(100), helpstring("method DestroyBall")] HRESULT DestroyBall([out, retval] int *pVal);
 				V_VT(&res) = VT_I4;
 				hres = DestroyBall((int*)&V_I4(&res));
 			}
@@ -14939,12 +15004,12 @@ STDMETHODIMP DispReel::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, W
 		}
 		case DISPID_DispReel_BackColor: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2438: [propget, id(DISPID_DispReel_BackColor), helpstring("property BackColor")] HRESULT BackColor([out, retval] OLE_COLOR *pVal);
+				// line 2440: [propget, id(DISPID_DispReel_BackColor), helpstring("property BackColor")] HRESULT BackColor([out, retval] OLE_COLOR *pVal);
 				V_VT(&res) = VT_UI4;
 				hres = get_BackColor(&V_UI4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2439: [propput, id(DISPID_DispReel_BackColor), helpstring("property BackColor")] HRESULT BackColor([in] OLE_COLOR newVal);
+				// line 2441: [propput, id(DISPID_DispReel_BackColor), helpstring("property BackColor")] HRESULT BackColor([in] OLE_COLOR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_UI4);
@@ -14955,12 +15020,12 @@ STDMETHODIMP DispReel::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, W
 		}
 		case DISPID_Image: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2440: [propget, id(DISPID_Image), helpstring("property Image")] HRESULT Image([out, retval] BSTR *pVal);
+				// line 2442: [propget, id(DISPID_Image), helpstring("property Image")] HRESULT Image([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Image(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2441: [propput, id(DISPID_Image), helpstring("property Image")] HRESULT Image([in] BSTR newVal);
+				// line 2443: [propput, id(DISPID_Image), helpstring("property Image")] HRESULT Image([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -14971,12 +15036,12 @@ STDMETHODIMP DispReel::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, W
 		}
 		case 11: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2442: [propget, id(11), helpstring("property Reels")] HRESULT Reels([out, retval] float *pVal);
+				// line 2444: [propget, id(11), helpstring("property Reels")] HRESULT Reels([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Reels(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2443: [propput, id(11), helpstring("property Reels")] HRESULT Reels([in] float newVal);
+				// line 2445: [propput, id(11), helpstring("property Reels")] HRESULT Reels([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -14987,12 +15052,12 @@ STDMETHODIMP DispReel::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, W
 		}
 		case 5: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2444: [propget, id(5), helpstring("property Width")] HRESULT Width([out, retval] float *pVal);
+				// line 2446: [propget, id(5), helpstring("property Width")] HRESULT Width([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Width(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2445: [propput, id(5), helpstring("property Width")] HRESULT Width([in] float newVal);
+				// line 2447: [propput, id(5), helpstring("property Width")] HRESULT Width([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -15003,12 +15068,12 @@ STDMETHODIMP DispReel::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, W
 		}
 		case 6: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2446: [propget, id(6), helpstring("property Height")] HRESULT Height([out, retval] float *pVal);
+				// line 2448: [propget, id(6), helpstring("property Height")] HRESULT Height([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Height(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2447: [propput, id(6), helpstring("property Height")] HRESULT Height([in] float newVal);
+				// line 2449: [propput, id(6), helpstring("property Height")] HRESULT Height([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -15019,12 +15084,12 @@ STDMETHODIMP DispReel::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, W
 		}
 		case 7: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2448: [propget, id(7), helpstring("property Spacing")] HRESULT Spacing([out, retval] float *pVal);
+				// line 2450: [propget, id(7), helpstring("property Spacing")] HRESULT Spacing([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Spacing(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2449: [propput, id(7), helpstring("property Spacing")] HRESULT Spacing([in] float newVal);
+				// line 2451: [propput, id(7), helpstring("property Spacing")] HRESULT Spacing([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -15035,12 +15100,12 @@ STDMETHODIMP DispReel::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, W
 		}
 		case 12: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2450: [propget, id(12), helpstring("property IsTransparent")] HRESULT IsTransparent([out, retval] VARIANT_BOOL *pVal);
+				// line 2452: [propget, id(12), helpstring("property IsTransparent")] HRESULT IsTransparent([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_IsTransparent(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2451: [propput, id(12), helpstring("property IsTransparent")] HRESULT IsTransparent([in] VARIANT_BOOL newVal);
+				// line 2453: [propput, id(12), helpstring("property IsTransparent")] HRESULT IsTransparent([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -15051,12 +15116,12 @@ STDMETHODIMP DispReel::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, W
 		}
 		case DISPID_Sound: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2452: [propget, id(DISPID_Sound), helpstring("property Sound")] HRESULT Sound([out, retval] BSTR *pVal);
+				// line 2454: [propget, id(DISPID_Sound), helpstring("property Sound")] HRESULT Sound([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Sound(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2453: [propput, id(DISPID_Sound), helpstring("property Sound")] HRESULT Sound([in] BSTR newVal);
+				// line 2455: [propput, id(DISPID_Sound), helpstring("property Sound")] HRESULT Sound([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -15067,12 +15132,12 @@ STDMETHODIMP DispReel::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, W
 		}
 		case 8: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2454: [propget, id(8), helpstring("property Steps")] HRESULT Steps([out, retval] float *pVal);
+				// line 2456: [propget, id(8), helpstring("property Steps")] HRESULT Steps([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Steps(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2455: [propput, id(8), helpstring("property Steps")] HRESULT Steps([in] float newVal);
+				// line 2457: [propput, id(8), helpstring("property Steps")] HRESULT Steps([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -15083,12 +15148,12 @@ STDMETHODIMP DispReel::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, W
 		}
 		case DISPID_Timer_Enabled: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2456: [propget, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([out, retval] VARIANT_BOOL *pVal);
+				// line 2458: [propget, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_TimerEnabled(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2457: [propput, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([in] VARIANT_BOOL newVal);
+				// line 2459: [propput, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -15099,12 +15164,12 @@ STDMETHODIMP DispReel::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, W
 		}
 		case DISPID_Timer_Interval: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2458: [propget, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([out, retval] long *pVal);
+				// line 2460: [propget, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([out, retval] long *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_TimerInterval((LONG*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2459: [propput, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([in] long newVal);
+				// line 2461: [propput, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([in] long newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -15115,12 +15180,12 @@ STDMETHODIMP DispReel::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, W
 		}
 		case 9: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2460: [propget, id(9), helpstring("property X")] HRESULT X([out, retval] float *pVal);
+				// line 2462: [propget, id(9), helpstring("property X")] HRESULT X([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_X(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2461: [propput, id(9), helpstring("property X")] HRESULT X([in] float newVal);
+				// line 2463: [propput, id(9), helpstring("property X")] HRESULT X([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -15131,12 +15196,12 @@ STDMETHODIMP DispReel::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, W
 		}
 		case 10: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2462: [propget, id(10), helpstring("property Y")] HRESULT Y([out, retval] float *pVal);
+				// line 2464: [propget, id(10), helpstring("property Y")] HRESULT Y([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Y(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2463: [propput, id(10), helpstring("property Y")] HRESULT Y([in] float newVal);
+				// line 2465: [propput, id(10), helpstring("property Y")] HRESULT Y([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -15147,12 +15212,12 @@ STDMETHODIMP DispReel::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, W
 		}
 		case 14: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2464: [propget, id(14), helpstring("property Range")] HRESULT Range([out, retval] float *pVal);
+				// line 2466: [propget, id(14), helpstring("property Range")] HRESULT Range([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_Range(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2465: [propput, id(14), helpstring("property Range")] HRESULT Range([in] float newVal);
+				// line 2467: [propput, id(14), helpstring("property Range")] HRESULT Range([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -15163,12 +15228,12 @@ STDMETHODIMP DispReel::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, W
 		}
 		case DISPID_Name: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2466: [propget, id(DISPID_Name), helpstring("property Name")] HRESULT Name([out, retval] BSTR *pVal);
+				// line 2468: [propget, id(DISPID_Name), helpstring("property Name")] HRESULT Name([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Name(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2467: [propput, id(DISPID_Name), helpstring("property Name")] HRESULT Name([in] BSTR newVal);
+				// line 2469: [propput, id(DISPID_Name), helpstring("property Name")] HRESULT Name([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -15179,12 +15244,12 @@ STDMETHODIMP DispReel::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, W
 		}
 		case 15: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2468: [propget, id(15), helpstring("property UpdateInterval")] HRESULT UpdateInterval([out, retval] long *pVal);
+				// line 2470: [propget, id(15), helpstring("property UpdateInterval")] HRESULT UpdateInterval([out, retval] long *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_UpdateInterval((LONG*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2469: [propput, id(15), helpstring("property UpdateInterval")] HRESULT UpdateInterval([in] long newVal);
+				// line 2471: [propput, id(15), helpstring("property UpdateInterval")] HRESULT UpdateInterval([in] long newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -15195,11 +15260,11 @@ STDMETHODIMP DispReel::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, W
 		}
 		case DISPID_UserValue: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2470: [propget, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([out, retval] VARIANT* pVal);
+				// line 2472: [propget, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([out, retval] VARIANT* pVal);
 				hres = get_UserValue(&res);
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2471: [propput, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([in] VARIANT* newVal);
+				// line 2473: [propput, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([in] VARIANT* newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantCopyInd(&var0, &pDispParams->rgvarg[--index]);
@@ -15210,12 +15275,12 @@ STDMETHODIMP DispReel::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, W
 		}
 		case 17: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2472: [propget, id(17), helpstring("property UseImageGrid")] HRESULT UseImageGrid([out, retval] VARIANT_BOOL *pVal);
+				// line 2474: [propget, id(17), helpstring("property UseImageGrid")] HRESULT UseImageGrid([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_UseImageGrid(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2473: [propput, id(17), helpstring("property UseImageGrid")] HRESULT UseImageGrid([in] VARIANT_BOOL newVal);
+				// line 2475: [propput, id(17), helpstring("property UseImageGrid")] HRESULT UseImageGrid([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -15226,12 +15291,12 @@ STDMETHODIMP DispReel::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, W
 		}
 		case 458: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2474: [propget, id(458), helpstring("property Visible")] HRESULT Visible([out, retval] VARIANT_BOOL *pVal);
+				// line 2476: [propget, id(458), helpstring("property Visible")] HRESULT Visible([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_Visible(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2475: [propput, id(458), helpstring("property Visible")] HRESULT Visible([in] VARIANT_BOOL newVal);
+				// line 2477: [propput, id(458), helpstring("property Visible")] HRESULT Visible([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -15242,12 +15307,12 @@ STDMETHODIMP DispReel::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, W
 		}
 		case 18: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2476: [propget, id(18), helpstring("property ImagesPerGridRow")] HRESULT ImagesPerGridRow([out, retval] long *pVal);
+				// line 2478: [propget, id(18), helpstring("property ImagesPerGridRow")] HRESULT ImagesPerGridRow([out, retval] long *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_ImagesPerGridRow((LONG*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2477: [propput, id(18), helpstring("property ImagesPerGridRow")] HRESULT ImagesPerGridRow([in] long newVal);
+				// line 2479: [propput, id(18), helpstring("property ImagesPerGridRow")] HRESULT ImagesPerGridRow([in] long newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -15258,7 +15323,7 @@ STDMETHODIMP DispReel::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, W
 		}
 		case 30: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 2479: [id(30), helpstring("method AddValue")] HRESULT AddValue([in] long Value);
+				// line 2481: [id(30), helpstring("method AddValue")] HRESULT AddValue([in] long Value);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -15269,14 +15334,14 @@ STDMETHODIMP DispReel::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, W
 		}
 		case 31: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 2480: [id(31), helpstring("method ResetToZero")] HRESULT ResetToZero();
+				// line 2482: [id(31), helpstring("method ResetToZero")] HRESULT ResetToZero();
 				hres = ResetToZero();
 			}
 			break;
 		}
 		case 32: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 2481: [id(32), helpstring("method SpinReel")] HRESULT SpinReel([in] long ReelNumber, [in] long PulseCount);
+				// line 2483: [id(32), helpstring("method SpinReel")] HRESULT SpinReel([in] long ReelNumber, [in] long PulseCount);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -15291,7 +15356,7 @@ STDMETHODIMP DispReel::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, W
 		}
 		case 33: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 2482: [id(33), helpstring("method SetValue")] HRESULT SetValue([in] long Value);
+				// line 2484: [id(33), helpstring("method SetValue")] HRESULT SetValue([in] long Value);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -15415,12 +15480,12 @@ STDMETHODIMP LightSeq::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, W
 		}
 		case DISPID_Name: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2506: [propget, id(DISPID_Name), helpstring("property Name")] HRESULT Name([out, retval] BSTR *pVal);
+				// line 2508: [propget, id(DISPID_Name), helpstring("property Name")] HRESULT Name([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Name(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2507: [propput, id(DISPID_Name), helpstring("property Name")] HRESULT Name([in] BSTR newVal);
+				// line 2509: [propput, id(DISPID_Name), helpstring("property Name")] HRESULT Name([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -15431,12 +15496,12 @@ STDMETHODIMP LightSeq::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, W
 		}
 		case DISPID_Collection: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2508: [propget, id(DISPID_Collection), helpstring("property Collection")] HRESULT Collection([out, retval] BSTR *pVal);
+				// line 2510: [propget, id(DISPID_Collection), helpstring("property Collection")] HRESULT Collection([out, retval] BSTR *pVal);
 				V_VT(&res) = VT_BSTR;
 				hres = get_Collection(&V_BSTR(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2509: [propput, id(DISPID_Collection), helpstring("property Collection")] HRESULT Collection([in] BSTR newVal);
+				// line 2511: [propput, id(DISPID_Collection), helpstring("property Collection")] HRESULT Collection([in] BSTR newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BSTR);
@@ -15447,12 +15512,12 @@ STDMETHODIMP LightSeq::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, W
 		}
 		case 9: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2510: [propget, id(9), helpstring("property CenterX")] HRESULT CenterX([out, retval] float *pVal);
+				// line 2512: [propget, id(9), helpstring("property CenterX")] HRESULT CenterX([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_CenterX(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2511: [propput, id(9), helpstring("property CenterX")] HRESULT CenterX([in] float newVal);
+				// line 2513: [propput, id(9), helpstring("property CenterX")] HRESULT CenterX([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -15463,12 +15528,12 @@ STDMETHODIMP LightSeq::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, W
 		}
 		case 10: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2512: [propget, id(10), helpstring("property CenterY")] HRESULT CenterY([out, retval] float *pVal);
+				// line 2514: [propget, id(10), helpstring("property CenterY")] HRESULT CenterY([out, retval] float *pVal);
 				V_VT(&res) = VT_R4;
 				hres = get_CenterY(&V_R4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2513: [propput, id(10), helpstring("property CenterY")] HRESULT CenterY([in] float newVal);
+				// line 2515: [propput, id(10), helpstring("property CenterY")] HRESULT CenterY([in] float newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_R4);
@@ -15479,12 +15544,12 @@ STDMETHODIMP LightSeq::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, W
 		}
 		case 15: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2514: [propget, id(15), helpstring("property UpdateInterval")] HRESULT UpdateInterval([out, retval] long *pVal);
+				// line 2516: [propget, id(15), helpstring("property UpdateInterval")] HRESULT UpdateInterval([out, retval] long *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_UpdateInterval((LONG*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2515: [propput, id(15), helpstring("property UpdateInterval")] HRESULT UpdateInterval([in] long newVal);
+				// line 2517: [propput, id(15), helpstring("property UpdateInterval")] HRESULT UpdateInterval([in] long newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -15495,12 +15560,12 @@ STDMETHODIMP LightSeq::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, W
 		}
 		case DISPID_Timer_Enabled: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2516: [propget, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([out, retval] VARIANT_BOOL *pVal);
+				// line 2518: [propget, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([out, retval] VARIANT_BOOL *pVal);
 				V_VT(&res) = VT_BOOL;
 				hres = get_TimerEnabled(&V_BOOL(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2517: [propput, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([in] VARIANT_BOOL newVal);
+				// line 2519: [propput, id(DISPID_Timer_Enabled), helpstring("property TimerEnabled")] HRESULT TimerEnabled([in] VARIANT_BOOL newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_BOOL);
@@ -15511,12 +15576,12 @@ STDMETHODIMP LightSeq::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, W
 		}
 		case DISPID_Timer_Interval: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2518: [propget, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([out, retval] long *pVal);
+				// line 2520: [propget, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([out, retval] long *pVal);
 				V_VT(&res) = VT_I4;
 				hres = get_TimerInterval((LONG*)&V_I4(&res));
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2519: [propput, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([in] long newVal);
+				// line 2521: [propput, id(DISPID_Timer_Interval), helpstring("property TimerInterval")] HRESULT TimerInterval([in] long newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -15527,11 +15592,11 @@ STDMETHODIMP LightSeq::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, W
 		}
 		case DISPID_UserValue: {
 			if (wFlags & DISPATCH_PROPERTYGET) {
-				// line 2520: [propget, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([out, retval] VARIANT* pVal);
+				// line 2522: [propget, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([out, retval] VARIANT* pVal);
 				hres = get_UserValue(&res);
 			}
 			else if (wFlags & DISPATCH_PROPERTYPUT) {
-				// line 2521: [propput, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([in] VARIANT* newVal);
+				// line 2523: [propput, id(DISPID_UserValue), helpstring("property User")] HRESULT UserValue([in] VARIANT* newVal);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantCopyInd(&var0, &pDispParams->rgvarg[--index]);
@@ -15542,7 +15607,7 @@ STDMETHODIMP LightSeq::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, W
 		}
 		case 32: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 2522: [id(32), helpstring("method Play")] HRESULT Play([in] SequencerState Animation, [defaultvalue(0)] long TailLength, [defaultvalue(1)] long Repeat, [defaultvalue(0)] long Pause);
+				// line 2524: [id(32), helpstring("method Play")] HRESULT Play([in] SequencerState Animation, [defaultvalue(0)] long TailLength, [defaultvalue(1)] long Repeat, [defaultvalue(0)] long Pause);
 				VARIANT var0;
 				V_VT(&var0) = VT_EMPTY;
 				VariantChangeType(&var0, &pDispParams->rgvarg[--index], 0, VT_I4);
@@ -15568,7 +15633,7 @@ STDMETHODIMP LightSeq::Invoke(DISPID dispIdMember, REFIID /*riid*/, LCID lcid, W
 		}
 		case 33: {
 			if (wFlags & DISPATCH_METHOD) {
-				// line 2523: [id(33), helpstring("method StopPlay")] HRESULT StopPlay();
+				// line 2525: [id(33), helpstring("method StopPlay")] HRESULT StopPlay();
 				hres = StopPlay();
 			}
 			break;